@@ -397,20 +397,22 @@ bool ReferenceTrajectory::propagate(const Plane &previousSurface, const Trajecto
 						tsosWithPath.first.globalPosition(),
 						tsosWithPath.first.globalMomentum(),
 						tsosWithPath.second);
-  const AlgebraicMatrix curvilinearJacobian = asHepMatrix<5,5>(aJacobian.jacobian());
+  const AlgebraicMatrix55& curvilinearJacobian = aJacobian.jacobian();
 
   // jacobian of the track parameters on the previous layer for local->global transformation
   const JacobianLocalToCurvilinear startTrafo(previousSurface, previousTsos.localParameters(), *magField);
-  const AlgebraicMatrix localToCurvilinear = asHepMatrix<5>(startTrafo.jacobian());
+  const AlgebraicMatrix55& localToCurvilinear = startTrafo.jacobian();
     
   // jacobian of the track parameters on the actual layer for global->local transformation
   const JacobianCurvilinearToLocal endTrafo(newSurface, tsosWithPath.first.localParameters(), *magField);
-  const AlgebraicMatrix curvilinearToLocal = asHepMatrix<5>(endTrafo.jacobian());
+  const AlgebraicMatrix55& curvilinearToLocal = endTrafo.jacobian();
   
   // compute derivative of reference-track parameters on the actual layer w.r.t. the ones on
-  // the previous layer (both in their local representation)
-  newCurvlinJacobian = curvilinearJacobian;
-  newJacobian = curvilinearToLocal * curvilinearJacobian * localToCurvilinear;
+  // the previous layer (both in their local representation), with fixed size matrices
+  const AlgebraicMatrix55 curvilinearToLocalJacobian = curvilinearToLocal * curvilinearJacobian;
+  const AlgebraicMatrix55 localJacobian = curvilinearToLocalJacobian * localToCurvilinear;
+  newCurvlinJacobian = asHepMatrix<5,5>(curvilinearJacobian);
+  newJacobian = asHepMatrix<5,5>(localJacobian);
   newTsos     = tsosWithPath.first;
 
   return true;
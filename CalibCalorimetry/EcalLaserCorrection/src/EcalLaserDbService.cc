@@ -1,4 +1,5 @@
 #include <iostream>
+#include <vector>
 
 #include "FWCore/Utilities/interface/typelookup.h"
 
@@ -13,6 +14,33 @@
 
 using namespace std;
 
+namespace {
+  // laser monitoring region of each crystal, by hashed index: it depends only on
+  // the crystal position, so it is computed once instead of for every correction
+  struct LaserRegions {
+    LaserRegions() : eb(EBDetId::kSizeForDenseIndexing), ee(EEDetId::kSizeForDenseIndexing) {
+      for (int i = 0; i < EBDetId::kSizeForDenseIndexing; ++i) {
+        EBDetId ebid = EBDetId::unhashIndex(i);
+        eb[i] = MEEBGeom::lmr(ebid.ieta(), ebid.iphi());
+      }
+      for (int i = 0; i < EEDetId::kSizeForDenseIndexing; ++i) {
+        EEDetId eeid = EEDetId::unhashIndex(i);
+        // SuperCrystal coordinates
+        MEEEGeom::SuperCrysCoord iX = (eeid.ix()-1)/5 + 1;
+        MEEEGeom::SuperCrysCoord iY = (eeid.iy()-1)/5 + 1;
+        ee[i] = MEEEGeom::lmr(iX, iY, eeid.zside());
+      }
+    }
+    std::vector<int> eb;
+    std::vector<int> ee;
+  };
+
+  const LaserRegions& laserRegions() {
+    static const LaserRegions regions;
+    return regions;
+  }
+}
+
 EcalLaserDbService::EcalLaserDbService () 
   : 
   mAlphas_ (nullptr),
@@ -74,15 +102,12 @@ float EcalLaserDbService::getLaserCorrection (DetId const & xid, edm::Timestamp
   if (xid.subdetId()==EcalBarrel) {
     EBDetId ebid( xid.rawId() );
     xind = ebid.hashedIndex();
-    iLM = MEEBGeom::lmr(ebid.ieta(), ebid.iphi());
+    iLM = laserRegions().eb[xind];
   } else if (xid.subdetId()==EcalEndcap) {
     isBarrel=false;
     EEDetId eeid( xid.rawId() );  
     xind = eeid.hashedIndex();
-    // SuperCrystal coordinates
-    MEEEGeom::SuperCrysCoord iX = (eeid.ix()-1)/5 + 1;
-    MEEEGeom::SuperCrysCoord iY = (eeid.iy()-1)/5 + 1;    
-    iLM = MEEEGeom::lmr(iX, iY, eeid.zside());    
+    iLM = laserRegions().ee[xind];
   } else {
     edm::LogError("EcalLaserDbService") << " DetId is NOT in ECAL Barrel or Endcap" << endl;
     return correctionFactor;
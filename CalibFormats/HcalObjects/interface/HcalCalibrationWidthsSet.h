@@ -19,6 +19,7 @@ public:
   const HcalCalibrationWidths& getCalibrationWidths(const DetId id) const;
   void setCalibrationWidths(const DetId id, const HcalCalibrationWidths& ca);
   void clear();
+  void reserve(size_t n) { mItems.reserve(n); }
   std::vector<DetId> getAllChannels() const;
 private:
   struct CalibWidthSetObject {
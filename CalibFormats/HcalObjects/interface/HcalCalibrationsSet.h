@@ -19,6 +19,7 @@ public:
   const HcalCalibrations& getCalibrations(const DetId id) const;
   void setCalibrations(const DetId id, const HcalCalibrations& ca);
   void clear();
+  void reserve(size_t n) { mItems.reserve(n); }
   std::vector<DetId> getAllChannels() const;
 private:
   struct CalibSetObject {
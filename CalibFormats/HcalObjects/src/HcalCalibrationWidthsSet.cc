@@ -18,13 +18,9 @@ const HcalCalibrationWidths& HcalCalibrationWidthsSet::getCalibrationWidths(cons
 
 void HcalCalibrationWidthsSet::setCalibrationWidths(DetId fId, const HcalCalibrationWidths& ca) {
   DetId fId2(hcalTransformedId(fId));
-  auto cell = mItems.find(fId2);
-  if (cell==mItems.end()) {
-    auto result = mItems.emplace(fId2,fId2);
-    result.first->second.calib=ca;
-    return;
-  }
-  cell->second.calib=ca;
+  // emplace finds the existing cell as well, hash the id only once
+  auto result = mItems.emplace(fId2,fId2);
+  result.first->second.calib=ca;
 }
 
 void HcalCalibrationWidthsSet::clear() {
@@ -82,6 +82,7 @@ void HcalDbService::buildCalibrations() const {
       auto ptr = new HcalCalibrationsSet();
 
       std::vector<DetId> ids=mPedestals->getAllChannels();
+      ptr->reserve(ids.size());
       bool pedsInADC = mPedestals->isADC();
       bool effPedsInADC = mEffectivePedestals->isADC();
       // loop!
@@ -113,6 +114,7 @@ void HcalDbService::buildCalibWidths() const {
       auto ptr = new HcalCalibrationWidthsSet();
 
       const std::vector<DetId>& ids=mPedestalWidths->getAllChannels();
+      ptr->reserve(ids.size());
       bool pedsInADC = mPedestalWidths->isADC();
       bool effPedsInADC = mEffectivePedestalWidths->isADC();
       // loop!
@@ -4,6 +4,7 @@
 #include "CommonTools/PileupAlgos/interface/PuppiAlgo.h"
 #include "CommonTools/PileupAlgos/interface/RecoObj.h"
 #include "CommonTools/PileupAlgos/interface/PuppiCandidate.h"
+#include "CommonTools/PileupAlgos/interface/PuppiNeighbourGrid.h"
 
 class PuppiContainer{
 public:
@@ -25,12 +26,16 @@ public:
     std::vector<PuppiCandidate> const & puppiParticles() const { return fPupParticles;}
 
 protected:
-    double  goodVar      (PuppiCandidate const &iPart,std::vector<PuppiCandidate> const &iParts, int iOpt,const double iRCone);
-    void    getRMSAvg    (int iOpt,std::vector<PuppiCandidate> const &iConstits,std::vector<PuppiCandidate> const &iParticles,std::vector<PuppiCandidate> const &iChargeParticles);
-    void    getRawAlphas    (int iOpt,std::vector<PuppiCandidate> const &iConstits,std::vector<PuppiCandidate> const &iParticles,std::vector<PuppiCandidate> const &iChargeParticles);
+    // the grids are those of iParticles and iChargeParticles, or null to loop over all the particles
+    double  goodVar      (PuppiCandidate const &iPart,std::vector<PuppiCandidate> const &iParts, int iOpt,const double iRCone,PuppiNeighbourGrid const *iGrid);
+    void    getRMSAvg    (int iOpt,std::vector<PuppiCandidate> const &iConstits,std::vector<PuppiCandidate> const &iParticles,std::vector<PuppiCandidate> const &iChargeParticles,
+                          PuppiNeighbourGrid const *iGrid,PuppiNeighbourGrid const *iChargeGrid);
+    void    getRawAlphas    (int iOpt,std::vector<PuppiCandidate> const &iConstits,std::vector<PuppiCandidate> const &iParticles,std::vector<PuppiCandidate> const &iChargeParticles,
+                          PuppiNeighbourGrid const *iGrid,PuppiNeighbourGrid const *iChargeGrid);
     double  getChi2FromdZ(double iDZ);
     int     getPuppiId   ( float iPt, float iEta);
     double  var_within_R (int iId, const std::vector<PuppiCandidate> & particles, const PuppiCandidate& centre, const double R);
+    double  var_within_R (int iId, const std::vector<PuppiCandidate> & particles, const PuppiNeighbourGrid& grid, const PuppiCandidate& centre, const double R);
     
     bool      fPuppiDiagnostics;
     std::vector<RecoObj>   fRecoParticles;
@@ -42,6 +47,12 @@ protected:
     std::vector<double>    fRawAlphas;
     std::vector<double>    fAlphaMed;
     std::vector<double>    fAlphaRMS;
+    // neighbour search in (rapidity, phi) tiles of the size of the largest cone
+    bool   fUseNeighbourGrid;
+    double fMaxConeSize;
+    PuppiNeighbourGrid fPFGrid;
+    PuppiNeighbourGrid fChargedPVGrid;
+    std::vector<unsigned int> fNeighbours;
 
     bool   fApplyCHS;
     bool   fInvert;
@@ -0,0 +1,95 @@
+#ifndef CommonTools_PileupAlgos_PuppiNeighbourGrid
+#define CommonTools_PileupAlgos_PuppiNeighbourGrid
+
+#include "CommonTools/PileupAlgos/interface/PuppiCandidate.h"
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+// Fixed grid of (rapidity, phi) tiles over a collection of particles, with the indices of the
+// particles of each tile stored contiguously, so that the neighbours of a particle within a cone
+// are only searched in the tiles overlapping the cone instead of in the whole collection.
+// The particles outside the rapidity range of the grid go to the border tiles.
+// The eta, phi and pt of the particles are also kept in flat arrays.
+class PuppiNeighbourGrid {
+  public:
+    static constexpr double minRap = -5.;
+    static constexpr double maxRap = 5.;
+
+    // the cones searched must not be larger than tileSize
+    void fill(const std::vector<PuppiCandidate> &particles, double tileSize) {
+      const unsigned int n = particles.size();
+      rapWidth_ = tileSize;
+      nRap_ = std::max(1, (int)std::ceil((maxRap - minRap)/tileSize));
+      nPhi_ = std::max(1, (int)std::floor(2*M_PI/tileSize));
+      phiWidth_ = 2*M_PI/nPhi_;
+
+      eta_.resize(n);
+      phi_.resize(n);
+      pt_.resize(n);
+      std::vector<int> bins(n);
+      offsets_.assign(nRap_*nPhi_ + 1, 0);
+      for (unsigned int i = 0; i < n; ++i) {
+        eta_[i] = particles[i].eta();
+        phi_[i] = particles[i].phi();
+        pt_[i]  = particles[i].pt();
+        bins[i] = rapBin(particles[i].rap())*nPhi_ + phiBin(particles[i].phi());
+        ++offsets_[bins[i] + 1];
+      }
+      for (unsigned int bin = 0; bin + 1 < offsets_.size(); ++bin) offsets_[bin+1] += offsets_[bin];
+      indices_.resize(n);
+      std::vector<unsigned int> next(offsets_.begin(), offsets_.end() - 1);
+      for (unsigned int i = 0; i < n; ++i) indices_[next[bins[i]]++] = i;
+    }
+
+    // indices, in increasing order, of the particles in the tiles overlapping the square of half
+    // side R around (rap, phi), with phi in [0, 2pi) as for fastjet
+    void candidates(double rap, double phi, double R, std::vector<unsigned int> &out) const {
+      out.clear();
+      if (indices_.empty()) return;
+      const int rapLow  = rapBin(rap - R);
+      const int rapHigh = rapBin(rap + R);
+      int phiLow  = (int)std::floor((phi - R)/phiWidth_);
+      int phiHigh = (int)std::floor((phi + R)/phiWidth_);
+      if (phiHigh - phiLow + 1 >= nPhi_) {
+        phiLow  = 0;
+        phiHigh = nPhi_ - 1;
+      }
+      for (int irap = rapLow; irap <= rapHigh; ++irap) {
+        for (int k = phiLow; k <= phiHigh; ++k) {
+          const unsigned int bin = irap*nPhi_ + (k%nPhi_ + nPhi_)%nPhi_;
+          out.insert(out.end(), indices_.begin() + offsets_[bin], indices_.begin() + offsets_[bin+1]);
+        }
+      }
+      // same order as a loop over the collection
+      std::sort(out.begin(), out.end());
+    }
+
+    const std::vector<double> &eta() const { return eta_; }
+    const std::vector<double> &phi() const { return phi_; }
+    const std::vector<double> &pt() const { return pt_; }
+
+  private:
+    int rapBin(double rap) const {
+      const int irap = (int)std::floor((rap - minRap)/rapWidth_);
+      return std::min(std::max(irap, 0), nRap_ - 1);
+    }
+    int phiBin(double phi) const {
+      const int iphi = (int)std::floor(phi/phiWidth_);
+      return std::min(std::max(iphi, 0), nPhi_ - 1);
+    }
+
+    int nRap_ = 1;
+    int nPhi_ = 1;
+    double rapWidth_ = 1;
+    double phiWidth_ = 2*M_PI;
+
+    std::vector<unsigned int> offsets_; // first particle of each tile, tiles ordered by rapidity then phi
+    std::vector<unsigned int> indices_;
+    std::vector<double> eta_;
+    std::vector<double> phi_;
+    std::vector<double> pt_;
+};
+
+#endif
@@ -16,12 +16,18 @@ PuppiContainer::PuppiContainer(const edm::ParameterSet &iConfig) {
     fUseExp          = iConfig.getParameter<bool>("useExp");
     fPuppiWeightCut  = iConfig.getParameter<double>("MinPuppiWeight");
     fPtMax           = iConfig.getParameter<double>("PtMaxNeutrals");
+    fUseNeighbourGrid = iConfig.existsAs<bool>("useNeighbourGrid") ? iConfig.getParameter<bool>("useNeighbourGrid") : false;
     std::vector<edm::ParameterSet> lAlgos = iConfig.getParameter<std::vector<edm::ParameterSet> >("algos");
     fNAlgos = lAlgos.size();
     for(unsigned int i0 = 0; i0 < lAlgos.size(); i0++) {
         PuppiAlgo pPuppiConfig(lAlgos[i0]);
         fPuppiAlgo.push_back(pPuppiConfig);
     }
+    fMaxConeSize = 0;
+    for(auto const& algo : fPuppiAlgo) {
+        for(int i1 = 0; i1 < algo.numAlgos(); i1++) fMaxConeSize = std::max(fMaxConeSize, algo.coneSize(i1));
+    }
+    if(fMaxConeSize <= 0) fUseNeighbourGrid = false;
 }
 
 void PuppiContainer::initialize(const std::vector<RecoObj> &iRecoObjects) {
@@ -72,7 +78,8 @@ void PuppiContainer::initialize(const std::vector<RecoObj> &iRecoObjects) {
 }
 PuppiContainer::~PuppiContainer(){}
 
-double PuppiContainer::goodVar(PuppiCandidate const &iPart,std::vector<PuppiCandidate> const &iParts, int iOpt,const double iRCone) {
+double PuppiContainer::goodVar(PuppiCandidate const &iPart,std::vector<PuppiCandidate> const &iParts, int iOpt,const double iRCone,PuppiNeighbourGrid const *iGrid) {
+    if(iGrid != nullptr) return var_within_R(iOpt,iParts,*iGrid,iPart,iRCone);
     return var_within_R(iOpt,iParts,iPart,iRCone);
 }
 
@@ -116,8 +123,39 @@ double PuppiContainer::var_within_R(int iId, const vector<PuppiCandidate> & part
     else if(iId == 5 && var != 0) var = log(var);
     return var;
 }
+//Same as above, with the particles close to the centre taken from the tiles of the grid
+double PuppiContainer::var_within_R(int iId, const vector<PuppiCandidate> & particles, const PuppiNeighbourGrid& grid, const PuppiCandidate& centre, const double R){
+    if(iId == -1) return 1;
+
+    grid.candidates(centre.rap(), centre.phi(), R, fNeighbours);
+    const double r2 = R*R;
+    const double etaC = centre.eta();
+    const double phiC = centre.phi();
+    auto const& eta = grid.eta();
+    auto const& phi = grid.phi();
+    auto const& pts = grid.pt();
+    double var = 0;
+    for(auto j : fNeighbours){
+        if ( !(particles[j].squared_distance(centre) < r2) ) continue;
+        auto dr2 = reco::deltaR2(eta[j], phi[j], etaC, phiC);
+        auto pt  = pts[j];
+        if(dr2  <  0.0001) continue;
+        if(iId == 0) var += (pt/dr2);
+        else if(iId == 1) var += pt;
+        else if(iId == 2) var += (1./dr2);
+        else if(iId == 3) var += (1./dr2);
+        else if(iId == 4) var += pt;
+        else if(iId == 5) var += (pt * pt/dr2);
+    }
+    if(iId == 1) var += centre.pt(); //Sum in a cone
+    else if(iId == 0 && var != 0) var = log(var);
+    else if(iId == 3 && var != 0) var = log(var);
+    else if(iId == 5 && var != 0) var = log(var);
+    return var;
+}
 //In fact takes the median not the average
-void PuppiContainer::getRMSAvg(int iOpt,std::vector<PuppiCandidate> const &iConstits,std::vector<PuppiCandidate> const &iParticles,std::vector<PuppiCandidate> const &iChargedParticles) {
+void PuppiContainer::getRMSAvg(int iOpt,std::vector<PuppiCandidate> const &iConstits,std::vector<PuppiCandidate> const &iParticles,std::vector<PuppiCandidate> const &iChargedParticles,
+                               PuppiNeighbourGrid const *iGrid,PuppiNeighbourGrid const *iChargedGrid) {
     for(unsigned int i0 = 0; i0 < iConstits.size(); i0++ ) {
         double pVal = -1;
         //Calculate the Puppi Algo to use
@@ -131,8 +169,8 @@ void PuppiContainer::getRMSAvg(int iOpt,std::vector<PuppiCandidate> const &iCons
         bool pCharged = fPuppiAlgo[pPupId].isCharged(iOpt);
         double pCone  = fPuppiAlgo[pPupId].coneSize (iOpt);
         //Compute the Puppi Metric
-        if(!pCharged) pVal = goodVar(iConstits[i0],iParticles       ,pAlgo,pCone);
-        if( pCharged) pVal = goodVar(iConstits[i0],iChargedParticles,pAlgo,pCone);
+        if(!pCharged) pVal = goodVar(iConstits[i0],iParticles       ,pAlgo,pCone,iGrid);
+        if( pCharged) pVal = goodVar(iConstits[i0],iChargedParticles,pAlgo,pCone,iChargedGrid);
         fVals.push_back(pVal);
         //if(std::isnan(pVal) || std::isinf(pVal)) cerr << "====> Value is Nan " << pVal << " == " << iConstits[i0].pt() << " -- " << iConstits[i0].eta() << endl;
         if( ! edm::isFinite(pVal)) {
@@ -147,8 +185,8 @@ void PuppiContainer::getRMSAvg(int iOpt,std::vector<PuppiCandidate> const &iCons
             pCharged = fPuppiAlgo[i1].isCharged(iOpt);
             pCone    = fPuppiAlgo[i1].coneSize (iOpt);
             double curVal = -1; 
-            if(!pCharged) curVal = goodVar(iConstits[i0],iParticles       ,pAlgo,pCone);
-            if( pCharged) curVal = goodVar(iConstits[i0],iChargedParticles,pAlgo,pCone);
+            if(!pCharged) curVal = goodVar(iConstits[i0],iParticles       ,pAlgo,pCone,iGrid);
+            if( pCharged) curVal = goodVar(iConstits[i0],iChargedParticles,pAlgo,pCone,iChargedGrid);
             //std::cout << "i1 = " << i1 << ", curVal = " << curVal << ", eta = " << iConstits[i0].eta() << ", pupID = " << pPupId << std::endl;
             fPuppiAlgo[i1].add(iConstits[i0],curVal,iOpt);
         }
@@ -157,7 +195,8 @@ void PuppiContainer::getRMSAvg(int iOpt,std::vector<PuppiCandidate> const &iCons
     for(int i0 = 0; i0 < fNAlgos; i0++) fPuppiAlgo[i0].computeMedRMS(iOpt,fPVFrac);
 }
 //In fact takes the median not the average
-void PuppiContainer::getRawAlphas(int iOpt,std::vector<PuppiCandidate> const &iConstits,std::vector<PuppiCandidate> const &iParticles,std::vector<PuppiCandidate> const &iChargedParticles) {
+void PuppiContainer::getRawAlphas(int iOpt,std::vector<PuppiCandidate> const &iConstits,std::vector<PuppiCandidate> const &iParticles,std::vector<PuppiCandidate> const &iChargedParticles,
+                                  PuppiNeighbourGrid const *iGrid,PuppiNeighbourGrid const *iChargedGrid) {
     for(int j0 = 0; j0 < fNAlgos; j0++){
         for(unsigned int i0 = 0; i0 < iConstits.size(); i0++ ) {
             double pVal = -1;
@@ -166,8 +205,8 @@ void PuppiContainer::getRawAlphas(int iOpt,std::vector<PuppiCandidate> const &iC
             bool pCharged = fPuppiAlgo[j0].isCharged(iOpt);
             double pCone  = fPuppiAlgo[j0].coneSize (iOpt);
             //Compute the Puppi Metric
-            if(!pCharged) pVal = goodVar(iConstits[i0],iParticles       ,pAlgo,pCone);
-            if( pCharged) pVal = goodVar(iConstits[i0],iChargedParticles,pAlgo,pCone);
+            if(!pCharged) pVal = goodVar(iConstits[i0],iParticles       ,pAlgo,pCone,iGrid);
+            if( pCharged) pVal = goodVar(iConstits[i0],iChargedParticles,pAlgo,pCone,iChargedGrid);
             fRawAlphas.push_back(pVal);
             if( ! edm::isFinite(pVal)) {
                 LogDebug( "NotFound" )  << "====> Value is Nan " << pVal << " == " << iConstits[i0].pt() << " -- " << iConstits[i0].eta() << endl;
@@ -216,10 +255,18 @@ std::vector<double> const & PuppiContainer::puppiWeights() {
     for(int i0 = 0; i0 < fNAlgos; i0++) lNMaxAlgo = std::max(fPuppiAlgo[i0].numAlgos(),lNMaxAlgo);
     //Run through all compute mean and RMS
     int lNParticles    = fRecoParticles.size();
+    PuppiNeighbourGrid const *lGrid = nullptr;
+    PuppiNeighbourGrid const *lChargedGrid = nullptr;
+    if(fUseNeighbourGrid) {
+        fPFGrid.fill(fPFParticles, fMaxConeSize);
+        fChargedPVGrid.fill(fChargedPV, fMaxConeSize);
+        lGrid = &fPFGrid;
+        lChargedGrid = &fChargedPVGrid;
+    }
     for(int i0 = 0; i0 < lNMaxAlgo; i0++) {
-        getRMSAvg(i0,fPFParticles,fPFParticles,fChargedPV);
+        getRMSAvg(i0,fPFParticles,fPFParticles,fChargedPV,lGrid,lChargedGrid);
     }
-    if (fPuppiDiagnostics) getRawAlphas(0,fPFParticles,fPFParticles,fChargedPV);
+    if (fPuppiDiagnostics) getRawAlphas(0,fPFParticles,fPFParticles,fChargedPV,lGrid,lChargedGrid);
 
     std::vector<double> pVals;
     for(int i0 = 0; i0 < lNParticles; i0++) {
@@ -44,6 +44,8 @@ MethodInvoker(const edm::MemberWithDict& member)
   , isFunction_(false)
 {
   setArgs();
+  // typeOf() looks the type up by name, do it once rather than at each invoke
+  retTypeFinal_ = member_.typeOf();
   //std::cout <<
   //  "Booking " <<
   //  methodName() <<
@@ -139,7 +141,7 @@ invoke(const edm::ObjectWithDict& o, edm::ObjectWithDict& retstore) const
     //  << " with " << args_.size() << " arguments"
     //  << std::endl;
     ret = member_.get(o);
-    retType = member_.typeOf();
+    retType = retTypeFinal_;
   }
   void* addr = ret.address();
   //std::cout << "Stored result of " <<  methodName() << " (type " <<
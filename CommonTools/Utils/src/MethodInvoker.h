@@ -36,7 +36,7 @@ private: // Private Data Members
   std::vector<void*> args_;
 
   bool isFunction_;
-  edm::TypeWithDict retTypeFinal_;
+  edm::TypeWithDict retTypeFinal_; // return type of the method, or type of the data member
 private: // Private Function Members
   void setArgs();
 public: // Public Function Members
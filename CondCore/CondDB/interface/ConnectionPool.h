@@ -37,6 +37,7 @@ namespace cond {
       void setAuthenticationPath( const std::string& p );
       void setAuthenticationSystem( int authSysCode );
       void setFrontierSecurity( const std::string& signature );
+      void setPayloadCachePath( const std::string& p );
       void setLogging( bool flag );   
       bool isLoggingEnabled() const;
       void setParameters( const edm::ParameterSet& connectionPset );
@@ -61,6 +62,8 @@ namespace cond {
       //The frontier security option is turned on for all sessions
       //usig this wrapper of the CORAL connection setup for configuring the server access
       std::string m_frontierSecurity = std::string( "" );
+      // directory of the local disk cache of the payload data, empty if none
+      std::string m_payloadCachePath = std::string( "" );
       // this one has to be moved!
       cond::CoralServiceManager* m_pluginManager = nullptr; 
       std::map<std::string,int> m_dbTypes;
@@ -29,7 +29,8 @@ namespace cond {
       
       void loadTag( const std::string& tag );
 
-      void loadTag( const std::string& tag, const boost::posix_time::ptime& snapshotTime );
+      // full: load the whole iov sequence of the tag at once, instead of the groups around the requested times
+      void loadTag( const std::string& tag, const boost::posix_time::ptime& snapshotTime, bool full=false );
       
       void reload();
       
@@ -67,6 +68,7 @@ namespace cond {
       Iov_t m_currentIov;
       Session m_session;
       std::vector<Iov_t> m_requests;
+      bool m_fullIov = false;
       
     };
     
@@ -54,6 +54,7 @@ namespace cond {
       setAuthenticationPath( connectionPset.getUntrackedParameter<std::string>( "authenticationPath", m_authPath ) );
       setAuthenticationSystem( connectionPset.getUntrackedParameter<int>( "authenticationSystem", m_authSys ) );
       setFrontierSecurity( connectionPset.getUntrackedParameter<std::string>( "security", m_frontierSecurity ) );
+      setPayloadCachePath( connectionPset.getUntrackedParameter<std::string>( "payloadCachePath", m_payloadCachePath ) );
       int messageLevel = connectionPset.getUntrackedParameter<int>( "messageLevel", 0 ); //0 corresponds to Error level, current default
       coral::MsgLevel level = m_messageLevel;
       switch (messageLevel) {
@@ -156,7 +157,9 @@ namespace cond {
                                            const std::string& transactionId, 
                                            bool writeCapable ){
       std::shared_ptr<coral::ISessionProxy> coralSession = createCoralSession( connectionString, transactionId, writeCapable );
-      return Session( std::make_shared<SessionImpl>( coralSession, connectionString ));
+      auto session = std::make_shared<SessionImpl>( coralSession, connectionString );
+      session->payloadCachePath = m_payloadCachePath;
+      return Session( session );
     }
 
     Session ConnectionPool::createSession( const std::string& connectionString, bool writeCapable ){
@@ -175,6 +178,10 @@ namespace cond {
     void ConnectionPool::setMessageVerbosity( coral::MsgLevel level ){
       m_messageLevel = level;
     }
+
+    void ConnectionPool::setPayloadCachePath( const std::string& p ){
+      m_payloadCachePath = p;
+    }
     
 
 
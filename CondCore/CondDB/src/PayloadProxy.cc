@@ -17,14 +17,15 @@ namespace cond {
     
     void BasePayloadProxy::loadTag( const std::string& tag ){
       m_session.transaction().start(true);
-      m_iovProxy = m_session.readIov( tag );
+      m_iovProxy = m_session.readIov( tag, m_fullIov );
       m_session.transaction().commit();
       invalidateCache();
     }
     
-    void BasePayloadProxy::loadTag( const std::string& tag, const boost::posix_time::ptime& snapshotTime ){
+    void BasePayloadProxy::loadTag( const std::string& tag, const boost::posix_time::ptime& snapshotTime, bool full ){
+      m_fullIov = full;
       m_session.transaction().start(true);
-      m_iovProxy = m_session.readIov( tag, snapshotTime );
+      m_iovProxy = m_session.readIov( tag, snapshotTime, full );
       m_session.transaction().commit();
       invalidateCache();
     }
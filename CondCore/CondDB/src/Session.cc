@@ -1,6 +1,67 @@
 #include "CondCore/CondDB/interface/Session.h"
 #include "SessionImpl.h"
 //
+#include <cstdint>
+#include <cstdio>
+#include <fstream>
+#include <vector>
+#include <unistd.h>
+
+namespace {
+
+  // The payloads are immutable and addressed by the hash of their content, so the jobs of a node can
+  // share a directory with a file per payload hash, holding the payload type, the payload and the
+  // streamer info, each preceded by its size. A file is written under a temporary name and renamed,
+  // so the readers only see complete files, and a file which can't be read is ignored.
+
+  bool readCachedBlock( std::istream& in, std::vector<char>& block ){
+    uint64_t size = 0;
+    if( !in.read( reinterpret_cast<char*>( &size ), sizeof( size ) ) ) return false;
+    block.resize( size );
+    return size == 0 || bool( in.read( block.data(), size ) );
+  }
+
+  void writeCachedBlock( std::ostream& out, const void* data, size_t size ){
+    uint64_t blockSize = size;
+    out.write( reinterpret_cast<const char*>( &blockSize ), sizeof( blockSize ) );
+    if( size ) out.write( static_cast<const char*>( data ), size );
+  }
+
+  bool readCachedPayload( const std::string& fileName,
+			  std::string& payloadType,
+			  cond::Binary& payloadData,
+			  cond::Binary& streamerInfoData ){
+    std::ifstream in( fileName, std::ios::binary );
+    if( !in ) return false;
+    std::vector<char> type, payload, streamerInfo;
+    if( !readCachedBlock( in, type ) || !readCachedBlock( in, payload ) || !readCachedBlock( in, streamerInfo ) ) return false;
+    if( in.peek() != std::char_traits<char>::eof() ) return false;
+    payloadType.assign( type.begin(), type.end() );
+    payloadData = cond::Binary( payload.data(), payload.size() );
+    streamerInfoData = cond::Binary( streamerInfo.data(), streamerInfo.size() );
+    return true;
+  }
+
+  void writeCachedPayload( const std::string& fileName,
+			   const std::string& payloadType,
+			   const cond::Binary& payloadData,
+			   const cond::Binary& streamerInfoData ){
+    const std::string tmpName = fileName + ".tmp" + std::to_string( ::getpid() );
+    bool written = false;
+    {
+      std::ofstream out( tmpName, std::ios::binary | std::ios::trunc );
+      if( out ){
+	writeCachedBlock( out, payloadType.data(), payloadType.size() );
+	writeCachedBlock( out, payloadData.data(), payloadData.size() );
+	writeCachedBlock( out, streamerInfoData.data(), streamerInfoData.size() );
+	out.close();
+	written = bool( out );
+      }
+    }
+    if( !written || std::rename( tmpName.c_str(), fileName.c_str() ) != 0 ) std::remove( tmpName.c_str() );
+  }
+
+}
 
 namespace cond {
 
@@ -203,8 +264,13 @@ namespace cond {
 				    std::string& payloadType, 
 				    cond::Binary& payloadData,
 				    cond::Binary& streamerInfoData ){
+      const std::string& cachePath = m_session->payloadCachePath;
+      const std::string cacheFile = cachePath.empty() ? std::string( "" ) : cachePath + "/" + payloadHash;
+      if( !cacheFile.empty() && readCachedPayload( cacheFile, payloadType, payloadData, streamerInfoData ) ) return true;
       m_session->openIovDb();
-      return m_session->iovSchema().payloadTable().select( payloadHash, payloadType, payloadData, streamerInfoData );
+      bool found = m_session->iovSchema().payloadTable().select( payloadHash, payloadType, payloadData, streamerInfoData );
+      if( found && !cacheFile.empty() ) writeCachedPayload( cacheFile, payloadType, payloadData, streamerInfoData );
+      return found;
     }
 
     RunInfoProxy Session::getRunInfo( cond::Time_t start, cond::Time_t end ){
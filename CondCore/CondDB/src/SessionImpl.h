@@ -70,6 +70,8 @@ namespace cond {
       std::unique_ptr<IIOVSchema> iovSchemaHandle; 
       std::unique_ptr<IGTSchema> gtSchemaHandle; 
       std::unique_ptr<IRunInfoSchema> runInfoSchemaHandle; 
+      // directory of the payload data cached on the local disk by hash, empty if none
+      std::string payloadCachePath;
     };
 
   }
@@ -76,8 +76,9 @@ namespace cond {
     DataProxyWrapperBase();
     explicit DataProxyWrapperBase(std::string const & il);
     // late initialize (to allow to load ALL library first)
+    // fullIov: load the whole iov sequence of the tag at once
     virtual void lateInit(cond::persistency::Session& session, const std::string & tag, const boost::posix_time::ptime& snapshotTime,
-			  std::string const & il, std::string const & cs)=0;
+			  std::string const & il, std::string const & cs, bool fullIov)=0;
 
     void addInfo(std::string const & il, std::string const & cs, std::string const & tag);
     
@@ -128,10 +129,10 @@ public:
 
   // late initialize (to allow to load ALL library first)
   void lateInit(cond::persistency::Session& session, const std::string & tag, const boost::posix_time::ptime& snapshotTime,
-			std::string const & il, std::string const & cs) override {
+			std::string const & il, std::string const & cs, bool fullIov) override {
     m_proxy.reset(new PayProxy(m_source.empty() ?  (const char *)nullptr : m_source.c_str() ) );
     m_proxy->setUp( session );
-    m_proxy->loadTag( tag, snapshotTime );
+    m_proxy->loadTag( tag, snapshotTime, fullIov );
     m_edmProxy.reset(new DataProxy(m_proxy));
     addInfo(il, cs, tag);
   }
@@ -94,6 +94,8 @@ namespace {
  *  RefreshEachRun: if true will refresh the IOV at each new run (or lumiSection)
  *  DumpStat: if true dump the statistics of all DataProxy (currently on cout)
  *  DBParameters: configuration set of the connection
+ *  LoadFullIOVSequence: if true load the whole iov sequence of each tag at the start, instead of querying
+ *                       the iovs around the requested times (useful for jobs crossing many per-lumi iovs)
  *  globaltag: The GlobalTag
  *  toGet: list of record label tag connection-string to add/overwrite the content of the global-tag
  */
@@ -138,6 +140,9 @@ CondDBESSource::CondDBESSource( const edm::ParameterSet& iConfig ) :
     if( !snapshotTimeString.empty() ) snapshotTime = boost::posix_time::time_from_string( snapshotTimeString );
   }
 
+  // iov loading
+  const bool loadFullIOVSequence = iConfig.getUntrackedParameter<bool>( "LoadFullIOVSequence", false );
+
   // connection configuration
   if( iConfig.exists("DBParameters") ) {
     edm::ParameterSet connectionPset = iConfig.getParameter<edm::ParameterSet>( "DBParameters" );
@@ -254,7 +259,7 @@ CondDBESSource::CondDBESSource( const edm::ParameterSet& iConfig ) :
     if(tagSnapshotTime == boost::posix_time::time_from_string(std::string(cond::time::MAX_TIMESTAMP) ) )
       tagSnapshotTime = boost::posix_time::ptime();
 
-    proxy->lateInit(nsess, tag, tagSnapshotTime, it->second.recordLabel(), connStr);
+    proxy->lateInit(nsess, tag, tagSnapshotTime, it->second.recordLabel(), connStr, loadFullIOVSequence);
   }
 
   // one loaded expose all other tags to the Proxy! 
@@ -19,6 +19,7 @@
 #include "CondFormats/Serialization/interface/Serializable.h"
 
 #include <vector>
+#include <algorithm>
 #include "GBRTree.h"
 #include <cmath>
 #include <cstdio>
@@ -37,6 +38,9 @@
        
        double GetResponse(const float* vector) const;
        double GetGradBoostClassifier(const float* vector) const;
+       //responses of n entries stored as x[ivar*stride+i], i.e. the values of one variable are contiguous
+       void GetResponses(const float* x, unsigned int stride, unsigned int n, double* response) const;
+       void GetGradBoostClassifiers(const float* x, unsigned int stride, unsigned int n, double* response) const;
        double GetAdaBoostClassifier(const float* vector) const { return GetResponse(vector); }
        
        //for backwards-compatibility
@@ -70,4 +74,27 @@ inline double GBRForest::GetGradBoostClassifier(const float* vector) const {
   return 2.0/(1.0+exp(-2.0*response))-1; //MVA output between -1 and 1
 }
 
+//_______________________________________________________________________
+inline void GBRForest::GetResponses(const float* x, unsigned int stride, unsigned int n, double* response) const {
+  // the entries are evaluated in blocks small enough for their inputs to stay in cache through all the trees
+  constexpr unsigned int kBlock = 64;
+  int index[kBlock];
+  for (unsigned int b=0; b<n; b+=kBlock) {
+    unsigned int nb = std::min(kBlock, n-b);
+    double* r = response+b;
+    for (unsigned int i=0; i<nb; ++i) r[i] = fInitialResponse;
+    for (std::vector<GBRTree>::const_iterator it=fTrees.begin(); it!=fTrees.end(); ++it) {
+      it->TerminalIndices(x+b, stride, nb, index);
+      auto const & responses = it->Responses();
+      for (unsigned int i=0; i<nb; ++i) r[i] += responses[index[i]];
+    }
+  }
+}
+
+//_______________________________________________________________________
+inline void GBRForest::GetGradBoostClassifiers(const float* x, unsigned int stride, unsigned int n, double* response) const {
+  GetResponses(x, stride, n, response);
+  for (unsigned int i=0; i<n; ++i) response[i] = 2.0/(1.0+exp(-2.0*response[i]))-1;
+}
+
 #endif
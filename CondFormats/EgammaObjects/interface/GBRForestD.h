@@ -19,6 +19,7 @@
 #include "CondFormats/Serialization/interface/Serializable.h"
 
 #include <vector>
+#include <algorithm>
 #include "GBRTreeD.h"
 #include <cmath>
 #include <cstdio>
@@ -33,6 +34,8 @@ class GBRForestD {
     virtual ~GBRForestD();
 
     double GetResponse(const float* vector) const;
+    //responses of n entries stored as x[ivar*stride+i], i.e. the values of one variable are contiguous
+    void GetResponses(const float* x, unsigned int stride, unsigned int n, double* response) const;
 
     double InitialResponse() const { return fInitialResponse; }
     void SetInitialResponse(double response) { fInitialResponse = response; }
@@ -57,6 +60,23 @@ inline double GBRForestD::GetResponse(const float* vector) const {
   return response;
 }
 
+//_______________________________________________________________________
+inline void GBRForestD::GetResponses(const float* x, unsigned int stride, unsigned int n, double* response) const {
+  // the entries are evaluated in blocks small enough for their inputs to stay in cache through all the trees
+  constexpr unsigned int kBlock = 64;
+  int index[kBlock];
+  for (unsigned int b=0; b<n; b+=kBlock) {
+    unsigned int nb = std::min(kBlock, n-b);
+    double* r = response+b;
+    for (unsigned int i=0; i<nb; ++i) r[i] = fInitialResponse;
+    for (std::vector<GBRTreeD>::const_iterator it=fTrees.begin(); it!=fTrees.end(); ++it) {
+      it->TerminalIndices(x+b, stride, nb, index);
+      auto const & responses = it->Responses();
+      for (unsigned int i=0; i<nb; ++i) r[i] += responses[index[i]];
+    }
+  }
+}
+
 //_______________________________________________________________________
 template<typename InputForestT> GBRForestD::GBRForestD(const InputForestT &forest) : 
  fInitialResponse(forest.InitialResponse()) {
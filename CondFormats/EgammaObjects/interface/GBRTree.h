@@ -43,6 +43,8 @@
        
        double GetResponse(const float* vector) const;
        int TerminalIndex(const float *vector) const;
+       //terminal indices of n entries stored as x[ivar*stride+i]
+       void TerminalIndices(const float *x, unsigned int stride, unsigned int n, int *index) const;
        
        std::vector<float> &Responses() { return fResponses; }       
        const std::vector<float> &Responses() const { return fResponses; }
@@ -93,4 +95,23 @@ inline int GBRTree::TerminalIndex(const float* vector) const {
   return -index;
 }
 
+//_______________________________________________________________________
+inline void GBRTree::TerminalIndices(const float* x, unsigned int stride, unsigned int n, int* index) const {
+  // all the entries go down the tree one level at a time
+  for (unsigned int i=0; i<n; ++i)
+    index[i] = x[fCutIndices[0]*stride+i] > fCutVals[0] ? fRightIndices[0] : fLeftIndices[0];
+  bool active = true;
+  while (active) {
+    active = false;
+    for (unsigned int i=0; i<n; ++i) {
+      int j = index[i];
+      if (j>0) {
+        index[i] = x[fCutIndices[j]*stride+i] > fCutVals[j] ? fRightIndices[j] : fLeftIndices[j];
+        active |= index[i]>0;
+      }
+    }
+  }
+  for (unsigned int i=0; i<n; ++i) index[i] = -index[i];
+}
+
 #endif
@@ -41,6 +41,8 @@ class GBRTreeD {
     //double GetResponse(const float* vector) const;
     double GetResponse(int termidx) const { return fResponses[termidx]; }
     int TerminalIndex(const float *vector) const;
+    //terminal indices of n entries stored as x[ivar*stride+i]
+    void TerminalIndices(const float *x, unsigned int stride, unsigned int n, int *index) const;
           
     std::vector<double> &Responses() { return fResponses; }       
     const std::vector<double> &Responses() const { return fResponses; }
@@ -96,6 +98,25 @@ inline int GBRTreeD::TerminalIndex(const float* vector) const {
   
 }
 
+//_______________________________________________________________________
+inline void GBRTreeD::TerminalIndices(const float* x, unsigned int stride, unsigned int n, int* index) const {
+  // all the entries go down the tree one level at a time
+  for (unsigned int i=0; i<n; ++i)
+    index[i] = x[fCutIndices[0]*stride+i] > fCutVals[0] ? fRightIndices[0] : fLeftIndices[0];
+  bool active = true;
+  while (active) {
+    active = false;
+    for (unsigned int i=0; i<n; ++i) {
+      int j = index[i];
+      if (j>0) {
+        index[i] = x[fCutIndices[j]*stride+i] > fCutVals[j] ? fRightIndices[j] : fLeftIndices[j];
+        active |= index[i]>0;
+      }
+    }
+  }
+  for (unsigned int i=0; i<n; ++i) index[i] = -index[i];
+}
+
 //_______________________________________________________________________
 template<typename InputTreeT> GBRTreeD::GBRTreeD(const InputTreeT &tree) :
  fCutIndices(tree.CutIndices()),
@@ -1138,15 +1138,11 @@ bool SiPixelTemplate::interpolate(int id, float cotalpha, float cotbeta, float l
          
          if(cotb >= thePixelTemp_[index_id_].enty[0].cotbeta) {
             
-            for (i=0; i<Ny-1; ++i) {
-               
-               if( thePixelTemp_[index_id_].enty[i].cotbeta <= cotb && cotb < thePixelTemp_[index_id_].enty[i+1].cotbeta) {
-                  
-                  ilow = i;
-                  yratio = (cotb - thePixelTemp_[index_id_].enty[i].cotbeta)/(thePixelTemp_[index_id_].enty[i+1].cotbeta - thePixelTemp_[index_id_].enty[i].cotbeta);
-                  break;
-               }
-            }
+            // the entries are ordered in cot(beta): bisect instead of scanning them
+            
+            const float* cotbetaY = thePixelTemp_[index_id_].cotbetaY;
+            ilow = std::upper_bound(cotbetaY, cotbetaY+Ny-1, cotb) - cotbetaY - 1;
+            yratio = (cotb - cotbetaY[ilow])/(cotbetaY[ilow+1] - cotbetaY[ilow]);
          } else { success_ = false; }
       }
       
@@ -1280,15 +1276,9 @@ bool SiPixelTemplate::interpolate(int id, float cotalpha, float cotbeta, float l
          
       } else if(abs_cotb_ >= thePixelTemp_[index_id_].entx[0][0].cotbeta) {
          
-         for (i=0; i<Nyx-1; ++i) {
-            
-            if( thePixelTemp_[index_id_].entx[i][0].cotbeta <= abs_cotb_ && abs_cotb_ < thePixelTemp_[index_id_].entx[i+1][0].cotbeta) {
-               
-               iylow = i;
-               yxratio = (abs_cotb_ - thePixelTemp_[index_id_].entx[i][0].cotbeta)/(thePixelTemp_[index_id_].entx[i+1][0].cotbeta - thePixelTemp_[index_id_].entx[i][0].cotbeta);
-               break;
-            }
-         }
+         const float* cotbetaX = thePixelTemp_[index_id_].cotbetaX;
+         iylow = std::upper_bound(cotbetaX, cotbetaX+Nyx-1, abs_cotb_) - cotbetaX - 1;
+         yxratio = (abs_cotb_ - cotbetaX[iylow])/(cotbetaX[iylow+1] - cotbetaX[iylow]);
       }
       
       iyhigh=iylow + 1;
@@ -1306,15 +1296,9 @@ bool SiPixelTemplate::interpolate(int id, float cotalpha, float cotbeta, float l
          
          if(cota >= thePixelTemp_[index_id_].entx[0][0].cotalpha) {
             
-            for (i=0; i<Nxx-1; ++i) {
-               
-               if( thePixelTemp_[index_id_].entx[0][i].cotalpha <= cota && cota < thePixelTemp_[index_id_].entx[0][i+1].cotalpha) {
-                  
-                  ilow = i;
-                  xxratio = (cota - thePixelTemp_[index_id_].entx[0][i].cotalpha)/(thePixelTemp_[index_id_].entx[0][i+1].cotalpha - thePixelTemp_[index_id_].entx[0][i].cotalpha);
-                  break;
-               }
-            }
+            const float* cotalphaX = thePixelTemp_[index_id_].cotalphaX;
+            ilow = std::upper_bound(cotalphaX, cotalphaX+Nxx-1, cota) - cotalphaX - 1;
+            xxratio = (cota - cotalphaX[ilow])/(cotalphaX[ilow+1] - cotalphaX[ilow]);
          } else { success_ = false; }
       }
       
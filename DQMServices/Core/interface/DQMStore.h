@@ -608,13 +608,12 @@ private:
 
   // ------------------------ private I/O helpers ------------------------------
   void saveMonitorElementToPB(MonitorElement const& me,
-                              dqmstorepb::ROOTFilePB& file);
+                              dqmstorepb::ROOTFilePB_Histo& histo);
   void saveMonitorElementRangeToPB(std::string const& dir,
                                    unsigned int run,
                                    MEMap::const_iterator begin,
                                    MEMap::const_iterator end,
-                                   dqmstorepb::ROOTFilePB& file,
-                                   unsigned int& counter);
+                                   std::vector<MonitorElement const*>& mes);
   void saveMonitorElementToROOT(MonitorElement const& me,
                                 TFile& file);
   void saveMonitorElementRangeToROOT(std::string const& dir,
@@ -18,6 +18,8 @@
 #include "TBufferFile.h"
 #include <boost/algorithm/string.hpp>
 #include <boost/range/iterator_range_core.hpp>
+#include <tbb/parallel_for.h>
+#include <tbb/task_arena.h>
 
 #include <iterator>
 #include <cerrno>
@@ -2552,7 +2554,7 @@ DQMStore::save(std::string const& filename,
 
 void
 DQMStore::saveMonitorElementToPB(MonitorElement const& me,
-                                 dqmstorepb::ROOTFilePB& file)
+                                 dqmstorepb::ROOTFilePB::Histo& histo)
 {
   // Save the object.
   TBufferFile buffer(TBufferFile::kWrite);
@@ -2562,7 +2564,6 @@ DQMStore::saveMonitorElementToPB(MonitorElement const& me,
   } else {
     buffer.WriteObject(me.object_);
   }
-  dqmstorepb::ROOTFilePB::Histo & histo = * file.add_histo();
   histo.set_full_pathname(*me.data_.dirname + '/' + me.data_.objname);
   histo.set_flags(me.data_.flags);
   histo.set_size(buffer.Length());
@@ -2583,8 +2584,7 @@ DQMStore::saveMonitorElementRangeToPB(std::string const& dir,
                                       unsigned int const run,
                                       MEMap::const_iterator const begin,
                                       MEMap::const_iterator const end,
-                                      dqmstorepb::ROOTFilePB& file,
-                                      unsigned int& counter)
+                                      std::vector<MonitorElement const*>& mes)
 {
   for (auto const& me: boost::make_iterator_range(begin, end)) {
     if (not isSubdirectory(dir, *me.data_.dirname))
@@ -2615,10 +2615,8 @@ DQMStore::saveMonitorElementRangeToPB(std::string const& dir,
       std::cout << "DQMStore::savePB: saving monitor element" << std::endl;
     }
 
-    saveMonitorElementToPB(me, file);
-
-    // Count saved histograms
-    ++counter;
+    // The monitor element is streamed later, together with all the others.
+    mes.push_back(&me);
   }
 }
 
@@ -2636,13 +2634,12 @@ DQMStore::savePB(std::string const& filename,
 
   std::lock_guard<std::mutex> guard(book_mutex_);
 
-  unsigned int nme = 0;
-
   if (verbose_) {
     std::cout << "DQMStore::savePB: Opening PBFile '" << filename << "'"
               << std::endl;
   }
   dqmstorepb::ROOTFilePB dqmstore_message;
+  std::vector<MonitorElement const*> mes;
 
   // Loop over the directory structure.
   for (auto const& dir: dirs_) {
@@ -2661,7 +2658,7 @@ DQMStore::savePB(std::string const& filename,
       MonitorElement proto(&dir, std::string(), run, 0);
       auto begin = data_.lower_bound(proto);
       auto end   = data_.end();
-      saveMonitorElementRangeToPB(dir, run, begin, end, dqmstore_message, nme);
+      saveMonitorElementRangeToPB(dir, run, begin, end, mes);
     } else {
       // Restrict the loop to the monitor elements for the current lumisection
       MonitorElement proto(&dir, std::string(), run, 0);
@@ -2669,7 +2666,7 @@ DQMStore::savePB(std::string const& filename,
       auto begin = data_.lower_bound(proto);
       proto.setLumi(lumi+1);
       auto end   = data_.lower_bound(proto);
-      saveMonitorElementRangeToPB(dir, run, begin, end, dqmstore_message, nme);
+      saveMonitorElementRangeToPB(dir, run, begin, end, mes);
     }
 
     // In LSbasedMode, loop also over the (run, 0) global histograms;
@@ -2679,10 +2676,23 @@ DQMStore::savePB(std::string const& filename,
     if (enableMultiThread_ and LSbasedMode_ and lumi != 0) {
       auto begin = data_.lower_bound(MonitorElement(&dir, std::string(), run, 0));
       auto end   = data_.lower_bound(MonitorElement(&dir, std::string(), run, 1));
-      saveMonitorElementRangeToPB(dir, run, begin, end, dqmstore_message, nme);
+      saveMonitorElementRangeToPB(dir, run, begin, end, mes);
     }
   }
 
+  // Streaming the objects is what takes most of the time, and each monitor element
+  // is independent of the others, so they are streamed in parallel.
+  unsigned int const nme = mes.size();
+  for (unsigned int i = 0; i < nme; ++i) {
+    dqmstore_message.add_histo();
+  }
+  // We hold book_mutex_, so we must not pick up unrelated tasks which could try to take it.
+  tbb::this_task_arena::isolate([&]() {
+    tbb::parallel_for(0U, nme, [&](unsigned int i) {
+      saveMonitorElementToPB(*mes[i], *dqmstore_message.mutable_histo(i));
+    });
+  });
+
   int filedescriptor = ::open(filename.c_str(),
                               O_WRONLY | O_CREAT | O_TRUNC,
                               S_IRUSR | S_IWUSR |
@@ -3017,13 +3027,38 @@ DQMStore::readFilePB(std::string const& filename,
   }
   ::close(filedescriptor);
 
-  for (int i = 0; i < dqmstore_message.histo_size(); ++i) {
-    std::string path;
-    std::string objname;
+  // Select the histograms to read before any of them is deserialized, which is the
+  // expensive part. Deserialization is then done in parallel, while the objects are
+  // added to the store one by one in the original order.
+  std::vector<dqmstorepb::ROOTFilePB::Histo const*> selected;
+  selected.reserve(dqmstore_message.histo_size());
+  for (auto const& h : dqmstore_message.histo()) {
+    if (not onlypath.empty()) {
+      size_t slash = h.full_pathname().rfind('/');
+      std::string const dir(h.full_pathname(), 0, (slash == std::string::npos ? 0 : slash));
+      if (not isSubdirectory(onlypath, dir))
+        continue;
+    }
+    selected.push_back(&h);
+  }
+  unsigned int const nselected = selected.size();
+  std::vector<std::string> paths(nselected);
+  std::vector<std::string> objnames(nselected);
+  std::vector<std::unique_ptr<TObject>> objects(nselected);
+  tbb::this_task_arena::isolate([&]() {
+    tbb::parallel_for(0U, nselected, [&](unsigned int i) {
+      TObject* obj = nullptr;
+      get_info(*selected[i], paths[i], objnames[i], &obj);
+      objects[i].reset(obj);
+    });
+  });
+
+  for (unsigned int i = 0; i < nselected; ++i) {
+    std::string const& path = paths[i];
+    std::string const& objname = objnames[i];
 
-    TObject* obj = nullptr;
-    dqmstorepb::ROOTFilePB::Histo const& h = dqmstore_message.histo(i);
-    get_info(h, path, objname, &obj);
+    TObject* obj = objects[i].get();
+    dqmstorepb::ROOTFilePB::Histo const& h = *selected[i];
 
     setCurrentFolder(path);
     if (obj) {
@@ -3044,8 +3079,6 @@ DQMStore::readFilePB(std::string const& filename,
         me = findObject(0, 0, 0, path, objname);
         me->data_.flags = h.flags();
       }
-
-      delete obj;
     }
   }
 
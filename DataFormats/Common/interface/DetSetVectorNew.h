@@ -348,7 +348,8 @@ namespace edmNew {
           m_v.m_filling = false;
           dstvdetails::throwCapacityExausted();
         }
-        std::move(m_lv.begin(), m_lv.end(), std::back_inserter(m_v.m_data));
+        // a single insert moves the whole DetSet with at most one reallocation
+        m_v.m_data.insert(m_v.m_data.end(), std::make_move_iterator(m_lv.begin()), std::make_move_iterator(m_lv.end()));
         m_item.size=m_lv.size();
         m_item.offset = offset;
 
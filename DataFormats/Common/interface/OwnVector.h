@@ -15,7 +15,9 @@
 
 #include <algorithm>
 #include <functional>
+#include <memory>
 #include <typeinfo>
+#include <utility>
 #include <vector>
 
 namespace edm {
@@ -135,6 +137,8 @@ namespace edm {
     template <typename D> void push_back(D* const& d);
     template <typename D> void push_back(std::unique_ptr<D> d);
     void push_back(T const& valueToCopy);
+    /// construct a D in place, instead of cloning a temporary as push_back(T const&) does
+    template <typename D = T, typename... Args> D& emplace_back(Args&&... args);
 
     template <typename D> void set(size_t i, D*& d);
     template <typename D> void set(size_t i, D* const & d);
@@ -317,6 +321,16 @@ namespace edm {
     data_.push_back(policy_type::clone(d));
   }
 
+  template<typename T, typename P>
+  template<typename D, typename... Args>
+  inline D& OwnVector<T, P>::emplace_back(Args&&... args) {
+    auto d = std::make_unique<D>(std::forward<Args>(args)...);
+    D& result = *d;
+    data_.push_back(d.get());
+    d.release();
+    return result;
+  }
+
   template<typename T, typename P>
   template<typename D>
   inline void OwnVector<T, P>::set(size_t i, D*& d) {
@@ -15,6 +15,7 @@
 #include <iterator>
 #include <algorithm>
 #include <cstddef>
+#include <utility>
 
 namespace edm {
   namespace helper {
@@ -44,9 +45,9 @@ namespace edm {
 	  size_t max = (j == end ? size : j->second);
 	  typename value_map::iterator f = values_.find(id);
 	  if(f!=values_.end()) throwAdd();
-	  value_vector & values = values_.insert(std::make_pair(id, value_vector())).first->second;
-	  while(i!=max)
-	    values.push_back( map.values_[i++] );
+	  values_.insert(std::make_pair(id, value_vector(map.values_.begin() + i, map.values_.begin() + max)));
+	  totSize_ += max - i;
+	  i = max;
 	} while(j != end);
       }
       template<typename H, typename I>
@@ -60,6 +61,17 @@ namespace edm {
 	std::copy(begin, end, values.begin());
         totSize_+=size;
       }
+      // move the values in, without copying them
+      template<typename H>
+      void insert(const H & h, value_vector && values) {
+	ProductID id = h.id();
+	size_t size = h->size();
+	if(values.size()!=size) throwFillSize();
+	typename value_map::const_iterator f = values_.find(id);
+	if(f != values_.end()) throwFillID(id);
+	values_.insert(make_pair(id, std::move(values)));
+        totSize_+=size;
+      }
       void fill() {
 	map_.clear();
 	offset off = 0;
@@ -69,10 +81,8 @@ namespace edm {
 	  ProductID id = i->first;
 	  map_.ids_.push_back(std::make_pair(id, off));
 	  const value_vector & values = i->second;
-	  for(typename value_vector::const_iterator j = values.begin(); j != values.end(); ++j) {
-	    map_.values_.push_back( *j );
-	    ++off;
-	  }
+	  map_.values_.insert(map_.values_.end(), values.begin(), values.end());
+	  off += values.size();
 	}
         map_.shrink_to_fit();
       }
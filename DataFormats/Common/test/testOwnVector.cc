@@ -137,5 +137,10 @@ void testOwnVector::checkAll() {
     if(data_b != 0) { // To silence Coverity
       CPPUNIT_ASSERT( data_b->f() == 3);
     }
+
+    test::ClassB & b = v.emplace_back<test::ClassB>(4);
+    CPPUNIT_ASSERT(v.size() == 4);
+    CPPUNIT_ASSERT(&v.back() == &b);
+    CPPUNIT_ASSERT(v.back().f() == 4);
   }
 }
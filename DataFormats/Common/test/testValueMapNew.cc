@@ -80,6 +80,14 @@ void testValueMapNew::checkAll() {
     filler2.fill();
     edm::ValueMap<int> values = values1 + values2;
     test(values);
+  } {
+    edm::ValueMap<int> values;
+    edm::ValueMap<int>::Filler filler(values);
+    std::vector<int> m1(w1), m2(w2);
+    filler.insert(handleK2, std::move(m2));
+    filler.insert(handleK1, std::move(m1));
+    filler.fill();
+    test(values);
   }
 }
 
@@ -50,6 +50,10 @@ class FEDRawData {
   /// the size is a multiple of the size of a FED word (8 bytes)
   void resize(size_t newsize);
 
+  /// Replace the content with a copy of the size bytes starting at data.
+  /// It is required that the size is a multiple of the size of a FED word (8 bytes)
+  void assign(const unsigned char * data, size_t size);
+
  private:
 
 
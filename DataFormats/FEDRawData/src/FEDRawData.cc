@@ -36,3 +36,9 @@ void FEDRawData::resize(size_t newsize) {
 
   if (newsize%8!=0) throw cms::Exception("DataCorrupt") << "FEDRawData::resize: " << newsize << " is not a multiple of 8 bytes." << endl;
 }
+
+void FEDRawData::assign(const unsigned char * data, size_t size) {
+  if (size%8!=0) throw cms::Exception("DataCorrupt") << "FEDRawData::assign: " << size << " is not a multiple of 8 bytes." << endl;
+
+  data_.assign(data, data+size);
+}
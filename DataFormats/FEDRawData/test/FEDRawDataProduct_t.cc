@@ -9,12 +9,14 @@
 #include <cppunit/extensions/HelperMacros.h>
 #include <DataFormats/FEDRawData/interface/FEDRawData.h>
 #include <DataFormats/FEDRawData/interface/FEDRawDataCollection.h>
+#include <FWCore/Utilities/interface/Exception.h>
 
 class testFEDRawDataProduct: public CppUnit::TestFixture {
 
   CPPUNIT_TEST_SUITE(testFEDRawDataProduct);
 
   CPPUNIT_TEST(testInsertAndReadBack);
+  CPPUNIT_TEST(testAssign);
  
   CPPUNIT_TEST_SUITE_END();
 
@@ -24,6 +26,7 @@ public:
   void setUp(){}
   void tearDown(){}  
   void testInsertAndReadBack();
+  void testAssign();
 }; 
 
 ///registration of the test so that the runner can find it
@@ -54,4 +57,20 @@ void testFEDRawDataProduct::testInsertAndReadBack(){
 
 }
 
+void testFEDRawDataProduct::testAssign(){
 
+  unsigned char buffer[16] = {'a','b','c','d','e','f','g','h','i','j','k','l','m','n','o','p'};
+
+  FEDRawDataCollection fp;
+  fp.FEDData(12).assign(buffer, 16);
+
+  CPPUNIT_ASSERT(fp.FEDData(12).size()==16);
+  CPPUNIT_ASSERT(fp.FEDData(12).data()[0]=='a');
+  CPPUNIT_ASSERT(fp.FEDData(12).data()[15]=='p');
+
+  fp.FEDData(12).assign(buffer+8, 8);
+  CPPUNIT_ASSERT(fp.FEDData(12).size()==8);
+  CPPUNIT_ASSERT(fp.FEDData(12).data()[0]=='i');
+
+  CPPUNIT_ASSERT_THROW(fp.FEDData(12).assign(buffer, 12), cms::Exception);
+}
@@ -11,6 +11,7 @@
 //
 
 // system include files
+#include <algorithm>
 
 // user include files
 #include "DataFormats/FWLite/interface/ChainEvent.h"
@@ -120,14 +121,10 @@ ChainEvent::to(Long64_t iIndex)
 
    Long64_t offsetIndex = eventIndex_;
 
-   // we're going backwards, so start from the beginning
-   if (iIndex < accumulatedSize_[offsetIndex]) {
-      offsetIndex = 0;
-   }
-
-   // is it past the end of this file?
-   while (iIndex >= accumulatedSize_[offsetIndex+1]) {
-      ++offsetIndex;
+   // not in this file: find the last file starting at or before iIndex
+   if (iIndex < accumulatedSize_[offsetIndex] || iIndex >= accumulatedSize_[offsetIndex+1]) {
+      auto itFile = std::upper_bound(accumulatedSize_.begin(), accumulatedSize_.end(), iIndex);
+      offsetIndex = std::max<Long64_t>(itFile - accumulatedSize_.begin() - 1, 0);
    }
 
    if(offsetIndex != eventIndex_) {
@@ -130,6 +130,8 @@ class FlatTable {
      typename std::vector<T>::const_iterator beginData(unsigned int column) const {
          const Column & col = columns_[column];
          check_type<T>(col.type); // throws if type is wrong
+         // the storage of a column type can be left empty if it was not read from the file (see PoolSource 'subBranchesNotToRead')
+         if (col.firstIndex + size_ > bigVector<T>().size()) throw cms::Exception("LogicError", "The data of column "+col.name+" was not read");
          return bigVector<T>().begin() + col.firstIndex;
      }
      template<typename T>
@@ -680,6 +680,11 @@ namespace pat {
     /// set time measurement
     void setTime(float aTime, float aTimeError=0) { setDTimeAssociatedPV(aTime - vertexRef()->t(), aTimeError); }
 
+    /// fill pt, eta, phi and mass, arrays of cands.size() elements, with the kinematics of the candidates,
+    /// decoding the packed values of those not yet unpacked without allocating their four-momenta
+    /// the values are those of pt(), eta(), phi() and mass(), rounded to float
+    static void unpackKinematics(const std::vector<PackedCandidate> & cands, float * pt, float * eta, float * phi, float * mass) ;
+
   private:
     void unpackCovarianceElement(reco::TrackBase::CovarianceMatrix & m, uint16_t packed, int i,int j) const {
       m(i,j)= covarianceParameterization().unpack(packed,covarianceSchema_,i,j,pt(),eta(),numberOfHits(), numberOfPixelHits());
@@ -5,6 +5,8 @@
 #include "DataFormats/Math/interface/deltaPhi.h"
 
 #include "DataFormats/Math/interface/liblogintpack.h"
+
+#include <cmath>
 using namespace logintpack;
 
 CovarianceParameterization pat::PackedCandidate::covarianceParameterization_;
@@ -45,11 +47,17 @@ void pat::PackedCandidate::packVtx(bool unpackAfterwards) {
     }
 }
 
-void pat::PackedCandidate::unpack() const {
-    float pt = MiniFloatConverter::float16to32(packedPt_);
+namespace {
+  double unpackPhi(float pt, uint16_t packedPhi) {
     double shift = (pt<1. ? 0.1*pt : 0.1/pt); // shift particle phi to break degeneracies in angular separations
     double sign = ( ( int(pt*10) % 2 == 0 ) ? 1 : -1 ); // introduce a pseudo-random sign of the shift
-    double phi = int16_t(packedPhi_)*3.2f/std::numeric_limits<int16_t>::max() + sign*shift*3.2/std::numeric_limits<int16_t>::max();
+    return int16_t(packedPhi)*3.2f/std::numeric_limits<int16_t>::max() + sign*shift*3.2/std::numeric_limits<int16_t>::max();
+  }
+}
+
+void pat::PackedCandidate::unpack() const {
+    float pt = MiniFloatConverter::float16to32(packedPt_);
+    double phi = unpackPhi(pt, packedPhi_);
     auto p4 = std::make_unique<PolarLorentzVector>(pt,
                              int16_t(packedEta_)*6.0f/std::numeric_limits<int16_t>::max(),
                              phi,
@@ -68,6 +76,35 @@ void pat::PackedCandidate::unpack() const {
     }
 }
 
+void pat::PackedCandidate::unpackKinematics(const std::vector<PackedCandidate> & cands, float * pt, float * eta, float * phi, float * mass) {
+    for (size_t i = 0, n = cands.size(); i < n; ++i) {
+      const PackedCandidate & cand = cands[i];
+      // the cached four-momentum differs from the packed values until the candidate is packed again
+      if (cand.p4c_) {
+        const PolarLorentzVector & p4 = *cand.p4_;
+        pt[i] = p4.Pt();
+        eta[i] = p4.Eta();
+        phi[i] = p4.Phi();
+        mass[i] = p4.M();
+        continue;
+      }
+      const float ipt = MiniFloatConverter::float16to32(cand.packedPt_);
+      const float ieta = int16_t(cand.packedEta_)*6.0f/std::numeric_limits<int16_t>::max();
+      double iphi = unpackPhi(ipt, cand.packedPhi_);
+      double im = MiniFloatConverter::float16to32(cand.packedM_);
+      // same corrections as the PolarLorentzVector constructor
+      if (iphi <= -M_PI || iphi > M_PI) iphi -= std::floor(iphi/(2*M_PI) + .5)*2*M_PI;
+      if (im < 0) {
+        const double p = ipt*std::cosh(double(ieta));
+        if (p*p - im*im < 0) im = -p;
+      }
+      pt[i] = ipt;
+      eta[i] = ieta;
+      phi[i] = iphi;
+      mass[i] = im;
+    }
+}
+
 void pat::PackedCandidate::packCovariance(const reco::TrackBase::CovarianceMatrix &m, bool unpackAfterwards){
     packedCovariance_.dptdpt = packCovarianceElement(m,0,0);
     packedCovariance_.detadeta = packCovarianceElement(m,1,1);
@@ -13,6 +13,7 @@ class testPackedCandidate : public CppUnit::TestFixture {
   CPPUNIT_TEST(testCopyConstructor);
   CPPUNIT_TEST(testPackUnpack);
   CPPUNIT_TEST(testSimulateReadFromRoot);
+  CPPUNIT_TEST(testUnpackKinematics);
   CPPUNIT_TEST(testPackUnpackTime);
   CPPUNIT_TEST(testQualityFlags);
 
@@ -25,6 +26,7 @@ public:
   void testCopyConstructor();
   void testPackUnpack();
   void testSimulateReadFromRoot();
+  void testUnpackKinematics();
 
   void testPackUnpackTime();
   void testQualityFlags();
@@ -176,6 +178,33 @@ void testPackedCandidate::testSimulateReadFromRoot() {
   
 }
 
+void testPackedCandidate::testUnpackKinematics() {
+
+  std::vector<pat::PackedCandidate> cands;
+  for (int i = 0; i < 20; ++i) {
+    pat::PackedCandidate::PolarLorentzVector plv(0.3+1.7*i, -4.9+0.5*i, -3.14159+0.33*i, 0.01*i);
+    pat::PackedCandidate::Point v(-0.005,0.005,0.1);
+    cands.emplace_back(plv, v, plv.Pt(), plv.Eta(), plv.Phi(), 211, reco::VertexRefProd(), reco::VertexRef().key());
+  }
+  //as read back from ROOT for all but the first candidate
+  for (unsigned i = 1; i < cands.size(); ++i) {
+    delete cands[i].p4_.exchange(nullptr);
+    delete cands[i].p4c_.exchange(nullptr);
+  }
+
+  std::vector<float> pt(cands.size()), eta(cands.size()), phi(cands.size()), mass(cands.size());
+  pat::PackedCandidate::unpackKinematics(cands, pt.data(), eta.data(), phi.data(), mass.data());
+
+  for (unsigned i = 1; i < cands.size(); ++i) {
+    CPPUNIT_ASSERT(cands[i].p4c_.load() == nullptr);
+  }
+  for (unsigned i = 0; i < cands.size(); ++i) {
+    CPPUNIT_ASSERT(pt[i] == float(cands[i].pt()));
+    CPPUNIT_ASSERT(eta[i] == float(cands[i].eta()));
+    CPPUNIT_ASSERT(phi[i] == float(cands[i].phi()));
+    CPPUNIT_ASSERT(mass[i] == float(cands[i].mass()));
+  }
+}
 
 void testPackedCandidate::testPackUnpackTime() {
   bool debug = false; // turn this on in order to get a printout of the numerical precision you get for the timing in the various encodings
@@ -22,6 +22,7 @@
 #include <map>
 #include <set>
 #include <string>
+#include <unordered_map>
 #include <utility>
 #include <vector>
 
@@ -149,7 +150,11 @@ namespace edm {
       ProductResolverIndex lumiNextIndexValue_;
       ProductResolverIndex runNextIndexValue_;
 
-      std::map<BranchID, ProductResolverIndex> branchIDToIndex_;
+      // looked up for every Ref and Ptr resolved by ProductID; the BranchID value is already a hash
+      struct BranchIDHasher {
+        size_t operator()(BranchID const& bid) const { return bid.id(); }
+      };
+      std::unordered_map<BranchID, ProductResolverIndex, BranchIDHasher> branchIDToIndex_;
 
       std::vector<std::pair<std::string, std::string> > aliasToOriginal_;
     };
@@ -556,7 +556,7 @@ namespace edm {
   }
 
   ProductResolverIndex ProductRegistry::indexFrom(BranchID const& iID) const {
-    std::map<BranchID, ProductResolverIndex>::const_iterator itFind = transient_.branchIDToIndex_.find(iID);
+    auto itFind = transient_.branchIDToIndex_.find(iID);
     if(itFind == transient_.branchIDToIndex_.end()) {
       return ProductResolverIndexInvalid;
     }
@@ -49,6 +49,8 @@ DDLSAX2FileHandler::startElement( const XMLCh* const uri,
 
   unsigned int numAtts = attrs.getLength();
   std::vector<std::string> attrNames, attrValues;
+  attrNames.reserve(numAtts);
+  attrValues.reserve(numAtts);
 
   for (unsigned int i = 0; i < numAtts; ++i)
   {
@@ -98,11 +100,13 @@ DDLSAX2FileHandler::characters( const XMLCh* const chars,
 				const XMLSize_t length )
 {
   auto myElement = registry_.getElement(self());
-  std::string inString = "";
+  // one char per XMLCh, built in place instead of copying the string for each char
+  std::string inString;
+  inString.reserve(length);
   for (XMLSize_t i = 0; i < length; ++i)
   {
     char s = chars[i];
-    inString = inString + s;
+    inString.push_back(s);
   }
   if (myElement->gotText())
     myElement->appendText(inString);
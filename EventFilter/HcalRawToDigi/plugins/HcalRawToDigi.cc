@@ -266,6 +266,7 @@ void HcalRawToDigi::produce(edm::Event& e, const edm::EventSetup& es)
 
   // check HF duplication
   std::unordered_set<uint32_t> cacheForHFdup;
+  cacheForHFdup.reserve(hf.size());
   unsigned int cntHFdup = 0;
   for( auto & hf_digi : hf ){
      if( ! cacheForHFdup.insert(hf_digi.id().rawId()).second ) cntHFdup++;
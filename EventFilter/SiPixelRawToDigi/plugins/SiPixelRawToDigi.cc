@@ -36,6 +36,8 @@
 #include "EventFilter/SiPixelRawToDigi/interface/PixelUnpackingRegions.h"
 #include "FWCore/Framework/interface/ConsumesCollector.h"
 
+#include "tbb/parallel_for.h"
+
 #include "TH1D.h"
 #include "TFile.h"
 
@@ -214,6 +216,8 @@ void SiPixelRawToDigi::produce( edm::Event& ev,
     LogDebug("SiPixelRawToDigi") << "region2unpack #modules (BPIX,EPIX,total): "<<regions_->nBarrelModules()<<" "<<regions_->nForwardModules()<<" "<<regions_->nModules();
   }
 
+  std::vector<int> fedsToUnpack;
+  fedsToUnpack.reserve(fedIds.size());
   for (auto aFed = fedIds.begin(); aFed != fedIds.end(); ++aFed) {
     int fedId = *aFed;
 
@@ -223,13 +227,44 @@ void SiPixelRawToDigi::produce( edm::Event& ev,
 
     if(debug) LogDebug("SiPixelRawToDigi")<< " PRODUCE DIGI FOR FED: " <<  fedId << endl;
 
-    PixelDataFormatter::Errors errors;
-
-    //get event data for this fed
-    const FEDRawData& fedRawData = buffers->FEDData( fedId );
+    fedsToUnpack.push_back(fedId);
+  }
 
+  // the FEDs are unpacked concurrently, each one with its own copy of the formatter
+  // and its own digis and errors, which are then merged in the order of the FEDs
+  struct UnpackedFed {
+    PixelDataFormatter::Collection digis;
+    PixelDataFormatter::Errors errors;
+    bool errorsInEvent = false;
+    int nDigis = 0;
+    int nWords = 0;
+  };
+  std::vector<UnpackedFed> unpacked(fedsToUnpack.size());
+  tbb::parallel_for(size_t(0), fedsToUnpack.size(), [&](size_t i) {
+    PixelDataFormatter fedFormatter(formatter);
+    UnpackedFed& fed = unpacked[i];
     //convert data to digi and strip off errors
-    formatter.interpretRawData( errorsInEvent, fedId, fedRawData, *collection, errors);
+    fedFormatter.interpretRawData( fed.errorsInEvent, fedsToUnpack[i], buffers->FEDData( fedsToUnpack[i] ), fed.digis, fed.errors);
+    fed.nDigis = fedFormatter.nDigis();
+    fed.nWords = fedFormatter.nWords();
+  });
+
+  int nDigisInEvent = 0;
+  int nWordsInEvent = 0;
+  for (size_t iFed = 0; iFed != fedsToUnpack.size(); ++iFed) {
+    int fedId = fedsToUnpack[iFed];
+    UnpackedFed& fed = unpacked[iFed];
+    errorsInEvent |= fed.errorsInEvent;
+    nDigisInEvent += fed.nDigis;
+    nWordsInEvent += fed.nWords;
+
+    for (auto& fedDetSet : fed.digis) {
+      edm::DetSet<PixelDigi>& detSet = collection->find_or_insert(fedDetSet.detId());
+      if (detSet.empty()) detSet.data.swap(fedDetSet.data);
+      else detSet.data.insert(detSet.data.end(), fedDetSet.data.begin(), fedDetSet.data.end());
+    }
+
+    PixelDataFormatter::Errors& errors = fed.errors;
 
     //pack errors into collection
     if(includeErrors) {
@@ -307,12 +342,12 @@ void SiPixelRawToDigi::produce( edm::Event& ev,
   if (theTimer) {
     theTimer->stop();
     LogDebug("SiPixelRawToDigi") << "TIMING IS: (real)" << theTimer->realTime() ;
-    ndigis += formatter.nDigis();
-    nwords += formatter.nWords();
+    ndigis += nDigisInEvent;
+    nwords += nWordsInEvent;
     LogDebug("SiPixelRawToDigi") << " (Words/Digis) this ev: "
-         <<formatter.nWords()<<"/"<<formatter.nDigis() << "--- all :"<<nwords<<"/"<<ndigis;
+         <<nWordsInEvent<<"/"<<nDigisInEvent << "--- all :"<<nwords<<"/"<<ndigis;
     hCPU->Fill( theTimer->realTime() ); 
-    hDigi->Fill(formatter.nDigis());
+    hDigi->Fill(nDigisInEvent);
   }
 
   //send digis and errors back to framework 
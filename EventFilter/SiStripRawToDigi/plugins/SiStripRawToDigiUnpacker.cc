@@ -13,11 +13,13 @@
 #include "FWCore/Utilities/interface/Exception.h"
 #include "FWCore/MessageLogger/interface/MessageLogger.h"
 #include <iostream>
+#include <memory>
 #include <sstream>
 #include <iomanip>
 #include <boost/format.hpp>
 #include <ext/algorithm>
 #include "FWCore/Utilities/interface/RunningAverage.h"
+#include "tbb/parallel_for.h"
 
 namespace sistrip {
 
@@ -96,10 +98,40 @@ namespace sistrip {
 
     // Flag for EventSummary update using DAQ register  
     bool first_fed = true;
-  
+
+    // The FED buffers are constructed and checked concurrently, then the EventSummary
+    // is updated from the first good one, and finally the channels of the FEDs are
+    // unpacked concurrently into separate work vectors merged in the order of the FEDs
+    auto fedIds = cabling.fedIds();
+    std::vector<std::unique_ptr<sistrip::FEDBuffer> > fedBuffers(fedIds.size());
+    std::vector<std::string> bufferErrors(fedIds.size());
+    tbb::parallel_for(size_t(0), fedIds.size(), [&](size_t i) {
+      const FEDRawData& input = buffers.FEDData( static_cast<int>(fedIds[i]) );
+      if ( fedIds[i] == triggerFedId_ || !input.data() || !input.size() ) { return; }
+      try {
+        auto buffer = std::make_unique<sistrip::FEDBuffer>(input.data(),input.size());
+        buffer->setLegacyMode(legacy_);
+        if (!buffer->doChecks(true)) {
+          if (!unpackBadChannels_ || !buffer->checkNoFEOverflows() )
+            throw cms::Exception("FEDBuffer") << "FED Buffer check fails for FED ID " << fedIds[i] << ".";
+        }
+        if (doFullCorruptBufferChecks_ && !buffer->doCorruptBufferChecks()) {
+          throw cms::Exception("FEDBuffer") << "FED corrupt buffer check fails for FED ID " << fedIds[i] << ".";
+        }
+        fedBuffers[i] = std::move(buffer);
+      }
+      catch (const cms::Exception& e) {
+        bufferErrors[i] = e.what();
+      }
+    });
+
+    std::vector<WorkVectors> work(fedIds.size());
+    std::vector<size_t> fedsToUnpack;
+    fedsToUnpack.reserve(fedIds.size());
+
     // Retrieve FED ids from cabling map and iterate through 
-    std::vector<uint16_t>::const_iterator ifed = cabling.fedIds().begin();
-    for ( ; ifed != cabling.fedIds().end(); ifed++ ) {
+    for ( size_t i = 0; i < fedIds.size(); ++i ) {
+      auto ifed = fedIds.begin() + i;
 
       // ignore trigger FED
       if ( *ifed == triggerFedId_ ) { continue;  }
@@ -143,11 +175,10 @@ namespace sistrip {
       if ( !input.data() ) {
         warnings_.add("NULL pointer to FEDRawData for FED", (boost::format("id %1%") % *ifed).str());
         // Mark FED modules as bad
-        detids.reserve(detids.size()+conns.size());
         std::vector<FedChannelConnection>::const_iterator iconn = conns.begin();
         for ( ; iconn != conns.end(); iconn++ ) {
           if ( !iconn->detId() || iconn->detId() == sistrip::invalid32_ ) continue;
-          detids.push_back(iconn->detId()); //@@ Possible multiple entries (ok for Giovanni)
+          work[i].detids.push_back(iconn->detId()); //@@ Possible multiple entries (ok for Giovanni)
         }
 	continue;
       }	
@@ -156,35 +187,23 @@ namespace sistrip {
       if ( !input.size() ) {
         warnings_.add("FEDRawData has zero size for FED", (boost::format("id %1%") % *ifed).str());
         // Mark FED modules as bad
-        detids.reserve(detids.size()+conns.size());
         std::vector<FedChannelConnection>::const_iterator iconn = conns.begin();
         for ( ; iconn != conns.end(); iconn++ ) {
           if ( !iconn->detId() || iconn->detId() == sistrip::invalid32_ ) continue;
-          detids.push_back(iconn->detId()); //@@ Possible multiple entries (ok for Giovanni)
+          work[i].detids.push_back(iconn->detId()); //@@ Possible multiple entries (ok for Giovanni)
         }
         continue;
       }
       
-      // construct FEDBuffer
-      std::auto_ptr<sistrip::FEDBuffer> buffer;
-      try {
-        buffer.reset(new sistrip::FEDBuffer(input.data(),input.size()));
-        buffer->setLegacyMode(legacy_);
-        if (!buffer->doChecks(true)) {
-          if (!unpackBadChannels_ || !buffer->checkNoFEOverflows() )
-            throw cms::Exception("FEDBuffer") << "FED Buffer check fails for FED ID " << *ifed << ".";
-        }
-        if (doFullCorruptBufferChecks_ && !buffer->doCorruptBufferChecks()) {
-          throw cms::Exception("FEDBuffer") << "FED corrupt buffer check fails for FED ID " << *ifed << ".";
-        }
-      }
-      catch (const cms::Exception& e) {
-        warnings_.add("Exception caught when creating FEDBuffer object for FED", (boost::format("id %1%: %2%") % *ifed % e.what()).str());
+      // FEDBuffer constructed above
+      const sistrip::FEDBuffer* buffer = fedBuffers[i].get();
+      if ( !buffer ) {
+        warnings_.add("Exception caught when creating FEDBuffer object for FED", (boost::format("id %1%: %2%") % *ifed % bufferErrors[i]).str());
         // FED buffer is bad and should not be unpacked. Skip this FED and mark all modules as bad. 
         std::vector<FedChannelConnection>::const_iterator iconn = conns.begin();
         for ( ; iconn != conns.end(); iconn++ ) {
           if ( !iconn->detId() || iconn->detId() == sistrip::invalid32_ ) continue;
-          detids.push_back(iconn->detId()); //@@ Possible multiple entries (ok for Giovanni)
+          work[i].detids.push_back(iconn->detId()); //@@ Possible multiple entries (ok for Giovanni)
         }
         continue;
       }
@@ -207,10 +226,6 @@ namespace sistrip {
 	continue; 
       }
     
-      /// extract readout mode
-      sistrip::FEDReadoutMode mode = buffer->readoutMode();
-      sistrip::FEDLegacyReadoutMode lmode = (legacy_) ? buffer->legacyReadoutMode() : sistrip::READOUT_MODE_LEGACY_INVALID;
-
       // Retrive run type
       sistrip::RunType runType_ = summary.runType();
       if( runType_ == sistrip::APV_LATENCY || runType_ == sistrip::FINE_DELAY ) { useFedKey_ = false; } 
@@ -224,8 +239,50 @@ namespace sistrip {
 	}
       }
     
+      fedsToUnpack.push_back(i);
+    } // fed loop
+
+    // FED channels, the data members are only read
+    tbb::parallel_for(size_t(0), fedsToUnpack.size(), [&](size_t j) {
+      const size_t i = fedsToUnpack[j];
+      unpackChannels( fedIds[i], *fedBuffers[i], cabling.fedConnections(fedIds[i]), summary.runType(), work[i] );
+    });
+    for ( auto& fedWork : work ) { mergeWork( fedWork, detids ); }
+
+    // bad channels warning
+    unsigned int detIdsSize = detids.size();
+    if ( edm::isDebugEnabled() && detIdsSize ) {
+      std::ostringstream ss;
+      ss << "[sistrip::RawToDigiUnpacker::" << __func__ << "]"
+         << " Problems were found in data and " << detIdsSize << " channels could not be unpacked. "
+         << "See output of FED Hardware monitoring for more information. ";
+      edm::LogWarning(sistrip::mlRawToDigi_) << ss.str();
+    }
+    if( (errorThreshold_ != 0) && (detIdsSize > errorThreshold_) ) {
+      edm::LogError("TooManyErrors") << "Total number of errors = " << detIdsSize;
+    }
+
+    // update DetSetVectors
+    update(scope_mode, virgin_raw, proc_raw, zero_suppr, cm_values);
+
+    // increment event counter
+    event_++;
+  
+    // no longer first event!
+    if ( first_ ) { first_ = false; }
+  
+    // final cleanup, just in case
+    cleanupWorkVectors();
+  }
+
+  void RawToDigiUnpacker::unpackChannels( uint16_t fed_id, const sistrip::FEDBuffer& buffer, SiStripFedCabling::ConnsConstIterRange conns, sistrip::RunType runType, WorkVectors& work ) const {
+
+      /// extract readout mode
+      sistrip::FEDReadoutMode mode = buffer.readoutMode();
+      sistrip::FEDLegacyReadoutMode lmode = (legacy_) ? buffer.legacyReadoutMode() : sistrip::READOUT_MODE_LEGACY_INVALID;
+
       // Iterate through FED channels, extract payload and create Digis
-      std::vector<FedChannelConnection>::const_iterator iconn = conns.begin();
+      auto iconn = conns.begin();
       for ( ; iconn != conns.end(); iconn++ ) {
 
 	/// FED channel
@@ -238,15 +295,15 @@ namespace sistrip {
 	if ( !useFedKey_ && ( !iconn->detId() || iconn->detId() == sistrip::invalid32_ ) ) { continue; }
       
 	// Check FED channel
-	if (!buffer->channelGood(iconn->fedCh(),doAPVEmulatorCheck_)) {
-          if (!unpackBadChannels_ || !(buffer->fePresent(iconn->fedCh()/FEDCH_PER_FEUNIT) && buffer->feEnabled(iconn->fedCh()/FEDCH_PER_FEUNIT)) ) {
-            detids.push_back(iconn->detId()); //@@ Possible multiple entries (ok for Giovanni)
+	if (!buffer.channelGood(iconn->fedCh(),doAPVEmulatorCheck_)) {
+          if (!unpackBadChannels_ || !(buffer.fePresent(iconn->fedCh()/FEDCH_PER_FEUNIT) && buffer.feEnabled(iconn->fedCh()/FEDCH_PER_FEUNIT)) ) {
+            work.detids.push_back(iconn->detId()); //@@ Possible multiple entries (ok for Giovanni)
             continue;
           }
 	}
 
 	// Determine whether FED key is inferred from cabling or channel loop
-	uint32_t fed_key = ( summary.runType() == sistrip::FED_CABLING ) ? ( ( *ifed & sistrip::invalid_ ) << 16 ) | ( chan & sistrip::invalid_ ) : ( ( iconn->fedId() & sistrip::invalid_ ) << 16 ) | ( iconn->fedCh() & sistrip::invalid_ );
+	uint32_t fed_key = ( runType == sistrip::FED_CABLING ) ? ( ( fed_id & sistrip::invalid_ ) << 16 ) | ( chan & sistrip::invalid_ ) : ( ( iconn->fedId() & sistrip::invalid_ ) << 16 ) | ( iconn->fedCh() & sistrip::invalid_ );
 
 	// Determine whether DetId or FED key should be used to index digi containers
 	uint32_t key = ( useFedKey_ || (!legacy_ && mode == sistrip::READOUT_MODE_SCOPE) || (legacy_ && lmode == sistrip::READOUT_MODE_LEGACY_SCOPE) ) ? fed_key : iconn->detId();
@@ -257,60 +314,60 @@ namespace sistrip {
 	if ((!legacy_ && (mode == sistrip::READOUT_MODE_ZERO_SUPPRESSED || mode == sistrip::READOUT_MODE_ZERO_SUPPRESSED_FAKE))
          || (legacy_ && (lmode == sistrip::READOUT_MODE_LEGACY_ZERO_SUPPRESSED_REAL || lmode == sistrip::READOUT_MODE_LEGACY_ZERO_SUPPRESSED_FAKE)) ) {
 	
-	  Registry regItem(key, 0, zs_work_digis_.size(), 0);
+	  Registry regItem(key, 0, work.zs_digis.size(), 0);
 	
           try {
 	    /// create unpacker
             /// unpack -> add check to make sure strip < nstrips && strip > last strip......
-            const uint8_t packet_code = buffer->packetCode(legacy_, iconn->fedCh());
+            const uint8_t packet_code = buffer.packetCode(legacy_, iconn->fedCh());
             switch (packet_code) {
               case PACKET_CODE_ZERO_SUPPRESSED: {
-                sistrip::FEDZSChannelUnpacker unpacker = sistrip::FEDZSChannelUnpacker::zeroSuppressedModeUnpacker(buffer->channel(iconn->fedCh()));
-                while (unpacker.hasData()) {zs_work_digis_.push_back(SiStripDigi(unpacker.sampleNumber()+ipair*256,unpacker.adc())); unpacker++;}
+                sistrip::FEDZSChannelUnpacker unpacker = sistrip::FEDZSChannelUnpacker::zeroSuppressedModeUnpacker(buffer.channel(iconn->fedCh()));
+                while (unpacker.hasData()) {work.zs_digis.push_back(SiStripDigi(unpacker.sampleNumber()+ipair*256,unpacker.adc())); unpacker++;}
                 break; }
               case PACKET_CODE_ZERO_SUPPRESSED10: {
-                sistrip::FEDBSChannelUnpacker unpacker = sistrip::FEDBSChannelUnpacker::zeroSuppressedModeUnpacker(buffer->channel(iconn->fedCh()), 10);
-                while (unpacker.hasData()) {zs_work_digis_.push_back(SiStripDigi(unpacker.sampleNumber()+ipair*256,unpacker.adc())); unpacker++;}
+                sistrip::FEDBSChannelUnpacker unpacker = sistrip::FEDBSChannelUnpacker::zeroSuppressedModeUnpacker(buffer.channel(iconn->fedCh()), 10);
+                while (unpacker.hasData()) {work.zs_digis.push_back(SiStripDigi(unpacker.sampleNumber()+ipair*256,unpacker.adc())); unpacker++;}
                 break; }
               case PACKET_CODE_ZERO_SUPPRESSED8_BOTBOT: {
-                sistrip::FEDBSChannelUnpacker unpacker = sistrip::FEDBSChannelUnpacker::zeroSuppressedModeUnpacker(buffer->channel(iconn->fedCh()), 8);
-                while (unpacker.hasData()) {zs_work_digis_.push_back(SiStripDigi(unpacker.sampleNumber()+ipair*256,unpacker.adc()<<2)); unpacker++;}
+                sistrip::FEDBSChannelUnpacker unpacker = sistrip::FEDBSChannelUnpacker::zeroSuppressedModeUnpacker(buffer.channel(iconn->fedCh()), 8);
+                while (unpacker.hasData()) {work.zs_digis.push_back(SiStripDigi(unpacker.sampleNumber()+ipair*256,unpacker.adc()<<2)); unpacker++;}
                 break; }
               case PACKET_CODE_ZERO_SUPPRESSED8_TOPBOT: {
-                sistrip::FEDBSChannelUnpacker unpacker = sistrip::FEDBSChannelUnpacker::zeroSuppressedModeUnpacker(buffer->channel(iconn->fedCh()), 8);
-                while (unpacker.hasData()) {zs_work_digis_.push_back(SiStripDigi(unpacker.sampleNumber()+ipair*256,unpacker.adc()<<1)); unpacker++;}
+                sistrip::FEDBSChannelUnpacker unpacker = sistrip::FEDBSChannelUnpacker::zeroSuppressedModeUnpacker(buffer.channel(iconn->fedCh()), 8);
+                while (unpacker.hasData()) {work.zs_digis.push_back(SiStripDigi(unpacker.sampleNumber()+ipair*256,unpacker.adc()<<1)); unpacker++;}
                 break; }
               default: {
-                warnings_.add((boost::format("Invalid packet code %1$#x for zero-suppressed data") % uint16_t(buffer->packetCode(legacy_, iconn->fedCh()))).str(), (boost::format("FED %1% channel %2%") % *ifed % iconn->fedCh()).str());
+                work.warnings.emplace_back((boost::format("Invalid packet code %1$#x for zero-suppressed data") % uint16_t(buffer.packetCode(legacy_, iconn->fedCh()))).str(), (boost::format("FED %1% channel %2%") % fed_id % iconn->fedCh()).str());
                 if ( packet_code == 0 ) {
                   // workaround for a pre-2015 bug in the packer: assume default ZS packing
-                  sistrip::FEDZSChannelUnpacker unpacker = sistrip::FEDZSChannelUnpacker::zeroSuppressedModeUnpacker(buffer->channel(iconn->fedCh()));
-                  while (unpacker.hasData()) {zs_work_digis_.push_back(SiStripDigi(unpacker.sampleNumber()+ipair*256,unpacker.adc())); unpacker++;}
+                  sistrip::FEDZSChannelUnpacker unpacker = sistrip::FEDZSChannelUnpacker::zeroSuppressedModeUnpacker(buffer.channel(iconn->fedCh()));
+                  while (unpacker.hasData()) {work.zs_digis.push_back(SiStripDigi(unpacker.sampleNumber()+ipair*256,unpacker.adc())); unpacker++;}
                 }
               }
             }
           } catch (const cms::Exception& e) {
-            warnings_.add("Clusters are not ordered", (boost::format("FED %1% channel %2% : %3%") % *ifed % iconn->fedCh() % e.what()).str());
-            detids.push_back(iconn->detId()); //@@ Possible multiple entries (ok for Giovanni)
+            work.warnings.emplace_back("Clusters are not ordered", (boost::format("FED %1% channel %2% : %3%") % fed_id % iconn->fedCh() % e.what()).str());
+            work.detids.push_back(iconn->detId()); //@@ Possible multiple entries (ok for Giovanni)
             continue;
           }
           
-	  regItem.length = zs_work_digis_.size() - regItem.index;
+	  regItem.length = work.zs_digis.size() - regItem.index;
 	  if (regItem.length > 0) {
-	    regItem.first = zs_work_digis_[regItem.index].strip();
-	    zs_work_registry_.push_back(regItem);
+	    regItem.first = work.zs_digis[regItem.index].strip();
+	    work.zs_registry.push_back(regItem);
 	  }
 
 	    
 	  // Common mode values
  	  if ( extractCm_ ) {
  	    try {
-	      Registry regItem2( key, 2*ipair, cm_work_digis_.size(), 2 );
-	      cm_work_digis_.push_back( SiStripRawDigi( buffer->channel(iconn->fedCh()).cmMedian(0) ) );
-	      cm_work_digis_.push_back( SiStripRawDigi( buffer->channel(iconn->fedCh()).cmMedian(1) ) );
-	      cm_work_registry_.push_back( regItem2 );
+	      Registry regItem2( key, 2*ipair, work.cm_digis.size(), 2 );
+	      work.cm_digis.push_back( SiStripRawDigi( buffer.channel(iconn->fedCh()).cmMedian(0) ) );
+	      work.cm_digis.push_back( SiStripRawDigi( buffer.channel(iconn->fedCh()).cmMedian(1) ) );
+	      work.cm_registry.push_back( regItem2 );
  	    } catch (const cms::Exception& e) {
-              warnings_.add("Problem extracting common modes", (boost::format("FED %1% channel %2%:\n %3%") % *ifed % iconn->fedCh() % e.what()).str());
+              work.warnings.emplace_back("Problem extracting common modes", (boost::format("FED %1% channel %2%:\n %3%") % fed_id % iconn->fedCh() % e.what()).str());
  	    }
  	  }
 	  
@@ -318,24 +375,24 @@ namespace sistrip {
 
 	else if (!legacy_ && (mode==sistrip::READOUT_MODE_ZERO_SUPPRESSED_LITE10 || mode==sistrip::READOUT_MODE_ZERO_SUPPRESSED_LITE10_CMOVERRIDE)) { 
 
-	  Registry regItem(key, 0, zs_work_digis_.size(), 0);
+	  Registry regItem(key, 0, work.zs_digis.size(), 0);
 
 	  try {
             /// create unpacker
-	    sistrip::FEDBSChannelUnpacker unpacker = sistrip::FEDBSChannelUnpacker::zeroSuppressedLiteModeUnpacker(buffer->channel(iconn->fedCh()), 10);
+	    sistrip::FEDBSChannelUnpacker unpacker = sistrip::FEDBSChannelUnpacker::zeroSuppressedLiteModeUnpacker(buffer.channel(iconn->fedCh()), 10);
 	    
 	    /// unpack -> add check to make sure strip < nstrips && strip > last strip......
-	    while (unpacker.hasData()) {zs_work_digis_.push_back(SiStripDigi(unpacker.sampleNumber()+ipair*256,unpacker.adc()));unpacker++;}
+	    while (unpacker.hasData()) {work.zs_digis.push_back(SiStripDigi(unpacker.sampleNumber()+ipair*256,unpacker.adc()));unpacker++;}
 	  } catch (const cms::Exception& e) {
-            warnings_.add("Clusters are not ordered", (boost::format("FED %1% channel %2%: %3%") % *ifed % iconn->fedCh() % e.what()).str());
-            detids.push_back(iconn->detId()); //@@ Possible multiple entries (ok for Giovanni)
+            work.warnings.emplace_back("Clusters are not ordered", (boost::format("FED %1% channel %2%: %3%") % fed_id % iconn->fedCh() % e.what()).str());
+            work.detids.push_back(iconn->detId()); //@@ Possible multiple entries (ok for Giovanni)
             continue;
           }  
 
-	  regItem.length = zs_work_digis_.size() - regItem.index;
+	  regItem.length = work.zs_digis.size() - regItem.index;
 	  if (regItem.length > 0) {
-	    regItem.first = zs_work_digis_[regItem.index].strip();
-	    zs_work_registry_.push_back(regItem);
+	    regItem.first = work.zs_digis[regItem.index].strip();
+	    work.zs_registry.push_back(regItem);
 	  }
           
 
@@ -347,7 +404,7 @@ namespace sistrip {
                   mode==sistrip::READOUT_MODE_ZERO_SUPPRESSED_LITE8_BOTBOT || mode==sistrip::READOUT_MODE_ZERO_SUPPRESSED_LITE8_BOTBOT_CMOVERRIDE))
              || (legacy_ && (lmode == sistrip::READOUT_MODE_LEGACY_ZERO_SUPPRESSED_LITE_REAL || lmode == sistrip::READOUT_MODE_LEGACY_ZERO_SUPPRESSED_LITE_FAKE))) {
 
-      	  Registry regItem(key, 0, zs_work_digis_.size(), 0);
+      	  Registry regItem(key, 0, work.zs_digis.size(), 0);
 	
 	  size_t bits_shift = 0;
 	  if (mode==sistrip::READOUT_MODE_ZERO_SUPPRESSED_LITE8_TOPBOT || mode==sistrip::READOUT_MODE_ZERO_SUPPRESSED_LITE8_TOPBOT_CMOVERRIDE) bits_shift = 1;
@@ -355,20 +412,20 @@ namespace sistrip {
 	  
 	  try {
             /// create unpacker
-            sistrip::FEDZSChannelUnpacker unpacker = sistrip::FEDZSChannelUnpacker::zeroSuppressedLiteModeUnpacker(buffer->channel(iconn->fedCh()));
+            sistrip::FEDZSChannelUnpacker unpacker = sistrip::FEDZSChannelUnpacker::zeroSuppressedLiteModeUnpacker(buffer.channel(iconn->fedCh()));
 	    	    
     	    /// unpack -> add check to make sure strip < nstrips && strip > last strip......
-   	    while (unpacker.hasData()) {zs_work_digis_.push_back(SiStripDigi(unpacker.sampleNumber()+ipair*256,unpacker.adc()<<bits_shift));unpacker++;}
+   	    while (unpacker.hasData()) {work.zs_digis.push_back(SiStripDigi(unpacker.sampleNumber()+ipair*256,unpacker.adc()<<bits_shift));unpacker++;}
  	  } catch (const cms::Exception& e) {
-            warnings_.add("Clusters are not ordered", (boost::format("FED %1% channel %2%: %3%") % *ifed % iconn->fedCh() % e.what()).str());
-            detids.push_back(iconn->detId()); //@@ Possible multiple entries (ok for Giovanni)
+            work.warnings.emplace_back("Clusters are not ordered", (boost::format("FED %1% channel %2%: %3%") % fed_id % iconn->fedCh() % e.what()).str());
+            work.detids.push_back(iconn->detId()); //@@ Possible multiple entries (ok for Giovanni)
             continue;
           }
 
-	  regItem.length = zs_work_digis_.size() - regItem.index;
+	  regItem.length = work.zs_digis.size() - regItem.index;
 	  if (regItem.length > 0) {
-	    regItem.first = zs_work_digis_[regItem.index].strip();
-	    zs_work_registry_.push_back(regItem);
+	    regItem.first = work.zs_digis[regItem.index].strip();
+	    work.zs_registry.push_back(regItem);
 	  }
 
         }
@@ -377,25 +434,25 @@ namespace sistrip {
               || (legacy_ && lmode == sistrip::READOUT_MODE_LEGACY_PREMIX_RAW)
                 ) { 
 
-	  Registry regItem(key, 0, zs_work_digis_.size(), 0);
+	  Registry regItem(key, 0, work.zs_digis.size(), 0);
 	
 	  try {
 
             /// create unpacker
-	    sistrip::FEDZSChannelUnpacker unpacker = sistrip::FEDZSChannelUnpacker::preMixRawModeUnpacker(buffer->channel(iconn->fedCh()));
+	    sistrip::FEDZSChannelUnpacker unpacker = sistrip::FEDZSChannelUnpacker::preMixRawModeUnpacker(buffer.channel(iconn->fedCh()));
 	    
 	    /// unpack -> add check to make sure strip < nstrips && strip > last strip......
-	    while (unpacker.hasData()) {zs_work_digis_.push_back(SiStripDigi(unpacker.sampleNumber()+ipair*256,unpacker.adcPreMix()));unpacker++;}
+	    while (unpacker.hasData()) {work.zs_digis.push_back(SiStripDigi(unpacker.sampleNumber()+ipair*256,unpacker.adcPreMix()));unpacker++;}
 	  } catch (const cms::Exception& e) {
-            warnings_.add("Clusters are not ordered", (boost::format("FED %1% channel %2%: %3%") % *ifed % iconn->fedCh() % e.what()).str());
-            detids.push_back(iconn->detId()); //@@ Possible multiple entries (ok for Giovanni)
+            work.warnings.emplace_back("Clusters are not ordered", (boost::format("FED %1% channel %2%: %3%") % fed_id % iconn->fedCh() % e.what()).str());
+            work.detids.push_back(iconn->detId()); //@@ Possible multiple entries (ok for Giovanni)
             continue;
           }  
 
-	  regItem.length = zs_work_digis_.size() - regItem.index;
+	  regItem.length = work.zs_digis.size() - regItem.index;
 	  if (regItem.length > 0) {
-	    regItem.first = zs_work_digis_[regItem.index].strip();
-	    zs_work_registry_.push_back(regItem);
+	    regItem.first = work.zs_digis[regItem.index].strip();
+	    work.zs_registry.push_back(regItem);
 	  }
           
 
@@ -410,36 +467,36 @@ namespace sistrip {
 	  /// create unpacker
 	  /// and unpack -> add check to make sure strip < nstrips && strip > last strip......
 
-          uint8_t packet_code = buffer->packetCode(legacy_);
+          uint8_t packet_code = buffer.packetCode(legacy_);
           if ( packet_code == PACKET_CODE_VIRGIN_RAW ) {
-            sistrip::FEDRawChannelUnpacker unpacker = sistrip::FEDRawChannelUnpacker::virginRawModeUnpacker(buffer->channel(iconn->fedCh()));
+            sistrip::FEDRawChannelUnpacker unpacker = sistrip::FEDRawChannelUnpacker::virginRawModeUnpacker(buffer.channel(iconn->fedCh()));
 	    while (unpacker.hasData()) {samples.push_back(unpacker.adc());unpacker++;}
           }
           else {
             if ( packet_code == PACKET_CODE_VIRGIN_RAW10 ) {
-              sistrip::FEDBSChannelUnpacker unpacker = sistrip::FEDBSChannelUnpacker::virginRawModeUnpacker(buffer->channel(iconn->fedCh()), 10);
+              sistrip::FEDBSChannelUnpacker unpacker = sistrip::FEDBSChannelUnpacker::virginRawModeUnpacker(buffer.channel(iconn->fedCh()), 10);
               while (unpacker.hasData()) {samples.push_back(unpacker.adc());unpacker.sampleNumber();unpacker++;}
             }
             else if ( packet_code == PACKET_CODE_VIRGIN_RAW8_BOTBOT ) {
-              sistrip::FEDBSChannelUnpacker unpacker = sistrip::FEDBSChannelUnpacker::virginRawModeUnpacker(buffer->channel(iconn->fedCh()), 8);
+              sistrip::FEDBSChannelUnpacker unpacker = sistrip::FEDBSChannelUnpacker::virginRawModeUnpacker(buffer.channel(iconn->fedCh()), 8);
 	      while (unpacker.hasData()) {samples.push_back(( unpacker.adc()<<2 ));unpacker++;}
             }
             else if ( packet_code == PACKET_CODE_VIRGIN_RAW8_TOPBOT ) {
-              sistrip::FEDBSChannelUnpacker unpacker = sistrip::FEDBSChannelUnpacker::virginRawModeUnpacker(buffer->channel(iconn->fedCh()), 8);
+              sistrip::FEDBSChannelUnpacker unpacker = sistrip::FEDBSChannelUnpacker::virginRawModeUnpacker(buffer.channel(iconn->fedCh()), 8);
 	      while (unpacker.hasData()) {samples.push_back(( unpacker.adc()<<1 ));unpacker++;}
             }
           }
           if ( !samples.empty() ) { 
-            Registry regItem(key, 256*ipair, virgin_work_digis_.size(), samples.size());
+            Registry regItem(key, 256*ipair, work.virgin_digis.size(), samples.size());
 	    uint16_t physical;
 	    uint16_t readout; 
 	    for ( uint16_t i = 0, n = samples.size(); i < n; i++ ) {
 	      physical = i%128;
 	      readoutOrder( physical, readout );                 // convert index from physical to readout order
 	      (i/128) ? readout=readout*2+1 : readout=readout*2; // un-multiplex data
-	      virgin_work_digis_.push_back(  SiStripRawDigi( samples[readout] ) );
+	      work.virgin_digis.push_back(  SiStripRawDigi( samples[readout] ) );
 	    }
-	    virgin_work_registry_.push_back( regItem );
+	    work.virgin_registry.push_back( regItem );
 	  }
 	} 
     
@@ -450,17 +507,17 @@ namespace sistrip {
 	  std::vector<uint16_t> samples; 
 	
 	  /// create unpacker
-	  sistrip::FEDRawChannelUnpacker unpacker = sistrip::FEDRawChannelUnpacker::procRawModeUnpacker(buffer->channel(iconn->fedCh()));
+	  sistrip::FEDRawChannelUnpacker unpacker = sistrip::FEDRawChannelUnpacker::procRawModeUnpacker(buffer.channel(iconn->fedCh()));
 	
 	  /// unpack -> add check to make sure strip < nstrips && strip > last strip......
 	  while (unpacker.hasData()) {samples.push_back(unpacker.adc());unpacker++;}
 	
 	  if ( !samples.empty() ) { 
-	    Registry regItem(key, 256*ipair, proc_work_digis_.size(), samples.size());
+	    Registry regItem(key, 256*ipair, work.proc_digis.size(), samples.size());
 	    for ( uint16_t i = 0, n = samples.size(); i < n; i++ ) {
-	      proc_work_digis_.push_back(  SiStripRawDigi( samples[i] ) );
+	      work.proc_digis.push_back(  SiStripRawDigi( samples[i] ) );
 	    }
-	    proc_work_registry_.push_back( regItem );
+	    work.proc_registry.push_back( regItem );
 	  }
 	} 
 
@@ -471,38 +528,38 @@ namespace sistrip {
 	  std::vector<uint16_t> samples; 
 	
 	  /// create unpacker
-	  sistrip::FEDRawChannelUnpacker unpacker = sistrip::FEDRawChannelUnpacker::scopeModeUnpacker(buffer->channel(iconn->fedCh()));
+	  sistrip::FEDRawChannelUnpacker unpacker = sistrip::FEDRawChannelUnpacker::scopeModeUnpacker(buffer.channel(iconn->fedCh()));
 
 	  /// unpack -> add check to make sure strip < nstrips && strip > last strip......
 	  while (unpacker.hasData()) {samples.push_back(unpacker.adc());unpacker++;}
 	
 	  if ( !samples.empty() ) { 
-	    Registry regItem(key, 0, scope_work_digis_.size(), samples.size());
+	    Registry regItem(key, 0, work.scope_digis.size(), samples.size());
 	    for ( uint16_t i = 0, n = samples.size(); i < n; i++ ) {
-	      scope_work_digis_.push_back(  SiStripRawDigi( samples[i] ) );
+	      work.scope_digis.push_back(  SiStripRawDigi( samples[i] ) );
 	    }
-	    scope_work_registry_.push_back( regItem );
+	    work.scope_registry.push_back( regItem );
 	  }
 	} 
 	
 	else { // Unknown readout mode! => assume scope mode
 
-          warnings_.add((boost::format("Unknown FED readout mode (%1%)! Assuming SCOPE MODE...") % mode).str());
+          work.warnings.emplace_back((boost::format("Unknown FED readout mode (%1%)! Assuming SCOPE MODE...") % mode).str(), std::string());
 
 	  std::vector<uint16_t> samples; 
 	
 	  /// create unpacker
-	  sistrip::FEDRawChannelUnpacker unpacker = sistrip::FEDRawChannelUnpacker::scopeModeUnpacker(buffer->channel(iconn->fedCh()));
+	  sistrip::FEDRawChannelUnpacker unpacker = sistrip::FEDRawChannelUnpacker::scopeModeUnpacker(buffer.channel(iconn->fedCh()));
 	
 	  /// unpack -> add check to make sure strip < nstrips && strip > last strip......
 	  while (unpacker.hasData()) {samples.push_back(unpacker.adc());unpacker++;}
 	
 	  if ( !samples.empty() ) { 
-	    Registry regItem(key, 0, scope_work_digis_.size(), samples.size());
+	    Registry regItem(key, 0, work.scope_digis.size(), samples.size());
 	    for ( uint16_t i = 0, n = samples.size(); i < n; i++ ) {
-	      scope_work_digis_.push_back(  SiStripRawDigi( samples[i] ) );
+	      work.scope_digis.push_back(  SiStripRawDigi( samples[i] ) );
 	    }
-	    scope_work_registry_.push_back( regItem );
+	    work.scope_registry.push_back( regItem );
 	  
 	    if ( edm::isDebugEnabled() ) {
 	      std::stringstream ss;
@@ -516,36 +573,28 @@ namespace sistrip {
 	      LogTrace("SiStripRawToDigi") << ss.str();
 	    }
 	  } else {
-            warnings_.add("No SM digis found!");
+            work.warnings.emplace_back("No SM digis found!", std::string());
           }
 	}
       } // channel loop
-    } // fed loop
-
-    // bad channels warning
-    unsigned int detIdsSize = detids.size();
-    if ( edm::isDebugEnabled() && detIdsSize ) {
-      std::ostringstream ss;
-      ss << "[sistrip::RawToDigiUnpacker::" << __func__ << "]"
-         << " Problems were found in data and " << detIdsSize << " channels could not be unpacked. "
-         << "See output of FED Hardware monitoring for more information. ";
-      edm::LogWarning(sistrip::mlRawToDigi_) << ss.str();
-    }
-    if( (errorThreshold_ != 0) && (detIdsSize > errorThreshold_) ) {
-      edm::LogError("TooManyErrors") << "Total number of errors = " << detIdsSize;
-    }
-
-    // update DetSetVectors
-    update(scope_mode, virgin_raw, proc_raw, zero_suppr, cm_values);
+  }
 
-    // increment event counter
-    event_++;
-  
-    // no longer first event!
-    if ( first_ ) { first_ = false; }
-  
-    // final cleanup, just in case
-    cleanupWorkVectors();
+  void RawToDigiUnpacker::mergeWork( WorkVectors& work, DetIdCollection& detids ) {
+    auto append = [](std::vector<Registry>& registry, const std::vector<Registry>& fedRegistry, size_t offset) {
+      for ( auto item : fedRegistry ) { item.index += offset; registry.push_back(item); }
+    };
+    append( zs_work_registry_, work.zs_registry, zs_work_digis_.size() );
+    zs_work_digis_.insert( zs_work_digis_.end(), work.zs_digis.begin(), work.zs_digis.end() );
+    append( virgin_work_registry_, work.virgin_registry, virgin_work_digis_.size() );
+    virgin_work_digis_.insert( virgin_work_digis_.end(), work.virgin_digis.begin(), work.virgin_digis.end() );
+    append( proc_work_registry_, work.proc_registry, proc_work_digis_.size() );
+    proc_work_digis_.insert( proc_work_digis_.end(), work.proc_digis.begin(), work.proc_digis.end() );
+    append( scope_work_registry_, work.scope_registry, scope_work_digis_.size() );
+    scope_work_digis_.insert( scope_work_digis_.end(), work.scope_digis.begin(), work.scope_digis.end() );
+    append( cm_work_registry_, work.cm_registry, cm_work_digis_.size() );
+    cm_work_digis_.insert( cm_work_digis_.end(), work.cm_digis.begin(), work.cm_digis.end() );
+    for ( auto id : work.detids ) { detids.push_back(id); }
+    for ( const auto& warning : work.warnings ) { warnings_.add(warning.first, warning.second); }
   }
 
   void RawToDigiUnpacker::update( RawDigis& scope_mode, RawDigis& virgin_raw, RawDigis& proc_raw, Digis& zero_suppr, RawDigis& common_mode ) {
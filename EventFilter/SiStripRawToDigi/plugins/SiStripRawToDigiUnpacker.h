@@ -2,6 +2,11 @@
 #ifndef EventFilter_SiStripRawToDigi_SiStripRawToDigiUnpacker_H
 #define EventFilter_SiStripRawToDigi_SiStripRawToDigiUnpacker_H
 
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "CondFormats/SiStripObjects/interface/SiStripFedCabling.h"
 #include "DataFormats/Common/interface/Handle.h"
 #include "DataFormats/Common/interface/DetSetVector.h"
 #include "DataFormats/DetId/interface/DetIdCollection.h"
@@ -19,7 +24,6 @@ class FEDRawData;
 class SiStripDigi;
 class SiStripRawDigi;
 class SiStripEventSummary;
-class SiStripFedCabling;
 
 namespace sistrip {
   
@@ -76,7 +80,7 @@ namespace sistrip {
     void updateEventSummary( const sistrip::FEDBuffer&, SiStripEventSummary& );
     
     /// order of strips
-    inline void readoutOrder( uint16_t& physical_order, uint16_t& readout_order );
+    inline void readoutOrder( uint16_t& physical_order, uint16_t& readout_order ) const;
     
     /// order of strips
     inline void physicalOrder( uint16_t& readout_order, uint16_t& physical_order ); 
@@ -110,6 +114,21 @@ namespace sistrip {
       size_t index;
       uint16_t length;
     };
+
+    /// registries, digis, bad modules and warnings of a single FED, filled concurrently for different FEDs
+    struct WorkVectors {
+      std::vector<Registry> zs_registry, virgin_registry, scope_registry, proc_registry, cm_registry;
+      std::vector<SiStripDigi> zs_digis;
+      std::vector<SiStripRawDigi> virgin_digis, scope_digis, proc_digis, cm_digis;
+      std::vector<uint32_t> detids;
+      std::vector<std::pair<std::string,std::string> > warnings;
+    };
+
+    /// unpacks the channels of one FED, only reads the data members
+    void unpackChannels( uint16_t fed_id, const sistrip::FEDBuffer&, SiStripFedCabling::ConnsConstIterRange, sistrip::RunType, WorkVectors& ) const;
+
+    /// appends the work vectors of one FED to the registries and digi collections
+    void mergeWork( WorkVectors&, DetIdCollection& );
     
     /// configurables
     int16_t headerBytes_;
@@ -150,7 +169,7 @@ namespace sistrip {
   };
 }
 
-void sistrip::RawToDigiUnpacker::readoutOrder( uint16_t& physical_order, uint16_t& readout_order ) 
+void sistrip::RawToDigiUnpacker::readoutOrder( uint16_t& physical_order, uint16_t& readout_order ) const
 {
   readout_order = ( 4*((static_cast<uint16_t>((static_cast<float>(physical_order)/8.0)))%4) + static_cast<uint16_t>(static_cast<float>(physical_order)/32.0) + 16*(physical_order%8) );
 }
@@ -54,8 +54,10 @@ namespace edm {
 
 namespace evf{
 
+  //the per-stream states are written at every module transition by their own stream:
+  //give each one a cache line so that the streams do not invalidate each other's line
   template<typename T>
-    struct ContainableAtomic {
+    struct alignas(64) ContainableAtomic {
     ContainableAtomic(): m_value{} {}
     ContainableAtomic(T iValue): m_value(iValue) {}
     ContainableAtomic(ContainableAtomic<T> const& iOther): m_value(iOther.m_value.load()) {}
@@ -55,6 +55,7 @@ private:
   evf::EvFDaqDirector::FileStatus nextEvent();
   evf::EvFDaqDirector::FileStatus getNextEvent();
   edm::Timestamp fillFEDRawDataCollection(FEDRawDataCollection&);
+  void verifyEventChecksum();
   void deleteFile(std::string const&);
 
   void readSupervisor();
@@ -58,11 +58,12 @@ bool FRDStreamSource::setRunAndEventInfo(edm::EventID& id, edm::TimeValue_t& the
     assert( fin_.gcount() == FRDHeaderVersionSize[detectedFRDversion_] );
   }
 
-  std::unique_ptr<FRDEventMsgView> frdEventMsg(new FRDEventMsgView(&buffer_[0]));
+  // the views only decode the header of the buffer: keep them on the stack
+  FRDEventMsgView frdEventMsg(&buffer_[0]);
   if (useL1EventID_)
-    id = edm::EventID(frdEventMsg->run(), frdEventMsg->lumi(), frdEventMsg->event());
+    id = edm::EventID(frdEventMsg.run(), frdEventMsg.lumi(), frdEventMsg.event());
 
-  const uint32_t totalSize = frdEventMsg->size();
+  const uint32_t totalSize = frdEventMsg.size();
   if ( totalSize > buffer_.size() ) {
     buffer_.resize(totalSize);
   }
@@ -72,35 +73,35 @@ bool FRDStreamSource::setRunAndEventInfo(edm::EventID& id, edm::TimeValue_t& the
       throw cms::Exception("FRDStreamSource::setRunAndEventInfo") <<
         "premature end of file " << *itFileName_;
     }
-    frdEventMsg.reset(new FRDEventMsgView(&buffer_[0]));
+    frdEventMsg = FRDEventMsgView(&buffer_[0]);
   }
 
-  if ( verifyChecksum_ && frdEventMsg->version() >= 5 )
+  if ( verifyChecksum_ && frdEventMsg.version() >= 5 )
   {
     uint32_t crc=0;
-    crc = crc32c(crc,(const unsigned char*)frdEventMsg->payload(),frdEventMsg->eventSize());
-    if ( crc != frdEventMsg->crc32c() ) {
+    crc = crc32c(crc,(const unsigned char*)frdEventMsg.payload(),frdEventMsg.eventSize());
+    if ( crc != frdEventMsg.crc32c() ) {
       throw cms::Exception("FRDStreamSource::getNextEvent") <<
-        "Found a wrong crc32c checksum: expected 0x" << std::hex << frdEventMsg->crc32c() <<
+        "Found a wrong crc32c checksum: expected 0x" << std::hex << frdEventMsg.crc32c() <<
         " but calculated 0x" << crc;
     }
   }
-  else if ( verifyAdler32_ && frdEventMsg->version() >= 3 )
+  else if ( verifyAdler32_ && frdEventMsg.version() >= 3 )
   {
     uint32_t adler = adler32(0L,Z_NULL,0);
-    adler = adler32(adler,(Bytef*)frdEventMsg->payload(),frdEventMsg->eventSize());
+    adler = adler32(adler,(Bytef*)frdEventMsg.payload(),frdEventMsg.eventSize());
 
-    if ( adler != frdEventMsg->adler32() ) {
+    if ( adler != frdEventMsg.adler32() ) {
       throw cms::Exception("FRDStreamSource::setRunAndEventInfo") <<
-        "Found a wrong Adler32 checksum: expected 0x" << std::hex << frdEventMsg->adler32() <<
+        "Found a wrong Adler32 checksum: expected 0x" << std::hex << frdEventMsg.adler32() <<
         " but calculated 0x" << adler;
     }
   }
 
   rawData_ = std::make_unique<FEDRawDataCollection>();
 
-  uint32_t eventSize = frdEventMsg->eventSize();
-  unsigned char* event = (unsigned char*)frdEventMsg->payload();
+  uint32_t eventSize = frdEventMsg.eventSize();
+  unsigned char* event = (unsigned char*)frdEventMsg.payload();
   bool foundTCDSFED=false;
   bool foundGTPFED=false;
 
@@ -121,7 +122,7 @@ bool FRDStreamSource::setRunAndEventInfo(edm::EventID& id, edm::TimeValue_t& the
     if (fedId == FEDNumbering::MINTCDSuTCAFEDID) {
       foundTCDSFED=true;
       tcds::Raw_v1 const* tcds = reinterpret_cast<tcds::Raw_v1 const*>(event + eventSize + FEDHeader::length);
-      id = edm::EventID(frdEventMsg->run(),tcds->header.lumiSection,tcds->header.eventNumber);
+      id = edm::EventID(frdEventMsg.run(),tcds->header.lumiSection,tcds->header.eventNumber);
       eType = static_cast<edm::EventAuxiliary::ExperimentType>(fedHeader.triggerType());
       theTime = static_cast<edm::TimeValue_t>(((uint64_t)tcds->bst.gpstimehigh << 32) | tcds->bst.gpstimelow);
     }
@@ -131,9 +132,9 @@ bool FRDStreamSource::setRunAndEventInfo(edm::EventID& id, edm::TimeValue_t& the
       const bool GTPEvmBoardSense=evf::evtn::evm_board_sense(event + eventSize,fedSize);
       if (!useL1EventID_) {
         if (GTPEvmBoardSense)
-          id = edm::EventID(frdEventMsg->run(), frdEventMsg->lumi(), evf::evtn::get(event + eventSize,true));
+          id = edm::EventID(frdEventMsg.run(), frdEventMsg.lumi(), evf::evtn::get(event + eventSize,true));
         else
-          id = edm::EventID(frdEventMsg->run(), frdEventMsg->lumi(), evf::evtn::get(event + eventSize,false));
+          id = edm::EventID(frdEventMsg.run(), frdEventMsg.lumi(), evf::evtn::get(event + eventSize,false));
       }
       //evf::evtn::evm_board_setformat(fedSize);
       const uint64_t gpsl = evf::evtn::getgpslow(event + eventSize);
@@ -146,7 +147,7 @@ bool FRDStreamSource::setRunAndEventInfo(edm::EventID& id, edm::TimeValue_t& the
     //take event ID from GTPE FED
     if (fedId == FEDNumbering::MINTriggerEGTPFEDID && !foundGTPFED && !foundTCDSFED && !useL1EventID_) {
       if (evf::evtn::gtpe_board_sense(event + eventSize)) {
-        id = edm::EventID(frdEventMsg->run(), frdEventMsg->lumi(), evf::evtn::gtpe_get(event + eventSize));
+        id = edm::EventID(frdEventMsg.run(), frdEventMsg.lumi(), evf::evtn::gtpe_get(event + eventSize));
       }
     }
     FEDRawData& fedData = rawData_->FEDData(fedId);
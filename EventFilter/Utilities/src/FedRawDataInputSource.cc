@@ -46,6 +46,9 @@
 #include "DataFormats/Provenance/interface/Timestamp.h"
 #include "EventFilter/Utilities/interface/crc32c.h"
 
+#include "tbb/task_arena.h"
+#include "tbb/task_group.h"
+
 //JSON file reader
 #include "EventFilter/Utilities/interface/reader.h"
 
@@ -578,31 +581,6 @@ inline evf::EvFDaqDirector::FileStatus FedRawDataInputSource::getNextEvent()
       }
     }
   }//end multibuffer mode
-  if (fms_) fms_->setInState(evf::FastMonitoringThread::inChecksumEvent);
-
-  if (verifyChecksum_ && event_->version() >= 5)
-  {
-    uint32_t crc=0;
-    crc = crc32c(crc,(const unsigned char*)event_->payload(),event_->eventSize());
-    if ( crc != event_->crc32c() ) {
-      if (fms_) fms_->setExceptionDetected(currentLumiSection_);
-      throw cms::Exception("FedRawDataInputSource::getNextEvent") <<
-        "Found a wrong crc32c checksum: expected 0x" << std::hex << event_->crc32c() <<
-        " but calculated 0x" << crc;
-    }
-  }
-  else if ( verifyAdler32_ && event_->version() >= 3)
-  {
-    uint32_t adler = adler32(0L,Z_NULL,0);
-    adler = adler32(adler,(Bytef*)event_->payload(),event_->eventSize());
-
-    if ( adler != event_->adler32() ) {
-      if (fms_) fms_->setExceptionDetected(currentLumiSection_);
-      throw cms::Exception("FedRawDataInputSource::getNextEvent") <<
-        "Found a wrong Adler32 checksum: expected 0x" << std::hex << event_->adler32() <<
-        " but calculated 0x" << adler;
-    }
-  }
   if (fms_) fms_->setInState(evf::FastMonitoringThread::inCachedEvent);
 
   currentFile_->nProcessed_++;
@@ -643,11 +621,66 @@ void FedRawDataInputSource::deleteFile(std::string const& fileName)
 }
 
 
+void FedRawDataInputSource::verifyEventChecksum()
+{
+  if (verifyChecksum_ && event_->version() >= 5)
+  {
+    uint32_t crc=0;
+    crc = crc32c(crc,(const unsigned char*)event_->payload(),event_->eventSize());
+    if ( crc != event_->crc32c() ) {
+      if (fms_) fms_->setExceptionDetected(currentLumiSection_);
+      throw cms::Exception("FedRawDataInputSource::verifyEventChecksum") <<
+        "Found a wrong crc32c checksum: expected 0x" << std::hex << event_->crc32c() <<
+        " but calculated 0x" << crc;
+    }
+  }
+  else if ( verifyAdler32_ && event_->version() >= 3)
+  {
+    uint32_t adler = adler32(0L,Z_NULL,0);
+    adler = adler32(adler,(Bytef*)event_->payload(),event_->eventSize());
+
+    if ( adler != event_->adler32() ) {
+      if (fms_) fms_->setExceptionDetected(currentLumiSection_);
+      throw cms::Exception("FedRawDataInputSource::verifyEventChecksum") <<
+        "Found a wrong Adler32 checksum: expected 0x" << std::hex << event_->adler32() <<
+        " but calculated 0x" << adler;
+    }
+  }
+}
+
+
 void FedRawDataInputSource::read(edm::EventPrincipal& eventPrincipal)
 {
   if (fms_) fms_->setInState(evf::FastMonitoringThread::inReadEvent);
   std::unique_ptr<FEDRawDataCollection> rawData(new FEDRawDataCollection);
-  edm::Timestamp tstamp = fillFEDRawDataCollection(*rawData);
+
+  //verify the checksum in a separate task while the FED fragments are copied.
+  //fillFEDRawDataCollection bounds-checks every fragment, so a corrupted event
+  //cannot read past the payload, and a checksum failure takes precedence over
+  //any parsing error
+  std::exception_ptr checksumException;
+  tbb::task_group checksumGroup;
+  checksumGroup.run([this, &checksumException]() {
+    try {
+      verifyEventChecksum();
+    }
+    catch (...) {
+      checksumException = std::current_exception();
+    }
+  });
+  edm::Timestamp tstamp;
+  std::exception_ptr fillException;
+  try {
+    tstamp = fillFEDRawDataCollection(*rawData);
+  }
+  catch (...) {
+    fillException = std::current_exception();
+  }
+  if (fms_) fms_->setInState(evf::FastMonitoringThread::inChecksumEvent);
+  tbb::this_task_arena::isolate([&checksumGroup]() { checksumGroup.wait(); });
+  if (checksumException) std::rethrow_exception(checksumException);
+  if (fillException) std::rethrow_exception(fillException);
+  if (fms_) fms_->setInState(evf::FastMonitoringThread::inReadEvent);
 
   if (useL1EventID_){
     eventID_ = edm::EventID(eventRunNumber_, currentLumiSection_, L1EventID_);
@@ -733,11 +766,16 @@ edm::Timestamp FedRawDataInputSource::fillFEDRawDataCollection(FEDRawDataCollect
   GTPEventID_=0;
   tcds_pointer_ = nullptr;
   while (eventSize > 0) {
-    assert(eventSize>=FEDTrailer::length);
+    //the checksum may still be running, so check the fragment bounds instead of asserting them
+    if (eventSize < FEDTrailer::length)
+      throw cms::Exception("FedRawDataInputSource::fillFEDRawDataCollection") << "Truncated FED trailer, "
+        << eventSize << " bytes left in the event";
     eventSize -= FEDTrailer::length;
     const FEDTrailer fedTrailer(event + eventSize);
     const uint32_t fedSize = fedTrailer.fragmentLength() << 3; //trailer length counts in 8 bytes
-    assert(eventSize>=fedSize - FEDHeader::length);
+    if (fedSize < FEDHeader::length + FEDTrailer::length || eventSize < fedSize - FEDHeader::length)
+      throw cms::Exception("FedRawDataInputSource::fillFEDRawDataCollection") << "Invalid FED fragment length "
+        << fedSize << ", " << eventSize + FEDTrailer::length << " bytes left in the event";
     eventSize -= (fedSize - FEDHeader::length);
     const FEDHeader fedHeader(event + eventSize);
     const uint16_t fedId = fedHeader.sourceID();
@@ -764,9 +802,8 @@ edm::Timestamp FedRawDataInputSource::fillFEDRawDataCollection(FEDRawDataCollect
         GTPEventID_ = evf::evtn::gtpe_get(event + eventSize);
       }
     }
-    FEDRawData& fedData = rawData.FEDData(fedId);
-    fedData.resize(fedSize);
-    memcpy(fedData.data(), event + eventSize, fedSize);
+    //copy the fragment in one pass instead of zero filling the buffer first
+    rawData.FEDData(fedId).assign(event + eventSize, fedSize);
   }
   assert(eventSize == 0);
 
@@ -54,6 +54,14 @@ namespace edm {
        */
       template<typename T>
       void push(T&& iAction);
+
+      /// asynchronously pushes functor iAction into queue ahead of tasks added with push()
+      /**
+       * \sa SerialTaskQueue::pushHighPriority()
+       * \param[in] iAction Must be a functor that takes no arguments and return no values.
+       */
+      template<typename T>
+      void pushHighPriority(T&& iAction);
       
       /// synchronously pushes functor iAction into queue
       /**
@@ -139,6 +147,19 @@ namespace edm {
      }
    }
    
+   template<typename T>
+   void LimitedTaskQueue::pushHighPriority(T&& iAction) {
+     auto set_to_run = std::make_shared<std::atomic<bool>>(false);
+     for(auto& q: m_queues) {
+       q.pushHighPriority([set_to_run,iAction]() mutable{
+         bool expected = false;
+         if(set_to_run->compare_exchange_strong(expected,true)) {
+           iAction();
+         }
+       });
+     }
+   }
+   
    template<typename T>
    void LimitedTaskQueue::pushAndWait(T&& iAction) {
       tbb::empty_task* waitTask = new (tbb::task::allocate_root()) tbb::empty_task;
@@ -73,10 +73,11 @@ namespace edm {
       
       SerialTaskQueue(SerialTaskQueue&& iOther):
         m_tasks(std::move(iOther.m_tasks)),
+        m_highPriorityTasks(std::move(iOther.m_highPriorityTasks)),
         m_taskChosen(iOther.m_taskChosen.exchange(false)),
         m_pauseCount(iOther.m_pauseCount.exchange(0))
       {
-        assert(m_tasks.empty() and m_taskChosen == false);
+        assert(m_tasks.empty() and m_highPriorityTasks.empty() and m_taskChosen == false);
       }
       ~SerialTaskQueue();
       
@@ -120,6 +121,16 @@ namespace edm {
        */
       template<typename T>
       void push(const T& iAction);
+
+      /// asynchronously pushes functor iAction into queue ahead of all tasks added with push()
+      /**
+       * Behaves the same as push() except iAction will be run before any waiting task
+       * which was added using push(). Tasks added with pushHighPriority() are run in the
+       * order they were added. A task which is already running is not interrupted.
+       * \param[in] iAction Must be a functor that takes no arguments and return no values.
+       */
+      template<typename T>
+      void pushHighPriority(const T& iAction);
       
       /// synchronously pushes functor iAction into queue
       /**
@@ -176,16 +187,20 @@ namespace edm {
       friend class TaskBase;
       
       void pushTask(TaskBase*);
+      void pushHighPriorityTask(TaskBase*);
       tbb::task* pushAndGetNextTask(TaskBase*);
       tbb::task* finishedTask();
       //returns nullptr if a task is already being processed
       TaskBase* pickNextTask();
+      bool tryToPopTask(TaskBase*&);
+      bool noTasksWaiting() const { return m_tasks.empty() and m_highPriorityTasks.empty(); }
       
       void pushAndWait(tbb::empty_task* iWait,TaskBase*);
       
       
       // ---------- member data --------------------------------
       tbb::concurrent_queue<TaskBase*> m_tasks;
+      tbb::concurrent_queue<TaskBase*> m_highPriorityTasks;
       std::atomic<bool> m_taskChosen;
       std::atomic<unsigned long> m_pauseCount;
    };
@@ -197,6 +212,13 @@ namespace edm {
       pushTask(pTask);
    }
    
+   template<typename T>
+   void SerialTaskQueue::pushHighPriority(const T& iAction) {
+      QueuedTask<T>* pTask{ new (tbb::task::allocate_root()) QueuedTask<T>{iAction} };
+      pTask->setQueue(this);
+      pushHighPriorityTask(pTask);
+   }
+   
    template<typename T>
    void SerialTaskQueue::pushAndWait(const T& iAction) {
       tbb::empty_task* waitTask = new (tbb::task::allocate_root()) tbb::empty_task;
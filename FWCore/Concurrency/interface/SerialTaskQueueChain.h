@@ -59,6 +59,14 @@ namespace edm {
      */
     template<typename T>
     void push(T&& iAction);
+
+    /// asynchronously pushes functor iAction into each queue of the chain ahead of tasks added with push()
+    /**
+     * \sa SerialTaskQueue::pushHighPriority()
+     * \param[in] iAction Must be a functor that takes no arguments and return no values.
+     */
+    template<typename T>
+    void pushHighPriority(T&& iAction);
     
     /// synchronously pushes functor iAction into queue
     /**
@@ -80,7 +88,7 @@ namespace edm {
     std::atomic<unsigned long> m_outstandingTasks{0};
     
     template<typename T>
-    void passDownChain(unsigned int iIndex, T&& iAction);
+    void passDownChain(unsigned int iIndex, T&& iAction, bool iHighPriority = false);
     
     template<typename T>
     void actionToRun(T&& iAction);
@@ -100,6 +108,19 @@ namespace edm {
     }
   }
   
+  template<typename T>
+  void SerialTaskQueueChain::pushHighPriority(T&& iAction) {
+    ++m_outstandingTasks;
+    if(m_queues.size() == 1) {
+      m_queues[0]->pushHighPriority( [this,iAction]() mutable {this->actionToRun(iAction);} );
+    } else {
+      assert(!m_queues.empty());
+      m_queues[0]->pushHighPriority([this, iAction]() mutable {
+        this->passDownChain(1, iAction, true);
+      });
+    }
+  }
+  
   template<typename T>
   void SerialTaskQueueChain::pushAndWait(T&& iAction) {
     auto destry = [](tbb::task* iTask) { tbb::task::destroy(*iTask); };
@@ -129,18 +150,29 @@ namespace edm {
   }
   
   template<typename T>
-  void SerialTaskQueueChain::passDownChain(unsigned int iQueueIndex, T&& iAction) {
+  void SerialTaskQueueChain::passDownChain(unsigned int iQueueIndex, T&& iAction, bool iHighPriority) {
     //Have to be sure the queue associated to this running task
     // does not attempt to start another task
     m_queues[iQueueIndex-1]->pause();
+    auto& queue = *m_queues[iQueueIndex];
     //is this the last queue?
     if(iQueueIndex +1 == m_queues.size()) {
-      m_queues[iQueueIndex]->push([this,iAction]() mutable { this->actionToRun(iAction); });
+      auto f = [this,iAction]() mutable { this->actionToRun(iAction); };
+      if(iHighPriority) {
+        queue.pushHighPriority(f);
+      } else {
+        queue.push(f);
+      }
     } else {
       auto nextQueue = iQueueIndex+1;
-      m_queues[iQueueIndex]->push([this, nextQueue, iAction]() mutable {
-        this->passDownChain(nextQueue, iAction);
-      });
+      auto f = [this, nextQueue, iAction, iHighPriority]() mutable {
+        this->passDownChain(nextQueue, iAction, iHighPriority);
+      };
+      if(iHighPriority) {
+        queue.pushHighPriority(f);
+      } else {
+        queue.push(f);
+      }
     }
   }
   
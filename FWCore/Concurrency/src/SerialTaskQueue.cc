@@ -26,7 +26,7 @@ using namespace edm;
 SerialTaskQueue::~SerialTaskQueue()
 {
   //be certain all tasks have completed
-  bool isEmpty = m_tasks.empty();
+  bool isEmpty = noTasksWaiting();
   bool isTaskChosen = m_taskChosen;
   if ( (not isEmpty and not isPaused()) or isTaskChosen) {
     pushAndWait([]() {return;});
@@ -53,6 +53,15 @@ SerialTaskQueue::pushTask(TaskBase* iTask) {
   }
 }
 
+void
+SerialTaskQueue::pushHighPriorityTask(TaskBase* iTask) {
+  m_highPriorityTasks.push(iTask);
+  tbb::task* t = pickNextTask();
+  if(nullptr!=t) {
+    tbb::task::spawn(*t);
+  }
+}
+
 tbb::task* 
 SerialTaskQueue::pushAndGetNextTask(TaskBase* iTask) {
   tbb::task* returnValue{nullptr};
@@ -70,13 +79,18 @@ SerialTaskQueue::finishedTask() {
   return pickNextTask();
 }
 
+bool
+SerialTaskQueue::tryToPopTask(TaskBase*& oTask) {
+  return m_highPriorityTasks.try_pop(oTask) or m_tasks.try_pop(oTask);
+}
+
 SerialTaskQueue::TaskBase*
 SerialTaskQueue::pickNextTask() {
   
   bool expect = false;
   if LIKELY(0 == m_pauseCount and m_taskChosen.compare_exchange_strong(expect,true)) {
     TaskBase* t=nullptr;
-    if LIKELY(m_tasks.try_pop(t)) {
+    if LIKELY(tryToPopTask(t)) {
       return t;
     }
     //no task was actually pulled
@@ -84,9 +98,9 @@ SerialTaskQueue::pickNextTask() {
     
     //was a new entry added after we called 'try_pop' but before we did the clear?
     expect = false;
-    if(not m_tasks.empty() and m_taskChosen.compare_exchange_strong(expect,true)) {
+    if(not noTasksWaiting() and m_taskChosen.compare_exchange_strong(expect,true)) {
       TaskBase* t=nullptr;
-      if(m_tasks.try_pop(t)) {
+      if(tryToPopTask(t)) {
         return t;
       }
       //no task was still pulled since a different thread beat us to it
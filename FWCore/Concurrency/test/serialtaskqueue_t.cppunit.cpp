@@ -20,6 +20,7 @@ class SerialTaskQueue_test : public CppUnit::TestFixture {
   CPPUNIT_TEST(testPush);
   CPPUNIT_TEST(testPushAndWait);
   CPPUNIT_TEST(testPause);
+  CPPUNIT_TEST(testHighPriority);
   CPPUNIT_TEST(stressTest);
   CPPUNIT_TEST_SUITE_END();
   
@@ -27,6 +28,7 @@ public:
   void testPush();
   void testPushAndWait();
   void testPause();
+  void testHighPriority();
   void stressTest();
   void setUp(){}
   void tearDown(){}
@@ -148,6 +150,38 @@ void SerialTaskQueue_test::testPause()
    
 }
 
+void SerialTaskQueue_test::testHighPriority()
+{
+   std::atomic<unsigned int> count{0};
+   
+   edm::SerialTaskQueue queue;
+   {
+      queue.pause();
+      std::shared_ptr<tbb::task> waitTask{new (tbb::task::allocate_root()) tbb::empty_task{},
+                                          [](tbb::task* iTask){tbb::task::destroy(*iTask);} };
+      waitTask->set_ref_count(1+3);
+      tbb::task* pWaitTask = waitTask.get();
+      
+      queue.push([&count,pWaitTask]{
+         CPPUNIT_ASSERT(count++ == 1);
+         pWaitTask->decrement_ref_count();
+      });
+      queue.push([&count,pWaitTask]{
+         CPPUNIT_ASSERT(count++ == 2);
+         pWaitTask->decrement_ref_count();
+      });
+      queue.pushHighPriority([&count,pWaitTask]{
+         CPPUNIT_ASSERT(count++ == 0);
+         pWaitTask->decrement_ref_count();
+      });
+      usleep(100);
+      CPPUNIT_ASSERT(0==count);
+      queue.resume();
+      waitTask->wait_for_all();
+      CPPUNIT_ASSERT(count==3);
+   }
+}
+
 void SerialTaskQueue_test::stressTest()
 {
    edm::SerialTaskQueue queue;
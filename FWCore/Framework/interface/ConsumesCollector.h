@@ -91,6 +91,11 @@ namespace edm {
     void consumesMany(const TypeToGet& id) {
       m_consumer->consumesMany<B>(id);
     }
+
+    template <typename ProductType, typename RecordType>
+    void esConsumes(std::string const& iLabel = std::string()) {
+      m_consumer->esConsumes<ProductType,RecordType>(iLabel);
+    }
     
 
   private:
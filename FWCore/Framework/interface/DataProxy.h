@@ -23,11 +23,14 @@
 #include <atomic>
 
 // user include files
+#include "FWCore/Concurrency/interface/WaitingTaskList.h"
 #include "FWCore/Utilities/interface/thread_safety_macros.h"
 
 // forward declarations
 namespace edm {
    class ActivityRegistry;
+   class ServiceToken;
+   class WaitingTask;
 
    namespace eventsetup {
       struct ComponentDescription;
@@ -46,6 +49,13 @@ namespace edm {
          void doGet(EventSetupRecordImpl const& iRecord, DataKey const& iKey, bool iTransiently, ActivityRegistry*) const;
          void const* get(EventSetupRecordImpl const&, DataKey const& iKey, bool iTransiently, ActivityRegistry*) const;
 
+         /**Starts building the data in a separate task if it is not already cached. iTask is spawned
+          once the data is available (or the attempt to make it failed). The DataKey must
+          stay valid until the data has been made.
+          */
+         void prefetchAsync(WaitingTask* iTask, EventSetupRecordImpl const&, DataKey const& iKey,
+                            ActivityRegistry*, ServiceToken const&) const;
+
          ///returns the description of the DataProxyProvider which owns this Proxy
          ComponentDescription const* providerDescription() const {
             return description_;
@@ -94,6 +104,8 @@ namespace edm {
          CMS_THREAD_SAFE mutable void const* cache_; //protected by a global mutex
          mutable std::atomic<bool> cacheIsValid_;
          mutable std::atomic<bool> nonTransientAccessRequested_;
+         mutable std::atomic<bool> prefetchRequested_;
+         mutable WaitingTaskList waitingTasks_;
          ComponentDescription const* description_;
       };
    }
@@ -55,6 +55,9 @@ class DependentRecordIntervalFinder : public EventSetupRecordIntervalFinder
       void setIntervalFor(const EventSetupRecordKey&,
                                    const IOVSyncValue& , 
                                    ValidityInterval&) override;
+
+      bool intervalMayChangeFor(const EventSetupRecordKey&,
+                                const IOVSyncValue&) const override;
       
    private:
       DependentRecordIntervalFinder(const DependentRecordIntervalFinder&) = delete; // stop default
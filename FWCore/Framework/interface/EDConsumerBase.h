@@ -21,9 +21,12 @@
 // system include files
 #include <map>
 #include <string>
+#include <utility>
 #include <vector>
 #include <array>
 // user include files
+#include "FWCore/Framework/interface/DataKey.h"
+#include "FWCore/Framework/interface/EventSetupRecordKey.h"
 #include "FWCore/Framework/interface/ProductResolverIndexAndSkipBit.h"
 #include "FWCore/ServiceRegistry/interface/ConsumesInfo.h"
 #include "FWCore/Utilities/interface/TypeID.h"
@@ -70,11 +73,24 @@ namespace edm {
 
     std::vector<ProductResolverIndexAndSkipBit> const& itemsToGetFrom(BranchType iType) const { return itemsToGetFromBranch_[iType]; }
 
+    typedef std::pair<eventsetup::EventSetupRecordKey, eventsetup::DataKey> ESItem;
+    ///\return the EventSetup data registered via esConsumes which the framework will prefetch
+    std::vector<ESItem> const& esItemsToGet() const { return esItemsToGet_; }
+
     ///\return true if the product corresponding to the index was registered via consumes or mayConsume call
     bool registeredToConsume(ProductResolverIndex, bool, BranchType) const;
     
     ///\return true of TypeID corresponds to a type specified in a consumesMany call
     bool registeredToConsumeMany(TypeID const&, BranchType) const;
+
+    ///\return the index found by updateLookup for data registered via consumes or mayConsume with the same
+    /// labels, else ProductResolverIndexInvalid. The process name must already have the current process alias replaced.
+    /// Only reads data filled in by updateLookup so it is safe to call from multiple threads.
+    ProductResolverIndex indexFromLabels(KindOfType, TypeID const&, BranchType,
+                                         char const* iModuleLabel,
+                                         char const* iProductInstance,
+                                         char const* iProcess,
+                                         bool iSkipCurrentProcess) const;
     // ---------- static member functions --------------------
     
     // ---------- member functions ---------------------------
@@ -146,6 +162,15 @@ namespace edm {
       recordConsumes(B,id,edm::InputTag{},true);
     }
 
+    ///declares the EventSetup data gotten by the module so the framework can make it before the module is run
+    template <typename ProductType, typename RecordType>
+    void esConsumes(std::string const& iLabel = std::string()) {
+      esConsumes(eventsetup::EventSetupRecordKey::makeKey<RecordType>(),
+                 eventsetup::DataKey(eventsetup::DataKey::makeTypeTag<ProductType>(), iLabel.c_str()));
+    }
+
+    void esConsumes(eventsetup::EventSetupRecordKey const&, eventsetup::DataKey const&);
+
   private:
     unsigned int recordConsumes(BranchType iBranch, TypeToGet const& iType, edm::InputTag const& iTag, bool iAlwaysGets);
 
@@ -190,6 +215,12 @@ namespace edm {
 
     std::array<std::vector<ProductResolverIndexAndSkipBit>, edm::NumBranchTypes> itemsToGetFromBranch_;
 
+    //entries into m_tokenInfo which were resolved by updateLookup, sorted by type
+    // so requests by labels can be found without using the ProductResolverIndexHelper
+    std::array<std::vector<unsigned int>, edm::NumBranchTypes> resolvedByType_;
+
+    std::vector<ESItem> esItemsToGet_;
+
     bool frozen_;
     bool containsCurrentProcessAlias_;
   };
@@ -60,6 +60,7 @@ namespace edm {
   class TriggerNames;
   class EDConsumerBase;
   class EDProductGetter;
+  class MemoryArena;
   class ProducerBase;
   class SharedResourcesAcquirer;
 
@@ -97,6 +98,10 @@ namespace edm {
       return streamID_;
     }
 
+    ///\return Memory which is released in bulk once the Event has finished being processed.
+    /// Objects using the memory must not outlive the Event, e.g. members of products put into the Event.
+    MemoryArena& memoryArena() const;
+
     LuminosityBlock const&
     getLuminosityBlock() const {
       return *luminosityBlock_;
@@ -0,0 +1,92 @@
+#ifndef FWCore_Framework_EventBatcher_h
+#define FWCore_Framework_EventBatcher_h
+// -*- C++ -*-
+//
+// Package:     FWCore/Framework
+// Class  :     EventBatcher
+//
+/**\class edm::EventBatcher EventBatcher.h "FWCore/Framework/interface/EventBatcher.h"
+
+ Description: Collects Events from different Streams so they can be processed together
+
+ Usage:
+    Used by the edm::BatchedEvents<N> ability of global modules. Each Stream adds itself
+ together with the task to run once the batch has been processed. Once the batch
+ holds the maximum number of Events, the processing function is called by the thread which
+ added the last Event. If the batch is not full within the maximum latency, a separate timer
+ thread enqueues a TBB task which processes the partial batch, so Streams are never left waiting
+ indefinitely. That task runs in the TBB arena and with the ServiceToken of the thread which
+ started the batch, so the processing function always sees the Services of the job.
+
+*/
+//
+
+// system include files
+#include <chrono>
+#include <condition_variable>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+// user include files
+#include "FWCore/Concurrency/interface/WaitingTaskWithArenaHolder.h"
+#include "FWCore/ServiceRegistry/interface/ServiceToken.h"
+#include "FWCore/Utilities/interface/StreamID.h"
+
+namespace tbb {
+  class task_arena;
+}
+
+// forward declarations
+namespace edm {
+
+  class EventBatcher {
+  public:
+    typedef std::function<void(std::vector<StreamID> const&)> Processor;
+
+    EventBatcher(unsigned int iMaxBatchSize, std::chrono::microseconds iMaxLatency, Processor iProcessor);
+    ~EventBatcher();
+
+    EventBatcher(EventBatcher const&) = delete;
+    EventBatcher& operator=(EventBatcher const&) = delete;
+
+    // ---------- const member functions ---------------------
+    unsigned int maxBatchSize() const { return maxBatchSize_; }
+
+    // ---------- member functions ---------------------------
+    ///Should only be called before any Event has been added
+    void setMaxLatency(std::chrono::microseconds iMaxLatency) { maxLatency_ = iMaxLatency; }
+
+    ///iHolder is signaled once the batch containing iID has been processed
+    void add(StreamID iID, WaitingTaskWithArenaHolder iHolder);
+
+  private:
+    struct Waiting {
+      Waiting(StreamID iID, WaitingTaskWithArenaHolder iHolder): stream_(iID), holder_(std::move(iHolder)) {}
+      StreamID stream_;
+      WaitingTaskWithArenaHolder holder_;
+    };
+
+    void process(std::vector<Waiting>& iBatch) const;
+    void flushOnTimeout();
+
+    // ---------- member data --------------------------------
+    unsigned int const maxBatchSize_;
+    std::chrono::microseconds maxLatency_;
+    Processor processor_;
+
+    std::mutex mutex_;
+    std::condition_variable condition_;
+    std::vector<Waiting> waiting_;
+    std::chrono::steady_clock::time_point startOfBatch_;
+    //where a timed out batch is processed, taken from the thread which started the batch
+    std::shared_ptr<tbb::task_arena> arena_;
+    ServiceToken token_;
+    std::thread timer_;
+    bool stop_;
+  };
+}
+
+#endif
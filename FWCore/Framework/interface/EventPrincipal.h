@@ -17,9 +17,11 @@ is the DataBlock.
 #include "DataFormats/Provenance/interface/ProductProvenanceRetriever.h"
 #include "DataFormats/Provenance/interface/EventAuxiliary.h"
 #include "DataFormats/Provenance/interface/EventSelectionID.h"
+#include "FWCore/Utilities/interface/MemoryArena.h"
 #include "FWCore/Utilities/interface/StreamID.h"
 #include "FWCore/Utilities/interface/Signal.h"
 #include "FWCore/Utilities/interface/get_underlying_safe.h"
+#include "FWCore/Utilities/interface/thread_safety_macros.h"
 #include "FWCore/Framework/interface/Principal.h"
 
 #include <map>
@@ -171,6 +173,9 @@ namespace edm {
 
     ProductID branchIDToProductID(BranchID const& bid) const;
 
+    ///Memory which is given back in bulk by clearEventPrincipal, i.e. after all products are deleted
+    MemoryArena& memoryArena() const {return memoryArena_;}
+
     void mergeProvenanceRetrievers(EventPrincipal& other) {
       provRetrieverPtr_->mergeProvenanceRetrievers(other.provRetrieverPtr());
     }
@@ -208,6 +213,8 @@ namespace edm {
     
     StreamID streamID_;
 
+    CMS_THREAD_SAFE mutable MemoryArena memoryArena_;
+
   };
 
   inline
@@ -19,6 +19,7 @@
 #include "DataFormats/Common/interface/TriggerResults.h"
 #include "DataFormats/Provenance/interface/ParameterSetID.h"
 
+#include <cstdint>
 #include <memory>
 
 #include <vector>
@@ -95,6 +96,19 @@ namespace edm
     std::vector<Bits> all_must_fail_;				// change 1
     std::vector<Bits> all_must_fail_noex_;			// change 3
 
+    // The acceptors above compiled to masks with one bit per path, filled with them
+    // by initPathNames, so that the decision only takes a few word operations on the
+    // states of the paths packed to the same layout.
+    typedef std::vector<std::uint64_t> Mask;
+
+    Mask absolute_pass_mask_;
+    Mask absolute_fail_mask_;
+    Mask conditional_pass_mask_;
+    Mask conditional_fail_mask_;
+    Mask exception_mask_;
+    std::vector<Mask> all_must_fail_masks_;
+    std::vector<Mask> all_must_fail_noex_masks_;
+
     ParameterSetID psetID_;
 
     int nPathNames_;
@@ -109,15 +123,14 @@ namespace edm
 
     bool acceptTriggerPath(HLTPathStatus const&, BitInfo const&) const;
 
-    bool acceptOneBit (Bits const & b, 
-    		       HLTGlobalStatus const & tr, 
-    		       hlt::HLTState const & s = hlt::Ready) const;
-    bool acceptAllBits (Bits const & b, 
-    		        HLTGlobalStatus const & tr) const;
+    void initMasks();
 
-    bool containsExceptions(HLTGlobalStatus const & tr) const;
-    
-    bool selectionDecision(HLTGlobalStatus const & tr) const;
+    Mask toMask(Bits const & b, bool accept_state) const;
+
+    bool selectionDecision(std::uint64_t const* pass,
+                           std::uint64_t const* fail,
+                           std::uint64_t const* exception,
+                           bool exceptionPresent) const;
     
     static std::string glob2reg(std::string const& s);
     static std::vector< Strings::const_iterator > 
@@ -39,8 +39,11 @@
 namespace edm {
    class ActivityRegistry;
    class ESInputTag;
+   class ServiceToken;
+   class WaitingTask;
 
    namespace eventsetup {
+      class DataKey;
       class EventSetupProvider;
       class EventSetupRecord;
       class EventSetupRecordImpl;
@@ -124,6 +127,13 @@ namespace edm {
       ///returns true if the Record is provided by a Source or a Producer
       /// a value of true does not mean this EventSetup object holds such a record
       bool recordIsProvidedByAModule( eventsetup::EventSetupRecordKey const& ) const;
+
+      ///used by the framework to start making data before a module asks for it, iTask
+      /// is spawned once the data is available. Nothing is done if the data is unknown.
+      void prefetchAsync(WaitingTask* iTask,
+                         eventsetup::EventSetupRecordKey const&,
+                         eventsetup::DataKey const&,
+                         ServiceToken const&) const;
       // ---------- static member functions --------------------
 
       // ---------- member functions ---------------------------
@@ -74,6 +74,8 @@ namespace edm {
    class ESHandleExceptionFactory;
    class ESInputTag;
    class EventSetup;
+   class ServiceToken;
+   class WaitingTask;
 
    namespace eventsetup {
       struct ComponentDescription;
@@ -94,6 +96,11 @@ namespace edm {
          ///returns false if no data available for key
          bool doGet(DataKey const& aKey, bool aGetTransiently = false) const;
 
+         /**starts making the data for the key, iTask is spawned once the data is available.
+          If no proxy is registered for the key iTask is not used.
+          */
+         void prefetchAsync(WaitingTask* iTask, DataKey const& aKey, ServiceToken const&) const;
+
          /**returns true only if someone has already requested data for this key
           and the data was retrieved
           */
@@ -39,6 +39,13 @@ class EventSetupRecordIntervalFinder
 
       // ---------- const member functions ---------------------
       std::set<eventsetup::EventSetupRecordKey> findingForRecords() const ;
+
+      /**returns false if a call to findIntervalFor with this IOVSyncValue is known to give back
+       the same interval as the last call. This does not modify the finder so it can be used to
+       decide if the EventSetup has to be updated before the update is actually done.
+      */
+      bool needsIntervalUpdateFor(const eventsetup::EventSetupRecordKey&,
+                                  const IOVSyncValue&) const;
    
       const eventsetup::ComponentDescription& descriptionForFinder() const { return description_;}
       // ---------- static member functions --------------------
@@ -64,6 +71,14 @@ class EventSetupRecordIntervalFinder
          }
       
       void findingRecordWithKey(const eventsetup::EventSetupRecordKey&);
+
+      /** called by needsIntervalUpdateFor if the last interval found is not valid for the IOVSyncValue.
+       Override this method if the finder can tell, without doing the search, that the interval will
+       not change (e.g. because it is built from other finders which are all still valid).
+       The default is to assume an update is needed.
+      */
+      virtual bool intervalMayChangeFor(const eventsetup::EventSetupRecordKey&,
+                                        const IOVSyncValue&) const;
       
 private:
       EventSetupRecordIntervalFinder(const EventSetupRecordIntervalFinder&) = delete; // stop default
@@ -65,6 +65,9 @@ class EventSetupRecordProvider {
       
       ///return information on which DataProxyProviders are supplying information
       std::set<ComponentDescription> proxyProviderDescriptions() const;
+
+      ///returns false if calling setValidityIntervalFor with this time is known not to change the validity interval
+      bool needsIntervalUpdateFor(IOVSyncValue const&) const;
   
       // ---------- static member functions --------------------
 
@@ -41,12 +41,13 @@ namespace edm {
       MaxLumisTooSmall = (MaxEventsTooSmall << 1),
       RunNumberModified = (MaxLumisTooSmall << 1),
       DuplicateEventsRemoved = (RunNumberModified << 1),
+      SubBranchesNotRead = (DuplicateEventsRemoved << 1),
 
       // The remainder of these are defined here for convenience,
       // but never set in FileBlock, because they are output module specific.
 
       // For a given output module
-      DisabledInConfigFile = (DuplicateEventsRemoved << 1),
+      DisabledInConfigFile = (SubBranchesNotRead << 1),
       EventSelectionUsed = (DisabledInConfigFile << 1),
 
       // For given input and output files
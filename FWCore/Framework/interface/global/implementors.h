@@ -19,11 +19,14 @@
 //
 
 // system include files
+#include <chrono>
 #include <memory>
 #include <mutex>
+#include <vector>
 
 // user include files
 #include "FWCore/Framework/interface/Frameworkfwd.h"
+#include "FWCore/Framework/interface/EventBatcher.h"
 #include "FWCore/Framework/interface/LuminosityBlock.h"
 #include "FWCore/Utilities/interface/StreamID.h"
 #include "FWCore/Utilities/interface/RunIndex.h"
@@ -322,6 +325,46 @@ namespace edm {
                              WaitingTaskWithArenaHolder) const = 0;
       };
 
+      template <typename T, unsigned int N>
+      class BatchedEvents : public virtual T {
+      public:
+        static constexpr unsigned int kDefaultMaxLatencyInMicroseconds = 1000;
+
+        BatchedEvents(): batcher_(N, std::chrono::microseconds(kDefaultMaxLatencyInMicroseconds),
+                                  [this](std::vector<StreamID> const& iStreams) { this->produceBatch(iStreams); }) {}
+        BatchedEvents(BatchedEvents const&) = delete;
+        BatchedEvents& operator=(BatchedEvents const&) = delete;
+        ~BatchedEvents() noexcept(false) override {};
+
+      protected:
+        ///the longest time an Event waits for the batch to be filled. Must be called from the constructor.
+        void setMaxBatchLatency(std::chrono::microseconds iLatency) { batcher_.setMaxLatency(iLatency); }
+
+      private:
+
+        bool hasAcquire() const override { return true; }
+
+        void doAcquire_(StreamID iID,
+                        Event const& iEvent,
+                        edm::EventSetup const& iES,
+                        WaitingTaskWithArenaHolder& iHolder) final {
+          this->acquireForBatch(iID, iEvent, iES);
+          batcher_.add(iID, iHolder);
+        }
+
+        ///called for each Event, the data needed by produceBatch must be cached by Stream
+        virtual void acquireForBatch(StreamID,
+                                     Event const&,
+                                     edm::EventSetup const&) const = 0;
+
+        ///called once for up to N Events from different Streams. The results must be cached by Stream
+        /// and then put into the Event by the module's produce method. A batch which is not filled within
+        /// the maximum latency is processed by a separate TBB task, not by one of the Streams in the batch.
+        virtual void produceBatch(std::vector<StreamID> const&) const = 0;
+
+        EventBatcher batcher_;
+      };
+
       template <typename T>
       class Accumulator : public virtual T {
       public:
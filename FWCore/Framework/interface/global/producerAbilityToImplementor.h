@@ -86,6 +86,11 @@ namespace edm {
         typedef edm::global::impl::Accumulator<edm::global::EDProducerBase> Type;
       };
 
+      template<unsigned int N>
+      struct AbilityToImplementor<edm::BatchedEvents<N>> {
+        typedef edm::global::impl::BatchedEvents<edm::global::EDProducerBase,N> Type;
+      };
+
       template<bool,bool,typename T> struct SpecializeAbilityToImplementor {
         typedef typename AbilityToImplementor<T>::Type Type;
       };
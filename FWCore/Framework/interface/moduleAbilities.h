@@ -103,6 +103,14 @@ namespace edm {
     typedef module::Empty Type;
   };
 
+  template <unsigned int N>
+  struct BatchedEvents {
+    static_assert(N > 0, "BatchedEvents requires a batch size of at least 1");
+    static constexpr module::Abilities kAbilities=module::Abilities::kBatchedEvents;
+    static constexpr unsigned int kBatchSize = N;
+    typedef module::Empty Type;
+  };
+
   //Recursively checks VArgs template arguments looking for the ABILITY
   template<module::Abilities ABILITY, typename... VArgs> struct CheckAbility;
 
@@ -43,7 +43,8 @@ namespace edm {
       kOneWatchLuminosityBlocks,
       kWatchInputFiles,
       kExternalWork,
-      kAccumulator
+      kAccumulator,
+      kBatchedEvents
     };
     
     namespace AbilityBits {
@@ -18,7 +18,9 @@
 #include "FWCore/Framework/interface/ComponentDescription.h"
 #include "FWCore/Framework/interface/MakeDataException.h"
 #include "FWCore/Framework/interface/EventSetupRecord.h"
+#include "FWCore/Concurrency/interface/SerialTaskQueue.h"
 #include "FWCore/ServiceRegistry/interface/ActivityRegistry.h"
+#include "FWCore/ServiceRegistry/interface/ServiceRegistry.h"
 
 //
 // constants, enums and typedefs
@@ -26,6 +28,9 @@
 namespace edm {
    namespace eventsetup {
      static std::recursive_mutex s_esGlobalMutex;
+     //Prefetching goes through a queue so that at most one thread is blocked
+     // waiting for s_esGlobalMutex because of prefetching
+     static SerialTaskQueue s_esPrefetchQueue;
 //
 // static data member definitions
 //
@@ -43,6 +48,7 @@ DataProxy::DataProxy() :
    cache_(nullptr),
    cacheIsValid_(false),
    nonTransientAccessRequested_(false),
+   prefetchRequested_(false),
    description_(dummyDescription())
 {
 }
@@ -75,6 +81,9 @@ void DataProxy::clearCacheIsValid() {
    cacheIsValid_.store(false, std::memory_order_release);
    nonTransientAccessRequested_.store(false, std::memory_order_release);
    cache_ = nullptr;
+   //the framework guarantees no prefetching is going on when the cache is cleared
+   prefetchRequested_.store(false, std::memory_order_release);
+   waitingTasks_.reset();
 }
       
 void 
@@ -156,6 +165,30 @@ DataProxy::get(const EventSetupRecordImpl& iRecord, const DataKey& iKey, bool iT
    return cache_;
 }
 
+void
+DataProxy::prefetchAsync(WaitingTask* iTask, EventSetupRecordImpl const& iRecord, DataKey const& iKey,
+                         ActivityRegistry* activityRegistry, ServiceToken const& iToken) const
+{
+   if(cacheIsValid()) {
+      return;
+   }
+   waitingTasks_.add(iTask);
+   bool expected = false;
+   if(prefetchRequested_.compare_exchange_strong(expected, true)) {
+      s_esPrefetchQueue.push([this, &iRecord, &iKey, activityRegistry, iToken]() {
+         ServiceRegistry::Operate guard(iToken);
+         std::exception_ptr exceptPtr;
+         try {
+            //a transient request so the prefetch alone does not make the data live for the full IOV
+            get(iRecord, iKey, true, activityRegistry);
+         } catch(...) {
+            exceptPtr = std::current_exception();
+         }
+         waitingTasks_.doneWaiting(exceptPtr);
+      });
+   }
+}
+
 void DataProxy::doGet(const EventSetupRecordImpl& iRecord, const DataKey& iKey, bool iTransiently, ActivityRegistry* activityRegistry) const {
    get(iRecord, iKey, iTransiently, activityRegistry);
 }
@@ -204,6 +204,24 @@ DependentRecordIntervalFinder::setIntervalFor(const EventSetupRecordKey& iKey,
 //
 // const member functions
 //
+bool
+DependentRecordIntervalFinder::intervalMayChangeFor(const EventSetupRecordKey& iKey,
+                                                    const IOVSyncValue& iTime) const
+{
+   //The interval is built only from the intervals of the records we depend on (and the
+   // alternate finder) so if none of those need to be updated our interval cannot change.
+   // This happens often when time based and run/lumi/event based records are mixed since
+   // then our interval is open ended even though all the dependent intervals are known.
+   if(alternate_.get() != nullptr && alternate_->needsIntervalUpdateFor(iKey, iTime)) {
+      return true;
+   }
+   for(auto const& provider : providers_) {
+      if(provider->needsIntervalUpdateFor(iTime)) {
+         return true;
+      }
+   }
+   return false;
+}
 
 //
 // static member functions
@@ -191,6 +191,23 @@ EDConsumerBase::updateLookup(BranchType iBranchType,
   }
   m_tokenInfo.shrink_to_fit();
 
+  {
+    auto& resolved = resolvedByType_[iBranchType];
+    resolved.clear();
+    for(unsigned int i=0, iEnd = m_tokenInfo.size(); i!=iEnd; ++i) {
+      auto const& info = m_tokenInfo.get<kLookupInfo>(i);
+      if(info.m_branchType == iBranchType and
+         info.m_index.productResolverIndex() < ProductResolverIndexAmbiguous and
+         m_tokenLabels[m_tokenInfo.get<kLabels>(i).m_startOfModuleLabel] != '\0') {
+        resolved.push_back(i);
+      }
+    }
+    std::sort(resolved.begin(),resolved.end(), [this](unsigned int iLHS, unsigned int iRHS) {
+      return m_tokenInfo.get<kLookupInfo>(iLHS).m_type < m_tokenInfo.get<kLookupInfo>(iRHS).m_type;
+    });
+    resolved.shrink_to_fit();
+  }
+
   itemsToGet(iBranchType, itemsToGetFromBranch_[iBranchType]);
   if(iPrefetchMayGet) {
     itemsMayGet(iBranchType, itemsToGetFromBranch_[iBranchType]);
@@ -323,6 +340,38 @@ EDConsumerBase::registeredToConsume(ProductResolverIndex iIndex, bool skipCurren
   return false;
 }
 
+ProductResolverIndex
+EDConsumerBase::indexFromLabels(KindOfType iKind, TypeID const& iType, BranchType iBranch,
+                                char const* iModuleLabel,
+                                char const* iProductInstance,
+                                char const* iProcess,
+                                bool iSkipCurrentProcess) const
+{
+  auto const& resolved = resolvedByType_[iBranch];
+  auto itFound = std::lower_bound(resolved.begin(), resolved.end(), iType,
+                                  [this](unsigned int iIndex, TypeID const& iValue) {
+                                    return m_tokenInfo.get<kLookupInfo>(iIndex).m_type < iValue;
+                                  });
+  for(auto itEnd = resolved.end(); itFound != itEnd; ++itFound) {
+    auto const& info = m_tokenInfo.get<kLookupInfo>(*itFound);
+    if(info.m_type != iType) {
+      break;
+    }
+    if(m_tokenInfo.get<kKind>(*itFound) != iKind or
+       info.m_index.skipCurrentProcess() != iSkipCurrentProcess) {
+      continue;
+    }
+    auto const& labels = m_tokenInfo.get<kLabels>(*itFound);
+    char const* moduleLabel = &(m_tokenLabels[labels.m_startOfModuleLabel]);
+    if(0 == std::strcmp(moduleLabel, iModuleLabel) and
+       0 == std::strcmp(moduleLabel+labels.m_deltaToProductInstance, iProductInstance) and
+       0 == std::strcmp(moduleLabel+labels.m_deltaToProcessName, iProcess)) {
+      return info.m_index.productResolverIndex();
+    }
+  }
+  return ProductResolverIndexInvalid;
+}
+
 bool
 EDConsumerBase::registeredToConsumeMany(TypeID const& iType, BranchType iBranch) const
 {
@@ -360,6 +409,17 @@ EDConsumerBase::throwBadToken(edm::TypeID const& iType, EDGetToken iToken) const
   throw cms::Exception("BadToken")<<"A get using a EDGetToken with the C++ type '"<<iType.className()<<"' was made using a token with a value "<<iToken.index()<<" which is beyond the range used by this module.\n Please check that the variable is being initialized from a 'consumes' call from this module.\n You can not share EDGetToken values between modules.";
 }
 
+void
+EDConsumerBase::esConsumes(eventsetup::EventSetupRecordKey const& iRecord, eventsetup::DataKey const& iKey) {
+  if(frozen_) {
+    throw cms::Exception("LogicError") << "A module declared it consumes EventSetup data after its constructor.\n"
+                                       << "This must be done in the contructor\n"
+                                       << "The data type was: " << iKey.type().name()
+                                       << " with label '" << iKey.name().value() << "' from record " << iRecord.name() << "\n";
+  }
+  esItemsToGet_.emplace_back(iRecord, iKey);
+}
+
 void
 EDConsumerBase::throwConsumesCallAfterFrozen(TypeToGet const& typeToGet, InputTag const& inputTag) const {
   throw cms::Exception("LogicError") << "A module declared it consumes a product after its constructor.\n"
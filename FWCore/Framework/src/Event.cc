@@ -100,6 +100,11 @@ namespace edm {
     return dynamic_cast<EventPrincipal const&>(provRecorder_.principal());
   }
 
+  MemoryArena&
+  Event::memoryArena() const {
+    return eventPrincipal().memoryArena();
+  }
+
   EDProductGetter const&
   Event::productGetter() const {
     return provRecorder_.principal();
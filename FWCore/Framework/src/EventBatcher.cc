@@ -0,0 +1,114 @@
+// -*- C++ -*-
+//
+// Package:     FWCore/Framework
+// Class  :     EventBatcher
+//
+// Implementation:
+//     [Notes on implementation]
+//
+
+// system include files
+#include <exception>
+
+#include "tbb/task_arena.h"
+
+// user include files
+#include "FWCore/Framework/interface/EventBatcher.h"
+#include "FWCore/ServiceRegistry/interface/ServiceRegistry.h"
+
+namespace edm {
+
+  EventBatcher::EventBatcher(unsigned int iMaxBatchSize, std::chrono::microseconds iMaxLatency, Processor iProcessor):
+    maxBatchSize_(iMaxBatchSize),
+    maxLatency_(iMaxLatency),
+    processor_(std::move(iProcessor)),
+    stop_(false)
+  {
+    waiting_.reserve(maxBatchSize_);
+  }
+
+  EventBatcher::~EventBatcher() {
+    {
+      std::lock_guard<std::mutex> guard(mutex_);
+      stop_ = true;
+    }
+    condition_.notify_one();
+    if(timer_.joinable()) {
+      timer_.join();
+    }
+  }
+
+  void
+  EventBatcher::add(StreamID iID, WaitingTaskWithArenaHolder iHolder) {
+    std::vector<Waiting> toProcess;
+    {
+      std::lock_guard<std::mutex> guard(mutex_);
+      if(not timer_.joinable()) {
+        //only start the thread once it is known the module is actually used
+        timer_ = std::thread([this]() { flushOnTimeout(); });
+      }
+      if(waiting_.empty()) {
+        startOfBatch_ = std::chrono::steady_clock::now();
+        arena_ = std::make_shared<tbb::task_arena>(tbb::task_arena::attach());
+        token_ = ServiceRegistry::instance().presentToken();
+        condition_.notify_one();
+      }
+      waiting_.emplace_back(iID, std::move(iHolder));
+      if(waiting_.size() >= maxBatchSize_) {
+        toProcess.reserve(maxBatchSize_);
+        toProcess.swap(waiting_);
+      }
+    }
+    if(not toProcess.empty()) {
+      process(toProcess);
+    }
+  }
+
+  void
+  EventBatcher::process(std::vector<Waiting>& iBatch) const {
+    std::vector<StreamID> streams;
+    streams.reserve(iBatch.size());
+    for(auto const& w : iBatch) {
+      streams.push_back(w.stream_);
+    }
+    std::exception_ptr exceptPtr;
+    try {
+      processor_(streams);
+    } catch(...) {
+      exceptPtr = std::current_exception();
+    }
+    for(auto& w : iBatch) {
+      w.holder_.doneWaiting(exceptPtr);
+    }
+  }
+
+  void
+  EventBatcher::flushOnTimeout() {
+    std::unique_lock<std::mutex> lock(mutex_);
+    while(not stop_) {
+      if(waiting_.empty()) {
+        condition_.wait(lock);
+        continue;
+      }
+      auto const deadline = startOfBatch_ + maxLatency_;
+      if(std::chrono::steady_clock::now() < deadline) {
+        //the batch may have been processed and a new one started while we were waiting
+        condition_.wait_until(lock, deadline);
+        continue;
+      }
+      //module code must not run on this non-TBB thread, which has no Services,
+      // so the partial batch is handed to a task, as doneWaiting does for ExternalWork
+      auto toProcess = std::make_shared<std::vector<Waiting>>();
+      toProcess->reserve(maxBatchSize_);
+      toProcess->swap(waiting_);
+      auto arena = std::move(arena_);
+      auto token = token_;
+      lock.unlock();
+      arena->enqueue([this, toProcess, token]() {
+        ServiceRegistry::Operate guard(token);
+        process(*toProcess);
+      });
+      lock.lock();
+    }
+  }
+}
@@ -56,6 +56,8 @@ namespace edm {
     // it is only connected at beginLumi transition
     provRetrieverPtr_->reset();
     branchListIndexToProcessIndex_.clear();
+    //all products have been deleted so nothing can still be using the memory
+    memoryArena_.releaseAll();
   }
 
   void
@@ -420,9 +420,6 @@ namespace edm {
     if (nStreams == 0) {
       nStreams = nThreads;
     }
-    if (nThreads > 1 or nStreams > 1) {
-      edm::LogInfo("ThreadStreamSetup") <<"setting # threads "<<nThreads<<"\nsetting # streams "<<nStreams;
-    }
     unsigned int nConcurrentRuns = optionsPset.getUntrackedParameter<unsigned int>("numberOfConcurrentRuns");
     if (nConcurrentRuns != 1) {
       throw Exception(errors::Configuration, "Illegal value nConcurrentRuns : ")
@@ -441,10 +438,17 @@ namespace edm {
       if(nConcurrentRuns>nStreams) {
       //bad
       }
-      if(nConcurrentRuns>nConcurrentLumis) {
-      //bad
-      }
     */
+    //Each stream processes only one luminosity block at a time so having more
+    // concurrent luminosity blocks than streams would only allocate
+    // LuminosityBlockPrincipals which can never be used
+    if(nConcurrentLumis > nStreams) {
+      nConcurrentLumis = nStreams;
+    }
+    if (nThreads > 1 or nStreams > 1) {
+      edm::LogInfo("ThreadStreamSetup") <<"setting # threads "<<nThreads<<"\nsetting # streams "<<nStreams
+                                        <<"\nsetting # concurrent luminosity blocks "<<nConcurrentLumis;
+    }
     IllegalParameters::setThrowAnException(optionsPset.getUntrackedParameter<bool>("throwIfIllegalParameter"));
 
     printDependencies_ =  optionsPset.getUntrackedParameter<bool>("printDependencies");
@@ -58,6 +58,13 @@ namespace edm
     exception_acceptors_(),
     all_must_fail_(),
     all_must_fail_noex_(),
+    absolute_pass_mask_(),
+    absolute_fail_mask_(),
+    conditional_pass_mask_(),
+    conditional_fail_mask_(),
+    exception_mask_(),
+    all_must_fail_masks_(),
+    all_must_fail_noex_masks_(),
     psetID_(),
     nPathNames_(0)
   {
@@ -73,6 +80,13 @@ namespace edm
     exception_acceptors_(),
     all_must_fail_(),
     all_must_fail_noex_(),
+    absolute_pass_mask_(),
+    absolute_fail_mask_(),
+    conditional_pass_mask_(),
+    conditional_fail_mask_(),
+    exception_mask_(),
+    all_must_fail_masks_(),
+    all_must_fail_noex_masks_(),
     psetID_(),
     nPathNames_(0)
   {
@@ -87,6 +101,13 @@ namespace edm
     exception_acceptors_(),
     all_must_fail_(),
     all_must_fail_noex_(),
+    absolute_pass_mask_(),
+    absolute_fail_mask_(),
+    conditional_pass_mask_(),
+    conditional_fail_mask_(),
+    exception_mask_(),
+    all_must_fail_masks_(),
+    all_must_fail_noex_masks_(),
     psetID_(),
     nPathNames_(0)
   {
@@ -259,10 +280,76 @@ namespace edm
       }
     } // end of the for loop on pathspecs
 
+    initMasks();
+
     // std::cerr << "### init exited\n";
 
   } // EventSelector::init
 
+  namespace {
+    // number of 64 bit words of the masks over n paths
+    inline unsigned int maskWords(unsigned int n) { return (n + 63) / 64; }
+
+    // masks of up to this number of words are packed on the stack
+    constexpr unsigned int kLocalMaskWords = 16;
+
+    // set the bit of path i in the mask of its state
+    inline void packState(hlt::HLTState state, unsigned int i,
+                          std::uint64_t* pass, std::uint64_t* fail, std::uint64_t* exception)
+    {
+      std::uint64_t const bit = std::uint64_t(1) << (i % 64);
+      if (state == hlt::Pass) pass[i / 64] |= bit;
+      else if (state == hlt::Fail) fail[i / 64] |= bit;
+      else if (state == hlt::Exception) exception[i / 64] |= bit;
+    }
+
+    inline bool anyOf(std::uint64_t const* states, std::vector<std::uint64_t> const& mask)
+    {
+      std::uint64_t any = 0;
+      for (unsigned int w = 0; w != mask.size(); ++w) any |= states[w] & mask[w];
+      return any != 0;
+    }
+
+    inline bool allOf(std::uint64_t const* states, std::vector<std::uint64_t> const& mask)
+    {
+      for (unsigned int w = 0; w != mask.size(); ++w) {
+        if ((states[w] & mask[w]) != mask[w]) return false;
+      }
+      return true;
+    }
+  }
+
+  EventSelector::Mask
+  EventSelector::toMask(Bits const& b, bool accept_state) const
+  {
+    Mask mask(maskWords(nPathNames_), 0);
+    for (auto const& bit : b) {
+      if (bit.accept_state_ == accept_state) {
+        mask[bit.pos_ / 64] |= std::uint64_t(1) << (bit.pos_ % 64);
+      }
+    }
+    return mask;
+  }
+
+  void
+  EventSelector::initMasks()
+  {
+    absolute_pass_mask_    = toMask(absolute_acceptors_, true);
+    absolute_fail_mask_    = toMask(absolute_acceptors_, false);
+    conditional_pass_mask_ = toMask(conditional_acceptors_, true);
+    conditional_fail_mask_ = toMask(conditional_acceptors_, false);
+    // the accept state is not used for the exception acceptors, they are all true
+    exception_mask_        = toMask(exception_acceptors_, true);
+    all_must_fail_masks_.clear();
+    for (auto const& b : all_must_fail_) {
+      all_must_fail_masks_.push_back(toMask(b, false));
+    }
+    all_must_fail_noex_masks_.clear();
+    for (auto const& b : all_must_fail_noex_) {
+      all_must_fail_noex_masks_.push_back(toMask(b, false));
+    }
+  }
+
   bool EventSelector::acceptEvent(TriggerResults const& tr) {
     if (accept_all_) return true;
 
@@ -295,9 +382,29 @@ namespace edm
     }
 
     // Now make the decision, based on the supplied TriggerResults tr,
-    // which of course can be treated as an HLTGlobalStatus by inheritance
+    // with the states of its paths packed as the masks
+
+    unsigned int const nWords = maskWords(nPathNames_);
+    std::uint64_t localStates[3 * kLocalMaskWords] = {};
+    std::vector<std::uint64_t> heapStates;
+    std::uint64_t* states = localStates;
+    if (nWords > kLocalMaskWords) {
+      heapStates.resize(3 * nWords, 0);
+      states = heapStates.data();
+    }
+    std::uint64_t* pass = states;
+    std::uint64_t* fail = states + nWords;
+    std::uint64_t* exception = states + 2 * nWords;
+
+    bool exceptionPresent = false;
+    unsigned int const n = tr.size();
+    for (unsigned int i = 0; i != n; ++i) {
+      hlt::HLTState const state = tr[i].state();
+      if (state == hlt::Exception) exceptionPresent = true;
+      if (i < static_cast<unsigned int>(nPathNames_)) packState(state, i, pass, fail, exception);
+    }
 
-    return selectionDecision(tr);
+    return selectionDecision(pass, fail, exception, exceptionPresent);
 
   } // acceptEvent(TriggerResults const& tr)
 
@@ -318,16 +425,30 @@ namespace edm
 
     if (accept_all_) return true;
 
-    // Form HLTGlobalStatus object to represent the array_of_trigger_results
-    HLTGlobalStatus tr(number_of_trigger_paths);
+    // Pack the states of the array_of_trigger_results as the masks
+    unsigned int const nWords = maskWords(nPathNames_);
+    std::uint64_t localStates[3 * kLocalMaskWords] = {};
+    std::vector<std::uint64_t> heapStates;
+    std::uint64_t* states = localStates;
+    if (nWords > kLocalMaskWords) {
+      heapStates.resize(3 * nWords, 0);
+      states = heapStates.data();
+    }
+    std::uint64_t* pass = states;
+    std::uint64_t* fail = states + nWords;
+    std::uint64_t* exception = states + 2 * nWords;
+
+    bool exceptionPresent = false;
     int byteIndex = 0;
     int subIndex  = 0;
     for (int pathIndex = 0; pathIndex < number_of_trigger_paths; ++pathIndex)
     {
       int state = array_of_trigger_results[byteIndex] >> (subIndex * 2);
       state &= 0x3;
-      HLTPathStatus pathStatus(static_cast<hlt::HLTState>(state));
-      tr[pathIndex] = pathStatus;
+      if (state == hlt::Exception) exceptionPresent = true;
+      if (pathIndex < nPathNames_) {
+        packState(static_cast<hlt::HLTState>(state), pathIndex, pass, fail, exception);
+      }
       ++subIndex;
       if (subIndex == 4) {
         ++byteIndex;
@@ -335,39 +456,34 @@ namespace edm
       }
     }
 
-    // Now make the decision, based on the HLTGlobalStatus tr,
-    // which we have created from the supplied array of results
+    // Now make the decision, based on the states we have packed
+    // from the supplied array of results
 
-    return selectionDecision(tr);
+    return selectionDecision(pass, fail, exception, exceptionPresent);
 
   } // acceptEvent(array_of_trigger_results, number_of_trigger_paths)
 
   bool
-  EventSelector::selectionDecision(HLTGlobalStatus const& tr) const
+  EventSelector::selectionDecision(std::uint64_t const* pass,
+                                   std::uint64_t const* fail,
+                                   std::uint64_t const* exception,
+                                   bool exceptionPresent) const
   {
     if (accept_all_) return true;
 
-    bool exceptionPresent = false;
-    bool exceptionsLookedFor = false;
-
-    if (acceptOneBit(absolute_acceptors_, tr)) return true;
-    if (acceptOneBit(conditional_acceptors_, tr)) {
-      exceptionPresent = containsExceptions(tr);
+    if (anyOf(pass, absolute_pass_mask_) || anyOf(fail, absolute_fail_mask_)) return true;
+    if (anyOf(pass, conditional_pass_mask_) || anyOf(fail, conditional_fail_mask_)) {
       if (!exceptionPresent) return true;
-      exceptionsLookedFor = true;
     }
-    if (acceptOneBit(exception_acceptors_, tr, hlt::Exception)) return true;
+    if (anyOf(exception, exception_mask_)) return true;
 
-    for (auto const& bit : all_must_fail_)
+    for (auto const& mask : all_must_fail_masks_)
     {
-      if (acceptAllBits(bit, tr)) return true;
+      if (allOf(fail, mask)) return true;
     }
-    for (auto const& bitn : all_must_fail_noex_)
+    for (auto const& mask : all_must_fail_noex_masks_)
     {
-      if (acceptAllBits(bitn, tr)) {
-        if (!exceptionsLookedFor) exceptionPresent = containsExceptions(tr);
-        return (!exceptionPresent);
-      }
+      if (allOf(fail, mask)) return (!exceptionPresent);
     }
 
     // If we have not accepted based on any of the acceptors, nor on any one of
@@ -386,37 +502,6 @@ namespace edm
             ((pathStatus.state()==hlt::Exception)));
   }
 
-  // Indicate if any bit in the trigger results matches the desired value
-  // at that position, based on the Bits array.  If s is Exception, this
-  // looks for a Exceptionmatch; otherwise, true-->Pass, false-->Fail.
-  bool
-  EventSelector::acceptOneBit(Bits const& b,
-    		       	       HLTGlobalStatus const& tr,
-    		               hlt::HLTState const& s) const
-  {
-    bool lookForException = (s == hlt::Exception);
-    for(auto const& bit : b) {
-      hlt::HLTState bstate =
-          lookForException ? hlt::Exception
-      			   : bit.accept_state_ ? hlt::Pass
-				               : hlt::Fail;
-      if (tr[bit.pos_].state() == bstate) return true;
-    }
-    return false;
-  } // acceptOneBit			
-
-  // Indicate if *every* bit in the trigger results matches the desired value
-  // at that position, based on the Bits array: true-->Pass, false-->Fail.
-  bool
-  EventSelector::acceptAllBits(Bits const& b,
-    		        	HLTGlobalStatus const& tr) const
-  {
-    for(auto const& bit : b) {
-      hlt::HLTState bstate = bit.accept_state_ ? hlt::Pass : hlt::Fail;
-      if (tr[bit.pos_].state() != bstate) return false;
-    }
-    return true;
-  } // acceptAllBits			
 
   /**
    * Tests if the specified trigger selection list (pathspecs) is valid
@@ -934,15 +1019,6 @@ namespace edm
     return selection;
   }
 
-  bool EventSelector::containsExceptions(HLTGlobalStatus const& tr) const
-  {
-    unsigned int e = tr.size();
-    for (unsigned int i = 0; i < e; ++i) {
-      if (tr[i].state() == hlt::Exception) return true;
-    }
-    return false;
-  }
-
   // The following routines are helpers for testSelectionOverlap
 
   bool
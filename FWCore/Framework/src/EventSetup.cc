@@ -17,6 +17,7 @@
 // user include files
 #include "FWCore/Framework/interface/EventSetup.h"
 #include "FWCore/Framework/interface/EventSetupRecord.h"
+#include "FWCore/Framework/interface/EventSetupRecordImpl.h"
 #include "FWCore/Framework/interface/EventSetupKnownRecordsSupplier.h"
 
 namespace edm {
@@ -123,6 +124,18 @@ EventSetup::recordIsProvidedByAModule( eventsetup::EventSetupRecordKey const& iK
   return knownRecords_->isKnown(iKey);
 }
 
+void
+EventSetup::prefetchAsync(WaitingTask* iTask,
+                          eventsetup::EventSetupRecordKey const& iRecordKey,
+                          eventsetup::DataKey const& iDataKey,
+                          ServiceToken const& iToken) const
+{
+  auto const record = findImpl(iRecordKey);
+  if(nullptr != record) {
+    record->prefetchAsync(iTask, iDataKey, iToken);
+  }
+}
+
 //
 // static member functions
 //
@@ -793,7 +793,7 @@ EventSetupProvider::isWithinValidityInterval(IOVSyncValue const& iSync) const {
   for( auto const& provider: providers_) {
     auto const& iov =provider.second->validityInterval();
     if( (iov != ValidityInterval::invalidInterval()) and
-        (not provider.second->validityInterval().validFor(iSync)) ) {
+        provider.second->needsIntervalUpdateFor(iSync) ) {
       return false;
     }
   }
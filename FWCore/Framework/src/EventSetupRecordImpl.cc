@@ -205,6 +205,15 @@ EventSetupRecordImpl::doGet(const DataKey& aKey, bool aGetTransiently) const {
    return nullptr != proxy;
 }
 
+void
+EventSetupRecordImpl::prefetchAsync(WaitingTask* iTask, const DataKey& aKey, ServiceToken const& iToken) const {
+   Proxies::const_iterator entry(proxies_.find(aKey)) ;
+   if (entry != proxies_.end()) {
+      //use the key held by the record since it lives as long as the proxy is registered
+      entry->second->prefetchAsync(iTask, *this, entry->first, eventSetup_->activityRegistry(), iToken);
+   }
+}
+
 bool 
 EventSetupRecordImpl::wasGotten(const DataKey& aKey) const {
    const DataProxy* proxy = find(aKey);
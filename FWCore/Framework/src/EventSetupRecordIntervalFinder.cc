@@ -78,9 +78,28 @@ EventSetupRecordIntervalFinder::delaySettingRecords()
 {
 }
 
+bool
+EventSetupRecordIntervalFinder::intervalMayChangeFor(const EventSetupRecordKey&,
+                                                     const IOVSyncValue&) const
+{
+   return true;
+}
+
 //
 // const member functions
 //
+bool
+EventSetupRecordIntervalFinder::needsIntervalUpdateFor(const EventSetupRecordKey& iKey,
+                                                       const IOVSyncValue& iInstance) const
+{
+   Intervals::const_iterator itFound = intervals_.find(iKey);
+   assert(itFound != intervals_.end()) ;
+   if(itFound->second.validFor(iInstance)) {
+      return false;
+   }
+   return intervalMayChangeFor(iKey, iInstance);
+}
+
 std::set<EventSetupRecordKey> 
 EventSetupRecordIntervalFinder::findingForRecords() const
 {
@@ -271,6 +271,18 @@ EventSetupRecordProvider::dependentRecords() const
   return dependencies(key());
 }
 
+bool
+EventSetupRecordProvider::needsIntervalUpdateFor(const IOVSyncValue& iTime) const
+{
+   if(validityInterval_.validFor(iTime)) {
+      return false;
+   }
+   if(nullptr == finder_.get()) {
+      return true;
+   }
+   return finder_->needsIntervalUpdateFor(key_, iTime);
+}
+
 std::set<ComponentDescription> 
 EventSetupRecordProvider::proxyProviderDescriptions() const
 {
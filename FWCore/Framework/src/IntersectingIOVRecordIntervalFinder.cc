@@ -109,6 +109,17 @@ IntersectingIOVRecordIntervalFinder::setIntervalFor(const EventSetupRecordKey& i
 //
 // const member functions
 //
+bool
+IntersectingIOVRecordIntervalFinder::intervalMayChangeFor(const EventSetupRecordKey& iKey,
+                                                          const IOVSyncValue& iTime) const
+{
+   for(auto const& finder : finders_) {
+      if(finder->needsIntervalUpdateFor(iKey, iTime)) {
+         return true;
+      }
+   }
+   return false;
+}
 
 //
 // static member functions
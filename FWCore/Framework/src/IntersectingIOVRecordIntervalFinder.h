@@ -46,6 +46,9 @@ namespace edm {
          void setIntervalFor(const EventSetupRecordKey&,
                                      const IOVSyncValue& , 
                                      ValidityInterval&) override;
+
+         bool intervalMayChangeFor(const EventSetupRecordKey&,
+                                   const IOVSyncValue&) const override;
          
       private:
          IntersectingIOVRecordIntervalFinder(const IntersectingIOVRecordIntervalFinder&) = delete; // stop default
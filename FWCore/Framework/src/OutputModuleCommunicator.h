@@ -44,6 +44,9 @@ namespace edm {
     virtual ~OutputModuleCommunicator();
     
     virtual void closeFile() = 0;
+
+    ///Closes the file using the module's own queue so that different OutputModules can close their files concurrently
+    virtual void closeFileAsync(WaitingTaskHolder iTask) = 0;
     
     ///\return true if output module wishes to close its file
     virtual bool shouldWeCloseFile() const = 0;
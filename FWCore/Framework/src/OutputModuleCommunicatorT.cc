@@ -53,6 +53,23 @@ namespace edm {
     module().doCloseFile();
   }
 
+  template<typename T>
+  void
+  OutputModuleCommunicatorT<T>::closeFileAsync(WaitingTaskHolder iTask) {
+    auto token = ServiceRegistry::instance().presentToken();
+    auto t = [&mod = module(), token, iTask]() mutable {
+      std::exception_ptr ex;
+      try {
+        ServiceRegistry::Operate op(token);
+        mod.doCloseFile();
+      } catch(...) {
+        ex = std::current_exception();
+      }
+      iTask.doneWaiting(ex);
+    };
+    async(module(), std::move(t));
+  }
+
   template<typename T>
   bool
   OutputModuleCommunicatorT<T>::shouldWeCloseFile() const {
@@ -36,6 +36,8 @@ namespace edm {
     OutputModuleCommunicatorT(T* iModule):
     module_(iModule){}
     void closeFile() override;
+
+    void closeFileAsync(WaitingTaskHolder iTask) override;
     
     ///\return true if output module wishes to close its file
     bool shouldWeCloseFile() const override;
@@ -707,6 +707,8 @@ namespace edm {
 
     ProductResolverIndex index = inputTag.indexFor(typeID, branchType(), &productRegistry());
 
+    //an index found from the labels the consumer registered is known to be consumed
+    bool checkConsumes = true;
     if (index == ProductResolverIndexInvalid) {
 
       char const* processName = inputTag.process().c_str();
@@ -716,11 +718,23 @@ namespace edm {
         processName = processConfiguration_->processName().c_str();
       }
 
-      index = productLookup().index(kindOfType,
-                                    typeID,
-                                    inputTag.label().c_str(),
-                                    inputTag.instance().c_str(),
-                                    processName);
+      if(consumer) {
+        index = consumer->indexFromLabels(kindOfType,
+                                          typeID,
+                                          branchType(),
+                                          inputTag.label().c_str(),
+                                          inputTag.instance().c_str(),
+                                          processName,
+                                          skipCurrentProcess);
+        checkConsumes = (index == ProductResolverIndexInvalid);
+      }
+      if(index == ProductResolverIndexInvalid) {
+        index = productLookup().index(kindOfType,
+                                      typeID,
+                                      inputTag.label().c_str(),
+                                      inputTag.instance().c_str(),
+                                      processName);
+      }
 
       if(index == ProductResolverIndexAmbiguous) {
         throwAmbiguousException("findProductByLabel", typeID, inputTag.label(), inputTag.instance(),
@@ -730,7 +744,7 @@ namespace edm {
       }
       inputTag.tryToCacheIndex(index, typeID, branchType(), &productRegistry());
     }
-    if(UNLIKELY( consumer and (not consumer->registeredToConsume(index, skipCurrentProcess, branchType())))) {
+    if(UNLIKELY( checkConsumes and consumer and (not consumer->registeredToConsume(index, skipCurrentProcess, branchType())))) {
       failedToRegisterConsumes(kindOfType,typeID,inputTag.label(),inputTag.instance(),
                                appendCurrentProcessIfAlias(inputTag.process(), processConfiguration_->processName()));
     }
@@ -756,11 +770,25 @@ namespace edm {
                                 SharedResourcesAcquirer* sra,
                                 ModuleCallingContext const* mcc) const {
 
-    ProductResolverIndex index = productLookup().index(kindOfType,
-                                                     typeID,
-                                                     label.c_str(),
-                                                     instance.c_str(),
-                                                     process.c_str());
+    ProductResolverIndex index = ProductResolverIndexInvalid;
+    bool checkConsumes = true;
+    if(consumer) {
+      index = consumer->indexFromLabels(kindOfType,
+                                        typeID,
+                                        branchType(),
+                                        label.c_str(),
+                                        instance.c_str(),
+                                        process.c_str(),
+                                        false);
+      checkConsumes = (index == ProductResolverIndexInvalid);
+    }
+    if(index == ProductResolverIndexInvalid) {
+      index = productLookup().index(kindOfType,
+                                    typeID,
+                                    label.c_str(),
+                                    instance.c_str(),
+                                    process.c_str());
+    }
    
     if(index == ProductResolverIndexAmbiguous) {
       throwAmbiguousException("findProductByLabel", typeID, label, instance, process);
@@ -768,7 +796,7 @@ namespace edm {
       return nullptr;
     }
     
-    if(UNLIKELY( consumer and (not consumer->registeredToConsume(index, false, branchType())))) {
+    if(UNLIKELY( checkConsumes and consumer and (not consumer->registeredToConsume(index, false, branchType())))) {
       failedToRegisterConsumes(kindOfType,typeID,label,instance,process);
     }
     
@@ -602,6 +602,24 @@ namespace edm {
       c->setEventSelectionInfo(outputModulePathPositions, preg.anyProductProduced());
     }
 
+    {
+      //modules waiting for a shared resource are run in the order requested unless they have high priority
+      ParameterSet const& optionsPset = proc_pset.getUntrackedParameterSet("options");
+      auto const& labels = optionsPset.getUntrackedParameter<std::vector<std::string>>("highPriorityModules", std::vector<std::string>());
+      if(not labels.empty()) {
+        std::set<std::string> highPriorityLabels(labels.begin(), labels.end());
+        auto setPriority = [&highPriorityLabels](Worker* iWorker) {
+          if(highPriorityLabels.find(iWorker->description().moduleLabel()) != highPriorityLabels.end()) {
+            iWorker->setHighPriority(true);
+          }
+        };
+        for_all(allWorkers(), setPriority);
+        for(auto const& stream : streamSchedules_) {
+          for_all(stream->allWorkers(), setPriority);
+        }
+      }
+    }
+
     if(wantSummary_) {
       std::vector<const ModuleDescription*> modDesc;
       const auto& workers = allWorkers();
@@ -991,8 +1009,20 @@ namespace edm {
   }
 
   void Schedule::closeOutputFiles() {
-    using std::placeholders::_1;
-    for_all(all_output_communicators_, std::bind(&OutputModuleCommunicator::closeFile, _1));
+    //Writing the indices and metadata at file close can take a long time so
+    // let each OutputModule close its file in parallel with the others
+    auto waitTask = make_empty_waiting_task();
+    waitTask->increment_ref_count();
+    {
+      WaitingTaskHolder holder(waitTask.get());
+      for(auto& c: all_output_communicators_) {
+        c->closeFileAsync(holder);
+      }
+    }
+    waitTask->wait_for_all();
+    if(waitTask->exceptionPtr() != nullptr) {
+      std::rethrow_exception(*(waitTask->exceptionPtr()));
+    }
   }
 
   void Schedule::openOutputFiles(FileBlock& fb) {
@@ -1,5 +1,6 @@
 #include "FWCore/Framework/src/StreamSchedule.h"
 
+#include "DataFormats/Provenance/interface/BranchDescription.h"
 #include "DataFormats/Provenance/interface/BranchIDListHelper.h"
 #include "DataFormats/Provenance/interface/ProcessConfiguration.h"
 #include "DataFormats/Provenance/interface/ProductRegistry.h"
@@ -85,10 +86,30 @@ namespace edm {
     void
     initializeBranchToReadingWorker(ParameterSet const& opts,
                                     ProductRegistry const& preg,
-                                    std::multimap<std::string,Worker*>& branchToReadingWorker)
+                                    std::multimap<std::string,Worker*>& branchToReadingWorker,
+                                    std::set<std::string>& explicitlyRequested)
     {
       // See if any data has been marked to be deleted early (removing any duplicates)
       auto vBranchesToDeleteEarly = opts.getUntrackedParameter<std::vector<std::string>>("canDeleteEarly");
+      explicitlyRequested.insert(vBranchesToDeleteEarly.begin(),vBranchesToDeleteEarly.end());
+      if(opts.getUntrackedParameter<bool>("deleteEarlyNotKeptProducts")) {
+        //products involved in an EDAlias are accessed by more than one name so are left alone
+        std::set<BranchID> aliased;
+        for(auto const& prod : preg.productList()) {
+          if(prod.second.isAlias()) {
+            aliased.insert(prod.second.branchID());
+            aliased.insert(prod.second.originalBranchID());
+          }
+        }
+        for(auto const& prod : preg.productList()) {
+          BranchDescription const& desc = prod.second;
+          if(desc.branchType() == InEvent and desc.present() and
+             aliased.end() == aliased.find(desc.branchID())) {
+            //the branch names all end with a period, which we do not want to compare with
+            vBranchesToDeleteEarly.emplace_back(desc.branchName(), 0, desc.branchName().size()-1);
+          }
+        }
+      }
       if(not vBranchesToDeleteEarly.empty()) {
         std::sort(vBranchesToDeleteEarly.begin(),vBranchesToDeleteEarly.end(),std::less<std::string>());
         vBranchesToDeleteEarly.erase(std::unique(vBranchesToDeleteEarly.begin(),vBranchesToDeleteEarly.end()),
@@ -126,6 +147,45 @@ namespace edm {
         }
       }
     }
+
+    typedef std::map<std::string, std::vector<std::pair<std::string, BranchDescription const*>>> CandidatesByLabel;
+
+    //finds which of the branches we want to delete early could be gotten via the consumes calls of the worker
+    void
+    branchesConsumedByWorker(Worker const& iWorker,
+                             CandidatesByLabel const& iCandidates,
+                             std::set<std::string>& oBranches) {
+      for(auto const& info : iWorker.consumesInfo()) {
+        if(info.branchType() != InEvent) {
+          continue;
+        }
+        //the type is only used for consumesMany, otherwise we assume any type with the labels could be read
+        // since View and base class requests can match several types
+        bool const anyProcess = info.process().empty() or info.skipCurrentProcess();
+        auto check = [&](std::pair<std::string, BranchDescription const*> const& iCandidate) {
+          BranchDescription const& desc = *iCandidate.second;
+          if(info.label().empty()) {
+            if(info.kindOfType() == PRODUCT_TYPE and desc.unwrappedTypeID() != info.type()) {
+              return;
+            }
+          } else if(info.instance() != desc.productInstanceName() or
+                    (not anyProcess and info.process() != desc.processName())) {
+            return;
+          }
+          oBranches.insert(iCandidate.first);
+        };
+        if(info.label().empty()) {
+          for(auto const& labelAndCandidates : iCandidates) {
+            for_all(labelAndCandidates.second, check);
+          }
+        } else {
+          auto found = iCandidates.find(info.label());
+          if(found != iCandidates.end()) {
+            for_all(found->second, check);
+          }
+        }
+      }
+    }
   }
 
   // -----------------------------
@@ -255,7 +315,8 @@ namespace edm {
     //see if 'canDeleteEarly' was set and if so setup the list with those products actually
     // registered for this job
     std::multimap<std::string,Worker*> branchToReadingWorker;
-    initializeBranchToReadingWorker(opts,preg,branchToReadingWorker);
+    std::set<std::string> explicitlyRequested;
+    initializeBranchToReadingWorker(opts,preg,branchToReadingWorker,explicitlyRequested);
     
     //If no delete early items have been specified we don't have to do anything
     if(branchToReadingWorker.empty()) {
@@ -277,7 +338,9 @@ namespace edm {
           SelectedProductsForBranchType const& kept = comm->keptProducts();
           for(auto const& item: kept[InEvent]) {
             BranchDescription const& desc = *item.first;
-            auto found = branchToReadingWorker.equal_range(desc.branchName());
+            //the branch name has a trailing '.' which is not part of the map key
+            std::string name(desc.branchName(), 0, desc.branchName().size()-1);
+            auto found = branchToReadingWorker.equal_range(name);
             if(found.first !=found.second) {
               --nUniqueBranchesToDelete;
               branchToReadingWorker.erase(found.first,found.second);
@@ -291,34 +354,66 @@ namespace edm {
       return;
     }
     
+    CandidatesByLabel candidates;
+    for(auto const& prod : preg.productList()) {
+      BranchDescription const& desc = prod.second;
+      if(desc.branchType() != InEvent) {
+        continue;
+      }
+      std::string name(desc.branchName(), 0, desc.branchName().size()-1);
+      if(branchToReadingWorker.end() != branchToReadingWorker.find(name)) {
+        candidates[desc.moduleLabel()].emplace_back(std::move(name), &desc);
+      }
+    }
+
     for (auto w :allWorkers()) {
       //determine if this module could read a branch we want to delete early
+      std::set<std::string> branches;
       auto pset = pset::Registry::instance()->getMapped(w->description().parameterSetID());
       if(nullptr!=pset) {
-        auto branches = pset->getUntrackedParameter<std::vector<std::string>>("mightGet",kEmpty);
-        if(not branches.empty()) {
-          ++upperLimitOnReadingWorker;
-        }
-        for(auto const& branch:branches){
-          auto found = branchToReadingWorker.equal_range(branch);
-          if(found.first != found.second) {
-            ++upperLimitOnIndicies;
-            ++reserveSizeForWorker[w];
-            if(nullptr == found.first->second) {
-              found.first->second = w;
-            } else {
-              branchToReadingWorker.insert(make_pair(found.first->first,w));
+        auto const& mightGet = pset->getUntrackedParameter<std::vector<std::string>>("mightGet",kEmpty);
+        branches.insert(mightGet.begin(),mightGet.end());
+      }
+      branchesConsumedByWorker(*w, candidates, branches);
+      {
+        //For products only added because of 'deleteEarlyNotKeptProducts' the producer is also treated
+        // as a reader. That way a product is never deleted before it is made and a product which
+        // is not consumed by anyone is deleted as soon as the producer is done.
+        auto found = candidates.find(w->description().moduleLabel());
+        if(found != candidates.end()) {
+          for(auto const& candidate : found->second) {
+            if(candidate.second->produced() and
+               explicitlyRequested.end() == explicitlyRequested.find(candidate.first)) {
+              branches.insert(candidate.first);
             }
           }
         }
       }
+      if(not branches.empty()) {
+        ++upperLimitOnReadingWorker;
+      }
+      for(auto const& branch:branches){
+        auto found = branchToReadingWorker.equal_range(branch);
+        if(found.first != found.second) {
+          ++upperLimitOnIndicies;
+          ++reserveSizeForWorker[w];
+          if(nullptr == found.first->second) {
+            found.first->second = w;
+          } else {
+            branchToReadingWorker.insert(make_pair(found.first->first,w));
+          }
+        }
+      }
     }
     {
       auto it = branchToReadingWorker.begin();
       std::vector<std::string> unusedBranches;
       while(it !=branchToReadingWorker.end()) {
         if(it->second == nullptr) {
-          unusedBranches.push_back(it->first);
+          //products only deleted early because of 'deleteEarlyNotKeptProducts' are not worth a warning
+          if(explicitlyRequested.end() != explicitlyRequested.find(it->first)) {
+            unusedBranches.push_back(it->first);
+          }
           //erasing the object invalidates the iterator so must advance it first
           auto temp = it;
           ++it;
@@ -4,6 +4,7 @@
 
 #include "FWCore/Framework/src/Worker.h"
 #include "FWCore/Framework/src/EarlyDeleteHelper.h"
+#include "FWCore/Framework/interface/EventSetup.h"
 #include "FWCore/ServiceRegistry/interface/StreamContext.h"
 #include "FWCore/Concurrency/interface/WaitingTask.h"
 #include "FWCore/Concurrency/interface/WaitingTaskHolder.h"
@@ -86,7 +87,8 @@ private:
     actReg_(),
     earlyDeleteHelper_(nullptr),
     workStarted_(false),
-    ranAcquireWithoutException_(false)
+    ranAcquireWithoutException_(false),
+    highPriority_(false)
   {
   }
 
@@ -204,7 +206,7 @@ private:
   }
 
   
-  void Worker::prefetchAsync(WaitingTask* iTask, ServiceToken const& token, ParentContext const& parentContext, Principal const& iPrincipal) {
+  void Worker::prefetchAsync(WaitingTask* iTask, ServiceToken const& token, ParentContext const& parentContext, Principal const& iPrincipal, EventSetup const& iES) {
     // Prefetch products the module declares it consumes (not including the products it maybe consumes)
     std::vector<ProductResolverIndexAndSkipBit> const& items = itemsToGetFrom(iPrincipal.branchType());
 
@@ -223,6 +225,12 @@ private:
         iPrincipal.prefetchAsync(iTask,productResolverIndex, skipCurrentProcess, token, &moduleCallingContext_);
       }
     }
+
+    //Start making the EventSetup data the module declared it gets so that its
+    // construction is not done on this module's critical path
+    for(auto const& item : esItemsToGet()) {
+      iES.prefetchAsync(iTask, item.first, item.second, token);
+    }
     
     if(iPrincipal.branchType()==InEvent) {
       preActionBeforeRunEventAsync(iTask,moduleCallingContext_,iPrincipal);
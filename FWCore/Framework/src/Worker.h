@@ -24,6 +24,7 @@ the worker is reset().
 #include "DataFormats/Provenance/interface/ModuleDescription.h"
 #include "FWCore/MessageLogger/interface/ExceptionMessages.h"
 #include "FWCore/Framework/src/WorkerParams.h"
+#include "FWCore/Framework/interface/EDConsumerBase.h"
 #include "FWCore/Framework/interface/ExceptionActions.h"
 #include "FWCore/Framework/interface/ModuleContextSentry.h"
 #include "FWCore/Framework/interface/OccurrenceTraits.h"
@@ -99,6 +100,23 @@ namespace edm {
         }
       }
       template <class F>
+      void pushHighPriority(F&& iF) {
+        if(serial_) {
+          serial_->pushHighPriority(iF);
+        } else {
+          limited_->pushHighPriority(iF);
+        }
+      }
+      /// uses pushHighPriority if iHighPriority is true else push
+      template <class F>
+      void push(F&& iF, bool iHighPriority) {
+        if(iHighPriority) {
+          pushHighPriority(std::forward<F>(iF));
+        } else {
+          push(std::forward<F>(iF));
+        }
+      }
+      template <class F>
       void pushAndWait(F&& iF) {
         if(serial_) {
           serial_->pushAndWait(iF);
@@ -193,6 +211,10 @@ namespace edm {
 
     void setEarlyDeleteHelper(EarlyDeleteHelper* iHelper);
 
+    ///When the module has to wait for a shared resource, run it before modules without high priority
+    void setHighPriority(bool iHighPriority) { highPriority_ = iHighPriority; }
+    bool highPriority() const { return highPriority_; }
+
     //Used to make EDGetToken work
     virtual void updateLookup(BranchType iBranchType,
                       ProductResolverIndexHelper const&) = 0;
@@ -286,6 +308,8 @@ namespace edm {
 
     virtual std::vector<ProductResolverIndexAndSkipBit> const& itemsToGetFrom(BranchType) const = 0;
 
+    virtual std::vector<EDConsumerBase::ESItem> const& esItemsToGet() const = 0;
+
 
     virtual std::vector<ProductResolverIndex> const& itemsShouldPutInEvent() const = 0;
 
@@ -362,7 +386,8 @@ namespace edm {
     void prefetchAsync(WaitingTask*,
                        ServiceToken const&,
                        ParentContext const& parentContext,
-                       Principal const& );
+                       Principal const&,
+                       EventSetup const&);
         
     void emitPostModuleEventPrefetchingSignal() {
       actReg_->postModuleEventPrefetchingSignal_.emit(*moduleCallingContext_.getStreamContext(),moduleCallingContext_);
@@ -467,11 +492,11 @@ namespace edm {
             //keep another global transition from running if necessary
             auto gQueue = workerhelper::CallImpl<T>::pauseGlobalQueue(m_worker);
             if(gQueue) {
-              gQueue->push( [queue,gQueue, f]() mutable {
+              gQueue->push( [queue,gQueue, f, highPriority = m_worker->highPriority()]() mutable {
                 gQueue->pause();
-                queue.push(std::move(f));} );
+                queue.push(std::move(f), highPriority);} );
             } else {
-              queue.push( std::move(f) );
+              queue.push( std::move(f), m_worker->highPriority() );
             }
             return nullptr;
           }
@@ -563,7 +588,7 @@ namespace edm {
                                                    es,
                                                    parentContext,
                                                    holder);
-            });
+            }, m_worker->highPriority());
             return nullptr;
           }
         }
@@ -624,6 +649,7 @@ namespace edm {
     edm::WaitingTaskList waitingTasks_;
     std::atomic<bool> workStarted_;
     bool ranAcquireWithoutException_;
+    bool highPriority_;
   };
 
   namespace {
@@ -898,10 +924,10 @@ namespace edm {
         };
 
         auto ownRunTask = std::make_shared<DestroyTask>(runTask);
-        auto selectionTask = make_waiting_task(tbb::task::allocate_root(), [ownRunTask,parentContext,&ep,token, this] (std::exception_ptr const* ) mutable {
+        auto selectionTask = make_waiting_task(tbb::task::allocate_root(), [ownRunTask,parentContext,&ep,&es,token, this] (std::exception_ptr const* ) mutable {
           
           ServiceRegistry::Operate guard(token);
-          prefetchAsync(ownRunTask->release(), token, parentContext, ep);
+          prefetchAsync(ownRunTask->release(), token, parentContext, ep, es);
         });
         prePrefetchSelectionAsync(selectionTask,token,streamID, &ep);
       } else {
@@ -916,7 +942,7 @@ namespace edm {
           moduleTask = new (tbb::task::allocate_root()) AcquireTask<T>(
             this, ep, es, token, parentContext, std::move(runTaskHolder));
         }
-        prefetchAsync(moduleTask, token, parentContext, ep);
+        prefetchAsync(moduleTask, token, parentContext, ep, es);
       }
     }
   }
@@ -1067,7 +1093,7 @@ namespace edm {
         //set count to 2 since wait_for_all requires value to not go to 0
         waitTask->set_ref_count(2);
         
-        prefetchAsync(waitTask.get(),ServiceRegistry::instance().presentToken(), parentContext, ep);
+        prefetchAsync(waitTask.get(),ServiceRegistry::instance().presentToken(), parentContext, ep, es);
         waitTask->decrement_ref_count();
         waitTask->wait_for_all();
       }
@@ -148,6 +148,8 @@ namespace edm {
     }
 
     std::vector<ProductResolverIndexAndSkipBit> const& itemsToGetFrom(BranchType iType) const final { return module_->itemsToGetFrom(iType); }
+
+    std::vector<EDConsumerBase::ESItem> const& esItemsToGet() const final { return module_->esItemsToGet(); }
     
     std::vector<ProductResolverIndex> const& itemsShouldPutInEvent() const override;
 
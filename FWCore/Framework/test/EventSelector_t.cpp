@@ -162,6 +162,48 @@ void testall(const Strings& paths,
     }
 }
 
+// Selections over more paths than the bits of one word of the compiled masks
+void testmanypaths()
+{
+  const unsigned int n = 150;
+  Strings paths;
+  for(unsigned int i=0;i<n;++i) paths.push_back("p" + std::to_string(i));
+
+  EventSelector single(Strings(1, "p130"), paths);
+  EventSelector vetoes(Strings(1, "!p1?"), paths);
+  EventSelector noex(Strings(1, "p70&noexception"), paths);
+  EventSelector exception(Strings(1, "exception@p140"), paths);
+
+  HLTGlobalStatus bm(n);
+  for(unsigned int i=0;i<n;++i) bm[i] = HLTPathStatus(edm::hlt::Fail);
+  TriggerResults allFail(bm, paths);
+  if (single.acceptEvent(allFail) || !vetoes.acceptEvent(allFail) ||
+      noex.acceptEvent(allFail) || exception.acceptEvent(allFail))
+    {
+      std::cerr << "failed to select with " << n << " paths all failing\n";
+      abort();
+    }
+
+  bm[130] = HLTPathStatus(edm::hlt::Pass);
+  bm[70]  = HLTPathStatus(edm::hlt::Pass);
+  bm[15]  = HLTPathStatus(edm::hlt::Pass);
+  TriggerResults somePass(bm, paths);
+  if (!single.acceptEvent(somePass) || vetoes.acceptEvent(somePass) ||
+      !noex.acceptEvent(somePass) || exception.acceptEvent(somePass))
+    {
+      std::cerr << "failed to select with " << n << " paths partly passing\n";
+      abort();
+    }
+
+  bm[140] = HLTPathStatus(edm::hlt::Exception);
+  TriggerResults withException(bm, paths);
+  if (!single.acceptEvent(withException) || noex.acceptEvent(withException) ||
+      !exception.acceptEvent(withException))
+    {
+      std::cerr << "failed to select with " << n << " paths with an exception\n";
+      abort();
+    }
+}
 
 int main()
 try {
@@ -275,6 +317,7 @@ try {
   // We are ready to run some tests
 
   testall(paths, patterns, testmasks, ans);
+  testmanypaths();
   return 0;
 } catch(cms::Exception const& e) {
   std::cerr << e.explainSelf() << std::endl;
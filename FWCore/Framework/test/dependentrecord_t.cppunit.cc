@@ -43,6 +43,7 @@ CPPUNIT_TEST(resetTest);
 CPPUNIT_TEST(alternateFinderTest);
 CPPUNIT_TEST(invalidRecordTest);
 CPPUNIT_TEST(extendIOVTest);
+CPPUNIT_TEST(intervalUpdateTest);
 
   
 CPPUNIT_TEST_SUITE_END();
@@ -62,6 +63,7 @@ public:
   void alternateFinderTest();
   void invalidRecordTest();
   void extendIOVTest();
+  void intervalUpdateTest();
   
 }; //Cppunit class declaration over
 
@@ -915,3 +917,46 @@ void testdependentrecord::extendIOVTest()
    }
 
 }
+
+void testdependentrecord::intervalUpdateTest()
+{
+   //mixing time and run/lumi/event based records gives an open ended interval but
+   // we should still know that nothing changes as long as the dependent records stay valid
+   auto dummyProvider1 = std::make_shared<EventSetupRecordProvider>(DummyRecord::keyForClass());
+   const edm::ValidityInterval runLumiInterval(edm::IOVSyncValue(edm::EventID(1, 1, 1)),
+                                               edm::IOVSyncValue(edm::EventID(1, 1, 5)));
+   dummyProvider1->setValidityInterval(runLumiInterval);
+
+   auto dummyProvider2 = std::make_shared<EventSetupRecordProvider>(DummyRecord::keyForClass());
+   const edm::ValidityInterval timeInterval(edm::IOVSyncValue(edm::Timestamp(1)),
+                                            edm::IOVSyncValue(edm::Timestamp(6)));
+   dummyProvider2->setValidityInterval(timeInterval);
+
+   const EventSetupRecordKey depRecordKey = DepRecord::keyForClass();
+   DependentRecordIntervalFinder finder(depRecordKey);
+   finder.addProviderWeAreDependentOn(dummyProvider1);
+   finder.addProviderWeAreDependentOn(dummyProvider2);
+
+   const edm::ValidityInterval overlapInterval(timeInterval.first(),
+                                               edm::IOVSyncValue::invalidIOVSyncValue());
+   CPPUNIT_ASSERT(overlapInterval == finder.findIntervalFor(depRecordKey,
+                                                            edm::IOVSyncValue(edm::EventID(1, 1, 2), edm::Timestamp(2))));
+
+   //both dependent records are still valid
+   CPPUNIT_ASSERT(not finder.needsIntervalUpdateFor(depRecordKey,
+                                                    edm::IOVSyncValue(edm::EventID(1, 1, 4), edm::Timestamp(5))));
+   CPPUNIT_ASSERT(overlapInterval == finder.findIntervalFor(depRecordKey,
+                                                            edm::IOVSyncValue(edm::EventID(1, 1, 4), edm::Timestamp(5))));
+
+   //the run/lumi/event based record is no longer valid
+   CPPUNIT_ASSERT(finder.needsIntervalUpdateFor(depRecordKey,
+                                                edm::IOVSyncValue(edm::EventID(1, 1, 6), edm::Timestamp(5))));
+
+   //the time based record is no longer valid
+   CPPUNIT_ASSERT(finder.needsIntervalUpdateFor(depRecordKey,
+                                                edm::IOVSyncValue(edm::EventID(1, 1, 4), edm::Timestamp(7))));
+
+   //a record with a known interval only needs an update when leaving that interval
+   CPPUNIT_ASSERT(not dummyProvider1->needsIntervalUpdateFor(edm::IOVSyncValue(edm::EventID(1, 1, 5))));
+   CPPUNIT_ASSERT(dummyProvider1->needsIntervalUpdateFor(edm::IOVSyncValue(edm::EventID(1, 1, 6))));
+}
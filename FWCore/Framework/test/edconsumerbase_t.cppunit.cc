@@ -164,6 +164,14 @@ TestEDConsumerBase::testRegularType()
 
     CPPUNIT_ASSERT(vint_c == intConsumer.indexFrom(intConsumer.m_tokens[1],edm::InEvent,typeID_vint).productResolverIndex());
     CPPUNIT_ASSERT(vint_blank == intConsumer.indexFrom(intConsumer.m_tokens[0],edm::InEvent,typeID_vint).productResolverIndex());
+
+    CPPUNIT_ASSERT(vint_c == intConsumer.indexFromLabels(edm::PRODUCT_TYPE,typeID_vint,edm::InEvent,"labelC","instanceC","processC",false));
+    CPPUNIT_ASSERT(vint_blank == intConsumer.indexFromLabels(edm::PRODUCT_TYPE,typeID_vint,edm::InEvent,"label","instance","process",false));
+    CPPUNIT_ASSERT(edm::ProductResolverIndexInvalid == intConsumer.indexFromLabels(edm::PRODUCT_TYPE,typeID_vint,edm::InEvent,"labelC","instanceC","",false));
+    CPPUNIT_ASSERT(edm::ProductResolverIndexInvalid == intConsumer.indexFromLabels(edm::PRODUCT_TYPE,typeID_vint,edm::InEvent,"labelC","instanceC","processC",true));
+    CPPUNIT_ASSERT(edm::ProductResolverIndexInvalid == intConsumer.indexFromLabels(edm::ELEMENT_TYPE,typeID_vint,edm::InEvent,"labelC","instanceC","processC",false));
+    CPPUNIT_ASSERT(edm::ProductResolverIndexInvalid == intConsumer.indexFromLabels(edm::PRODUCT_TYPE,typeIDEventID,edm::InEvent,"labelC","instanceC","processC",false));
+    CPPUNIT_ASSERT(edm::ProductResolverIndexInvalid == intConsumer.indexFromLabels(edm::PRODUCT_TYPE,typeID_vint,edm::InRun,"labelC","instanceC","processC",false));
     
     std::vector<edm::ProductResolverIndexAndSkipBit> indices;
     intConsumer.itemsToGet(edm::InEvent,indices);
@@ -0,0 +1,128 @@
+// -*- C++ -*-
+//
+// Package:     FWCore/Framework
+// Class  :     eventbatcher_t
+//
+// Implementation:
+//     Tests of edm::EventBatcher
+//
+
+// system include files
+#include <atomic>
+#include <chrono>
+#include <exception>
+#include <memory>
+#include <stdexcept>
+#include <vector>
+
+// user include files
+#include "cppunit/extensions/HelperMacros.h"
+#include "tbb/task.h"
+#include "FWCore/Framework/interface/EventBatcher.h"
+#include "FWCore/Concurrency/interface/WaitingTask.h"
+#include "FWCore/Concurrency/interface/WaitingTaskWithArenaHolder.h"
+
+class TestEventBatcher : public CppUnit::TestFixture {
+public:
+  CPPUNIT_TEST_SUITE(TestEventBatcher);
+  CPPUNIT_TEST(testFullBatch);
+  CPPUNIT_TEST(testLatency);
+  CPPUNIT_TEST(testException);
+  CPPUNIT_TEST_SUITE_END();
+
+public:
+  void setUp() {}
+  void tearDown() {}
+
+  void testFullBatch();
+  void testLatency();
+  void testException();
+};
+
+///registration of the test so that the runner can find it
+CPPUNIT_TEST_SUITE_REGISTRATION(TestEventBatcher);
+
+namespace {
+  std::shared_ptr<tbb::task> makeWaitTask(unsigned int iNWaiting) {
+    std::shared_ptr<tbb::task> waitTask{new (tbb::task::allocate_root()) tbb::empty_task{},
+                                        [](tbb::task* iTask){tbb::task::destroy(*iTask);} };
+    waitTask->set_ref_count(1+iNWaiting);
+    return waitTask;
+  }
+
+  edm::WaitingTaskWithArenaHolder makeHolder(tbb::task* iWaitTask, std::atomic<unsigned int>& iNExceptions) {
+    return edm::WaitingTaskWithArenaHolder(edm::make_waiting_task(tbb::task::allocate_root(),
+                                                                  [iWaitTask,&iNExceptions](std::exception_ptr const* iPtr) {
+                                                                    if(iPtr) {
+                                                                      ++iNExceptions;
+                                                                    }
+                                                                    iWaitTask->decrement_ref_count();
+                                                                  }));
+  }
+}
+
+void TestEventBatcher::testFullBatch()
+{
+  std::vector<std::vector<unsigned int>> batches;
+  edm::EventBatcher batcher(2, std::chrono::seconds(100), [&batches](std::vector<edm::StreamID> const& iStreams) {
+    batches.emplace_back();
+    for(auto const& s: iStreams) {
+      batches.back().push_back(s.value());
+    }
+  });
+  CPPUNIT_ASSERT(batcher.maxBatchSize() == 2);
+
+  std::atomic<unsigned int> nExceptions{0};
+  auto waitTask = makeWaitTask(2);
+  batcher.add(edm::StreamID::invalidStreamID(), makeHolder(waitTask.get(), nExceptions));
+  CPPUNIT_ASSERT(batches.empty());
+  batcher.add(edm::StreamID::invalidStreamID(), makeHolder(waitTask.get(), nExceptions));
+  //a full batch is processed by the thread adding the last Event
+  CPPUNIT_ASSERT(batches.size() == 1);
+  CPPUNIT_ASSERT(batches[0].size() == 2);
+  waitTask->wait_for_all();
+  CPPUNIT_ASSERT(nExceptions == 0);
+}
+
+void TestEventBatcher::testLatency()
+{
+  std::atomic<unsigned int> nProcessed{0};
+  std::atomic<unsigned int> nBatches{0};
+  edm::EventBatcher batcher(4, std::chrono::milliseconds(1), [&nProcessed,&nBatches](std::vector<edm::StreamID> const& iStreams) {
+    nProcessed += iStreams.size();
+    ++nBatches;
+  });
+
+  std::atomic<unsigned int> nExceptions{0};
+  {
+    auto waitTask = makeWaitTask(1);
+    batcher.add(edm::StreamID::invalidStreamID(), makeHolder(waitTask.get(), nExceptions));
+    //the timer thread must process the partial batch
+    waitTask->wait_for_all();
+    CPPUNIT_ASSERT(nProcessed == 1);
+    CPPUNIT_ASSERT(nBatches == 1);
+  }
+  {
+    auto waitTask = makeWaitTask(2);
+    batcher.add(edm::StreamID::invalidStreamID(), makeHolder(waitTask.get(), nExceptions));
+    batcher.add(edm::StreamID::invalidStreamID(), makeHolder(waitTask.get(), nExceptions));
+    waitTask->wait_for_all();
+    CPPUNIT_ASSERT(nProcessed == 3);
+  }
+  CPPUNIT_ASSERT(nExceptions == 0);
+}
+
+void TestEventBatcher::testException()
+{
+  edm::EventBatcher batcher(2, std::chrono::seconds(100), [](std::vector<edm::StreamID> const&) {
+    throw std::runtime_error("failed batch");
+  });
+
+  std::atomic<unsigned int> nExceptions{0};
+  auto waitTask = makeWaitTask(2);
+  batcher.add(edm::StreamID::invalidStreamID(), makeHolder(waitTask.get(), nExceptions));
+  batcher.add(edm::StreamID::invalidStreamID(), makeHolder(waitTask.get(), nExceptions));
+  waitTask->wait_for_all();
+  //all Events in the batch are told about the failure
+  CPPUNIT_ASSERT(nExceptions == 2);
+}
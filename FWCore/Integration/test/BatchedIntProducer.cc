@@ -0,0 +1,114 @@
+#include "DataFormats/Common/interface/Handle.h"
+#include "DataFormats/TestObjects/interface/ToyProducts.h"
+#include "FWCore/Framework/interface/Event.h"
+#include "FWCore/Framework/interface/global/EDProducer.h"
+#include "FWCore/Framework/interface/MakerMacros.h"
+#include "FWCore/Integration/test/WaitingService.h"
+#include "FWCore/ParameterSet/interface/ParameterSet.h"
+#include "FWCore/ServiceRegistry/interface/Service.h"
+#include "FWCore/Utilities/interface/EDGetToken.h"
+#include "FWCore/Utilities/interface/Exception.h"
+#include "FWCore/Utilities/interface/InputTag.h"
+#include "FWCore/Utilities/interface/StreamID.h"
+
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <vector>
+
+namespace edm {
+  class EventSetup;
+}
+
+namespace edmtest {
+
+  namespace test_batch {
+    struct Cache {
+      int input = 0;
+      int output = 0;
+    };
+  }
+
+  // Doubles the value of an IntProduct, with the Events of up to 4 Streams
+  // processed together. At the end of the job it checks which of the size
+  // and the latency triggers processed the batches.
+  class BatchedIntProducer : public edm::global::EDProducer<edm::BatchedEvents<4>,
+                                                            edm::StreamCache<test_batch::Cache>> {
+  public:
+
+    explicit BatchedIntProducer(edm::ParameterSet const& pset);
+
+    std::unique_ptr<test_batch::Cache> beginStream(edm::StreamID) const override;
+
+    void produce(edm::StreamID, edm::Event&, edm::EventSetup const&) const override;
+
+    void endJob() override;
+
+  private:
+
+    void acquireForBatch(edm::StreamID, edm::Event const&, edm::EventSetup const&) const override;
+
+    void produceBatch(std::vector<edm::StreamID> const&) const override;
+
+    edm::EDGetTokenT<IntProduct> m_token;
+    const bool m_expectFullBatches;
+    const bool m_expectPartialBatches;
+    mutable std::atomic<unsigned int> m_nFullBatches;
+    mutable std::atomic<unsigned int> m_nPartialBatches;
+  };
+
+  BatchedIntProducer::BatchedIntProducer(edm::ParameterSet const& pset) :
+    m_token(consumes<IntProduct>(pset.getParameter<edm::InputTag>("tag"))),
+    m_expectFullBatches(pset.getUntrackedParameter<bool>("expectFullBatches")),
+    m_expectPartialBatches(pset.getUntrackedParameter<bool>("expectPartialBatches")),
+    m_nFullBatches(0),
+    m_nPartialBatches(0)
+  {
+    setMaxBatchLatency(std::chrono::microseconds(pset.getUntrackedParameter<unsigned int>("maxBatchLatencyInMicroseconds")));
+    produces<IntProduct>();
+  }
+
+  std::unique_ptr<test_batch::Cache> BatchedIntProducer::beginStream(edm::StreamID) const {
+    return std::make_unique<test_batch::Cache>();
+  }
+
+  void BatchedIntProducer::acquireForBatch(edm::StreamID streamID,
+                                           edm::Event const& event,
+                                           edm::EventSetup const&) const {
+    edm::Handle<IntProduct> handle;
+    event.getByToken(m_token, handle);
+    streamCache(streamID)->input = handle->value;
+  }
+
+  void BatchedIntProducer::produceBatch(std::vector<edm::StreamID> const& streams) const {
+    // a timed out batch must still be processed with the Services of the job
+    if(not edm::Service<test_acquire::WaitingService>().isAvailable()) {
+      throw cms::Exception("BatchedIntProducer") << "produceBatch called without the Services of the job";
+    }
+    if(streams.size() == 4) {
+      ++m_nFullBatches;
+    } else {
+      ++m_nPartialBatches;
+    }
+    for(auto const& s : streams) {
+      auto cache = streamCache(s);
+      cache->output = 2*cache->input;
+    }
+  }
+
+  void BatchedIntProducer::produce(edm::StreamID streamID,
+                                   edm::Event& event,
+                                   edm::EventSetup const&) const {
+    event.put(std::make_unique<IntProduct>(streamCache(streamID)->output));
+  }
+
+  void BatchedIntProducer::endJob() {
+    if(m_expectFullBatches != (m_nFullBatches != 0) or m_expectPartialBatches != (m_nPartialBatches != 0)) {
+      throw cms::Exception("BatchedIntProducer") << "processed " << m_nFullBatches << " full and "
+                                                 << m_nPartialBatches << " partial batches";
+    }
+  }
+}
+
+using edmtest::BatchedIntProducer;
+DEFINE_FWK_MODULE(BatchedIntProducer);
@@ -70,7 +70,7 @@ WhatsItAnalyzer::WhatsItAnalyzer(const edm::ParameterSet& iConfig):
    index_(0)
 {
    //now do what ever initialization is needed
-
+   esConsumes<WhatsIt, GadgetRcd>();
 }
 
 
@@ -0,0 +1,31 @@
+import FWCore.ParameterSet.Config as cms
+
+process = cms.Process("Test")
+
+process.WaitingService = cms.Service("WaitingService")
+
+process.source = cms.Source("EmptySource")
+
+# Eight Events on four Streams fill two batches of four, so only the size
+# trigger must process them: the latency is much longer than the job.
+process.maxEvents = cms.untracked.PSet(input = cms.untracked.int32(8))
+
+process.options = cms.untracked.PSet(
+    numberOfThreads = cms.untracked.uint32(4),
+    numberOfStreams = cms.untracked.uint32(4)
+)
+
+process.busy = cms.EDProducer("BusyWaitIntProducer",ivalue = cms.int32(3), iterations = cms.uint32(10*1000))
+
+process.batched = cms.EDProducer("BatchedIntProducer",
+                                 tag = cms.InputTag("busy"),
+                                 maxBatchLatencyInMicroseconds = cms.untracked.uint32(600*1000*1000),
+                                 expectFullBatches = cms.untracked.bool(True),
+                                 expectPartialBatches = cms.untracked.bool(False)
+)
+
+process.tester = cms.EDAnalyzer("IntTestAnalyzer",
+                                moduleLabel = cms.untracked.string("batched"),
+                                valueMustMatch = cms.untracked.int32(6))
+
+process.p = cms.Path(process.tester, cms.Task(process.busy, process.batched))
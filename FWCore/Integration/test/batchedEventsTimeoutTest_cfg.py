@@ -0,0 +1,31 @@
+import FWCore.ParameterSet.Config as cms
+
+process = cms.Process("Test")
+
+process.WaitingService = cms.Service("WaitingService")
+
+process.source = cms.Source("EmptySource")
+
+# Two Streams can never fill a batch of four, so every batch must be
+# processed by the latency trigger.
+process.maxEvents = cms.untracked.PSet(input = cms.untracked.int32(8))
+
+process.options = cms.untracked.PSet(
+    numberOfThreads = cms.untracked.uint32(2),
+    numberOfStreams = cms.untracked.uint32(2)
+)
+
+process.busy = cms.EDProducer("BusyWaitIntProducer",ivalue = cms.int32(3), iterations = cms.uint32(10*1000))
+
+process.batched = cms.EDProducer("BatchedIntProducer",
+                                 tag = cms.InputTag("busy"),
+                                 maxBatchLatencyInMicroseconds = cms.untracked.uint32(1000),
+                                 expectFullBatches = cms.untracked.bool(False),
+                                 expectPartialBatches = cms.untracked.bool(True)
+)
+
+process.tester = cms.EDAnalyzer("IntTestAnalyzer",
+                                moduleLabel = cms.untracked.string("batched"),
+                                valueMustMatch = cms.untracked.int32(6))
+
+process.p = cms.Path(process.tester, cms.Task(process.busy, process.batched))
@@ -10,4 +10,10 @@ cmsRun --parameter-set ${LOCAL_TEST_DIR}/waiting_thread_cfg.py || die 'Failed in
 echo "cmsRun acquireTest_cfg.py"
 cmsRun --parameter-set ${LOCAL_TEST_DIR}/acquireTest_cfg.py || die 'Failed in acquireTest_cfg.py' $?
 
+echo "cmsRun batchedEventsTest_cfg.py"
+cmsRun --parameter-set ${LOCAL_TEST_DIR}/batchedEventsTest_cfg.py || die 'Failed in batchedEventsTest_cfg.py' $?
+
+echo "cmsRun batchedEventsTimeoutTest_cfg.py"
+cmsRun --parameter-set ${LOCAL_TEST_DIR}/batchedEventsTimeoutTest_cfg.py || die 'Failed in batchedEventsTimeoutTest_cfg.py' $?
+
 popd
@@ -121,6 +121,9 @@
 //                  the ErrorObj in a shared pointer with a custom deleter.
 //
 // 27 mkortela 2/27/17 Add IfLogTrace and IfLogDebug
+//
+// 28 char const * constructors for the suppressible Log classes, so that
+//    a suppressed message with a literal category allocates nothing
 // =================================================
 
 // system include files
@@ -145,6 +148,9 @@ public:
   explicit LogWarning( std::string const & id ) 
     : ap ( ELwarning,id,false,(MessageDrop::warningAlwaysSuppressed || !MessageDrop::instance()->warningEnabled)) // Change log 21
   { }
+  explicit LogWarning( char const * id )
+    : ap ( ELwarning,id,false,(MessageDrop::warningAlwaysSuppressed || !MessageDrop::instance()->warningEnabled))
+  { }
   ~LogWarning();						// Change log 13
 
   template< class T >
@@ -177,6 +183,9 @@ public:
   explicit LogError( std::string const & id ) 
     : ap ( ELerror,id,false,!MessageDrop::instance()->errorEnabled )        // Change log 24
   { }
+  explicit LogError( char const * id )
+    : ap ( ELerror,id,false,!MessageDrop::instance()->errorEnabled )
+  { }
   ~LogError();							// Change log 13
 
   template< class T >
@@ -241,6 +250,9 @@ public:
   explicit LogInfo( std::string const & id ) 
     : ap ( ELinfo,id,false,(MessageDrop::infoAlwaysSuppressed || !MessageDrop::instance()->infoEnabled) ) // Change log 21
   { }
+  explicit LogInfo( char const * id )
+    : ap ( ELinfo,id,false,(MessageDrop::infoAlwaysSuppressed || !MessageDrop::instance()->infoEnabled) )
+  { }
   ~LogInfo();							// Change log 13
 
   template< class T >
@@ -274,6 +286,9 @@ public:
   explicit LogVerbatim( std::string const & id ) 
     : ap ( ELinfo,id,true,(MessageDrop::infoAlwaysSuppressed || !MessageDrop::instance()->infoEnabled) ) // Change log 21
   { }
+  explicit LogVerbatim( char const * id )
+    : ap ( ELinfo,id,true,(MessageDrop::infoAlwaysSuppressed || !MessageDrop::instance()->infoEnabled) )
+  { }
   ~LogVerbatim();						// Change log 13
 
   template< class T >
@@ -309,6 +324,9 @@ public:
   explicit LogPrint( std::string const & id ) 
     : ap ( ELwarning,id,true,(MessageDrop::warningAlwaysSuppressed || !MessageDrop::instance()->warningEnabled)) // Change log 21
   { }
+  explicit LogPrint( char const * id )
+    : ap ( ELwarning,id,true,(MessageDrop::warningAlwaysSuppressed || !MessageDrop::instance()->warningEnabled))
+  { }
   ~LogPrint();							// Change log 13
 
   template< class T >
@@ -345,6 +363,9 @@ public:
  explicit LogProblem ( std::string const & id )
     : ap ( ELerror,id,true,!MessageDrop::instance()->errorEnabled )        // Change log 24
   { }
+  explicit LogProblem( char const * id )
+    : ap ( ELerror,id,true,!MessageDrop::instance()->errorEnabled )
+  { }
   ~LogProblem();						// Change log 13
 
   template< class T >
@@ -379,6 +400,9 @@ public:
   explicit LogImportant( std::string const & id ) 
     : ap ( ELerror,id,true,!MessageDrop::instance()->errorEnabled )        // Change log 24
   { }
+  explicit LogImportant( char const * id )
+    : ap ( ELerror,id,true,!MessageDrop::instance()->errorEnabled )
+  { }
   ~LogImportant();						 // Change log 13
 
   template< class T >
@@ -530,6 +554,9 @@ public:
   explicit LogWarningThatSuppressesLikeLogInfo( std::string const & id ) 
     : ap ( ELwarning,id,false,(MessageDrop::infoAlwaysSuppressed || !MessageDrop::instance()->warningEnabled) )  // Change log 22
   { }
+  explicit LogWarningThatSuppressesLikeLogInfo( char const * id )
+    : ap ( ELwarning,id,false,(MessageDrop::infoAlwaysSuppressed || !MessageDrop::instance()->warningEnabled) )
+  { }
   ~LogWarningThatSuppressesLikeLogInfo();						
   template< class T >
     LogWarningThatSuppressesLikeLogInfo & 
@@ -37,6 +37,10 @@ public:
   MessageSender( ELseverityLevel const & sev, 
   		 ELstring const & id,
 		 bool verbatim = false, bool suppressed = false );
+  // the id is only converted to an ELstring if the message is not suppressed
+  MessageSender( ELseverityLevel const & sev, 
+  		 char const * id,
+		 bool verbatim = false, bool suppressed = false );
   ~MessageSender();
 
   // ---  stream out the next part of a message:
@@ -87,11 +87,24 @@ CMS_THREAD_SAFE static std::vector<tbb::concurrent_unordered_map<ErrorSummaryMap
 MessageSender::MessageSender( ELseverityLevel const & sev, 
 			      ELstring const & id,
 			      bool verbatim, bool suppressed )
-: errorobj_p( suppressed ? nullptr : new ErrorObj(sev,id,verbatim), ErrorObjDeleter())
 {
+  //a suppressed message leaves errorobj_p empty, so it allocates neither the
+  //ErrorObj nor the shared_ptr control block
+  if (!suppressed) {
+    errorobj_p.reset(new ErrorObj(sev,id,verbatim), ErrorObjDeleter());
+  }
   //std::cout << "MessageSender ctor; new ErrorObj at: " << errorobj_p << '\n';
 }
 
+MessageSender::MessageSender( ELseverityLevel const & sev, 
+			      char const * id,
+			      bool verbatim, bool suppressed )
+{
+  if (!suppressed) {
+    errorobj_p.reset(new ErrorObj(sev,id,verbatim), ErrorObjDeleter());
+  }
+}
+
 
 // This destructor must not be permitted to throw. A
 // boost::thread_resoruce_error is thrown at static destruction time,
@@ -17,6 +17,7 @@
 #include "FWCore/ParameterSet/interface/ParameterSetEntry.h"
 #include "FWCore/ParameterSet/interface/VParameterSetEntry.h"
 
+#include <functional>
 #include <iosfwd>
 #include <map>
 #include <memory>
@@ -249,7 +250,9 @@ namespace edm {
 
     std::vector<ParameterSet> popVParameterSet(std::string const& name);
 
-    typedef std::map<std::string, Entry> table;
+    // transparent comparison, so that the lookups by a char const* name
+    // do not construct a std::string
+    typedef std::map<std::string, Entry, std::less<>> table;
     table const& tbl() const {return tbl_;}
 
     typedef std::map<std::string, ParameterSetEntry> psettable;
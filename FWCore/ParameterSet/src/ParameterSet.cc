@@ -213,19 +213,74 @@ namespace edm {
   // Entry-handling
   // ----------------------------------------------------------------------
 
+  namespace {
+    // the lookups of an Entry, shared by the std::string and the char const*
+    // names so that the latter are done without constructing a std::string
+
+    template<typename Table, typename Name>
+    Entry const& trackedEntry(Table const& tbl, Name const& name) {
+      typename Table::const_iterator it = tbl.find(name);
+      if(it == tbl.end()) {
+          throw Exception(errors::Configuration, "MissingParameter:")
+            << "Parameter '" << name
+            << "' not found.";
+      }
+      if(it->second.isTracked() == false) {
+        if(name[0] == '@') {
+          throw Exception(errors::Configuration, "StatusMismatch:")
+            << "Framework Error:  Parameter '" << name
+            << "' is incorrectly designated as tracked in the framework.";
+        } else {
+          throw Exception(errors::Configuration, "StatusMismatch:")
+            << "Parameter '" << name
+            << "' is designated as tracked in the code,\n"
+            << "but is designated as untracked in the configuration file.\n"
+            << "Please remove 'untracked' from the configuration file for parameter '"<< name << "'.";
+        }
+      }
+      return it->second;
+    }
+
+    template<typename Table, typename Name>
+    Entry const* untrackedEntry(Table const& tbl, Name const& name) {
+      typename Table::const_iterator it = tbl.find(name);
+
+      if(it == tbl.end()) return nullptr;
+      if(it->second.isTracked()) {
+        if(name[0] == '@') {
+          throw Exception(errors::Configuration, "StatusMismatch:")
+            << "Framework Error:  Parameter '" << name
+            << "' is incorrectly designated as untracked in the framework.";
+        } else {
+          throw Exception(errors::Configuration, "StatusMismatch:")
+            << "Parameter '" << name
+            << "' is designated as untracked in the code,\n"
+            << "but is not designated as untracked in the configuration file.\n"
+            << "Please change the configuration file to 'untracked <type> " << name << "'.";
+        }
+      }
+      return &it->second;
+    }
+
+    template<typename Table, typename Name>
+    Entry const* requiredUntrackedEntry(Table const& tbl, Name const& name) {
+      Entry const* result = untrackedEntry(tbl, name);
+      if(result == nullptr)
+        throw Exception(errors::Configuration, "MissingParameter:")
+          << "The required parameter '" << name
+          << "' was not specified.\n";
+      return result;
+    }
+  }
+
   Entry const*
   ParameterSet::getEntryPointerOrThrow_(char const* name) const {
-    return getEntryPointerOrThrow_(std::string(name));
+    return requiredUntrackedEntry(tbl_, name);
   }
 
   Entry const*
   ParameterSet::getEntryPointerOrThrow_(std::string const& name) const {
-    Entry const* result = retrieveUntracked(name);
-    if(result == nullptr)
-      throw Exception(errors::Configuration, "MissingParameter:")
-        << "The required parameter '" << name
-        << "' was not specified.\n";
-    return result;
+    return requiredUntrackedEntry(tbl_, name);
   }
 
   template<typename T, typename U> T first(std::pair<T, U> const& p) {
@@ -238,57 +293,22 @@ namespace edm {
 
   Entry const&
   ParameterSet::retrieve(char const* name) const {
-    return retrieve(std::string(name));
+    return trackedEntry(tbl_, name);
   }
 
   Entry const&
   ParameterSet::retrieve(std::string const& name) const {
-    table::const_iterator  it = tbl_.find(name);
-    if(it == tbl_.end()) {
-        throw Exception(errors::Configuration, "MissingParameter:")
-          << "Parameter '" << name
-          << "' not found.";
-    }
-    if(it->second.isTracked() == false) {
-      if(name[0] == '@') {
-        throw Exception(errors::Configuration, "StatusMismatch:")
-          << "Framework Error:  Parameter '" << name
-          << "' is incorrectly designated as tracked in the framework.";
-      } else {
-        throw Exception(errors::Configuration, "StatusMismatch:")
-          << "Parameter '" << name
-          << "' is designated as tracked in the code,\n"
-          << "but is designated as untracked in the configuration file.\n"
-          << "Please remove 'untracked' from the configuration file for parameter '"<< name << "'.";
-      }
-    }
-    return it->second;
-  }  // retrieve()
+    return trackedEntry(tbl_, name);
+  }
 
   Entry const*
   ParameterSet::retrieveUntracked(char const* name) const {
-    return retrieveUntracked(std::string(name));
+    return untrackedEntry(tbl_, name);
   }
 
   Entry const*
   ParameterSet::retrieveUntracked(std::string const& name) const {
-    table::const_iterator  it = tbl_.find(name);
-
-    if(it == tbl_.end()) return nullptr;
-    if(it->second.isTracked()) {
-      if(name[0] == '@') {
-        throw Exception(errors::Configuration, "StatusMismatch:")
-          << "Framework Error:  Parameter '" << name
-          << "' is incorrectly designated as untracked in the framework.";
-      } else {
-        throw Exception(errors::Configuration, "StatusMismatch:")
-          << "Parameter '" << name
-          << "' is designated as untracked in the code,\n"
-          << "but is not designated as untracked in the configuration file.\n"
-          << "Please change the configuration file to 'untracked <type> " << name << "'.";
-      }
-    }
-    return &it->second;
+    return untrackedEntry(tbl_, name);
   }  // retrieve()
 
   ParameterSetEntry const&
@@ -371,7 +391,11 @@ namespace edm {
 
   Entry const*
   ParameterSet::retrieveUnknown(char const* name) const {
-    return retrieveUnknown(std::string(name));
+    table::const_iterator it = tbl_.find(name);
+    if(it == tbl_.end()) {
+      return nullptr;
+    }
+    return &it->second;
   }
 
   Entry const*
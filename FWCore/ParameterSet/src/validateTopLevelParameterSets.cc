@@ -19,7 +19,7 @@ void fillOptionsDescription(ParameterSetDescription& description) {
     setComment("If zero, then set the number of streams to be the same as the number of threads");
   description.addUntracked<unsigned int>("numberOfConcurrentRuns", 1);
   description.addUntracked<unsigned int>("numberOfConcurrentLuminosityBlocks", 1)->
-    setComment("If zero, then set the same as the number of runs");
+    setComment("If zero, then set the same as the number of runs. Values larger than the number of streams are reduced to the number of streams");
   description.addUntracked<bool>("wantSummary", false)->
     setComment("Set true to print a report on the trigger decisions and timing of modules");
   description.addUntracked<std::string>("fileMode", "FULLMERGE")->
@@ -45,6 +45,12 @@ void fillOptionsDescription(ParameterSetDescription& description) {
 
   description.addUntracked<std::vector<std::string>>("canDeleteEarly", emptyVector)->
     setComment("Branch names of products that the Framework can try to delete before the end of the Event");
+  description.addUntracked<bool>("deleteEarlyNotKeptProducts", false)->
+    setComment("If true, all products not kept by an OutputModule are treated as if listed in 'canDeleteEarly'."
+               " The readers of a product are found from the consumes calls of the modules."
+               " Products only accessed through a Ref held by another product must not be deleted early.");
+  description.addUntracked<std::vector<std::string>>("highPriorityModules", emptyVector)->
+    setComment("Labels of modules which are run before other modules when waiting for the same shared resource");
 
   description.addOptionalUntracked<bool>("allowUnscheduled")->
     setComment("Obsolete. Has no effect. Allowed only for backward compatibility for old Python configuration files.");
@@ -207,7 +207,7 @@ namespace soa {
     
     template<typename U>
     ColumnValues<typename U::type> column() const {
-      return ColumnValues<typename U::type>{static_cast<typename U::type*>(columnAddress<U>()), m_size};
+      return ColumnValues<typename U::type>{static_cast<typename U::type const*>(columnAddress<U>()), m_size};
     }
     template<typename U>
     MutableColumnValues<typename U::type> column() {
@@ -223,11 +223,11 @@ namespace soa {
     
     const_iterator begin() const { 
       std::array<void const*, sizeof...(Args)> t;
-      for(size_t i = 0; i<size();++i) { t[i] = m_values[i]; }
+      for(size_t i = 0; i<kNColumns;++i) { t[i] = m_values[i]; }
       return const_iterator{t}; }
     const_iterator end() const { 
       std::array<void const*, sizeof...(Args)> t;
-      for(size_t i = 0; i<size();++i) { t[i] = m_values[i]; }
+      for(size_t i = 0; i<kNColumns;++i) { t[i] = m_values[i]; }
       return const_iterator{t,size()}; }
 
     iterator begin() { return iterator{m_values}; }
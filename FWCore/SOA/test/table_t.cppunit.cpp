@@ -318,6 +318,17 @@ void testTable::tableStandardOpsTest()
     opEqMvTable=std::move(moveTable);
     compare(opEqMvTable,particles);
   }
+
+  {
+    //const iteration over a table with more columns than rows
+    ParticleTable const& constTable = particles;
+    auto itE = energy.begin();
+    for(auto const& v: constTable) {
+      CPPUNIT_ASSERT(tolerance(*itE, v.get<Energy>()));
+      ++itE;
+    }
+    CPPUNIT_ASSERT(itE == energy.end());
+  }
   
 }
 
@@ -0,0 +1,346 @@
+// -*- C++ -*-
+//
+// Package:     FWCore/Services
+// Class  :     ChromeTracer
+//
+// Implementation:
+//     Records the time spans of the source, module, acquire, read from source and
+//     EventSetup get calls of each thread in per thread ring buffers and writes them at the
+//     end of the job in the Chrome trace event format, which chrome://tracing and the
+//     Perfetto UI read. For each module call, a flow arrow is drawn from the end of the
+//     last of the modules it consumes from to finish in the same Event, i.e. the dependency
+//     on its critical path.
+//
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <fstream>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <tuple>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "DataFormats/Provenance/interface/EventID.h"
+#include "DataFormats/Provenance/interface/ModuleDescription.h"
+#include "FWCore/Framework/interface/ComponentDescription.h"
+#include "FWCore/Framework/interface/DataKey.h"
+#include "FWCore/Framework/interface/EventSetupRecordKey.h"
+#include "FWCore/MessageLogger/interface/MessageLogger.h"
+#include "FWCore/ParameterSet/interface/ConfigurationDescriptions.h"
+#include "FWCore/ParameterSet/interface/ParameterSet.h"
+#include "FWCore/ParameterSet/interface/ParameterSetDescription.h"
+#include "FWCore/ServiceRegistry/interface/ActivityRegistry.h"
+#include "FWCore/ServiceRegistry/interface/ModuleCallingContext.h"
+#include "FWCore/ServiceRegistry/interface/PathsAndConsumesOfModulesBase.h"
+#include "FWCore/ServiceRegistry/interface/ServiceMaker.h"
+#include "FWCore/ServiceRegistry/interface/StreamContext.h"
+
+namespace {
+  enum class Kind : std::uint8_t { kSource, kModule, kAcquire, kReadFromSource, kEventSetup };
+
+  char const* const s_kindNames[] = {"source", "module", "acquire", "read from source", "event setup"};
+
+  constexpr std::uint32_t kNoStream = 0xffffffff;
+
+  struct Span {
+    std::uint64_t begin_;   // ns since the construction of the service
+    std::uint64_t end_;
+    edm::EventID event_;    // invalid if not known
+    edm::eventsetup::ComponentDescription const* component_;   // for Kind::kEventSetup
+    std::uint32_t id_;      // module id
+    std::uint32_t stream_;
+    Kind kind_;
+  };
+
+  //the last spans recorded by one thread, the oldest ones are overwritten when it is full
+  struct ThreadBuffer {
+    explicit ThreadBuffer(unsigned int iThread, std::size_t iCapacity): thread_(iThread), capacity_(iCapacity) {
+      spans_.reserve(capacity_);
+    }
+
+    void push(Span const& iSpan) {
+      if(spans_.size() < capacity_) {
+        spans_.push_back(iSpan);
+      } else {
+        spans_[next_] = iSpan;
+        next_ = (next_+1) % capacity_;
+        wrapped_ = true;
+      }
+    }
+
+    unsigned int thread_;
+    std::size_t capacity_;
+    std::size_t next_ = 0;
+    bool wrapped_ = false;
+    std::vector<Span> spans_;
+    //the spans begun but not yet ended, calls can be nested on the same thread
+    std::vector<Span> open_;
+  };
+
+  void writeEscaped(std::ostream& oStream, std::string const& iString) {
+    for(char c : iString) {
+      if(c == '"' or c == '\\') {
+        oStream<<'\\';
+      }
+      oStream<<c;
+    }
+  }
+}
+
+namespace edm {
+  namespace service {
+    class ChromeTracer {
+    public:
+      ChromeTracer(edm::ParameterSet const& iConfig, edm::ActivityRegistry& iAR);
+      static void fillDescriptions(edm::ConfigurationDescriptions & descriptions);
+    private:
+      std::uint64_t now() const {
+        return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - m_start).count();
+      }
+      ThreadBuffer& buffer();
+      void begin(Kind iKind, std::uint32_t iID, std::uint32_t iStream, EventID const& iEvent,
+                 eventsetup::ComponentDescription const* iComponent = nullptr);
+      void end();
+      void write() const;
+
+      static std::atomic<unsigned int> s_nInstances;
+      unsigned int const m_instance;
+      std::chrono::steady_clock::time_point const m_start;
+      std::string m_fileName;
+      std::size_t m_spansPerThread;
+
+      std::vector<std::string> m_labelForID;
+      std::vector<std::vector<unsigned int>> m_dependencies;
+      unsigned int m_sourceID = 0;
+
+      std::mutex m_buffersMutex;
+      std::vector<std::unique_ptr<ThreadBuffer>> m_buffers;
+    };
+  }
+}
+
+using namespace edm::service;
+
+std::atomic<unsigned int> ChromeTracer::s_nInstances{0};
+
+ChromeTracer::ChromeTracer(edm::ParameterSet const& iConfig, edm::ActivityRegistry& iReg):
+m_instance(++s_nInstances),
+m_start(std::chrono::steady_clock::now()),
+m_fileName(iConfig.getUntrackedParameter<std::string>("fileName")),
+m_spansPerThread(std::max(1u, iConfig.getUntrackedParameter<unsigned int>("spansPerThread")))
+{
+  auto setLabel = [this](ModuleDescription const& iMod) {
+    if(iMod.id() >= m_labelForID.size()) {
+      m_labelForID.resize(iMod.id()+1);
+    }
+    m_labelForID[iMod.id()] = iMod.moduleLabel();
+  };
+  iReg.watchPreModuleConstruction(setLabel);
+  iReg.watchPreSourceConstruction([this, setLabel](ModuleDescription const& iMod) {
+    setLabel(iMod);
+    m_sourceID = iMod.id();
+  });
+
+  //called once per (sub)process, the module ids are unique in the job
+  iReg.watchPreBeginJob([this](PathsAndConsumesOfModulesBase const& iPathsAndConsumes, ProcessContext const&) {
+    for(auto const* module : iPathsAndConsumes.allModules()) {
+      if(module->id() >= m_dependencies.size()) {
+        m_dependencies.resize(module->id()+1);
+      }
+      auto& dependencies = m_dependencies[module->id()];
+      for(auto const* producer : iPathsAndConsumes.modulesWhoseProductsAreConsumedBy(module->id())) {
+        dependencies.push_back(producer->id());
+      }
+    }
+  });
+
+  iReg.watchPreSourceEvent([this](StreamID iStream) {
+    begin(Kind::kSource, m_sourceID, iStream.value(), EventID());
+  });
+  iReg.watchPostSourceEvent([this](StreamID) {
+    end();
+  });
+
+  iReg.watchPreModuleEventAcquire([this](StreamContext const& iStream, ModuleCallingContext const& iContext) {
+    begin(Kind::kAcquire, iContext.moduleDescription()->id(), iStream.streamID().value(), iStream.eventID());
+  });
+  iReg.watchPostModuleEventAcquire([this](StreamContext const&, ModuleCallingContext const&) {
+    end();
+  });
+
+  iReg.watchPreModuleEvent([this](StreamContext const& iStream, ModuleCallingContext const& iContext) {
+    begin(Kind::kModule, iContext.moduleDescription()->id(), iStream.streamID().value(), iStream.eventID());
+  });
+  iReg.watchPostModuleEvent([this](StreamContext const&, ModuleCallingContext const&) {
+    end();
+  });
+
+  iReg.watchPreEventReadFromSource([this](StreamContext const& iStream, ModuleCallingContext const& iContext) {
+    begin(Kind::kReadFromSource, iContext.moduleDescription()->id(), iStream.streamID().value(), iStream.eventID());
+  });
+  iReg.watchPostEventReadFromSource([this](StreamContext const&, ModuleCallingContext const&) {
+    end();
+  });
+
+  //the span starts once the lock of the data proxy is taken, so the waiting for the lock is not included
+  iReg.watchPostLockEventSetupGet([this](eventsetup::ComponentDescription const* iComponent,
+                                         eventsetup::EventSetupRecordKey const&,
+                                         eventsetup::DataKey const&) {
+    begin(Kind::kEventSetup, 0, kNoStream, EventID(), iComponent);
+  });
+  iReg.watchPostEventSetupGet([this](eventsetup::ComponentDescription const*,
+                                     eventsetup::EventSetupRecordKey const&,
+                                     eventsetup::DataKey const&) {
+    end();
+  });
+
+  iReg.watchPostEndJob([this]() {
+    write();
+  });
+}
+
+ThreadBuffer&
+ChromeTracer::buffer()
+{
+  //the instance number tells apart the buffers of a previous service in the same process
+  thread_local std::pair<unsigned int, ThreadBuffer*> s_buffer{0, nullptr};
+  if(s_buffer.first != m_instance) {
+    std::lock_guard<std::mutex> guard(m_buffersMutex);
+    m_buffers.push_back(std::make_unique<ThreadBuffer>(m_buffers.size(), m_spansPerThread));
+    s_buffer = std::make_pair(m_instance, m_buffers.back().get());
+  }
+  return *s_buffer.second;
+}
+
+void
+ChromeTracer::begin(Kind iKind, std::uint32_t iID, std::uint32_t iStream, EventID const& iEvent,
+                    eventsetup::ComponentDescription const* iComponent)
+{
+  buffer().open_.push_back(Span{now(), 0, iEvent, iComponent, iID, iStream, iKind});
+}
+
+void
+ChromeTracer::end()
+{
+  auto& threadBuffer = buffer();
+  if(threadBuffer.open_.empty()) {
+    return;
+  }
+  Span span = threadBuffer.open_.back();
+  threadBuffer.open_.pop_back();
+  span.end_ = now();
+  threadBuffer.push(span);
+}
+
+void
+ChromeTracer::write() const
+{
+  std::ofstream file(m_fileName);
+  if(not file) {
+    edm::LogWarning("ChromeTracer")<<"Could not open '"<<m_fileName<<"', no trace is written.";
+    return;
+  }
+  auto label = [this](Span const& iSpan) -> std::string const& {
+    static std::string const s_unknown("unknown");
+    if(iSpan.kind_ == Kind::kEventSetup) {
+      if(iSpan.component_ == nullptr) {
+        return s_unknown;
+      }
+      return iSpan.component_->label_.empty() ? iSpan.component_->type_ : iSpan.component_->label_;
+    }
+    return iSpan.id_ < m_labelForID.size() ? m_labelForID[iSpan.id_] : s_unknown;
+  };
+
+  //timestamps are in microseconds in the trace event format
+  file.setf(std::ios::fixed);
+  file.precision(3);
+  file<<"{\"displayTimeUnit\": \"ns\", \"traceEvents\": [";
+  bool first = true;
+  auto separator = [&first, &file]() {
+    file<<(first ? "\n" : ",\n");
+    first = false;
+  };
+
+  //the module calls of each Event, identified by stream, run, lumi and event number, to find the critical dependencies
+  std::map<std::tuple<std::uint32_t, RunNumber_t, LuminosityBlockNumber_t, EventNumber_t>,
+           std::unordered_map<unsigned int, std::pair<Span const*, unsigned int>>> callsInEvent;
+
+  for(auto const& threadBuffer : m_buffers) {
+    separator();
+    file<<"{\"ph\": \"M\", \"name\": \"thread_name\", \"pid\": 0, \"tid\": "<<threadBuffer->thread_
+        <<", \"args\": {\"name\": \"thread "<<threadBuffer->thread_<<"\"}}";
+
+    auto const& spans = threadBuffer->spans_;
+    std::size_t const start = threadBuffer->wrapped_ ? threadBuffer->next_ : 0;
+    for(std::size_t i = 0; i < spans.size(); ++i) {
+      auto const& span = spans[(start + i) % spans.size()];
+      separator();
+      file<<"{\"ph\": \"X\", \"name\": \"";
+      writeEscaped(file, label(span));
+      file<<"\", \"cat\": \""<<s_kindNames[static_cast<unsigned int>(span.kind_)]
+          <<"\", \"pid\": 0, \"tid\": "<<threadBuffer->thread_
+          <<", \"ts\": "<<span.begin_/1000.<<", \"dur\": "<<(span.end_ - span.begin_)/1000.;
+      if(span.stream_ != kNoStream) {
+        file<<", \"args\": {\"stream\": "<<span.stream_<<", \"run\": "<<span.event_.run()
+            <<", \"lumi\": "<<span.event_.luminosityBlock()<<", \"event\": "<<span.event_.event()<<"}";
+      }
+      file<<"}";
+      if(span.kind_ == Kind::kModule) {
+        auto const key = std::make_tuple(span.stream_, span.event_.run(), span.event_.luminosityBlock(), span.event_.event());
+        callsInEvent[key][span.id_] = std::make_pair(&span, threadBuffer->thread_);
+      }
+    }
+  }
+
+  //flow arrow from the dependency which finished last to the start of the module call
+  unsigned int flowID = 0;
+  for(auto const& event : callsInEvent) {
+    auto const& calls = event.second;
+    for(auto const& call : calls) {
+      auto const& consumer = *call.second.first;
+      if(call.first >= m_dependencies.size()) {
+        continue;
+      }
+      std::pair<Span const*, unsigned int> critical{nullptr, 0};
+      for(auto producerID : m_dependencies[call.first]) {
+        auto found = calls.find(producerID);
+        if(found == calls.end() or found->second.first->end_ > consumer.begin_) {
+          continue;
+        }
+        if(critical.first == nullptr or found->second.first->end_ > critical.first->end_) {
+          critical = found->second;
+        }
+      }
+      if(critical.first == nullptr) {
+        continue;
+      }
+      ++flowID;
+      separator();
+      file<<"{\"ph\": \"s\", \"name\": \"dependency\", \"cat\": \"critical path\", \"id\": "<<flowID
+          <<", \"pid\": 0, \"tid\": "<<critical.second<<", \"ts\": "<<(critical.first->end_ - 1)/1000.<<"}";
+      separator();
+      file<<"{\"ph\": \"f\", \"bp\": \"e\", \"name\": \"dependency\", \"cat\": \"critical path\", \"id\": "<<flowID
+          <<", \"pid\": 0, \"tid\": "<<call.second.second<<", \"ts\": "<<consumer.begin_/1000.<<"}";
+    }
+  }
+  file<<"\n]}\n";
+}
+
+void
+ChromeTracer::fillDescriptions(edm::ConfigurationDescriptions & descriptions)
+{
+  edm::ParameterSetDescription desc;
+  desc.addUntracked<std::string>("fileName", "trace.json")->setComment("Name of the file the trace is written to at the end of the job");
+  desc.addUntracked<unsigned int>("spansPerThread", 100000)->setComment("Number of spans kept per thread, only the most recent ones are written");
+  descriptions.add("ChromeTracer", desc);
+  descriptions.setComment("Writes the calls of the source, the modules and the EventSetup of each thread in the Chrome trace event format,"
+                          " which can be opened with chrome://tracing or https://ui.perfetto.dev .\n"
+                          " A flow arrow goes to each module call from the module it consumes from which finished last in the same Event.");
+}
+
+DEFINE_FWK_SERVICE(ChromeTracer);
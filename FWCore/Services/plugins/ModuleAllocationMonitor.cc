@@ -0,0 +1,305 @@
+// -*- C++ -*-
+//
+// Package:     FWCore/Services
+// Class  :     ModuleAllocationMonitor
+//
+// Implementation:
+//     Uses the per thread allocation statistics of jemalloc to attribute the memory
+//     allocated and deallocated by each module during its Event call.
+//
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <dlfcn.h>
+#include <fstream>
+#include <iomanip>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "DataFormats/Provenance/interface/ModuleDescription.h"
+#include "FWCore/MessageLogger/interface/MessageLogger.h"
+#include "FWCore/ParameterSet/interface/ConfigurationDescriptions.h"
+#include "FWCore/ParameterSet/interface/ParameterSet.h"
+#include "FWCore/ParameterSet/interface/ParameterSetDescription.h"
+#include "FWCore/ServiceRegistry/interface/ActivityRegistry.h"
+#include "FWCore/ServiceRegistry/interface/ModuleCallingContext.h"
+#include "FWCore/ServiceRegistry/interface/ServiceMaker.h"
+
+// see <jemalloc/jemalloc.h>
+extern "C" {
+  typedef int (*mallctl_t)(const char *name, void *oldp, size_t *oldlenp, void *newp, size_t newlen);
+}
+
+namespace {
+  mallctl_t findMallctl() {
+    auto mallctl = reinterpret_cast<mallctl_t>(::dlsym(RTLD_DEFAULT, "mallctl"));
+    if(mallctl == nullptr) {
+      return nullptr;
+    }
+    //the statistics are only available if jemalloc was configured with --enable-stats
+    bool enableStats = false;
+    size_t boolSize = sizeof(bool);
+    if(0 != mallctl("config.stats", &enableStats, &boolSize, nullptr, 0) or not enableStats) {
+      return nullptr;
+    }
+    return mallctl;
+  }
+
+  mallctl_t const s_mallctl = findMallctl();
+
+  std::uint64_t const s_zero = 0;
+
+  std::uint64_t const* threadStatistic(char const* iName) {
+    std::uint64_t const* value = &s_zero;
+    size_t ptrSize = sizeof(std::uint64_t*);
+    if(s_mallctl) {
+      s_mallctl(iName, &value, &ptrSize, nullptr, 0);
+    }
+    return value;
+  }
+
+  struct ThreadCounters {
+    ThreadCounters():
+      allocated_(threadStatistic("thread.allocatedp")),
+      deallocated_(threadStatistic("thread.deallocatedp")) {}
+
+    std::uint64_t allocated() const { return *allocated_; }
+    std::uint64_t deallocated() const { return *deallocated_; }
+
+    std::uint64_t const* allocated_;
+    std::uint64_t const* deallocated_;
+  };
+
+  struct Start {
+    std::uint64_t allocated_;
+    std::uint64_t deallocated_;
+  };
+
+  ThreadCounters const& threadCounters() {
+    thread_local ThreadCounters const counters;
+    return counters;
+  }
+
+  //a module can be running inside another module's call on the same thread so keep a stack
+  std::vector<Start>& startStack() {
+    thread_local std::vector<Start> stack;
+    return stack;
+  }
+
+  void updateMax(std::atomic<std::int64_t>& iMax, std::int64_t iValue) {
+    auto old = iMax.load();
+    while(old < iValue and not iMax.compare_exchange_weak(old, iValue)) {}
+  }
+}
+
+namespace edm {
+  namespace service {
+    class ModuleAllocationMonitor {
+    public:
+      ModuleAllocationMonitor(edm::ParameterSet const& iConfig, edm::ActivityRegistry& iAR);
+      static void fillDescriptions(edm::ConfigurationDescriptions & descriptions);
+    private:
+      struct ModuleStats {
+        std::atomic<std::uint64_t> nCalls_{0};
+        std::atomic<std::uint64_t> allocated_{0};
+        std::atomic<std::uint64_t> deallocated_{0};
+        std::atomic<std::int64_t> maxAllocatedInCall_{0};
+        std::atomic<std::int64_t> maxRetainedInCall_{0};
+      };
+
+      void start();
+      void stop(ModuleCallingContext const&);
+      void startDelayedGet();
+      void stopDelayedGet();
+      void report() const;
+      void writeJSON() const;
+
+      std::vector<std::pair<std::string, std::string>> m_labelAndTypeForID;
+      std::unique_ptr<ModuleStats[]> m_stats;
+      std::string m_fileName;
+    };
+  }
+}
+
+using namespace edm::service;
+
+ModuleAllocationMonitor::ModuleAllocationMonitor(edm::ParameterSet const& iConfig, edm::ActivityRegistry& iReg):
+m_fileName(iConfig.getUntrackedParameter<std::string>("fileName"))
+{
+  if(nullptr == s_mallctl) {
+    edm::LogWarning("ModuleAllocationMonitor")<<"The job is not using jemalloc with statistics enabled so no allocations will be monitored.";
+    return;
+  }
+
+  iReg.watchPreModuleConstruction( [this](ModuleDescription const& iMod) {
+    if(iMod.id() >= m_labelAndTypeForID.size()) {
+      m_labelAndTypeForID.resize(iMod.id()+1);
+    }
+    m_labelAndTypeForID[iMod.id()] = std::make_pair(iMod.moduleLabel(), iMod.moduleName());
+  });
+
+  iReg.watchPreBeginJob([this](PathsAndConsumesOfModulesBase const&, ProcessContext const&) {
+    m_stats.reset(new ModuleStats[m_labelAndTypeForID.size()]);
+  });
+
+  iReg.watchPreModuleEvent([this](StreamContext const&, ModuleCallingContext const&) {
+    start();
+  });
+  iReg.watchPostModuleEvent([this](StreamContext const&, ModuleCallingContext const& iContext) {
+    stop(iContext);
+  });
+
+  //memory used to read delayed products is not attributed to the module asking for the product
+  iReg.watchPreModuleEventDelayedGet([this](StreamContext const&, ModuleCallingContext const& iContext) {
+    if(iContext.state() == ModuleCallingContext::State::kRunning) {
+      startDelayedGet();
+    }
+  });
+  iReg.watchPostModuleEventDelayedGet([this](StreamContext const&, ModuleCallingContext const& iContext) {
+    if(iContext.state() == ModuleCallingContext::State::kRunning) {
+      stopDelayedGet();
+    }
+  });
+
+  iReg.watchPostEndJob([this]() {
+    report();
+    if(not m_fileName.empty()) {
+      writeJSON();
+    }
+  });
+}
+
+void
+ModuleAllocationMonitor::start()
+{
+  auto const& counters = threadCounters();
+  startStack().push_back(Start{counters.allocated(), counters.deallocated()});
+}
+
+void
+ModuleAllocationMonitor::stop(ModuleCallingContext const& iContext)
+{
+  auto& stack = startStack();
+  if(stack.empty()) {
+    return;
+  }
+  auto const& counters = threadCounters();
+  auto const start = stack.back();
+  stack.pop_back();
+
+  std::int64_t const allocated = counters.allocated() - start.allocated_;
+  std::int64_t const deallocated = counters.deallocated() - start.deallocated_;
+
+  auto id = iContext.moduleDescription()->id();
+  if(not m_stats or id >= m_labelAndTypeForID.size()) {
+    return;
+  }
+  auto& stats = m_stats[id];
+  ++stats.nCalls_;
+  stats.allocated_ += allocated;
+  stats.deallocated_ += deallocated;
+  updateMax(stats.maxAllocatedInCall_, allocated);
+  updateMax(stats.maxRetainedInCall_, allocated - deallocated);
+}
+
+void
+ModuleAllocationMonitor::startDelayedGet()
+{
+  start();
+}
+
+void
+ModuleAllocationMonitor::stopDelayedGet()
+{
+  auto& stack = startStack();
+  if(stack.empty()) {
+    return;
+  }
+  auto const& counters = threadCounters();
+  auto const start = stack.back();
+  stack.pop_back();
+  if(not stack.empty()) {
+    //shift the start of the module so the delayed get is not included
+    stack.back().allocated_ += counters.allocated() - start.allocated_;
+    stack.back().deallocated_ += counters.deallocated() - start.deallocated_;
+  }
+}
+
+void
+ModuleAllocationMonitor::report() const
+{
+  if(not m_stats) {
+    return;
+  }
+  std::vector<unsigned int> order;
+  for(unsigned int id = 0; id < m_labelAndTypeForID.size(); ++id) {
+    if(m_stats[id].nCalls_ != 0) {
+      order.push_back(id);
+    }
+  }
+  std::sort(order.begin(), order.end(), [this](unsigned int iLHS, unsigned int iRHS) {
+    return m_stats[iLHS].allocated_ > m_stats[iRHS].allocated_;
+  });
+
+  constexpr double kB = 1024.;
+  LogVerbatim l("ModuleAllocationMonitor");
+  l<<"ModuleAllocationMonitor summary (memory in kB, per Event call)\n"
+   <<std::setw(12)<<"Calls"
+   <<std::setw(14)<<"Allocated"
+   <<std::setw(14)<<"Max Allocated"
+   <<std::setw(14)<<"Retained"
+   <<std::setw(14)<<"Max Retained"
+   <<"  Module";
+  for(auto id: order) {
+    auto const& stats = m_stats[id];
+    double const nCalls = stats.nCalls_;
+    l<<"\n"
+     <<std::setw(12)<<stats.nCalls_
+     <<std::setw(14)<<std::fixed<<std::setprecision(1)<<stats.allocated_/nCalls/kB
+     <<std::setw(14)<<stats.maxAllocatedInCall_/kB
+     <<std::setw(14)<<(double(stats.allocated_)-double(stats.deallocated_))/nCalls/kB
+     <<std::setw(14)<<stats.maxRetainedInCall_/kB
+     <<"  "<<m_labelAndTypeForID[id].first<<" ("<<m_labelAndTypeForID[id].second<<")";
+  }
+}
+
+void
+ModuleAllocationMonitor::writeJSON() const
+{
+  std::ofstream file(m_fileName);
+  file<<"{\n  \"resources\": [\"allocated\", \"deallocated\", \"max_allocated\", \"max_retained\"],\n  \"modules\": [";
+  bool first = true;
+  for(unsigned int id = 0; id < m_labelAndTypeForID.size(); ++id) {
+    auto const& stats = m_stats[id];
+    if(stats.nCalls_ == 0) {
+      continue;
+    }
+    if(not first) {
+      file<<",";
+    }
+    first = false;
+    file<<"\n    {\"label\": \""<<m_labelAndTypeForID[id].first
+        <<"\", \"type\": \""<<m_labelAndTypeForID[id].second
+        <<"\", \"events\": "<<stats.nCalls_
+        <<", \"allocated\": "<<stats.allocated_
+        <<", \"deallocated\": "<<stats.deallocated_
+        <<", \"max_allocated\": "<<stats.maxAllocatedInCall_
+        <<", \"max_retained\": "<<stats.maxRetainedInCall_<<"}";
+  }
+  file<<"\n  ]\n}\n";
+}
+
+void
+ModuleAllocationMonitor::fillDescriptions(edm::ConfigurationDescriptions & descriptions)
+{
+  edm::ParameterSetDescription desc;
+  desc.addUntracked<std::string>("fileName", std::string())->setComment("If not empty, the per module results are also written in JSON format to this file");
+  descriptions.add("ModuleAllocationMonitor", desc);
+  descriptions.setComment("Requires the job to use jemalloc with statistics enabled.\n"
+                          " Allocated is the memory allocated by a module during its Event call while Retained is what"
+                          " was allocated minus what was freed during the call, i.e. mostly what the module put into the Event.");
+}
+
+DEFINE_FWK_SERVICE(ModuleAllocationMonitor);
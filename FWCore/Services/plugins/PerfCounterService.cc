@@ -0,0 +1,361 @@
+// -*- C++ -*-
+//
+// Package:     FWCore/Services
+// Class  :     PerfCounterService
+//
+// Implementation:
+//     Uses per thread groups of Linux perf_event hardware counters to attribute the
+//     cycles, instructions, last level cache misses and branch misses of each thread
+//     to the module running in it during its Event (and acquire) calls.
+//
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <iomanip>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#if defined(__linux__)
+#include <linux/perf_event.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+#include "DataFormats/Provenance/interface/ModuleDescription.h"
+#include "FWCore/MessageLogger/interface/MessageLogger.h"
+#include "FWCore/ParameterSet/interface/ConfigurationDescriptions.h"
+#include "FWCore/ParameterSet/interface/ParameterSet.h"
+#include "FWCore/ParameterSet/interface/ParameterSetDescription.h"
+#include "FWCore/ServiceRegistry/interface/ActivityRegistry.h"
+#include "FWCore/ServiceRegistry/interface/ModuleCallingContext.h"
+#include "FWCore/ServiceRegistry/interface/ServiceMaker.h"
+
+namespace {
+  enum Counter { kCycles, kInstructions, kCacheMisses, kBranchMisses, kNCounters };
+
+  char const* const s_counterNames[kNCounters] = {"cycles", "instructions", "cache_misses", "branch_misses"};
+
+  using Values = std::array<std::uint64_t, kNCounters>;
+
+  std::atomic<bool> s_warned{false};
+
+  void warnOnce(char const* iWhat) {
+    if(not s_warned.exchange(true)) {
+      edm::LogWarning("PerfCounterService")<<"The hardware counters could not be "<<iWhat
+                                           <<" so the threads affected are not monitored.\n"
+                                           <<"Check that the machine has a PMU and that /proc/sys/kernel/perf_event_paranoid allows user space measurements.";
+    }
+  }
+
+  //the counters of the thread, opened as one group so that they are read together
+  class ThreadCounters {
+  public:
+    ThreadCounters() {
+      m_fds.fill(-1);
+#if defined(__linux__)
+      std::uint64_t const configs[kNCounters] = {PERF_COUNT_HW_CPU_CYCLES, PERF_COUNT_HW_INSTRUCTIONS,
+                                                 PERF_COUNT_HW_CACHE_MISSES, PERF_COUNT_HW_BRANCH_MISSES};
+      for(unsigned int i = 0; i < kNCounters; ++i) {
+        perf_event_attr attr;
+        std::memset(&attr, 0, sizeof(attr));
+        attr.size = sizeof(attr);
+        attr.type = PERF_TYPE_HARDWARE;
+        attr.config = configs[i];
+        attr.read_format = PERF_FORMAT_GROUP;
+        attr.exclude_kernel = 1;
+        attr.exclude_hv = 1;
+        //this thread, on any cpu
+        m_fds[i] = ::syscall(__NR_perf_event_open, &attr, 0, -1, (i == 0 ? -1 : m_fds[0]), 0);
+        if(m_fds[i] == -1) {
+          close();
+          warnOnce("opened");
+          return;
+        }
+      }
+#else
+      warnOnce("opened on this platform");
+#endif
+    }
+    ~ThreadCounters() { close(); }
+    ThreadCounters(ThreadCounters const&) = delete;
+    ThreadCounters& operator=(ThreadCounters const&) = delete;
+
+    bool read(Values& oValues) const {
+#if defined(__linux__)
+      if(m_fds[0] == -1) {
+        return false;
+      }
+      struct {
+        std::uint64_t nr;
+        std::uint64_t values[kNCounters];
+      } buffer;
+      if(::read(m_fds[0], &buffer, sizeof(buffer)) != sizeof(buffer) or buffer.nr != kNCounters) {
+        warnOnce("read");
+        return false;
+      }
+      std::copy(buffer.values, buffer.values+kNCounters, oValues.begin());
+      return true;
+#else
+      return false;
+#endif
+    }
+
+  private:
+    void close() {
+#if defined(__linux__)
+      for(auto& fd : m_fds) {
+        if(fd != -1) {
+          ::close(fd);
+          fd = -1;
+        }
+      }
+#endif
+    }
+
+    std::array<int, kNCounters> m_fds;
+  };
+
+  struct Start {
+    Values values_;
+    bool valid_;
+  };
+
+  ThreadCounters const& threadCounters() {
+    thread_local ThreadCounters const counters;
+    return counters;
+  }
+
+  //a module can be running inside another module's call on the same thread so keep a stack
+  std::vector<Start>& startStack() {
+    thread_local std::vector<Start> stack;
+    return stack;
+  }
+}
+
+namespace edm {
+  namespace service {
+    class PerfCounterService {
+    public:
+      PerfCounterService(edm::ParameterSet const& iConfig, edm::ActivityRegistry& iAR);
+      static void fillDescriptions(edm::ConfigurationDescriptions & descriptions);
+    private:
+      struct ModuleStats {
+        std::atomic<std::uint64_t> nCalls_{0};
+        std::array<std::atomic<std::uint64_t>, kNCounters> counts_{};
+      };
+
+      void start();
+      void stop(ModuleCallingContext const&, bool iCountCall);
+      void startDelayedGet();
+      void stopDelayedGet();
+      void report() const;
+      void writeJSON() const;
+
+      std::vector<std::pair<std::string, std::string>> m_labelAndTypeForID;
+      std::unique_ptr<ModuleStats[]> m_stats;
+      std::string m_fileName;
+    };
+  }
+}
+
+using namespace edm::service;
+
+PerfCounterService::PerfCounterService(edm::ParameterSet const& iConfig, edm::ActivityRegistry& iReg):
+m_fileName(iConfig.getUntrackedParameter<std::string>("fileName"))
+{
+  iReg.watchPreModuleConstruction( [this](ModuleDescription const& iMod) {
+    if(iMod.id() >= m_labelAndTypeForID.size()) {
+      m_labelAndTypeForID.resize(iMod.id()+1);
+    }
+    m_labelAndTypeForID[iMod.id()] = std::make_pair(iMod.moduleLabel(), iMod.moduleName());
+  });
+
+  iReg.watchPreBeginJob([this](PathsAndConsumesOfModulesBase const&, ProcessContext const&) {
+    m_stats.reset(new ModuleStats[m_labelAndTypeForID.size()]);
+  });
+
+  iReg.watchPreModuleEventAcquire([this](StreamContext const&, ModuleCallingContext const&) {
+    start();
+  });
+  iReg.watchPostModuleEventAcquire([this](StreamContext const&, ModuleCallingContext const& iContext) {
+    stop(iContext, false);
+  });
+
+  iReg.watchPreModuleEvent([this](StreamContext const&, ModuleCallingContext const&) {
+    start();
+  });
+  iReg.watchPostModuleEvent([this](StreamContext const&, ModuleCallingContext const& iContext) {
+    stop(iContext, true);
+  });
+
+  //the work done to read delayed products is not attributed to the module asking for the product
+  iReg.watchPreModuleEventDelayedGet([this](StreamContext const&, ModuleCallingContext const& iContext) {
+    if(iContext.state() == ModuleCallingContext::State::kRunning) {
+      startDelayedGet();
+    }
+  });
+  iReg.watchPostModuleEventDelayedGet([this](StreamContext const&, ModuleCallingContext const& iContext) {
+    if(iContext.state() == ModuleCallingContext::State::kRunning) {
+      stopDelayedGet();
+    }
+  });
+
+  iReg.watchPostEndJob([this]() {
+    report();
+    if(not m_fileName.empty()) {
+      writeJSON();
+    }
+  });
+}
+
+void
+PerfCounterService::start()
+{
+  Start start;
+  start.valid_ = threadCounters().read(start.values_);
+  startStack().push_back(start);
+}
+
+void
+PerfCounterService::stop(ModuleCallingContext const& iContext, bool iCountCall)
+{
+  auto& stack = startStack();
+  if(stack.empty()) {
+    return;
+  }
+  auto const start = stack.back();
+  stack.pop_back();
+
+  Values values;
+  if(not start.valid_ or not threadCounters().read(values)) {
+    return;
+  }
+
+  auto id = iContext.moduleDescription()->id();
+  if(not m_stats or id >= m_labelAndTypeForID.size()) {
+    return;
+  }
+  auto& stats = m_stats[id];
+  if(iCountCall) {
+    ++stats.nCalls_;
+  }
+  for(unsigned int i = 0; i < kNCounters; ++i) {
+    stats.counts_[i].fetch_add(values[i] - start.values_[i], std::memory_order_relaxed);
+  }
+}
+
+void
+PerfCounterService::startDelayedGet()
+{
+  start();
+}
+
+void
+PerfCounterService::stopDelayedGet()
+{
+  auto& stack = startStack();
+  if(stack.empty()) {
+    return;
+  }
+  auto const start = stack.back();
+  stack.pop_back();
+  Values values;
+  if(not stack.empty() and start.valid_ and threadCounters().read(values)) {
+    //shift the start of the module so the delayed get is not included
+    for(unsigned int i = 0; i < kNCounters; ++i) {
+      stack.back().values_[i] += values[i] - start.values_[i];
+    }
+  }
+}
+
+void
+PerfCounterService::report() const
+{
+  if(not m_stats) {
+    return;
+  }
+  std::vector<unsigned int> order;
+  double totalCycles = 0.;
+  for(unsigned int id = 0; id < m_labelAndTypeForID.size(); ++id) {
+    if(m_stats[id].nCalls_ != 0) {
+      order.push_back(id);
+      totalCycles += m_stats[id].counts_[kCycles];
+    }
+  }
+  std::sort(order.begin(), order.end(), [this](unsigned int iLHS, unsigned int iRHS) {
+    return m_stats[iLHS].counts_[kCycles] > m_stats[iRHS].counts_[kCycles];
+  });
+
+  LogVerbatim l("PerfCounterService");
+  l<<"PerfCounterService summary (cycles in millions per Event call, misses per thousand instructions)\n"
+   <<std::setw(12)<<"Calls"
+   <<std::setw(10)<<"Cycles %"
+   <<std::setw(12)<<"Mcycles"
+   <<std::setw(8)<<"IPC"
+   <<std::setw(12)<<"LLC miss"
+   <<std::setw(12)<<"Br miss"
+   <<"  Module";
+  for(auto id: order) {
+    auto const& stats = m_stats[id];
+    double const nCalls = stats.nCalls_;
+    double const cycles = stats.counts_[kCycles];
+    double const instructions = stats.counts_[kInstructions];
+    double const kInstructionsCount = std::max(instructions/1000., 1.);
+    l<<"\n"
+     <<std::setw(12)<<stats.nCalls_
+     <<std::setw(10)<<std::fixed<<std::setprecision(2)<<(totalCycles > 0. ? 100.*cycles/totalCycles : 0.)
+     <<std::setw(12)<<std::setprecision(3)<<cycles/nCalls/1.e6
+     <<std::setw(8)<<std::setprecision(2)<<(cycles > 0. ? instructions/cycles : 0.)
+     <<std::setw(12)<<std::setprecision(3)<<stats.counts_[kCacheMisses]/kInstructionsCount
+     <<std::setw(12)<<stats.counts_[kBranchMisses]/kInstructionsCount
+     <<"  "<<m_labelAndTypeForID[id].first<<" ("<<m_labelAndTypeForID[id].second<<")";
+  }
+}
+
+void
+PerfCounterService::writeJSON() const
+{
+  std::ofstream file(m_fileName);
+  file<<"{\n  \"resources\": [";
+  for(unsigned int i = 0; i < kNCounters; ++i) {
+    file<<(i == 0 ? "\"" : ", \"")<<s_counterNames[i]<<"\"";
+  }
+  file<<"],\n  \"modules\": [";
+  bool first = true;
+  for(unsigned int id = 0; id < m_labelAndTypeForID.size(); ++id) {
+    auto const& stats = m_stats[id];
+    if(stats.nCalls_ == 0) {
+      continue;
+    }
+    if(not first) {
+      file<<",";
+    }
+    first = false;
+    file<<"\n    {\"label\": \""<<m_labelAndTypeForID[id].first
+        <<"\", \"type\": \""<<m_labelAndTypeForID[id].second
+        <<"\", \"events\": "<<stats.nCalls_;
+    for(unsigned int i = 0; i < kNCounters; ++i) {
+      file<<", \""<<s_counterNames[i]<<"\": "<<stats.counts_[i];
+    }
+    file<<"}";
+  }
+  file<<"\n  ]\n}\n";
+}
+
+void
+PerfCounterService::fillDescriptions(edm::ConfigurationDescriptions & descriptions)
+{
+  edm::ParameterSetDescription desc;
+  desc.addUntracked<std::string>("fileName", std::string())->setComment("If not empty, the per module counts are also written in JSON format to this file");
+  descriptions.add("PerfCounterService", desc);
+  descriptions.setComment("Requires a Linux kernel with perf_event support and a /proc/sys/kernel/perf_event_paranoid setting allowing user space measurements.\n"
+                          " The counts of a module are those of the threads running its Event and acquire calls, excluding the delayed reads it triggers;"
+                          " the last level cache misses are the generic PERF_COUNT_HW_CACHE_MISSES event of the machine.");
+}
+
+DEFINE_FWK_SERVICE(PerfCounterService);
@@ -0,0 +1,25 @@
+#!/bin/bash
+
+# Pass in name and status
+function die { echo $1: status $2 ;  exit $2; }
+
+pushd ${LOCAL_TMP_DIR}
+
+F1=${LOCAL_TEST_DIR}/test_chrometracer_cfg.py
+(cmsRun $F1 ) || die "Failure using $F1" $?
+
+# each call of 'sum' is in its own Event and gets a dependency arrow from 'one'
+python - <<'END' || die "Failure checking test_chrometracer.json" $?
+import json, sys
+events = json.load(open("test_chrometracer.json"))["traceEvents"]
+calls = [e for e in events if e["ph"] == "X" and e["cat"] == "module" and e["name"] == "sum"]
+ids = set((e["args"]["run"], e["args"]["lumi"], e["args"]["event"]) for e in calls)
+arrows = set((e["tid"], e["ts"]) for e in events if e["ph"] == "f")
+if len(calls) != 4 or len(ids) != 4:
+    sys.exit("expected 4 calls of sum in 4 Events, found %d calls in %d Events" % (len(calls), len(ids)))
+for e in calls:
+    if (e["tid"], e["ts"]) not in arrows:
+        sys.exit("no dependency arrow to the call of sum in Event %s" % str((e["args"]["run"], e["args"]["lumi"], e["args"]["event"])))
+END
+
+popd
@@ -0,0 +1,17 @@
+import FWCore.ParameterSet.Config as cms
+
+process = cms.Process("TEST")
+
+# two runs with the same event numbers
+process.source = cms.Source("EmptySource",
+                            numberEventsInRun = cms.untracked.uint32(2))
+
+process.maxEvents = cms.untracked.PSet(input = cms.untracked.int32(4))
+
+process.add_(cms.Service("ChromeTracer",
+                         fileName = cms.untracked.string("test_chrometracer.json")))
+
+process.one = cms.EDProducer("IntProducer", ivalue = cms.int32(1))
+process.sum = cms.EDProducer("AddIntsProducer", labels = cms.vstring("one"))
+
+process.p = cms.Path(process.one + process.sum)
@@ -0,0 +1,110 @@
+#ifndef FWCore_Utilities_MemoryArena_h
+#define FWCore_Utilities_MemoryArena_h
+
+// -*- C++ -*-
+//
+// Package:     FWCore/Utilities
+// Class  :     MemoryArena
+//
+/**\class edm::MemoryArena MemoryArena "MemoryArena.h"
+
+ Description: Memory which is handed out in small pieces and given back all at once.
+
+ Usage:
+ Memory is taken from large blocks by just advancing a position within the block. Calling
+ deallocate does nothing; instead all the memory is given back in one call to releaseAll.
+ This avoids going to the system allocator for each small object and keeps objects which are
+ used together close in memory.
+
+ It is safe to call allocate from multiple threads at the same time. It is NOT safe to call
+ releaseAll while any other thread is using the arena.
+
+ The ArenaAllocator template can be used to have standard containers take their memory from a
+ MemoryArena
+ \code
+ std::vector<double, edm::ArenaAllocator<double>> values{edm::ArenaAllocator<double>(arena)};
+ \endcode
+ All objects using the memory MUST be destroyed before releaseAll is called.
+
+ */
+//
+//         Created:  Tue, 14 Oct 2026 09:12:31 GMT
+//
+
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace edm {
+  class MemoryArena {
+  public:
+    static constexpr std::size_t kDefaultBlockSize = 1 << 20;
+
+    explicit MemoryArena(std::size_t iBlockSize = kDefaultBlockSize);
+    MemoryArena(MemoryArena const&) = delete;
+    MemoryArena& operator=(MemoryArena const&) = delete;
+
+    ///Returns memory of at least iSize bytes aligned to iAlignment which stays valid until releaseAll is called
+    void* allocate(std::size_t iSize, std::size_t iAlignment = alignof(std::max_align_t));
+
+    ///Memory is only given back by releaseAll
+    void deallocate(void*, std::size_t) noexcept {}
+
+    ///Makes all memory available again. The first block is kept in order to be reused.
+    void releaseAll();
+
+    ///number of bytes handed out since the last call to releaseAll
+    std::size_t bytesAllocated() const { return m_bytesAllocated.load(std::memory_order_relaxed); }
+    ///number of bytes obtained from the system
+    std::size_t bytesReserved() const;
+
+  private:
+    struct Block {
+      explicit Block(std::size_t iSize): m_data(new char[iSize]), m_size(iSize) {}
+      std::unique_ptr<char[]> m_data;
+      std::size_t m_size;
+    };
+
+    void* allocateFromCurrentBlock(std::size_t iSize, std::size_t iAlignment);
+
+    std::size_t const m_blockSize;
+    mutable std::mutex m_mutex;
+    std::vector<Block> m_blocks;
+    std::size_t m_position;
+    std::atomic<std::size_t> m_bytesAllocated;
+  };
+
+  template<typename T>
+  class ArenaAllocator {
+  public:
+    using value_type = T;
+
+    explicit ArenaAllocator(MemoryArena& iArena) noexcept: m_arena(&iArena) {}
+    template<typename U>
+    ArenaAllocator(ArenaAllocator<U> const& iOther) noexcept: m_arena(iOther.arena()) {}
+
+    T* allocate(std::size_t iN) {
+      return static_cast<T*>(m_arena->allocate(iN*sizeof(T), alignof(T)));
+    }
+    void deallocate(T* iPtr, std::size_t iN) noexcept {
+      m_arena->deallocate(iPtr, iN*sizeof(T));
+    }
+
+    MemoryArena* arena() const noexcept { return m_arena; }
+  private:
+    MemoryArena* m_arena;
+  };
+
+  template<typename T, typename U>
+  bool operator==(ArenaAllocator<T> const& iLHS, ArenaAllocator<U> const& iRHS) noexcept {
+    return iLHS.arena() == iRHS.arena();
+  }
+  template<typename T, typename U>
+  bool operator!=(ArenaAllocator<T> const& iLHS, ArenaAllocator<U> const& iRHS) noexcept {
+    return not (iLHS == iRHS);
+  }
+}
+
+#endif
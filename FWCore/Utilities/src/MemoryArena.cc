@@ -0,0 +1,66 @@
+// -*- C++ -*-
+//
+// Package:     FWCore/Utilities
+// Class  :     MemoryArena
+//
+
+#include "FWCore/Utilities/interface/MemoryArena.h"
+
+namespace edm {
+
+  MemoryArena::MemoryArena(std::size_t iBlockSize):
+    m_blockSize(iBlockSize),
+    m_position(0),
+    m_bytesAllocated(0)
+  {}
+
+  void*
+  MemoryArena::allocate(std::size_t iSize, std::size_t iAlignment) {
+    std::lock_guard<std::mutex> guard(m_mutex);
+    void* returnValue = allocateFromCurrentBlock(iSize, iAlignment);
+    if(nullptr == returnValue) {
+      //objects larger than a block get their own block
+      std::size_t const needed = iSize + iAlignment;
+      m_blocks.emplace_back(needed > m_blockSize ? needed : m_blockSize);
+      m_position = 0;
+      returnValue = allocateFromCurrentBlock(iSize, iAlignment);
+    }
+    m_bytesAllocated.fetch_add(iSize, std::memory_order_relaxed);
+    return returnValue;
+  }
+
+  void*
+  MemoryArena::allocateFromCurrentBlock(std::size_t iSize, std::size_t iAlignment) {
+    if(m_blocks.empty()) {
+      return nullptr;
+    }
+    auto& block = m_blocks.back();
+    void* start = block.m_data.get() + m_position;
+    std::size_t space = block.m_size - m_position;
+    if(nullptr == std::align(iAlignment, iSize, start, space)) {
+      return nullptr;
+    }
+    m_position = block.m_size - space + iSize;
+    return start;
+  }
+
+  void
+  MemoryArena::releaseAll() {
+    std::lock_guard<std::mutex> guard(m_mutex);
+    if(m_blocks.size() > 1) {
+      m_blocks.erase(m_blocks.begin()+1, m_blocks.end());
+    }
+    m_position = 0;
+    m_bytesAllocated.store(0, std::memory_order_relaxed);
+  }
+
+  std::size_t
+  MemoryArena::bytesReserved() const {
+    std::lock_guard<std::mutex> guard(m_mutex);
+    std::size_t reserved = 0;
+    for(auto const& block : m_blocks) {
+      reserved += block.m_size;
+    }
+    return reserved;
+  }
+}
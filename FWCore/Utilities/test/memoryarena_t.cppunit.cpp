@@ -0,0 +1,117 @@
+#include <cstdint>
+#include <thread>
+#include <vector>
+#include "FWCore/Utilities/interface/MemoryArena.h"
+
+#include <cppunit/extensions/HelperMacros.h>
+
+class memoryarena_test : public CppUnit::TestFixture {
+      CPPUNIT_TEST_SUITE(memoryarena_test);
+      CPPUNIT_TEST(testAllocate);
+      CPPUNIT_TEST(testLargeAllocation);
+      CPPUNIT_TEST(testReleaseAll);
+      CPPUNIT_TEST(testAllocator);
+      CPPUNIT_TEST(testSimultaneousUse);
+      CPPUNIT_TEST_SUITE_END();
+   public:
+
+      void testAllocate();
+      void testLargeAllocation();
+      void testReleaseAll();
+      void testAllocator();
+      void testSimultaneousUse();
+
+      void setUp(){}
+      void tearDown(){}
+};
+
+void memoryarena_test::testAllocate()
+{
+   edm::MemoryArena arena(1024);
+   CPPUNIT_ASSERT(arena.bytesReserved() == 0);
+
+   void* p1 = arena.allocate(3,1);
+   void* p2 = arena.allocate(sizeof(double),alignof(double));
+   CPPUNIT_ASSERT(p1 != nullptr);
+   CPPUNIT_ASSERT(p2 != nullptr);
+   CPPUNIT_ASSERT(p1 != p2);
+   CPPUNIT_ASSERT(reinterpret_cast<std::uintptr_t>(p2) % alignof(double) == 0);
+   CPPUNIT_ASSERT(arena.bytesAllocated() == 3+sizeof(double));
+   CPPUNIT_ASSERT(arena.bytesReserved() == 1024);
+}
+
+void memoryarena_test::testLargeAllocation()
+{
+   edm::MemoryArena arena(64);
+   auto p = static_cast<char*>(arena.allocate(1000));
+   CPPUNIT_ASSERT(p != nullptr);
+   //make sure the whole range is usable
+   for(unsigned int i=0; i<1000; ++i) {
+      p[i] = 0;
+   }
+   CPPUNIT_ASSERT(arena.bytesReserved() >= 1000);
+}
+
+void memoryarena_test::testReleaseAll()
+{
+   edm::MemoryArena arena(128);
+   void* first = arena.allocate(8);
+   for(unsigned int i=0; i< 100; ++i) {
+      arena.allocate(8);
+   }
+   CPPUNIT_ASSERT(arena.bytesReserved() > 128);
+   arena.releaseAll();
+   CPPUNIT_ASSERT(arena.bytesAllocated() == 0);
+   CPPUNIT_ASSERT(arena.bytesReserved() == 128);
+   //the first block is reused
+   CPPUNIT_ASSERT(first == arena.allocate(8));
+}
+
+void memoryarena_test::testAllocator()
+{
+   edm::MemoryArena arena(256);
+   {
+      std::vector<int, edm::ArenaAllocator<int>> values{edm::ArenaAllocator<int>(arena)};
+      for(int i=0; i<1000; ++i) {
+         values.push_back(i);
+      }
+      for(int i=0; i<1000; ++i) {
+         CPPUNIT_ASSERT(values[i] == i);
+      }
+      CPPUNIT_ASSERT(arena.bytesAllocated() >= 1000*sizeof(int));
+
+      edm::ArenaAllocator<double> other(values.get_allocator());
+      CPPUNIT_ASSERT(other == values.get_allocator());
+   }
+   arena.releaseAll();
+   CPPUNIT_ASSERT(arena.bytesAllocated() == 0);
+}
+
+void memoryarena_test::testSimultaneousUse()
+{
+   edm::MemoryArena arena(512);
+   const unsigned int kThreads = 4;
+   const unsigned int kAllocations = 1000;
+   std::vector<std::vector<unsigned int*>> pointers(kThreads);
+   std::vector<std::thread> threads;
+   for(unsigned int t=0; t<kThreads; ++t) {
+      threads.emplace_back([&arena,&pointers,t,kAllocations]() {
+         for(unsigned int i=0; i<kAllocations; ++i) {
+            auto p = static_cast<unsigned int*>(arena.allocate(sizeof(unsigned int),alignof(unsigned int)));
+            *p = t*kAllocations+i;
+            pointers[t].push_back(p);
+         }
+      });
+   }
+   for(auto& t: threads) {
+      t.join();
+   }
+   for(unsigned int t=0; t<kThreads; ++t) {
+      for(unsigned int i=0; i<kAllocations; ++i) {
+         CPPUNIT_ASSERT(*pointers[t][i] == t*kAllocations+i);
+      }
+   }
+   CPPUNIT_ASSERT(arena.bytesAllocated() == kThreads*kAllocations*sizeof(unsigned int));
+}
+
+CPPUNIT_TEST_SUITE_REGISTRATION(memoryarena_test);
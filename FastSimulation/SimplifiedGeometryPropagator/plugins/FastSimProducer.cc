@@ -359,7 +359,7 @@ FastSimProducer::produce(edm::Event& iEvent, const edm::EventSetup& iSetup)
     // -----------------------------
     if(simulateCalorimetry)
     {
-        for(auto myFSimTrack : myFSimTracks)
+        for(auto & myFSimTrack : myFSimTracks)
         {
             myCalorimetry->reconstructTrack(myFSimTrack, _randomEngine.get());
         }
@@ -113,20 +113,30 @@ double fastsim::HelixTrajectory::nextCrossingTimeC(const BarrelSimplifiedGeometr
     }
 
     // asin is ambiguous, make sure to have the right solution
-    if(std::abs(layer.getRadius() - getRadParticle(phi1)) > 1.0e-2){
+    // (the radius of each solution is only recomputed if its phase changed)
+    double radPhi1 = getRadParticle(phi1);
+    double radPhi2 = getRadParticle(phi2);
+    bool phi1Changed = false, phi2Changed = false;
+    if(std::abs(layer.getRadius() - radPhi1) > 1.0e-2){
         phi1 = - phi1 + M_PI;
+        phi1Changed = true;
     }
-    if(std::abs(layer.getRadius() - getRadParticle(phi2)) > 1.0e-2){
+    if(std::abs(layer.getRadius() - radPhi2) > 1.0e-2){
         phi2 = - phi2 + M_PI;
+        phi2Changed = true;
     }
 
     // another ambiguity
     if(phi1 < 0){
         phi1 += 2. * M_PI;
+        phi1Changed = true;
     }
     if(phi2 < 0){
         phi2 += 2. * M_PI;
+        phi2Changed = true;
     }
+    if(phi1Changed) radPhi1 = getRadParticle(phi1);
+    if(phi2Changed) radPhi2 = getRadParticle(phi2);
 
     // find the corresponding times when the intersection occurs
     // make sure they are positive
@@ -144,8 +154,8 @@ double fastsim::HelixTrajectory::nextCrossingTimeC(const BarrelSimplifiedGeometr
     // Check if propagation successful (numerical reasons): both solutions (phi1, phi2) have to be on the layer (same radius)
     // Can happen due to numerical instabilities of geometrical function (if momentum is almost parallel to x/y axis)
     // Get crossingTimeC from StraightTrajectory as good approximation
-    if(std::abs(layer.getRadius() - getRadParticle(phi1)) > 1.0e-2 
-        || std::abs(layer.getRadius() - getRadParticle(phi2)) > 1.0e-2)
+    if(std::abs(layer.getRadius() - radPhi1) > 1.0e-2 
+        || std::abs(layer.getRadius() - radPhi2) > 1.0e-2)
     {
         StraightTrajectory traj(*this);
         return traj.nextCrossingTimeC(layer, onLayer);
@@ -209,5 +219,7 @@ void fastsim::HelixTrajectory::move(double deltaTimeC)
 
 double fastsim::HelixTrajectory::getRadParticle(double phi) const
 {
-    return sqrt((centerX_ + radius_*std::cos(phi))*(centerX_ + radius_*std::cos(phi)) + (centerY_ + radius_*std::sin(phi))*(centerY_ + radius_*std::sin(phi)));
+    const double x = centerX_ + radius_*std::cos(phi);
+    const double y = centerY_ + radius_*std::sin(phi);
+    return sqrt(x*x + y*y);
 }
@@ -185,8 +185,9 @@ FWGeometry::initMap( const FWRecoGeom::InfoMap& map )
 const TGeoMatrix*
 FWGeometry::getMatrix( unsigned int id ) const
 {
-   std::map<unsigned int, TGeoMatrix*>::iterator mit = m_idToMatrix.find( id );
-   if( mit != m_idToMatrix.end()) return mit->second;
+   // the insertion position of a missing id serves as hint for the new entry
+   std::map<unsigned int, TGeoMatrix*>::iterator mit = m_idToMatrix.lower_bound( id );
+   if( mit != m_idToMatrix.end() && mit->first == id ) return mit->second;
    
    IdToInfoItr it = FWGeometry::find( id );
    if( it == m_idToInfo.end())
@@ -205,8 +206,7 @@ FWGeometry::getMatrix( unsigned int id ) const
       };
       rotation.SetMatrix( matrix );
 
-      m_idToMatrix[id] = new TGeoCombiTrans( trans, rotation );
-      return m_idToMatrix[id];
+      return m_idToMatrix.emplace_hint( mit, id, new TGeoCombiTrans( trans, rotation ))->second;
    }
 }
 
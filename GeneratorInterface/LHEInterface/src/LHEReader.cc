@@ -219,7 +219,7 @@ void LHEReader::XMLHandler::startElement(const XMLCh *const uri,
     else if (name == "scales") {
       for (XMLSize_t iscale=0; iscale<attributes.getLength(); ++iscale) {
         int ipart = 0;
-        const char *scalename = XMLSimpleStr(attributes.getQName(iscale));
+        XMLSimpleStr scalename(attributes.getQName(iscale));
         int nmatch = sscanf(scalename,"pt_clust_%d",&ipart);
         
         if (nmatch!=1) {
@@ -229,7 +229,7 @@ void LHEReader::XMLHandler::startElement(const XMLCh *const uri,
         }
 
         float scaleval;
-        const char *scalevalstr = XMLSimpleStr(attributes.getValue(iscale));
+        XMLSimpleStr scalevalstr(attributes.getValue(iscale));
         sscanf(scalevalstr,"%e",&scaleval);
         
         scales.push_back(scaleval);
@@ -268,16 +268,17 @@ void LHEReader::XMLHandler::startElement(const XMLCh *const uri,
     
       npLO = -99;
       npNLO = -99;
-      const XMLCh *npLOval = attributes.getValue(XMLString::transcode("npLO"));
+      // the transcoded strings must live as long as they are read
+      const XMLCh *npLOval = attributes.getValue(XMLUniStr("npLO"));
       if (npLOval) {
-        const char *npLOs = XMLSimpleStr(npLOval);      
+        XMLSimpleStr npLOs(npLOval);
         sscanf(npLOs,"%d",&npLO);
       }
-      const XMLCh *npNLOval = attributes.getValue(XMLString::transcode("npNLO"));
+      const XMLCh *npNLOval = attributes.getValue(XMLUniStr("npNLO"));
       if (npNLOval) {
-        const char *npNLOs = XMLSimpleStr(npNLOval);      
-         sscanf(npNLOs,"%d",&npNLO);
-     }    
+        XMLSimpleStr npNLOs(npNLOval);
+        sscanf(npNLOs,"%d",&npNLO);
+      }    
     
       xmlEventNodes.resize(1);
       xmlEventNodes[0] = xmlEvent->getDocumentElement();
@@ -0,0 +1,80 @@
+#ifndef GEOMETRY_CALOGEOMETRY_CALOETAPHIGRID_H
+#define GEOMETRY_CALOGEOMETRY_CALOETAPHIGRID_H 1
+
+#include <cmath>
+#include <cstdint>
+#include <vector>
+
+/** \class CaloEtaPhiGrid
+
+Index of the cell positions of a calorimeter in bins of (eta, phi).
+
+The (eta, phi) of the cells are stored contiguously bin after bin, so that
+the closest cell search and the searches in a window only look at the bins
+around the point instead of looping over all the cells.
+
+*/
+class CaloEtaPhiGrid {
+
+public:
+
+  typedef float CCGFloat ;
+
+  /// cell i is at (eta[i], phi[i]), the queries return its index[i]
+  CaloEtaPhiGrid( const std::vector<CCGFloat>& eta ,
+		  const std::vector<CCGFloat>& phi ,
+		  const std::vector<uint32_t>& index ) ;
+
+  /// index of the cell closest in deltaR, the smallest index in case of ties, ~0 if there is no cell
+  uint32_t closest( CCGFloat eta, CCGFloat phi ) const ;
+
+  /// calls f( index[i], eta[i], phi[i] ) for the cells in the bins overlapping [eta - dEta, eta + dEta] x [phi - dPhi, phi + dPhi]
+  template<typename F>
+  void forEachInWindow( double eta, double phi, double dEta, double dPhi, F f ) const ;
+
+  unsigned int size() const { return m_index.size() ; }
+
+private:
+
+  int etaBin( double eta ) const ;
+  int phiBin( double phi ) const ;
+
+  template<typename F>
+  void forEachInBin( int ieta, int iphi, F& f ) const {
+    const unsigned int bin ( ieta*m_nPhi + iphi ) ;
+    for( unsigned int k ( m_offsets[bin] ) ; k != m_offsets[bin+1] ; ++k ) f( m_index[k], m_eta[k], m_phi[k] ) ;
+  }
+
+  int    m_nEta ;
+  int    m_nPhi ;
+  double m_etaMin ;
+  double m_etaWidth ;
+  double m_phiWidth ;
+
+  std::vector<unsigned int> m_offsets ; // first cell of each bin, bins ordered by eta then phi
+  std::vector<uint32_t>     m_index ;
+  std::vector<CCGFloat>     m_eta ;
+  std::vector<CCGFloat>     m_phi ;
+};
+
+template<typename F>
+void
+CaloEtaPhiGrid::forEachInWindow( double eta, double phi, double dEta, double dPhi, F f ) const {
+  if( m_index.empty() ) return ;
+  const int etaLow  ( etaBin( eta - dEta ) ) ;
+  const int etaHigh ( etaBin( eta + dEta ) ) ;
+  // one more bin on each side in phi for the rounding of the bins across +-pi
+  int phiLow  ( (int)std::floor( ( phi - dPhi + M_PI )/m_phiWidth ) - 1 ) ;
+  int phiHigh ( (int)std::floor( ( phi + dPhi + M_PI )/m_phiWidth ) + 1 ) ;
+  if( phiHigh - phiLow + 1 >= m_nPhi ) {
+    phiLow  = 0 ;
+    phiHigh = m_nPhi - 1 ;
+  }
+  for( int ieta ( etaLow ) ; ieta <= etaHigh ; ++ieta ) {
+    for( int k ( phiLow ) ; k <= phiHigh ; ++k ) {
+      forEachInBin( ieta, ( k%m_nPhi + m_nPhi )%m_nPhi, f ) ;
+    }
+  }
+}
+
+#endif
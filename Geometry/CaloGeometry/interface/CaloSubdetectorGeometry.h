@@ -10,6 +10,7 @@
 #include "DataFormats/DetId/interface/DetId.h"
 #include "DataFormats/GeometryVector/interface/GlobalPoint.h"
 #include "Geometry/CaloGeometry/interface/CaloCellGeometry.h"
+#include "Geometry/CaloGeometry/interface/CaloEtaPhiGrid.h"
 #include "DataFormats/Math/interface/deltaR.h"
 
 #include "FWCore/Utilities/interface/GCC11Compatibility.h"
@@ -66,12 +67,12 @@ public:
   */
   virtual const std::vector<DetId>& getValidDetIds( DetId::Detector det    = DetId::Detector(0) , int subdet = 0 ) const ;
 
-  // Get closest cell, etc...
+  /// Get closest cell in deltaR, the default implementation searches the bins of etaPhiGrid() around the point
   virtual DetId getClosestCell( const GlobalPoint& r ) const;
 
   /** \brief Get a list of all cells within a dR of the given cell
 	  
-      The default implementation makes a loop over all cell geometries.
+      The default implementation looks at the cells in the bins of etaPhiGrid() within dR.
       Cleverer implementations are suggested to use rough conversions between
       eta/phi and ieta/iphi and test on the boundaries.
   */
@@ -82,6 +83,9 @@ public:
   
   CCGFloat deltaEta( const DetId& detId ) const;
 
+  /// (eta, phi) index of the cell positions, the indices are those of getValidDetIds(), built at the first call
+  const CaloEtaPhiGrid& etaPhiGrid() const;
+
   void allocateCorners( CaloCellGeometry::CornersVec::size_type n ) ;
   
   CaloCellGeometry::CornersMgr* cornersMgr() { return m_cmgr ; }
@@ -136,9 +140,11 @@ private:
 #if !defined(__CINT__) && !defined(__MAKECINT__) && !defined(__REFLEX__)
   mutable std::atomic<std::vector<CCGFloat>*>  m_deltaPhi ;
   mutable std::atomic<std::vector<CCGFloat>*>  m_deltaEta ;
+  mutable std::atomic<CaloEtaPhiGrid*>  m_etaPhiGrid ;
 #else
   mutable std::vector<CCGFloat>*  m_deltaPhi ;
   mutable std::vector<CCGFloat>*  m_deltaEta ;
+  mutable CaloEtaPhiGrid*  m_etaPhiGrid ;
 #endif
 };
 
@@ -0,0 +1,109 @@
+#include "Geometry/CaloGeometry/interface/CaloEtaPhiGrid.h"
+#include "DataFormats/Math/interface/deltaR.h"
+
+#include <algorithm>
+#include <limits>
+
+typedef CaloEtaPhiGrid::CCGFloat CCGFloat ;
+
+CaloEtaPhiGrid::CaloEtaPhiGrid( const std::vector<CCGFloat>& eta ,
+				const std::vector<CCGFloat>& phi ,
+				const std::vector<uint32_t>& index ) :
+   m_nEta     ( 1 ) ,
+   m_nPhi     ( 1 ) ,
+   m_etaMin   ( 0 ) ,
+   m_etaWidth ( 1 ) ,
+   m_phiWidth ( 2*M_PI )
+{
+   const unsigned int nCells ( eta.size() ) ;
+   if( 0 != nCells ) {
+      const auto etaRange ( std::minmax_element( eta.begin(), eta.end() ) ) ;
+      m_etaMin = *etaRange.first ;
+      const double etaSpan ( *etaRange.second - m_etaMin ) ;
+
+      // about two cells per bin, with bins of similar size in eta and phi
+      const double nBins ( std::max( 1U, nCells/2 ) ) ;
+      m_nPhi = 0 < etaSpan ? (int)std::lround( std::sqrt( nBins*2*M_PI/etaSpan ) ) : (int)nBins ;
+      m_nPhi = std::max( 1, std::min( m_nPhi, (int)nBins ) ) ;
+      m_nEta = std::max( 1, (int)( nBins/m_nPhi ) ) ;
+      m_phiWidth = 2*M_PI/m_nPhi ;
+      // the last cell in eta falls inside the last bin
+      m_etaWidth = 0 < etaSpan ? etaSpan*( 1 + 1e-6 )/m_nEta : 1 ;
+   }
+
+   // order the cells by bin
+   std::vector<int> bins ( nCells ) ;
+   m_offsets.assign( m_nEta*m_nPhi + 1, 0 ) ;
+   for( unsigned int i ( 0 ) ; i != nCells ; ++i ) {
+      bins[i] = etaBin( eta[i] )*m_nPhi + phiBin( phi[i] ) ;
+      ++m_offsets[ bins[i] + 1 ] ;
+   }
+   for( unsigned int bin ( 0 ) ; bin + 1 < m_offsets.size() ; ++bin ) m_offsets[bin+1] += m_offsets[bin] ;
+
+   m_index.resize( nCells ) ;
+   m_eta.resize( nCells ) ;
+   m_phi.resize( nCells ) ;
+   std::vector<unsigned int> next ( m_offsets.begin(), m_offsets.end() - 1 ) ;
+   for( unsigned int i ( 0 ) ; i != nCells ; ++i ) {
+      const unsigned int k ( next[ bins[i] ]++ ) ;
+      m_index[k] = index[i] ;
+      m_eta[k]   = eta[i] ;
+      m_phi[k]   = phi[i] ;
+   }
+}
+
+int
+CaloEtaPhiGrid::etaBin( double eta ) const {
+   const int ieta ( (int)std::floor( ( eta - m_etaMin )/m_etaWidth ) ) ;
+   return std::max( 0, std::min( ieta, m_nEta - 1 ) ) ;
+}
+
+int
+CaloEtaPhiGrid::phiBin( double phi ) const {
+   const int iphi ( (int)std::floor( ( phi + M_PI )/m_phiWidth ) ) ;
+   return std::max( 0, std::min( iphi, m_nPhi - 1 ) ) ;
+}
+
+uint32_t
+CaloEtaPhiGrid::closest( CCGFloat eta, CCGFloat phi ) const {
+   uint32_t index ( ~0 ) ;
+   CCGFloat closest ( std::numeric_limits<CCGFloat>::max() ) ;
+   if( m_index.empty() ) return index ;
+
+   auto test = [&]( uint32_t i, CCGFloat eta0, CCGFloat phi0 ) {
+      const CCGFloat dR2 ( reco::deltaR2( eta0, phi0, eta, phi ) ) ;
+      if( dR2 < closest || ( dR2 == closest && i < index ) ) {
+	 closest = dR2 ;
+	 index   = i   ;
+      }
+   } ;
+
+   // look at the rings of bins around the bin of the point, until the
+   // cells which are left are all further than the closest one
+   const int ieta ( etaBin( eta ) ) ;
+   const int iphi ( phiBin( phi ) ) ;
+   const int maxPhiDist ( m_nPhi/2 ) ;
+   for( int r ( 0 ) ; ; ++r ) {
+      for( int jeta ( std::max( 0, ieta - r ) ) ; jeta <= std::min( m_nEta - 1, ieta + r ) ; ++jeta ) {
+	 const bool etaOnRing ( std::abs( jeta - ieta ) == r ) ;
+	 for( int dphi ( -std::min( r, maxPhiDist ) ) ; dphi <= std::min( r, maxPhiDist ) ; ++dphi ) {
+	    // -nPhi/2 and nPhi/2 are the same bin for an even nPhi
+	    if( 0 == m_nPhi%2 && 0 != dphi && dphi == -maxPhiDist ) continue ;
+	    if( !etaOnRing && std::abs( dphi ) != r ) continue ;
+	    forEachInBin( jeta, ( iphi + dphi + m_nPhi )%m_nPhi, test ) ;
+	 }
+      }
+
+      const bool etaDone ( ieta - r <= 0 && ieta + r >= m_nEta - 1 ) ;
+      const bool phiDone ( r >= maxPhiDist ) ;
+      if( etaDone && phiDone ) break ;
+
+      double bound ( std::numeric_limits<double>::max() ) ;
+      if( ieta - r > 0 )          bound = std::min( bound, eta - ( m_etaMin + ( ieta - r )*m_etaWidth ) ) ;
+      if( ieta + r < m_nEta - 1 ) bound = std::min( bound, m_etaMin + ( ieta + r + 1 )*m_etaWidth - eta ) ;
+      if( !phiDone )              bound = std::min( bound, r*m_phiWidth ) ;
+      // with a margin for the rounding of the bins
+      if( (uint32_t)(~0) != index && closest*( 1 + 1e-4 ) < bound*bound ) break ;
+   }
+   return index ;
+}
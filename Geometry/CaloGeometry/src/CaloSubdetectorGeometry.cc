@@ -5,6 +5,7 @@
 #include <Math/EulerAngles.h>
 
 #include <algorithm> 
+#include <cmath>
 
 typedef CaloCellGeometry::Pt3D     Pt3D     ;
 typedef CaloCellGeometry::Pt3DVec  Pt3DVec  ;
@@ -16,7 +17,8 @@ CaloSubdetectorGeometry::CaloSubdetectorGeometry() :
    m_parMgr ( nullptr ) ,
    m_cmgr   ( nullptr ) ,
    m_deltaPhi  (nullptr) ,
-   m_deltaEta  (nullptr)
+   m_deltaEta  (nullptr) ,
+   m_etaPhiGrid(nullptr)
 {}
 
 
@@ -26,6 +28,7 @@ CaloSubdetectorGeometry::~CaloSubdetectorGeometry()
    delete m_parMgr ; 
    if (m_deltaPhi) delete m_deltaPhi.load() ;
    if (m_deltaEta) delete m_deltaEta.load() ;
+   if (m_etaPhiGrid) delete m_etaPhiGrid.load() ;
 }
 
 void
@@ -57,25 +60,13 @@ DetId
 CaloSubdetectorGeometry::getClosestCell( const GlobalPoint& r ) const {
   const CCGFloat eta ( r.eta() ) ;
   const CCGFloat phi ( r.phi() ) ;
-  uint32_t index ( ~0 ) ;
-  CCGFloat closest ( 1e9 ) ;
-
-  for( uint32_t i ( 0 ); i != m_validIds.size() ; ++i ) {
-    std::shared_ptr<const CaloCellGeometry> cell ( getGeometry( m_validIds[ i ] ) ) ;
-    if( nullptr != cell ) {
-      const GlobalPoint& p ( cell->getPosition() ) ;
-      const CCGFloat eta0 ( p.eta() ) ;
-      const CCGFloat phi0 ( p.phi() ) ;
-      const CCGFloat dR2 ( reco::deltaR2( eta0, phi0, eta, phi ) ) ;
-      if( dR2 < closest ) {
-	closest = dR2 ;
-	index   = i   ;
-      }
-    }
-  }
-  return ( closest > 0.9e9 ||
-	   (uint32_t)(~0) == index       ? DetId(0) :
-	   m_validIds[index] ) ;
+  if( !std::isfinite( eta ) || !std::isfinite( phi ) ) return DetId(0) ;
+
+  const uint32_t index ( etaPhiGrid().closest( eta, phi ) ) ;
+  if( (uint32_t)(~0) == index ) return DetId(0) ;
+  const GlobalPoint& p ( getGeometry( m_validIds[ index ] )->getPosition() ) ;
+  const CCGFloat closest ( reco::deltaR2( CCGFloat( p.eta() ), CCGFloat( p.phi() ), eta, phi ) ) ;
+  return ( closest > 0.9e9 ? DetId(0) : m_validIds[index] ) ;
 }
 
 CaloSubdetectorGeometry::DetIdSet 
@@ -86,18 +77,11 @@ CaloSubdetectorGeometry::getCells(const GlobalPoint& r, double dR) const {
 
    DetIdSet dss;
    
-   if( 0.000001 < dR )
+   if( 0.000001 < dR && std::isfinite( eta ) && std::isfinite( phi ) )
    {
-      for( uint32_t i ( 0 ); i != m_validIds.size() ; ++i ) 
-      {
-	 std::shared_ptr<const CaloCellGeometry> cell ( getGeometry( m_validIds[i] ) ) ;
-	 if( nullptr != cell )
-	 {
-	    const GlobalPoint& p ( cell->getPosition() ) ;
-	    const CCGFloat eta0 ( p.eta() ) ;
+      etaPhiGrid().forEachInWindow( eta, phi, dR, dR, [&]( uint32_t i, CCGFloat eta0, CCGFloat phi0 ) {
 	    if( fabs( eta - eta0 ) < dR )
 	    {
-	       const CCGFloat phi0 ( p.phi() ) ;
 	       CCGFloat delp ( fabs( phi - phi0 ) ) ;
 	       if( delp > M_PI ) delp = 2*M_PI - delp ;
 	       if( delp < dR )
@@ -106,8 +90,7 @@ CaloSubdetectorGeometry::getCells(const GlobalPoint& r, double dR) const {
 		  if( dist2 < dR2 ) dss.insert( m_validIds[i] ) ;
 	       }
 	    }
-	 }
-      }   
+	 } ) ;
    }
    return dss;
 }
@@ -295,6 +278,31 @@ CaloSubdetectorGeometry::deltaEta( const DetId& detId ) const {
 }
 
 
+const CaloEtaPhiGrid&
+CaloSubdetectorGeometry::etaPhiGrid() const {
+  if(!m_etaPhiGrid.load(std::memory_order_acquire)) {
+    std::vector<CCGFloat> eta, phi;
+    std::vector<uint32_t> index;
+    eta.reserve(m_validIds.size());
+    phi.reserve(m_validIds.size());
+    index.reserve(m_validIds.size());
+    for( uint32_t i ( 0 ); i != m_validIds.size() ; ++i ) {
+      std::shared_ptr<const CaloCellGeometry> cell ( getGeometry( m_validIds[ i ] ) ) ;
+      if( nullptr != cell ) {
+	const GlobalPoint& p ( cell->getPosition() ) ;
+	eta.push_back( p.eta() ) ;
+	phi.push_back( p.phi() ) ;
+	index.push_back( i ) ;
+      }
+    }
+    auto ptr = new CaloEtaPhiGrid( eta, phi, index ) ;
+    CaloEtaPhiGrid* expect = nullptr;
+    bool exchanged = m_etaPhiGrid.compare_exchange_strong(expect, ptr, std::memory_order_acq_rel);
+    if (!exchanged) delete ptr;
+  }
+  return *m_etaPhiGrid.load(std::memory_order_acquire) ;
+}
+
 unsigned int CaloSubdetectorGeometry::indexFor(const DetId& id) const { return CaloGenericDetId(id).denseIndex(); }
 
 unsigned int CaloSubdetectorGeometry::sizeForDenseIndex(const DetId& id) const { return CaloGenericDetId(id).sizeForDenseIndexing(); }
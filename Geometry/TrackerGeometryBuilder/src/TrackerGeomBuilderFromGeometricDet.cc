@@ -142,6 +142,7 @@ TrackerGeomBuilderFromGeometricDet::build( const GeometricDet* gd, const PTracke
     }
   }
   buildGeomDet(tracker);//"GeomDet"
+  tracker->finalize();
 
   verifyDUinTG(*tracker);
 
@@ -110,6 +110,12 @@ void TrackerGeometry::finalize() {
     theTIDDets.shrink_to_fit(); // not owned: they're also in 'theDets'
     theTOBDets.shrink_to_fit(); // not owned: they're also in 'theDets'
     theTECDets.shrink_to_fit(); // not owned: they're also in 'theDets'
+
+    // the maps are complete: size their buckets once for short chains in idToDet(Unit)
+    theMapUnit.max_load_factor(0.5f);
+    theMapUnit.rehash(0);
+    theMap.max_load_factor(0.5f);
+    theMap.rehash(0);
 }
 
 void TrackerGeometry::addType(GeomDetType const * p) {
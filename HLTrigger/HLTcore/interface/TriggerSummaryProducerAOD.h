@@ -168,6 +168,8 @@ class TriggerSummaryProducerAOD : public edm::stream::EDProducer<edm::GlobalCach
 
   /// packing decision
   std::vector<bool> maskFilters_;
+  /// tags of the filters to pack, in the order of the filter objects
+  std::vector<edm::InputTag> filterTags_;
 
   edm::GetterOfProducts<trigger::TriggerFilterObjectWithRefs> getTriggerFilterObjectWithRefs_;
   edm::GetterOfProducts<reco::RecoEcalCandidateCollection> getRecoEcalCandidateCollection_;
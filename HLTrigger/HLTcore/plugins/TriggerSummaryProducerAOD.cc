@@ -87,7 +87,8 @@ TriggerSummaryProducerAOD::TriggerSummaryProducerAOD(const edm::ParameterSet& ps
   offset_(),
   keys_(),
   ids_(),
-  maskFilters_()
+  maskFilters_(),
+  filterTags_()
 {
   if (pn_=="@") {
     edm::Service<edm::service::TriggerNamesService> tns;
@@ -249,6 +250,8 @@ TriggerSummaryProducerAOD::produce(edm::Event& iEvent, const edm::EventSetup& iS
    /// Record the InputTags of those L3 filters and L3 collections.
    maskFilters_.clear();
    maskFilters_.resize(nfob);
+   filterTags_.clear();
+   filterTags_.resize(nfob);
    filterTagsEvent_.clear();
    collectionTagsEvent_.clear();
    unsigned int nf(0);
@@ -262,7 +265,8 @@ TriggerSummaryProducerAOD::produce(edm::Event& iEvent, const edm::EventSetup& iS
        const string& label    (fobs[ifob].provenance()->moduleLabel());
        const string& instance (fobs[ifob].provenance()->productInstanceName());
        const string& process  (fobs[ifob].provenance()->processName());
-       filterTagsEvent_.insert(InputTag(label,instance,process));
+       filterTags_[ifob]=InputTag(label,instance,process);
+       filterTagsEvent_.insert(filterTags_[ifob]);
        for (unsigned int icol=0; icol!=ncol; ++icol) {
 	 // overwrite process name (usually not set)
 	 tokenizeTag(collectionTags_[icol],tagLabel,tagInstance,tagProcess);
@@ -351,10 +355,7 @@ TriggerSummaryProducerAOD::produce(edm::Event& iEvent, const edm::EventSetup& iS
    /// fill the L3 filter objects
    for (unsigned int ifob=0; ifob!=nfob; ++ifob) {
      if (maskFilters_[ifob]) {
-       const string& label    (fobs[ifob].provenance()->moduleLabel());
-       const string& instance (fobs[ifob].provenance()->productInstanceName());
-       const string& process  (fobs[ifob].provenance()->processName());
-       const edm::InputTag filterTag(label,instance,process);
+       const edm::InputTag& filterTag(filterTags_[ifob]);
        ids_.clear();
        keys_.clear();
        fillFilterObjectMembers(iEvent,filterTag,fobs[ifob]->photonIds()   ,fobs[ifob]->photonRefs());
@@ -532,9 +533,19 @@ void TriggerSummaryProducerAOD::fillFilterObjectMembers(const edm::Event& iEvent
 					  << ids.size() << " " << refs.size();
   }
 
+  /// the refs of a filter mostly point to the same collection: keep
+  /// the offset of the last one instead of looking it up for each ref
+  ProductID lastPid;
+  int lastOffset(0);
+
   const unsigned int n(min(ids.size(),refs.size()));
   for (unsigned int i=0; i!=n; ++i) {
     const ProductID pid(refs[i].id());
+    if (pid.isValid() && pid==lastPid) {
+      fillFilterObjectMember(lastOffset,ids[i],refs[i]);
+      continue;
+    }
+    const map<ProductID,unsigned int>::const_iterator it(offset_.find(pid));
     if (!(pid.isValid())) {
       std::ostringstream ost;
       ost
@@ -550,7 +561,7 @@ void TriggerSummaryProducerAOD::fillFilterObjectMembers(const edm::Event& iEvent
       } else {
 	LogError("TriggerSummaryProducerAOD") << ost.str();
       }
-    } else if (offset_.find(pid)==offset_.end()) {
+    } else if (it==offset_.end()) {
       const string&    label(iEvent.getProvenance(pid).moduleLabel());
       const string& instance(iEvent.getProvenance(pid).productInstanceName());
       const string&  process(iEvent.getProvenance(pid).processName());
@@ -569,7 +580,9 @@ void TriggerSummaryProducerAOD::fillFilterObjectMembers(const edm::Event& iEvent
 	LogError("TriggerSummaryProducerAOD") << ost.str();
       }
     } else {
-      fillFilterObjectMember(offset_[pid],ids[i],refs[i]);
+      lastPid=pid;
+      lastOffset=it->second;
+      fillFilterObjectMember(lastOffset,ids[i],refs[i]);
     }
   }
   return;
@@ -5,6 +5,7 @@
 #include <iostream>
 #include <sstream>
 #include <cassert>
+#include <limits>
 
 #include "DataFormats/Common/interface/Handle.h"
 #include "DataFormats/Common/interface/Ref.h"
@@ -311,6 +312,22 @@ void HLTL1TSeed::dumpTriggerFilterObjectWithRefs(trigger::TriggerFilterObjectWit
 }
 
 // seeding is done via L1 trigger object maps, considering the objects which fired in L1
+const GlobalObjectMap* HLTL1TSeed::findObjectMap(const GlobalObjectMapRecord& gtObjectMapRecord,
+        const std::string& algoName, size_t& position) const {
+
+    const std::vector<GlobalObjectMap>& objMaps = gtObjectMapRecord.gtObjectMap();
+    if (position < objMaps.size() && objMaps[position].algoName() == algoName) {
+        return &objMaps[position];
+    }
+
+    const GlobalObjectMap* objMap = gtObjectMapRecord.getObjectMap(algoName);
+    if (objMap != nullptr) {
+        position = objMap - objMaps.data();
+    }
+    return objMap;
+
+}
+
 bool HLTL1TSeed::seedsL1TriggerObjectMaps(edm::Event& iEvent,
         trigger::TriggerFilterObjectWithRefs & filterproduct
         ) {
@@ -455,11 +472,13 @@ bool HLTL1TSeed::seedsL1TriggerObjectMaps(edm::Event& iEvent,
 
     // Update m_l1AlgoLogicParser and store emulator results for algOpTokens 
     // /////////////////////////////////////////////////////////////////////
-    for (auto & i : algOpTokenVector) {
+    m_l1AlgoTokenMapPositions.resize(algOpTokenVector.size(), std::numeric_limits<size_t>::max());
+    for (size_t iToken = 0; iToken < algOpTokenVector.size(); ++iToken) {
 
-        std::string algoName = i.tokenName;
+        auto & i = algOpTokenVector[iToken];
+        const std::string & algoName = i.tokenName;
 
-        const GlobalObjectMap* objMap = gtObjectMapRecord->getObjectMap(algoName);
+        const GlobalObjectMap* objMap = findObjectMap(*gtObjectMapRecord, algoName, m_l1AlgoTokenMapPositions[iToken]);
 
         if(objMap == nullptr) {
 
@@ -495,15 +514,17 @@ bool HLTL1TSeed::seedsL1TriggerObjectMaps(edm::Event& iEvent,
     /// Loop over the list of required algorithms for seeding
     /// /////////////////////////////////////////////////////
 
+    m_l1AlgoSeedMapPositions.resize(m_l1AlgoSeeds.size(), std::numeric_limits<size_t>::max());
     for (std::vector<GlobalLogicParser::OperandToken>::const_iterator
             itSeed = m_l1AlgoSeeds.begin(); itSeed != m_l1AlgoSeeds.end(); ++itSeed) {
       
-      std::string algoSeedName = (*itSeed).tokenName;
+      const std::string & algoSeedName = (*itSeed).tokenName;
 
       LogTrace("HLTL1TSeed") 
       << "\n ----------------  algo seed name = " << algoSeedName << endl;
 
-      const GlobalObjectMap* objMap = gtObjectMapRecord->getObjectMap(algoSeedName);
+      const GlobalObjectMap* objMap = findObjectMap(*gtObjectMapRecord, algoSeedName,
+              m_l1AlgoSeedMapPositions[itSeed - m_l1AlgoSeeds.begin()]);
 
       if(objMap == nullptr) {
 
@@ -37,6 +37,7 @@ class L1GtTriggerMenu;
 class L1GtTriggerMask;
 class L1GlobalTriggerReadoutRecord;
 
+class GlobalObjectMap;
 class GlobalObjectMapRecord;
 namespace edm {
   class ConfigurationDescriptions;
@@ -74,6 +75,11 @@ private:
     /// seeding is done via L1 trigger object maps, considering the objects which fired in L1
     bool seedsL1TriggerObjectMaps( edm::Event &, trigger::TriggerFilterObjectWithRefs &);
 
+    /// object map of an algorithm, looked up first at the position it had in the previous event,
+    /// since the maps of the same menu keep their order, and by name otherwise
+    const GlobalObjectMap* findObjectMap(const GlobalObjectMapRecord &, const std::string & algoName,
+            size_t & position) const;
+
 
     /// detailed print of filter content
     void dumpTriggerFilterObjectWithRefs(trigger::TriggerFilterObjectWithRefs &) const;
@@ -92,6 +98,11 @@ private:
     /// vector of object-type vectors for each condition in the required algorithms for seeding
     std::vector< std::vector< const std::vector<l1t::GlobalObject>* > > m_l1AlgoSeedsObjType;
 
+    /// positions of the object maps of the operand tokens and of the required algorithms
+    /// in the GlobalObjectMapRecord of the previous event
+    std::vector<size_t> m_l1AlgoTokenMapPositions;
+    std::vector<size_t> m_l1AlgoSeedMapPositions;
+
 
 private:
 
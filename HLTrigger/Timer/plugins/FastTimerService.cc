@@ -1,5 +1,7 @@
 // C++ headers
+#include <algorithm>
 #include <cmath>
+#include <fstream>
 #include <iomanip>
 #include <iostream>
 #include <limits>
@@ -10,6 +12,8 @@
 #include <unordered_set>
 
 // boost headers
+#include <sys/resource.h>
+
 #include <boost/format.hpp>
 #include <boost/range/irange.hpp>
 
@@ -878,6 +882,9 @@ FastTimerService::FastTimerService(const edm::ParameterSet & config, edm::Activi
   print_event_summary_(         config.getUntrackedParameter<bool>(     "printEventSummary"        ) ),
   print_run_summary_(           config.getUntrackedParameter<bool>(     "printRunSummary"          ) ),
   print_job_summary_(           config.getUntrackedParameter<bool>(     "printJobSummary"          ) ),
+  json_filename_(               config.getUntrackedParameter<std::string>( "jsonFileName"         ) ),
+  // sampling configuration
+  event_sampling_period_(       std::max(1u, config.getUntrackedParameter<unsigned int>( "eventSamplingPeriod" )) ),
   // dqm configuration
   enable_dqm_(                  config.getUntrackedParameter<bool>(     "enableDQM"                ) ),
   enable_dqm_bymodule_(         config.getUntrackedParameter<bool>(     "enableDQMbyModule"        ) ),
@@ -1069,6 +1076,13 @@ FastTimerService::preallocate(edm::service::SystemBounds const& bounds)
   for (unsigned int i = 0; i < concurrent_lumis_; ++i)
     subprocess_global_lumi_check_[i] = 0;
 
+  // keep track of which events are measured, stream by stream
+  sampled_event_ = std::make_unique<bool[]>(concurrent_streams_);
+  for (unsigned int i = 0; i < concurrent_streams_; ++i)
+    sampled_event_[i] = true;
+  sampled_event_counter_ = 0;
+  processed_events_ = 0;
+
   // allocate buffers to keep track of the resources spent in the lumi and run transitions
   lumi_transition_.resize(concurrent_lumis_);
   run_transition_.resize(concurrent_runs_);
@@ -1123,6 +1137,7 @@ FastTimerService::postBeginJob() {
     plots_ = std::make_unique<PlotsPerJob>(callgraph_, highlight_modules_);
   }
 
+  job_start_ = boost::chrono::high_resolution_clock::now();
 }
 
 void
@@ -1243,7 +1258,7 @@ FastTimerService::postGlobalEndRun(edm::GlobalContext const& gc)
 void
 FastTimerService::preSourceRun(edm::RunIndex index)
 {
-  thread().measure_and_accumulate(overhead_);
+  accountOverhead(overhead_);
 }
 
 void
@@ -1255,7 +1270,7 @@ FastTimerService::postSourceRun(edm::RunIndex index)
 void
 FastTimerService::preSourceLumi(edm::LuminosityBlockIndex index)
 {
-  thread().measure_and_accumulate(overhead_);
+  accountOverhead(overhead_);
 }
 
 void
@@ -1271,6 +1286,13 @@ FastTimerService::postEndJob()
     edm::LogVerbatim out("FastReport");
     printSummary(out, job_summary_, "Job");
   }
+  if (not json_filename_.empty()) {
+    std::ofstream file(json_filename_);
+    if (file)
+      writeSummaryJSON(file, job_summary_);
+    else
+      edm::LogWarning("FastTimerService") << "cannot open the file \"" << json_filename_ << "\" to write the job summary";
+  }
 }
 
 
@@ -1474,6 +1496,52 @@ void FastTimerService::printSummary(T& out, ResourcesPerJob const& data, std::st
   }
 }
 
+// write the job summary as a JSON object, with the same per-event averages as printSummary
+void FastTimerService::writeSummaryJSON(std::ostream& out, ResourcesPerJob const& data) const
+{
+  auto wall = boost::chrono::high_resolution_clock::now() - job_start_;
+  struct rusage usage;
+  getrusage(RUSAGE_SELF, &usage);
+
+  auto resources = [&out](Resources const& resources, uint64_t events) {
+    out << "\"time_thread\": " << (events ? ms(resources.time_thread) / events : 0)
+        << ", \"time_real\": " << (events ? ms(resources.time_real) / events : 0)
+        << ", \"mem_alloc\": " << (events ? kB(resources.allocated) / events : 0)
+        << ", \"mem_free\": " << (events ? kB(resources.deallocated) / events : 0);
+  };
+  bool first = true;
+  auto module = [&](unsigned int id) {
+    auto const& module_d = callgraph_.module(id);
+    auto const& module   = data.modules[id];
+    out << (first ? "" : ",\n");
+    first = false;
+    out << "    { \"label\": \"" << module_d.moduleLabel() << "\", \"type\": \"" << module_d.moduleName()
+        << "\", \"events\": " << module.events << ", ";
+    resources(module.total, data.events);
+    out << " }";
+  };
+
+  out << "{\n";
+  out << "  \"threads\": " << concurrent_threads_ << ",\n";
+  out << "  \"streams\": " << concurrent_streams_ << ",\n";
+  out << "  \"events\": " << data.events << ",\n";
+  out << "  \"processed_events\": " << processed_events_.load() << ",\n";
+  out << "  \"wall_time\": " << ms(wall) / 1000. << ",\n";
+  // with event sampling data.events counts only the measured events, so the throughput uses all of them
+  out << "  \"throughput\": " << (ms(wall) > 0 ? processed_events_.load() / ms(wall) * 1000. : 0) << ",\n";
+  out << "  \"peak_rss\": " << usage.ru_maxrss << ",\n";
+  out << "  \"total\": { ";
+  resources(data.total, data.events);
+  out << " },\n";
+  out << "  \"modules\": [\n";
+  module(callgraph_.source().id());
+  for (unsigned int i = 0; i < callgraph_.processes().size(); ++i)
+    for (unsigned int m: callgraph_.processDescription(i).modules_)
+      module(m);
+  out << "\n  ]\n";
+  out << "}\n";
+}
+
 template <typename T>
 void FastTimerService::printTransition(T& out, AtomicResources const& data, std::string const& label) const
 {
@@ -1515,8 +1583,11 @@ FastTimerService::postEvent(edm::StreamContext const& sc)
 {
   ignoredSignal(__func__);
 
-  unsigned int pid = callgraph_.processId(* sc.processContext());
   unsigned int sid = sc.streamID();
+  if (not sampled_event_[sid])
+    return;
+
+  unsigned int pid = callgraph_.processId(* sc.processContext());
   auto & stream  = streams_[sid];
   auto & process = callgraph_.processDescription(pid);
 
@@ -1559,6 +1630,13 @@ FastTimerService::postEvent(edm::StreamContext const& sc)
 void
 FastTimerService::preSourceEvent(edm::StreamID sid)
 {
+  ++processed_events_;
+
+  // with event sampling, measure only one event out of every event_sampling_period_ events
+  sampled_event_[sid] = (event_sampling_period_ == 1) or (sampled_event_counter_.fetch_add(1) % event_sampling_period_ == 0);
+  if (not sampled_event_[sid])
+    return;
+
   // clear the event counters
   auto & stream = streams_[sid];
   stream.reset();
@@ -1567,14 +1645,16 @@ FastTimerService::preSourceEvent(edm::StreamID sid)
   subprocess_event_check_[sid] = 0;
 
   // reuse the same measurement for the Source module and for the explicit begin of the Event
-  auto & measurement = thread();
-  measurement.measure_and_accumulate(stream.overhead);
-  stream.event_measurement = measurement;
+  accountOverhead(stream.overhead);
+  stream.event_measurement = thread();
 }
 
 void
 FastTimerService::postSourceEvent(edm::StreamID sid)
 {
+  if (not sampled_event_[sid])
+    return;
+
   edm::ModuleDescription const& md = callgraph_.source();
   unsigned int id  = md.id();
   auto & stream = streams_[sid];
@@ -1587,6 +1667,8 @@ void
 FastTimerService::prePathEvent(edm::StreamContext const& sc, edm::PathContext const & pc)
 {
   unsigned int sid = sc.streamID().value();
+  if (not sampled_event_[sid])
+    return;
   unsigned int pid = callgraph_.processId(* sc.processContext());
   unsigned int id  = pc.pathID();
   auto & stream = streams_[sid];
@@ -1599,6 +1681,8 @@ void
 FastTimerService::postPathEvent(edm::StreamContext const& sc, edm::PathContext const & pc, edm::HLTPathStatus const & status)
 {
   unsigned int sid = sc.streamID().value();
+  if (not sampled_event_[sid])
+    return;
   unsigned int pid = callgraph_.processId(* sc.processContext());
   unsigned int id  = pc.pathID();
   auto & stream = streams_[sid];
@@ -1622,8 +1706,10 @@ void
 FastTimerService::preModuleEventAcquire(edm::StreamContext const& sc, edm::ModuleCallingContext const& mcc)
 {
   unsigned int sid = sc.streamID().value();
+  if (not sampled_event_[sid])
+    return;
   auto & stream = streams_[sid];
-  thread().measure_and_accumulate(stream.overhead);
+  accountOverhead(stream.overhead);
 }
 
 void
@@ -1632,6 +1718,8 @@ FastTimerService::postModuleEventAcquire(edm::StreamContext const& sc, edm::Modu
   edm::ModuleDescription const& md = * mcc.moduleDescription();
   unsigned int id  = md.id();
   unsigned int sid = sc.streamID().value();
+  if (not sampled_event_[sid])
+    return;
   auto & stream = streams_[sid];
   auto & module = stream.modules[id];
 
@@ -1643,8 +1731,10 @@ void
 FastTimerService::preModuleEvent(edm::StreamContext const& sc, edm::ModuleCallingContext const& mcc)
 {
   unsigned int sid = sc.streamID().value();
+  if (not sampled_event_[sid])
+    return;
   auto & stream = streams_[sid];
-  thread().measure_and_accumulate(stream.overhead);
+  accountOverhead(stream.overhead);
 }
 
 void
@@ -1653,6 +1743,8 @@ FastTimerService::postModuleEvent(edm::StreamContext const& sc, edm::ModuleCalli
   edm::ModuleDescription const& md = * mcc.moduleDescription();
   unsigned int id  = md.id();
   unsigned int sid = sc.streamID().value();
+  if (not sampled_event_[sid])
+    return;
   auto & stream = streams_[sid];
   auto & module = stream.modules[id];
 
@@ -1703,7 +1795,7 @@ FastTimerService::postEventReadFromSource(edm::StreamContext const& sc, edm::Mod
 void
 FastTimerService::preModuleGlobalBeginRun(edm::GlobalContext const& gc, edm::ModuleCallingContext const& mcc)
 {
-  thread().measure_and_accumulate(overhead_);
+  accountOverhead(overhead_);
 }
 
 void
@@ -1716,7 +1808,7 @@ FastTimerService::postModuleGlobalBeginRun(edm::GlobalContext const& gc, edm::Mo
 void
 FastTimerService::preModuleGlobalEndRun(edm::GlobalContext const& gc, edm::ModuleCallingContext const& mcc)
 {
-  thread().measure_and_accumulate(overhead_);
+  accountOverhead(overhead_);
 }
 
 void
@@ -1729,7 +1821,7 @@ FastTimerService::postModuleGlobalEndRun(edm::GlobalContext const& gc, edm::Modu
 void
 FastTimerService::preModuleGlobalBeginLumi(edm::GlobalContext const& gc, edm::ModuleCallingContext const& mcc)
 {
-  thread().measure_and_accumulate(overhead_);
+  accountOverhead(overhead_);
 }
 
 void
@@ -1742,7 +1834,7 @@ FastTimerService::postModuleGlobalBeginLumi(edm::GlobalContext const& gc, edm::M
 void
 FastTimerService::preModuleGlobalEndLumi(edm::GlobalContext const& gc, edm::ModuleCallingContext const& mcc)
 {
-  thread().measure_and_accumulate(overhead_);
+  accountOverhead(overhead_);
 }
 
 void
@@ -1755,7 +1847,7 @@ FastTimerService::postModuleGlobalEndLumi(edm::GlobalContext const& gc, edm::Mod
 void
 FastTimerService::preModuleStreamBeginRun(edm::StreamContext const& sc, edm::ModuleCallingContext const& mcc)
 {
-  thread().measure_and_accumulate(overhead_);
+  accountOverhead(overhead_);
 }
 
 void
@@ -1768,7 +1860,7 @@ FastTimerService::postModuleStreamBeginRun(edm::StreamContext const& sc, edm::Mo
 void
 FastTimerService::preModuleStreamEndRun(edm::StreamContext const& sc, edm::ModuleCallingContext const& mcc)
 {
-  thread().measure_and_accumulate(overhead_);
+  accountOverhead(overhead_);
 }
 
 void
@@ -1781,7 +1873,7 @@ FastTimerService::postModuleStreamEndRun(edm::StreamContext const& sc, edm::Modu
 void
 FastTimerService::preModuleStreamBeginLumi(edm::StreamContext const& sc, edm::ModuleCallingContext const& mcc)
 {
-  thread().measure_and_accumulate(overhead_);
+  accountOverhead(overhead_);
 }
 
 void
@@ -1794,7 +1886,7 @@ FastTimerService::postModuleStreamBeginLumi(edm::StreamContext const& sc, edm::M
 void
 FastTimerService::preModuleStreamEndLumi(edm::StreamContext const& sc, edm::ModuleCallingContext const& mcc)
 {
-  thread().measure_and_accumulate(overhead_);
+  accountOverhead(overhead_);
 }
 
 void
@@ -1815,7 +1907,7 @@ void
 FastTimerService::on_scheduler_exit(bool worker)
 {
   // account any resources used or freed by the thread before leaving the TBB pool
-  thread().measure_and_accumulate(overhead_);
+  accountOverhead(overhead_);
 }
 
 FastTimerService::Measurement &
@@ -1824,6 +1916,17 @@ FastTimerService::thread()
   return threads_.local();
 }
 
+void
+FastTimerService::accountOverhead(AtomicResources & overhead)
+{
+  // with event sampling, the last measurement of the thread may predate the modules of the events that were
+  // not measured: the measurement is restarted, and the resources used in between are not accounted for
+  if (event_sampling_period_ == 1)
+    thread().measure_and_accumulate(overhead);
+  else
+    thread().measure();
+}
+
 
 // describe the module's configuration
 void
@@ -1833,6 +1936,8 @@ FastTimerService::fillDescriptions(edm::ConfigurationDescriptions & descriptions
   desc.addUntracked<bool>(        "printEventSummary",        false);
   desc.addUntracked<bool>(        "printRunSummary",          true);
   desc.addUntracked<bool>(        "printJobSummary",          true);
+  desc.addUntracked<std::string>( "jsonFileName",             ""    )->setComment("If not empty, write the job summary in JSON format to this file: the per-event averages of the time (ms) and memory (kB) of each module, the throughput (ev/s), the wall time (s) and the peak RSS (kB) of the job.");
+  desc.addUntracked<unsigned>(    "eventSamplingPeriod",      1     )->setComment("Measure only one event out of every 'eventSamplingPeriod' events; the summaries and plots are filled with the measured events, and the overhead is not measured if the period is larger than 1.");
   desc.addUntracked<bool>(        "enableDQM",                true);
   desc.addUntracked<bool>(        "enableDQMbyModule",        false);
   desc.addUntracked<bool>(        "enableDQMbyPath",          false);
@@ -418,6 +418,7 @@ private:
   // summary data
   ResourcesPerJob               job_summary_;                   // whole event time accounting per-job
   std::vector<ResourcesPerJob>  run_summary_;                   // whole event time accounting per-run
+  boost::chrono::high_resolution_clock::time_point job_start_;  // wall clock time at the end of beginJob
   std::mutex                    summary_mutex_;                 // synchronise access to the summary objects across different threads
 
   // per-thread quantities, lazily allocated
@@ -429,9 +430,19 @@ private:
   std::unique_ptr<std::atomic<unsigned int>[]> subprocess_global_lumi_check_;
   std::unique_ptr<std::atomic<unsigned int>[]> subprocess_global_run_check_;
 
+  // whether the current event of each stream is measured, and the number of events seen so far
+  std::unique_ptr<bool[]>       sampled_event_;
+  std::atomic<unsigned int>     sampled_event_counter_;
+
+  // number of events processed by the job, measured or not, used for the throughput
+  std::atomic<uint64_t>         processed_events_;
+
   // retrieve the current thread's per-thread quantities
   Measurement & thread();
 
+  // account the resources used by the current thread since its last measurement as overhead
+  void accountOverhead(AtomicResources & overhead);
+
   // job configuration
   unsigned int                  concurrent_lumis_;
   unsigned int                  concurrent_runs_;
@@ -442,6 +453,10 @@ private:
   const bool                    print_event_summary_;           // print the time spent in each process, path and module after every event
   const bool                    print_run_summary_;             // print the time spent in each process, path and module for each run
   const bool                    print_job_summary_;             // print the time spent in each process, path and module for the whole job
+  const std::string             json_filename_;                 // write the job summary in JSON format to this file, if not empty
+
+  // sampling configuration
+  const unsigned int            event_sampling_period_;         // measure only one event out of every event_sampling_period_ events
 
   // dqm configuration
   bool                          enable_dqm_;                    // non const, depends on the availability of the DQMStore
@@ -498,6 +513,8 @@ private:
   template <typename T>
   void printSummary(T& out, ResourcesPerJob const& data, std::string const& label) const;
 
+  void writeSummaryJSON(std::ostream& out, ResourcesPerJob const& data) const;
+
   template <typename T>
   void printTransition(T& out, AtomicResources const& data, std::string const& label) const;
 
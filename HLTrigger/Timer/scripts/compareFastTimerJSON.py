@@ -0,0 +1,70 @@
+#! /usr/bin/env python
+"""Compare two job summaries written by the FastTimerService "jsonFileName" option.
+
+Prints the throughput, peak RSS and per-module time of the reference and of the
+target job, and flags the modules whose average real time per event grew by more
+than the given threshold. The exit code is 1 if any regression was flagged.
+"""
+
+from __future__ import print_function
+import argparse
+import json
+import sys
+
+def load(name):
+  with open(name) as f:
+    return json.load(f)
+
+def relative(ref, new):
+  return (new - ref) / ref if ref > 0 else 0.
+
+def main():
+  parser = argparse.ArgumentParser(description = __doc__)
+  parser.add_argument('reference', help = 'job summary of the reference release')
+  parser.add_argument('target',    help = 'job summary of the release to check')
+  parser.add_argument('-t', '--threshold', type = float, default = 0.10,
+                      help = 'relative increase flagged as a regression (default: 0.10)')
+  parser.add_argument('-m', '--min-time',  type = float, default = 0.1,
+                      help = 'ignore modules faster than this in both jobs, in ms per event (default: 0.1)')
+  args = parser.parse_args()
+
+  ref = load(args.reference)
+  new = load(args.target)
+  regressions = 0
+
+  print('%-40s %12s %12s %8s' % ('', 'reference', 'target', 'change'))
+  for key, unit in (('throughput', 'ev/s'), ('peak_rss', 'kB')):
+    change = relative(ref[key], new[key])
+    print('%-40s %12.1f %12.1f %+7.1f%%' % ('%s (%s)' % (key, unit), ref[key], new[key], 100. * change))
+  for key in ('time_real', 'time_thread', 'mem_alloc'):
+    change = relative(ref['total'][key], new['total'][key])
+    print('%-40s %12.1f %12.1f %+7.1f%%' % ('total %s' % key, ref['total'][key], new['total'][key], 100. * change))
+  if (ref['threads'], ref['streams']) != (new['threads'], new['streams']):
+    print('warning: the jobs ran with different numbers of threads or streams')
+  print()
+
+  modules = dict((m['label'], m) for m in ref['modules'])
+  print('%-40s %12s %12s %8s' % ('module (real time, ms/ev)', 'reference', 'target', 'change'))
+  for module in new['modules']:
+    label = module['label']
+    if label not in modules:
+      print('%-40s %12s %12.2f %8s' % (label, '-', module['time_real'], 'new'))
+      continue
+    old = modules.pop(label)
+    if max(old['time_real'], module['time_real']) < args.min_time:
+      continue
+    change = relative(old['time_real'], module['time_real'])
+    flag = ''
+    if change > args.threshold:
+      flag = '  <-- regression'
+      regressions += 1
+    print('%-40s %12.2f %12.2f %+7.1f%%%s' % (label, old['time_real'], module['time_real'], 100. * change, flag))
+  for label, old in sorted(modules.items()):
+    print('%-40s %12.2f %12s %8s' % (label, old['time_real'], '-', 'removed'))
+
+  if regressions:
+    print('\n%d module(s) slower by more than %.0f%%' % (regressions, 100. * args.threshold))
+  return 1 if regressions else 0
+
+if __name__ == '__main__':
+  sys.exit(main())
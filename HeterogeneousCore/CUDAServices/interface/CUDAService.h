@@ -0,0 +1,104 @@
+#ifndef HeterogeneousCore_CUDAServices_CUDAService_h
+#define HeterogeneousCore_CUDAServices_CUDAService_h
+// -*- C++ -*-
+//
+// Package:     HeterogeneousCore/CUDAServices
+// Class  :     CUDAService
+//
+/**\class CUDAService CUDAService.h "HeterogeneousCore/CUDAServices/interface/CUDAService.h"
+
+ Description: Owns the CUDA devices, streams and (cached) memory used by the job
+
+ Usage:
+    Each edm::Stream is assigned one of the available devices (round robin) and one
+ non-blocking CUDA stream on that device, created once at the start of the job.
+ Device memory and pinned host memory are obtained through caching allocators so
+ that cudaMalloc/cudaMallocHost are only called while the caches warm up; a freed
+ block is only reused by another CUDA stream once the work queued on the stream which
+ used it has completed.
+
+    notifyWhenDone signals a WaitingTaskWithArenaHolder once all the work queued so far
+ on a CUDA stream has completed, which is what edm::ExternalWork modules need to return
+ from acquire without blocking a TBB thread (see CUDAStreamEDProducer.h).
+
+    If no device is available or the service is disabled, enabled() returns false and
+ modules are expected to fall back to their CPU implementation.
+*/
+//
+
+// system include files
+#include <cstddef>
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include <cuda_runtime.h>
+
+// user include files
+#include "FWCore/Concurrency/interface/WaitingTaskWithArenaHolder.h"
+#include "FWCore/Utilities/interface/StreamID.h"
+
+// forward declarations
+namespace edm {
+  class ActivityRegistry;
+  class ConfigurationDescriptions;
+  class ParameterSet;
+}
+
+namespace cudaServices {
+  class CachingAllocator;
+}
+
+class CUDAService {
+public:
+  CUDAService(edm::ParameterSet const& iConfig, edm::ActivityRegistry& iRegistry);
+  ~CUDAService();
+
+  CUDAService(CUDAService const&) = delete;
+  CUDAService& operator=(CUDAService const&) = delete;
+
+  static void fillDescriptions(edm::ConfigurationDescriptions& descriptions);
+
+  // ---------- const member functions ---------------------
+  bool enabled() const { return enabled_; }
+  int numberOfDevices() const { return numberOfDevices_; }
+  /// major and minor compute capability of iDevice
+  std::pair<int, int> computeCapability(int iDevice) const { return computeCapabilities_[iDevice]; }
+
+  /// the device assigned to iStream, the caller is responsible for calling cudaSetDevice
+  int deviceForStream(edm::StreamID iStream) const { return streams_[iStream.value()].device_; }
+  /// the CUDA stream assigned to iStream, which lives on deviceForStream(iStream)
+  cudaStream_t cudaStream(edm::StreamID iStream) const { return streams_[iStream.value()].stream_; }
+
+  // ---------- member functions ---------------------------
+  /// memory on iDevice which may be used by work queued on iStream
+  void* allocateDevice(int iDevice, std::size_t iBytes, cudaStream_t iStream);
+  /// work already queued on the stream passed to allocateDevice may still use the memory
+  void freeDevice(void* iPtr);
+
+  /// pinned host memory which may be used by work queued on iStream
+  void* allocateHost(std::size_t iBytes, cudaStream_t iStream);
+  void freeHost(void* iPtr);
+
+  /// iHolder is signaled, from a CUDA thread, once the work queued so far on iStream has completed.
+  /// If the work failed the exception given to iHolder is a cms::Exception of category CUDAError.
+  void notifyWhenDone(cudaStream_t iStream, edm::WaitingTaskWithArenaHolder iHolder);
+
+private:
+  struct StreamInfo {
+    int device_ = -1;
+    cudaStream_t stream_ = nullptr;
+  };
+
+  void preallocate(unsigned int iNStreams);
+
+  // ---------- member data --------------------------------
+  bool enabled_ = false;
+  int numberOfDevices_ = 0;
+  std::vector<std::pair<int, int>> computeCapabilities_;
+  std::vector<StreamInfo> streams_;
+  std::unique_ptr<cudaServices::CachingAllocator> deviceAllocator_;
+  std::unique_ptr<cudaServices::CachingAllocator> hostAllocator_;
+};
+
+#endif
@@ -0,0 +1,64 @@
+#ifndef HeterogeneousCore_CUDAServices_CUDAStreamEDProducer_h
+#define HeterogeneousCore_CUDAServices_CUDAStreamEDProducer_h
+// -*- C++ -*-
+//
+// Package:     HeterogeneousCore/CUDAServices
+// Class  :     CUDAStreamEDProducer
+//
+/**\class CUDAStreamEDProducer CUDAStreamEDProducer.h "HeterogeneousCore/CUDAServices/interface/CUDAStreamEDProducer.h"
+
+ Description: Base class for stream EDProducers which offload their work to a CUDA device
+
+ Usage:
+    acquireCUDA is called with the device of the edm::Stream already set and should only
+ queue (asynchronous) work on the given CUDA stream, e.g. copies into pinned host memory,
+ kernels and copies back. The TBB thread is released when acquireCUDA returns and
+ produceCUDA is called, on the same device, once all the queued work has completed so the
+ results in host memory can be put into the Event.
+ \code
+ class MyProducer : public CUDAStreamEDProducer<> {
+   void acquireCUDA(edm::Event const&, edm::EventSetup const&, cudaStream_t) override;
+   void produceCUDA(edm::Event&, edm::EventSetup const&, cudaStream_t) override;
+ };
+ \endcode
+    The CUDAService must be enabled, see CUDAService::enabled().
+*/
+//
+
+#include <cuda_runtime.h>
+
+#include "FWCore/Framework/interface/Event.h"
+#include "FWCore/Framework/interface/stream/EDProducer.h"
+#include "FWCore/ServiceRegistry/interface/Service.h"
+#include "HeterogeneousCore/CUDAServices/interface/CUDAService.h"
+#include "HeterogeneousCore/CUDAServices/interface/cudaCheck.h"
+
+template <typename... T>
+class CUDAStreamEDProducer : public edm::stream::EDProducer<edm::ExternalWork, T...> {
+public:
+  void acquire(edm::Event const& iEvent, edm::EventSetup const& iSetup, edm::WaitingTaskWithArenaHolder iHolder) final {
+    edm::Service<CUDAService> cs;
+    device_ = cs->deviceForStream(iEvent.streamID());
+    stream_ = cs->cudaStream(iEvent.streamID());
+    cudaCheck(cudaSetDevice(device_));
+    acquireCUDA(iEvent, iSetup, stream_);
+    cs->notifyWhenDone(stream_, std::move(iHolder));
+  }
+
+  void produce(edm::Event& iEvent, edm::EventSetup const& iSetup) final {
+    cudaCheck(cudaSetDevice(device_));
+    produceCUDA(iEvent, iSetup, stream_);
+  }
+
+protected:
+  int device() const { return device_; }
+
+private:
+  virtual void acquireCUDA(edm::Event const&, edm::EventSetup const&, cudaStream_t) = 0;
+  virtual void produceCUDA(edm::Event&, edm::EventSetup const&, cudaStream_t) = 0;
+
+  int device_ = -1;
+  cudaStream_t stream_ = nullptr;
+};
+
+#endif
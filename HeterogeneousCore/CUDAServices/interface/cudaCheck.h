@@ -0,0 +1,23 @@
+#ifndef HeterogeneousCore_CUDAServices_cudaCheck_h
+#define HeterogeneousCore_CUDAServices_cudaCheck_h
+
+#include <cuda_runtime.h>
+
+#include "FWCore/Utilities/interface/Exception.h"
+
+namespace cudaServices {
+  /// throws a cms::Exception of category CUDAError if iResult is not cudaSuccess
+  inline void cudaCheck(cudaError_t iResult, char const* iCall, char const* iFile, int iLine) {
+    if(iResult == cudaSuccess) {
+      return;
+    }
+    cms::Exception ex("CUDAError");
+    ex << iFile << ", line " << iLine << ":\n" << iCall << "\n"
+       << cudaGetErrorName(iResult) << ": " << cudaGetErrorString(iResult);
+    throw ex;
+  }
+}
+
+#define cudaCheck(ARG) (cudaServices::cudaCheck((ARG), #ARG, __FILE__, __LINE__))
+
+#endif
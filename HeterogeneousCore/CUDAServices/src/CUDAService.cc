@@ -0,0 +1,138 @@
+// -*- C++ -*-
+//
+// Package:     HeterogeneousCore/CUDAServices
+// Class  :     CUDAService
+//
+
+// system include files
+#include <exception>
+
+// user include files
+#include "CachingAllocator.h"
+#include "FWCore/MessageLogger/interface/MessageLogger.h"
+#include "FWCore/ParameterSet/interface/ConfigurationDescriptions.h"
+#include "FWCore/ParameterSet/interface/ParameterSet.h"
+#include "FWCore/ParameterSet/interface/ParameterSetDescription.h"
+#include "FWCore/ServiceRegistry/interface/ActivityRegistry.h"
+#include "FWCore/ServiceRegistry/interface/SystemBounds.h"
+#include "FWCore/Utilities/interface/Exception.h"
+#include "HeterogeneousCore/CUDAServices/interface/CUDAService.h"
+#include "HeterogeneousCore/CUDAServices/interface/cudaCheck.h"
+
+namespace {
+  void CUDART_CB doneCallback(cudaStream_t, cudaError_t iStatus, void* iData) {
+    std::unique_ptr<edm::WaitingTaskWithArenaHolder> holder(static_cast<edm::WaitingTaskWithArenaHolder*>(iData));
+    if(iStatus == cudaSuccess) {
+      holder->doneWaiting(std::exception_ptr{});
+      return;
+    }
+    try {
+      throw cms::Exception("CUDAError") << "Work queued on a CUDA stream failed with "
+                                        << cudaGetErrorName(iStatus) << ": " << cudaGetErrorString(iStatus);
+    } catch(...) {
+      holder->doneWaiting(std::current_exception());
+    }
+  }
+}
+
+CUDAService::CUDAService(edm::ParameterSet const& iConfig, edm::ActivityRegistry& iRegistry)
+{
+  if(not iConfig.getUntrackedParameter<bool>("enabled")) {
+    edm::LogInfo("CUDAService") << "CUDAService disabled by configuration";
+    return;
+  }
+  if(cudaSuccess != cudaGetDeviceCount(&numberOfDevices_) or numberOfDevices_ == 0) {
+    cudaGetLastError();
+    numberOfDevices_ = 0;
+    edm::LogWarning("CUDAService") << "No CUDA device available, the CUDAService is disabled";
+    return;
+  }
+
+  edm::LogInfo log("CUDAService");
+  log << "CUDA runtime found " << numberOfDevices_ << " device(s)";
+  for(int i = 0; i < numberOfDevices_; ++i) {
+    cudaDeviceProp properties;
+    cudaCheck(cudaGetDeviceProperties(&properties, i));
+    computeCapabilities_.emplace_back(properties.major, properties.minor);
+    log << "\n  " << i << ": " << properties.name
+        << " compute capability " << properties.major << "." << properties.minor
+        << ", " << properties.totalGlobalMem / (1024 * 1024) << " MB";
+  }
+
+  std::size_t const megaByte = 1024 * 1024;
+  deviceAllocator_ = std::make_unique<cudaServices::CachingAllocator>(
+    cudaServices::CachingAllocator::Kind::Device,
+    iConfig.getUntrackedParameter<unsigned int>("maxCachedDeviceMemoryMB") * megaByte);
+  hostAllocator_ = std::make_unique<cudaServices::CachingAllocator>(
+    cudaServices::CachingAllocator::Kind::Host,
+    iConfig.getUntrackedParameter<unsigned int>("maxCachedHostMemoryMB") * megaByte);
+  enabled_ = true;
+
+  iRegistry.watchPreallocate([this](edm::service::SystemBounds const& iBounds) {
+    preallocate(iBounds.maxNumberOfStreams());
+  });
+}
+
+CUDAService::~CUDAService() {
+  //the allocators must release their memory before the streams they refer to go away
+  deviceAllocator_.reset();
+  hostAllocator_.reset();
+  for(auto const& s : streams_) {
+    cudaSetDevice(s.device_);
+    cudaStreamDestroy(s.stream_);
+  }
+}
+
+void
+CUDAService::preallocate(unsigned int iNStreams) {
+  streams_.resize(iNStreams);
+  int previous = 0;
+  cudaCheck(cudaGetDevice(&previous));
+  for(unsigned int i = 0; i < iNStreams; ++i) {
+    auto& s = streams_[i];
+    s.device_ = i % numberOfDevices_;
+    cudaCheck(cudaSetDevice(s.device_));
+    cudaCheck(cudaStreamCreateWithFlags(&s.stream_, cudaStreamNonBlocking));
+  }
+  cudaCheck(cudaSetDevice(previous));
+}
+
+void*
+CUDAService::allocateDevice(int iDevice, std::size_t iBytes, cudaStream_t iStream) {
+  return deviceAllocator_->allocate(iDevice, iBytes, iStream);
+}
+
+void
+CUDAService::freeDevice(void* iPtr) {
+  deviceAllocator_->free(iPtr);
+}
+
+void*
+CUDAService::allocateHost(std::size_t iBytes, cudaStream_t iStream) {
+  int device = 0;
+  cudaCheck(cudaGetDevice(&device));
+  return hostAllocator_->allocate(device, iBytes, iStream);
+}
+
+void
+CUDAService::freeHost(void* iPtr) {
+  hostAllocator_->free(iPtr);
+}
+
+void
+CUDAService::notifyWhenDone(cudaStream_t iStream, edm::WaitingTaskWithArenaHolder iHolder) {
+  auto holder = std::make_unique<edm::WaitingTaskWithArenaHolder>(std::move(iHolder));
+  cudaCheck(cudaStreamAddCallback(iStream, doneCallback, holder.get(), 0));
+  //ownership now belongs to the callback
+  holder.release();
+}
+
+void
+CUDAService::fillDescriptions(edm::ConfigurationDescriptions& descriptions) {
+  edm::ParameterSetDescription desc;
+  desc.addUntracked<bool>("enabled", true);
+  desc.addUntracked<unsigned int>("maxCachedDeviceMemoryMB", 0)->setComment("Maximum amount of free device memory kept for reuse per device, 0 means no limit");
+  desc.addUntracked<unsigned int>("maxCachedHostMemoryMB", 0)->setComment("Maximum amount of free pinned host memory kept for reuse, 0 means no limit");
+  descriptions.add("CUDAService", desc);
+  descriptions.setComment("Assigns a CUDA device and stream to each edm::Stream and caches device and pinned host memory.");
+}
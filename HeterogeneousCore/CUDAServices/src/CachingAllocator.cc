@@ -0,0 +1,181 @@
+// -*- C++ -*-
+//
+// Package:     HeterogeneousCore/CUDAServices
+// Class  :     CachingAllocator
+//
+
+// system include files
+
+// user include files
+#include "CachingAllocator.h"
+#include "FWCore/Utilities/interface/Exception.h"
+#include "HeterogeneousCore/CUDAServices/interface/cudaCheck.h"
+
+namespace {
+  //the device is changed for the duration of a call which needs it
+  class ScopedSetDevice {
+  public:
+    explicit ScopedSetDevice(int iDevice) {
+      cudaGetDevice(&previous_);
+      if(iDevice != previous_) {
+        cudaCheck(cudaSetDevice(iDevice));
+      }
+      current_ = iDevice;
+    }
+    ~ScopedSetDevice() {
+      if(current_ != previous_) {
+        cudaSetDevice(previous_);
+      }
+    }
+  private:
+    int previous_ = 0;
+    int current_ = 0;
+  };
+}
+
+namespace cudaServices {
+
+  CachingAllocator::CachingAllocator(Kind iKind, std::size_t iMaxCachedBytes):
+    kind_(iKind),
+    maxCachedBytes_(iMaxCachedBytes)
+  {}
+
+  CachingAllocator::~CachingAllocator() {
+    //errors are ignored since the CUDA runtime may already be shutting down
+    std::lock_guard<std::mutex> guard(mutex_);
+    for(auto& c : cached_) {
+      cudaSetDevice(c.second.device_);
+      cudaEventDestroy(c.second.ready_);
+      if(kind_ == Kind::Device) {
+        ::cudaFree(c.second.ptr_);
+      } else {
+        ::cudaFreeHost(c.second.ptr_);
+      }
+    }
+    cached_.clear();
+  }
+
+  std::size_t
+  CachingAllocator::binBytes(std::size_t iBytes) {
+    std::size_t bytes = kMinBinBytes;
+    while(bytes < iBytes) {
+      bytes <<= 1;
+    }
+    return bytes;
+  }
+
+  void*
+  CachingAllocator::cudaAllocate(std::size_t iBytes) const {
+    void* ptr = nullptr;
+    cudaError_t result = (kind_ == Kind::Device) ? cudaMalloc(&ptr, iBytes) : cudaMallocHost(&ptr, iBytes);
+    if(result != cudaSuccess) {
+      //clear the sticky error state of the runtime
+      cudaGetLastError();
+      return nullptr;
+    }
+    return ptr;
+  }
+
+  void
+  CachingAllocator::cudaFree(void* iPtr) const {
+    if(kind_ == Kind::Device) {
+      cudaCheck(::cudaFree(iPtr));
+    } else {
+      cudaCheck(cudaFreeHost(iPtr));
+    }
+  }
+
+  void
+  CachingAllocator::freeCached(int iDevice) {
+    for(auto it = cached_.lower_bound(BinKey(iDevice, 0)); it != cached_.end() and it->first.first == iDevice;) {
+      if(cudaEventQuery(it->second.ready_) != cudaSuccess) {
+        ++it;
+        continue;
+      }
+      cudaCheck(cudaEventDestroy(it->second.ready_));
+      cudaFree(it->second.ptr_);
+      cachedBytes_[iDevice] -= it->second.bytes_;
+      it = cached_.erase(it);
+    }
+  }
+
+  void*
+  CachingAllocator::allocate(int iDevice, std::size_t iBytes, cudaStream_t iStream) {
+    std::size_t const bytes = binBytes(iBytes);
+    BinKey const key(iDevice, bytes);
+    {
+      std::lock_guard<std::mutex> guard(mutex_);
+      auto range = cached_.equal_range(key);
+      for(auto it = range.first; it != range.second; ++it) {
+        auto& block = it->second;
+        if(block.stream_ == iStream or cudaEventQuery(block.ready_) == cudaSuccess) {
+          block.stream_ = iStream;
+          void* ptr = block.ptr_;
+          cachedBytes_[iDevice] -= bytes;
+          live_.emplace(ptr, block);
+          cached_.erase(it);
+          return ptr;
+        }
+      }
+    }
+
+    ScopedSetDevice setDevice(iDevice);
+    void* ptr = cudaAllocate(bytes);
+    std::lock_guard<std::mutex> guard(mutex_);
+    if(ptr == nullptr) {
+      freeCached(iDevice);
+      ptr = cudaAllocate(bytes);
+      if(ptr == nullptr) {
+        throw cms::Exception("CUDAError") << "Unable to allocate " << bytes << " bytes of "
+                                          << (kind_ == Kind::Device ? "device" : "pinned host")
+                                          << " memory for device " << iDevice;
+      }
+    }
+    ++nCUDAAllocations_;
+    Block block;
+    block.ptr_ = ptr;
+    block.bytes_ = bytes;
+    block.device_ = iDevice;
+    block.stream_ = iStream;
+    live_.emplace(ptr, block);
+    return ptr;
+  }
+
+  void
+  CachingAllocator::free(void* iPtr) {
+    if(iPtr == nullptr) {
+      return;
+    }
+    std::lock_guard<std::mutex> guard(mutex_);
+    auto it = live_.find(iPtr);
+    if(it == live_.end()) {
+      throw cms::Exception("LogicError") << "CachingAllocator::free called for memory it did not allocate";
+    }
+    Block block = it->second;
+    live_.erase(it);
+
+    ScopedSetDevice setDevice(block.device_);
+    auto& cachedBytes = cachedBytes_[block.device_];
+    if(maxCachedBytes_ != 0 and cachedBytes + block.bytes_ > maxCachedBytes_) {
+      //work queued on the stream may still use the memory
+      cudaCheck(cudaStreamSynchronize(block.stream_));
+      if(block.ready_ != nullptr) {
+        cudaCheck(cudaEventDestroy(block.ready_));
+      }
+      cudaFree(block.ptr_);
+      return;
+    }
+    if(block.ready_ == nullptr) {
+      cudaCheck(cudaEventCreateWithFlags(&block.ready_, cudaEventDisableTiming));
+    }
+    cudaCheck(cudaEventRecord(block.ready_, block.stream_));
+    cachedBytes += block.bytes_;
+    cached_.emplace(BinKey(block.device_, block.bytes_), block);
+  }
+
+  unsigned long long
+  CachingAllocator::numberOfCUDAAllocations() const {
+    std::lock_guard<std::mutex> guard(mutex_);
+    return nCUDAAllocations_;
+  }
+}
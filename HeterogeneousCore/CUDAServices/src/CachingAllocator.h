@@ -0,0 +1,75 @@
+#ifndef HeterogeneousCore_CUDAServices_CachingAllocator_h
+#define HeterogeneousCore_CUDAServices_CachingAllocator_h
+// -*- C++ -*-
+//
+// Package:     HeterogeneousCore/CUDAServices
+// Class  :     CachingAllocator
+//
+/**\class cudaServices::CachingAllocator CachingAllocator.h "CachingAllocator.h"
+
+ Description: Keeps freed device or pinned host memory blocks for later reuse
+
+ Usage:
+    Requests are rounded up to a power of two (at least kMinBinBytes) so blocks of the
+ same bin are interchangeable. When a block is freed an event is recorded on the CUDA
+ stream it was allocated for; the block can be reused right away by the same stream and by
+ other streams once that event has completed. If an allocation fails, all the cached
+ blocks of that device which are not in use are given back and the allocation is retried.
+    All member functions are thread safe.
+*/
+//
+
+#include <cstddef>
+#include <map>
+#include <mutex>
+#include <utility>
+
+#include <cuda_runtime.h>
+
+namespace cudaServices {
+  class CachingAllocator {
+  public:
+    enum class Kind { Device, Host };
+    static constexpr std::size_t kMinBinBytes = 256;
+
+    /// iMaxCachedBytes is the maximum amount of free memory kept per device, 0 means no limit
+    CachingAllocator(Kind iKind, std::size_t iMaxCachedBytes);
+    ~CachingAllocator();
+
+    CachingAllocator(CachingAllocator const&) = delete;
+    CachingAllocator& operator=(CachingAllocator const&) = delete;
+
+    /// for Kind::Host iDevice must be the device of iStream
+    void* allocate(int iDevice, std::size_t iBytes, cudaStream_t iStream);
+    void free(void* iPtr);
+
+    /// total number of calls to the underlying CUDA allocation function
+    unsigned long long numberOfCUDAAllocations() const;
+
+  private:
+    struct Block {
+      void* ptr_ = nullptr;
+      std::size_t bytes_ = 0;
+      int device_ = -1;
+      cudaStream_t stream_ = nullptr;
+      cudaEvent_t ready_ = nullptr;
+    };
+    using BinKey = std::pair<int, std::size_t>;
+
+    static std::size_t binBytes(std::size_t iBytes);
+    void* cudaAllocate(std::size_t iBytes) const;
+    void cudaFree(void* iPtr) const;
+    ///must be called with mutex_ held
+    void freeCached(int iDevice);
+
+    Kind const kind_;
+    std::size_t const maxCachedBytes_;
+    mutable std::mutex mutex_;
+    std::multimap<BinKey, Block> cached_;
+    std::map<void*, Block> live_;
+    std::map<int, std::size_t> cachedBytes_;
+    unsigned long long nCUDAAllocations_ = 0;
+  };
+}
+
+#endif
@@ -16,7 +16,7 @@ Holder for an input TFile.
 
 namespace edm {
   InputFile::InputFile(char const* fileName, char const* msg, InputType inputType) :
-    file_(), fileName_(fileName), reportToken_(0), inputType_(inputType) {
+    file_(), fileName_(fileName), reportToken_(0), reportedOpened_(false), inputType_(inputType) {
 
     logFileAction(msg, fileName);
     {
@@ -65,6 +65,7 @@ namespace edm {
                                               label,
                                               fid,
                                               branchNames);
+    reportedOpened_ = true;
   }
 
   void
@@ -103,8 +104,10 @@ namespace edm {
       file_->Close();
       try {
         logFileAction("  Closed file ", fileName_.c_str());
-        Service<JobReport> reportSvc;
-        reportSvc->inputFileClosed(inputType_, reportToken_);
+        if(reportedOpened_) {
+          Service<JobReport> reportSvc;
+          reportSvc->inputFileClosed(inputType_, reportToken_);
+        }
       } catch(std::exception const&) {
         // If Close() called in a destructor after an exception throw, the services may no longer be active.
         // Therefore, we catch any reasonable new exception.
@@ -51,6 +51,7 @@ namespace edm {
     edm::propagate_const<std::unique_ptr<TFile>> file_;
     std::string fileName_;
     JobReport::Token reportToken_;
+    bool reportedOpened_; // a file opened in the background may be closed without ever being used
     InputType inputType_;
   }; 
 }
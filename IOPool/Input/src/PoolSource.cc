@@ -4,6 +4,7 @@
 #include "InputFile.h"
 #include "RootPrimaryFileSequence.h"
 #include "RootSecondaryFileSequence.h"
+#include "RootTree.h"
 #include "RunHelper.h"
 #include "DataFormats/Common/interface/ThinnedAssociation.h"
 #include "DataFormats/Provenance/interface/BranchDescription.h"
@@ -153,6 +154,7 @@ namespace edm {
     if(secondaryFileSequence_) secondaryFileSequence_->endJob();
     primaryFileSequence_->endJob();
     InputFile::reportReadBranches();
+    roottree::reportCacheStatistics();
   }
 
   std::unique_ptr<FileBlock>
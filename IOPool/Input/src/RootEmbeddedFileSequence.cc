@@ -43,19 +43,20 @@ namespace edm {
     // and should be deleted from the code.
     initialNumberOfEventsToSkip_(pset.getUntrackedParameter<unsigned int>("skipEvents", 0U)),
     treeCacheSize_(pset.getUntrackedParameter<unsigned int>("cacheSize", roottree::defaultCacheSize)),
-    enablePrefetching_(false) {
+    enablePrefetching_(pset.getUntrackedParameter<bool>("enablePrefetching", false)) {
 
     if(noFiles()) {
       throw Exception(errors::Configuration) << "RootEmbeddedFileSequence no input files specified for secondary input source.\n";
     }
     //
     // The SiteLocalConfig controls the TTreeCache size and the prefetching settings.
+    // The prefetching can also be enabled for the secondary input source alone.
     Service<SiteLocalConfig> pSLC;
     if(pSLC.isAvailable()) {
       if(treeCacheSize_ != 0U && pSLC->sourceTTreeCacheSize()) {
         treeCacheSize_ = *(pSLC->sourceTTreeCacheSize());
       }
-      enablePrefetching_ = pSLC->enablePrefetching();
+      enablePrefetching_ = enablePrefetching_ || pSLC->enablePrefetching();
     }
 
     // Set the pointer to the function that reads an event.
@@ -336,5 +337,8 @@ namespace edm {
         ->setComment("Skip the first 'skipEvents' events. Used only if 'sequential' is True and 'sameLumiBlock' is False");
     desc.addUntracked<unsigned int>("cacheSize", roottree::defaultCacheSize)
         ->setComment("Size of ROOT TTree prefetch cache.  Affects performance.");
+    desc.addUntracked<bool>("enablePrefetching", false)
+        ->setComment("True: the TTree cache of the events is filled asynchronously, the next block being read in the background.\n"
+                     "False: the prefetching is enabled only if the site local config enables it.");
   }
 }
@@ -157,7 +157,8 @@ namespace edm {
                      bool bypassVersionCheck,
                      bool labelRawDataLikeMC,
                      bool usingGoToEvent,
-                     bool enablePrefetching) :
+                     bool enablePrefetching,
+                     bool parallelUnzip) :
       file_(fileName),
       logicalFile_(logicalFileName),
       processConfiguration_(processConfiguration),
@@ -182,9 +183,9 @@ namespace edm {
       hasNewlyDroppedBranch_(),
       branchListIndexesUnchanged_(false),
       eventAux_(),
-      eventTree_(filePtr, InEvent, nStreams, treeMaxVirtualSize, treeCacheSize, roottree::defaultLearningEntries, enablePrefetching, inputType),
-      lumiTree_(filePtr, InLumi, 1, treeMaxVirtualSize, roottree::defaultNonEventCacheSize, roottree::defaultNonEventLearningEntries, enablePrefetching, inputType),
-      runTree_(filePtr, InRun, 1, treeMaxVirtualSize, roottree::defaultNonEventCacheSize, roottree::defaultNonEventLearningEntries, enablePrefetching, inputType),
+      eventTree_(filePtr, InEvent, nStreams, treeMaxVirtualSize, treeCacheSize, roottree::defaultLearningEntries, enablePrefetching, parallelUnzip, inputType),
+      lumiTree_(filePtr, InLumi, 1, treeMaxVirtualSize, roottree::defaultNonEventCacheSize, roottree::defaultNonEventLearningEntries, enablePrefetching, false, inputType),
+      runTree_(filePtr, InRun, 1, treeMaxVirtualSize, roottree::defaultNonEventCacheSize, roottree::defaultNonEventLearningEntries, enablePrefetching, false, inputType),
       treePointers_(),
       lastEventEntryNumberRead_(IndexIntoFile::invalidEntry),
       productRegistry_(),
@@ -1711,6 +1712,27 @@ namespace edm {
     }
   }
 
+  void
+  RootFile::disableSubBranches(std::vector<std::string> const& patterns) {
+    // Only the data members matching the patterns are skipped when a product is read. The product
+    // itself is still available, but the skipped members are left default constructed. Since the
+    // event tree is no longer read in full it must not be fast cloned.
+    TTree* tree = eventTree_.tree();
+    if(tree == nullptr) {
+      return;
+    }
+    for(auto const& pattern : patterns) {
+      UInt_t found = 0;
+      tree->SetBranchStatus(pattern.c_str(), false, &found);
+      if(found == 0) {
+        LogInfo("RootFile") << "No branch in the Events tree of file " << file_
+                            << " matches the pattern '" << pattern << "' of 'subBranchesNotToRead'.\n";
+      } else if((whyNotFastClonable_ & FileBlock::SubBranchesNotRead) == 0) {
+        whyNotFastClonable_ += FileBlock::SubBranchesNotRead;
+      }
+    }
+  }
+
   void
   RootFile::dropOnInput (ProductRegistry& reg, ProductSelectorRules const& rules, bool dropDescendants, InputType inputType) {
 
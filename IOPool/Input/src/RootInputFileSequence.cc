@@ -9,10 +9,14 @@
 #include "FWCore/MessageLogger/interface/MessageLogger.h"
 #include "FWCore/ParameterSet/interface/ParameterSet.h"
 #include "FWCore/ParameterSet/interface/ParameterSetDescription.h"
+#include "FWCore/ServiceRegistry/interface/ServiceRegistry.h"
 #include "Utilities/StorageFactory/interface/StorageFactory.h"
 
 #include "TSystem.h"
 
+#include <algorithm>
+#include <chrono>
+
 namespace edm {
   class BranchIDListHelper;
   class EventPrincipal;
@@ -32,7 +36,10 @@ namespace edm {
     fileIter_(fileIterEnd_),
     fileIterLastOpened_(fileIterEnd_),
     rootFile_(),
-    indexesIntoFiles_(fileCatalogItems().size()) {
+    indexesIntoFiles_(fileCatalogItems().size()),
+    numberOfFilesToPreOpen_(0U),
+    preOpenedFiles_(),
+    abandonedPreOpenedFiles_() {
   }
 
   std::vector<FileCatalogItem> const&
@@ -235,8 +242,7 @@ namespace edm {
     std::list<std::string> originalInfo;
     try {
       std::unique_ptr<InputSource::FileOpenSentry> sentry(input ? std::make_unique<InputSource::FileOpenSentry>(*input, lfn_, usedFallback_) : nullptr);
-      std::unique_ptr<char[]> name(gSystem->ExpandPathName(fileName().c_str()));;
-      filePtr = std::make_shared<InputFile>(name.get(), "  Initiating request to open file ", inputType);
+      filePtr = openFile("  Initiating request to open file ", inputType);
     }
     catch (cms::Exception const& e) {
       if(!skipBadFiles) {
@@ -297,6 +303,7 @@ namespace edm {
       fileIterLastOpened_ = fileIter_;
       setIndexIntoFile(currentIndexIntoFile);
       rootFile_->reportOpened(inputTypeName);
+      preOpenNextFiles(inputType);
     } else {
       InputFile::reportSkippedFile(fileName(), logicalFileName());
       if(!skipBadFiles) {
@@ -307,6 +314,61 @@ namespace edm {
     }
   }
 
+  std::shared_ptr<InputFile>
+  RootInputFileSequence::openFile(char const* msg, InputType inputType) {
+    auto itFound = preOpenedFiles_.find(sequenceNumberOfFile());
+    if(itFound != preOpenedFiles_.end()) {
+      auto future = std::move(itFound->second);
+      preOpenedFiles_.erase(itFound);
+      // Any exception thrown while opening the file in the background is rethrown here.
+      return future.get();
+    }
+    std::unique_ptr<char[]> name(gSystem->ExpandPathName(fileName().c_str()));
+    return std::make_shared<InputFile>(name.get(), msg, inputType);
+  }
+
+  // Opening a remote file can take seconds. The following files are therefore opened on separate
+  // threads while the current file is being processed, so that no stream has to wait for it.
+  // Only the TFile is opened in the background; the RootFile is still created when the file is needed.
+  void
+  RootInputFileSequence::preOpenNextFiles(InputType inputType) {
+    if(numberOfFilesToPreOpen_ == 0U) {
+      return;
+    }
+    size_t const current = sequenceNumberOfFile();
+    // Forget files outside the window, e.g. after skipping to another file. The destructor of a
+    // future from std::async waits for the open to finish, so the futures still in flight are kept
+    // aside instead of being destroyed here, which would block the event loop until the open is done.
+    for(auto it = preOpenedFiles_.begin(); it != preOpenedFiles_.end();) {
+      if(it->first <= current || it->first > current + numberOfFilesToPreOpen_) {
+        abandonedPreOpenedFiles_.push_back(std::move(it->second));
+        it = preOpenedFiles_.erase(it);
+      } else {
+        ++it;
+      }
+    }
+    // Drop the abandoned files whose open has finished; the others are waited for in the destructor.
+    abandonedPreOpenedFiles_.erase(std::remove_if(abandonedPreOpenedFiles_.begin(), abandonedPreOpenedFiles_.end(),
+                                                  [](std::future<std::shared_ptr<InputFile>> const& future) {
+                                                    return future.wait_for(std::chrono::seconds(0)) == std::future_status::ready;
+                                                  }),
+                                   abandonedPreOpenedFiles_.end());
+    // The InputFile uses services, e.g. the JobReport and the site local configuration.
+    ServiceToken serviceToken = ServiceRegistry::instance().presentToken();
+    for(size_t index = current + 1; index <= current + numberOfFilesToPreOpen_ && index < numberOfFiles(); ++index) {
+      std::string const& name = fileCatalogItems()[index].fileName();
+      if(name.empty() || preOpenedFiles_.find(index) != preOpenedFiles_.end()) {
+        continue;
+      }
+      std::unique_ptr<char[]> expandedName(gSystem->ExpandPathName(name.c_str()));
+      std::string fullName(expandedName.get());
+      preOpenedFiles_.emplace(index, std::async(std::launch::async, [fullName, inputType, serviceToken]() {
+        ServiceRegistry::Operate operate(serviceToken);
+        return std::make_shared<InputFile>(fullName.c_str(), "  Initiating background request to open file ", inputType);
+      }));
+    }
+  }
+
   void
   RootInputFileSequence::setIndexIntoFile(size_t index) {
    indexesIntoFiles_[index] = rootFile()->indexIntoFileSharedPtr();
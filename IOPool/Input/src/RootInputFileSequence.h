@@ -13,6 +13,8 @@ RootInputFileSequence: This is an InputSource
 #include "FWCore/Utilities/interface/InputType.h"
 #include "FWCore/Utilities/interface/get_underlying_safe.h"
 
+#include <future>
+#include <map>
 #include <memory>
 #include <string>
 #include <unordered_map>
@@ -77,7 +79,13 @@ namespace edm {
 
     std::shared_ptr<RootFile const> rootFile() const {return get_underlying_safe(rootFile_);}
     std::shared_ptr<RootFile>& rootFile() {return get_underlying_safe(rootFile_);}
+
+    // Number of the files following the current one which are opened in the background
+    void setNumberOfFilesToPreOpen(unsigned int n) {numberOfFilesToPreOpen_ = n;}
   private:
+    std::shared_ptr<InputFile> openFile(char const* msg, InputType inputType);
+    void preOpenNextFiles(InputType inputType);
+
     InputFileCatalog const& catalog_;
     std::string lfn_;
     size_t lfnHash_;
@@ -89,6 +97,10 @@ namespace edm {
     std::vector<FileCatalogItem>::const_iterator fileIterLastOpened_;
     edm::propagate_const<RootFileSharedPtr> rootFile_;
     std::vector<std::shared_ptr<IndexIntoFile> > indexesIntoFiles_;
+    unsigned int numberOfFilesToPreOpen_;
+    std::map<size_t, std::future<std::shared_ptr<InputFile>>> preOpenedFiles_;
+    // Files opened in the background which are no longer needed, kept until their open is done
+    std::vector<std::future<std::shared_ptr<InputFile>>> abandonedPreOpenedFiles_;
 
   private:
     virtual RootFileSharedPtr makeRootFile(std::shared_ptr<InputFile> filePtr) = 0; 
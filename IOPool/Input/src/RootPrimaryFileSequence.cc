@@ -33,7 +33,11 @@ namespace edm {
     treeCacheSize_(noEventSort_ ? pset.getUntrackedParameter<unsigned int>("cacheSize") : 0U),
     duplicateChecker_(new DuplicateChecker(pset)),
     usingGoToEvent_(false),
-    enablePrefetching_(false) {
+    enablePrefetching_(false),
+    // Let ROOT decompress the baskets held in the TTreeCache of the events using its own tasks. The
+    // delayed reader then only has to deserialize while holding the source's shared resource.
+    parallelUnzip_(treeCacheSize_ != 0U && pset.getUntrackedParameter<bool>("parallelUnzip")),
+    subBranchesNotToRead_(pset.getUntrackedParameter<std::vector<std::string> >("subBranchesNotToRead")) {
 
     // The SiteLocalConfig controls the TTreeCache size and the prefetching settings.
     Service<SiteLocalConfig> pSLC;
@@ -47,6 +51,8 @@ namespace edm {
     std::string branchesMustMatch = pset.getUntrackedParameter<std::string>("branchesMustMatch", std::string("permissive"));
     if(branchesMustMatch == std::string("strict")) branchesMustMatch_ = BranchDescription::Strict;
 
+    setNumberOfFilesToPreOpen(pset.getUntrackedParameter<unsigned int>("numberOfFilesToPreOpen"));
+
     // Prestage the files
     for (setAtFirstFile(); !noMoreFiles(); setAtNextFile()) {
       StorageFactory::get()->stagein(fileName());
@@ -114,7 +120,7 @@ namespace edm {
   RootPrimaryFileSequence::RootFileSharedPtr
   RootPrimaryFileSequence::makeRootFile(std::shared_ptr<InputFile> filePtr) {
       size_t currentIndexIntoFile = sequenceNumberOfFile();
-      return std::make_shared<RootFile>(
+      auto rootFile = std::make_shared<RootFile>(
           fileName(),
           input_.processConfiguration(),
           logicalFileName(),
@@ -143,7 +149,12 @@ namespace edm {
           input_.bypassVersionCheck(),
           input_.labelRawDataLikeMC(),
           usingGoToEvent_,
-          enablePrefetching_);
+          enablePrefetching_,
+          parallelUnzip_);
+      if(!subBranchesNotToRead_.empty()) {
+        rootFile->disableSubBranches(subBranchesNotToRead_);
+      }
+      return rootFile;
   }
 
   bool RootPrimaryFileSequence::nextFile() {
@@ -330,10 +341,20 @@ namespace edm {
                      "Note 3: Any sorting occurs independently in each input file (no sorting across input files).");
     desc.addUntracked<unsigned int>("cacheSize", roottree::defaultCacheSize)
         ->setComment("Size of ROOT TTree prefetch cache.  Affects performance.");
+    desc.addUntracked<bool>("parallelUnzip", false)
+        ->setComment("True: baskets in the TTree prefetch cache of the events are decompressed in parallel by ROOT before being requested.\n"
+                     "Only applies to the primary files of this source, and only has an effect if the prefetch cache is used.");
     std::string defaultString("permissive");
     desc.addUntracked<std::string>("branchesMustMatch", defaultString)
         ->setComment("'strict':     Branches in each input file must match those in the first file.\n"
                      "'permissive': Branches in each input file may be any subset of those in the first file.");
+    desc.addUntracked<unsigned int>("numberOfFilesToPreOpen", 0U)
+        ->setComment("Number of the files following the one being processed which are opened in the background.\n"
+                     "Hides the latency of opening remote files.");
+    desc.addUntracked<std::vector<std::string> >("subBranchesNotToRead", std::vector<std::string>())
+        ->setComment("Wildcard patterns of sub-branches of the Events tree which are not read, e.g.\n"
+                     "'nanoaodFlatTable_jetTable__RECO.obj.ints_' so that only the float columns of a table are read.\n"
+                     "The products themselves stay available but the members skipped are left empty. Disables fast cloning.");
 
     EventSkipperByID::fillDescription(desc);
     DuplicateChecker::fillDescription(desc);
@@ -78,6 +78,8 @@ namespace edm {
     edm::propagate_const<std::shared_ptr<DuplicateChecker>> duplicateChecker_;
     bool usingGoToEvent_;
     bool enablePrefetching_;
+    bool parallelUnzip_;
+    std::vector<std::string> subBranchesNotToRead_;
   }; // class RootPrimaryFileSequence
 }
 #endif
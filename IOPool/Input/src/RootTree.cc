@@ -1,5 +1,7 @@
 #include "RootTree.h"
 #include "RootDelayedReader.h"
+#include "FWCore/MessageLogger/interface/JobReport.h"
+#include "FWCore/ServiceRegistry/interface/Service.h"
 #include "FWCore/Utilities/interface/EDMException.h"
 #include "FWCore/Utilities/interface/Exception.h"
 #include "DataFormats/Provenance/interface/BranchDescription.h"
@@ -7,12 +9,23 @@
 #include "TTree.h"
 #include "TTreeIndex.h"
 #include "TTreeCache.h"
+#include "TTreeCacheUnzip.h"
 
 #include <cassert>
 #include <iostream>
+#include <map>
+#include <mutex>
 
 namespace edm {
   namespace {
+    // A branch read outside of the treeCache_ in this many consecutive clusters is added to it
+    unsigned int const clustersBeforeAddingBranch = 2U;
+    // A branch in the treeCache_ which was not read in this many clusters is dropped from it
+    unsigned int const clustersBeforeDroppingBranch = 4U;
+
+    std::mutex s_cacheStatisticsMutex;
+    roottree::CacheStatistics s_cacheStatistics;
+
     TBranch* getAuxiliaryBranch(TTree* tree, BranchType const& branchType) {
       TBranch* branch = tree->GetBranch(BranchTypeToAuxiliaryBranchName(branchType).c_str());
       if (branch == nullptr) {
@@ -32,6 +45,7 @@ namespace edm {
                      unsigned int cacheSize,
                      unsigned int learningEntries,
                      bool enablePrefetching,
+                     bool parallelUnzip,
                      InputType inputType) :
     filePtr_(filePtr),
     tree_(dynamic_cast<TTree*>(filePtr_.get() != nullptr ? filePtr_->Get(BranchTypeToProductTreeName(branchType).c_str()) : nullptr)),
@@ -53,10 +67,15 @@ namespace edm {
     switchOverEntry_(-1),
     rawTriggerSwitchOverEntry_(-1),
     performedSwitchOver_{false},
+    branchUse_(),
+    clusterCount_(0),
+    nextClusterEntry_(-1),
+    cacheStatistics_(),
     learningEntries_(learningEntries),
     cacheSize_(cacheSize),
     treeAutoFlush_(0),
     enablePrefetching_(enablePrefetching),
+    parallelUnzip_(parallelUnzip),
     enableTriggerCache_(branchType_ == InEvent),
     rootDelayedReader_(new RootDelayedReader(*this, filePtr, inputType)),
     branchEntryInfoBranch_(metaTree_ ? getProductProvenanceBranch(metaTree_, branchType_) : (tree_ ? getProductProvenanceBranch(tree_, branchType_) : nullptr)),
@@ -84,6 +103,7 @@ namespace edm {
          Int_t branchCount = tree_->GetListOfBranches()->GetEntriesFast();
          trainedSet_.reserve(branchCount);
          triggerSet_.reserve(branchCount);
+         branchUse_.reserve(branchCount);
       }
   }
 
@@ -180,13 +200,28 @@ namespace edm {
   void
   RootTree::setCacheSize(unsigned int cacheSize) {
     cacheSize_ = cacheSize;
-    tree_->SetCacheSize(static_cast<Long64_t>(cacheSize));
+    createCache(static_cast<Long64_t>(cacheSize));
     treeCache_.reset(dynamic_cast<TTreeCache*>(filePtr_->GetCacheRead()));
     if(treeCache_) treeCache_->SetEnablePrefetching(enablePrefetching_);
     filePtr_->SetCacheRead(nullptr);
     rawTreeCache_.reset();
   }
 
+  // TTree::SetCacheSize creates a TTreeCacheUnzip instead of a TTreeCache when ROOT's parallel
+  // unzip is enabled. ROOT only has a global setting for it, so the setting of this tree is
+  // applied around the call and the previous one restored afterwards.
+  void
+  RootTree::createCache(Long64_t cacheSize) const {
+    bool const wasParallelUnzip = TTreeCacheUnzip::IsParallelUnzip();
+    if(wasParallelUnzip != parallelUnzip_) {
+      TTreeCacheUnzip::SetParallelUnzip(parallelUnzip_ ? TTreeCacheUnzip::kEnable : TTreeCacheUnzip::kDisable);
+    }
+    tree_->SetCacheSize(cacheSize);
+    if(wasParallelUnzip != parallelUnzip_) {
+      TTreeCacheUnzip::SetParallelUnzip(wasParallelUnzip ? TTreeCacheUnzip::kEnable : TTreeCacheUnzip::kDisable);
+    }
+  }
+
   void
   RootTree::setTreeMaxVirtualSize(int treeMaxVirtualSize) {
     if (treeMaxVirtualSize >= 0) tree_->SetMaxVirtualSize(static_cast<Long64_t>(treeMaxVirtualSize));
@@ -251,7 +286,72 @@ namespace edm {
     }
     if (treeCache_ && treeCache_->IsLearning() && switchOverEntry_ >= 0 && entryNumber_ >= switchOverEntry_) {
       stopTraining();
+    } else if (adaptingCache() && entryNumber_ >= nextClusterEntry_) {
+      adaptCache();
+    }
+  }
+
+  inline bool
+  RootTree::adaptingCache() const {
+    return switchOverEntry_ >= 0 && treeCache_ && !treeCache_->IsLearning();
+  }
+
+  void
+  RootTree::setNextClusterEntry() {
+    nextClusterEntry_ = -1;
+    TTree::TClusterIterator clusterIter = tree_->GetClusterIterator(entryNumber_);
+    while (nextClusterEntry_ <= entryNumber_) {
+      nextClusterEntry_ = clusterIter();
+    }
+  }
+
+  void
+  RootTree::noteBranchUse(TBranch* branch) const {
+    auto& use = branchUse_[branch];
+    if (use.lastCluster_ == clusterCount_ && use.consecutiveClusters_ != 0) {
+      return;
     }
+    use.consecutiveClusters_ = (use.lastCluster_ + 1 == clusterCount_) ? use.consecutiveClusters_ + 1 : 1;
+    use.lastCluster_ = clusterCount_;
+  }
+
+  // Called when reading moves into a new cluster. Branches which are now read regularly but are not in the
+  // treeCache_ (e.g. because a filter only started accepting events after the learning phase) are added,
+  // and branches which stopped being read are dropped, so the cache keeps fetching one cluster of exactly
+  // the needed branches in one vectored read.
+  void
+  RootTree::adaptCache() {
+    bool changed = false;
+    for (auto& branchAndUse : branchUse_) {
+      TBranch* branch = branchAndUse.first;
+      BranchUse& use = branchAndUse.second;
+      bool const inCache = trainedSet_.find(branch) != trainedSet_.end();
+      if (!inCache && use.lastCluster_ == clusterCount_ && use.consecutiveClusters_ >= clustersBeforeAddingBranch) {
+        trainedSet_.insert(branch);
+        triggerSet_.erase(branch);
+        ++cacheStatistics_.branchesAddedToCache_;
+        changed = true;
+      } else if (inCache && branch != auxBranch_ && clusterCount_ - use.lastCluster_ >= clustersBeforeDroppingBranch) {
+        trainedSet_.erase(branch);
+        use.consecutiveClusters_ = 0;
+        ++cacheStatistics_.branchesDroppedFromCache_;
+        changed = true;
+      }
+    }
+    if (changed) {
+      filePtr_->SetCacheRead(treeCache_.get());
+      treeCache_->StartLearningPhase();
+      treeCache_->SetEntryRange(entryNumber_, tree_->GetEntries());
+      treeCache_->AddBranch(BranchTypeToAuxiliaryBranchName(branchType_).c_str(), kTRUE);
+      for (auto branch : trainedSet_) {
+        treeCache_->AddBranch(branch, kTRUE);
+      }
+      treeCache_->StopLearningPhase();
+      filePtr_->SetCacheRead(nullptr);
+      ++cacheStatistics_.cacheRetrainings_;
+    }
+    ++clusterCount_;
+    setNextClusterEntry();
   }
 
   // The actual implementation is done below; it's split in this strange
@@ -293,7 +393,7 @@ namespace edm {
 
       // ROOT will automatically expand the cache to fit one cluster; hence, we use
       // 5 MB as the cache size below
-      tree_->SetCacheSize(static_cast<Long64_t>(5*1024*1024));
+      createCache(static_cast<Long64_t>(5*1024*1024));
       rawTriggerTreeCache_.reset(dynamic_cast<TTreeCache*>(filePtr_->GetCacheRead()));
       if(rawTriggerTreeCache_) rawTriggerTreeCache_->SetEnablePrefetching(false);
       TObjArray *branches = tree_->GetListOfBranches();
@@ -325,7 +425,7 @@ namespace edm {
         performedSwitchOver_ = true; 
         
         // Train the triggerCache
-        tree_->SetCacheSize(static_cast<Long64_t>(5*1024*1024));
+        createCache(static_cast<Long64_t>(5*1024*1024));
         triggerTreeCache_.reset(dynamic_cast<TTreeCache*>(filePtr_->GetCacheRead()));
         triggerTreeCache_->SetEnablePrefetching(false);
         triggerTreeCache_->SetLearnEntries(0);
@@ -370,6 +470,18 @@ namespace edm {
   RootTree::getEntry(TBranch* branch, EntryNumber entryNumber) const {
     try {
       TTreeCache * cache = selectCache(branch, entryNumber);
+      if (cache == nullptr) {
+        ++cacheStatistics_.readsWithoutCache_;
+      } else if (cache == treeCache_.get()) {
+        ++cacheStatistics_.readsFromCache_;
+      } else if (cache == rawTreeCache_.get()) {
+        ++cacheStatistics_.readsFromLearningCache_;
+      } else {
+        ++cacheStatistics_.readsFromTriggerCache_;
+      }
+      if (adaptingCache()) {
+        noteBranchUse(branch);
+      }
       filePtr_->SetCacheRead(cache);
       branch->GetEntry(entryNumber);
       filePtr_->SetCacheRead(nullptr);
@@ -408,7 +520,7 @@ namespace edm {
     assert(branchType_ == InEvent);
     assert(!rawTreeCache_);
     treeCache_->SetLearnEntries(learningEntries_);
-    tree_->SetCacheSize(static_cast<Long64_t>(cacheSize_));
+    createCache(static_cast<Long64_t>(cacheSize_));
     rawTreeCache_.reset(dynamic_cast<TTreeCache *>(filePtr_->GetCacheRead()));
     rawTreeCache_->SetEnablePrefetching(false);
     filePtr_->SetCacheRead(nullptr);
@@ -443,6 +555,14 @@ namespace edm {
     treeCache_->StopLearningPhase();
     filePtr_->SetCacheRead(nullptr);
     rawTreeCache_.reset();
+
+    // Start the adaptive training with everything learned considered as just used.
+    clusterCount_ = 1;
+    branchUse_.clear();
+    for (auto branch : trainedSet_) {
+      branchUse_[branch] = BranchUse{clusterCount_, 1};
+    }
+    setNextClusterEntry();
   }
 
   void
@@ -455,6 +575,17 @@ namespace edm {
     // We make sure the treeCache_ is detached from the file,
     // so that ROOT does not also delete it.
     filePtr_->SetCacheRead(nullptr);
+    if (branchType_ == InEvent) {
+      std::lock_guard<std::mutex> guard(s_cacheStatisticsMutex);
+      s_cacheStatistics.readsFromCache_ += cacheStatistics_.readsFromCache_;
+      s_cacheStatistics.readsFromLearningCache_ += cacheStatistics_.readsFromLearningCache_;
+      s_cacheStatistics.readsFromTriggerCache_ += cacheStatistics_.readsFromTriggerCache_;
+      s_cacheStatistics.readsWithoutCache_ += cacheStatistics_.readsWithoutCache_;
+      s_cacheStatistics.branchesAddedToCache_ += cacheStatistics_.branchesAddedToCache_;
+      s_cacheStatistics.branchesDroppedFromCache_ += cacheStatistics_.branchesDroppedFromCache_;
+      s_cacheStatistics.cacheRetrainings_ += cacheStatistics_.cacheRetrainings_;
+      cacheStatistics_ = roottree::CacheStatistics();
+    }
     // We *must* delete the TTreeCache here because the TFilePrefetch object
     // references the TFile.  If TFile is closed, before the TTreeCache is
     // deleted, the TFilePrefetch may continue to do TFile operations, causing
@@ -506,6 +637,23 @@ namespace edm {
 
 
   namespace roottree {
+    void
+    reportCacheStatistics() {
+      std::map<std::string, std::string> metrics;
+      {
+        std::lock_guard<std::mutex> guard(s_cacheStatisticsMutex);
+        metrics["ReadsFromCache"] = std::to_string(s_cacheStatistics.readsFromCache_);
+        metrics["ReadsFromLearningCache"] = std::to_string(s_cacheStatistics.readsFromLearningCache_);
+        metrics["ReadsFromTriggerCache"] = std::to_string(s_cacheStatistics.readsFromTriggerCache_);
+        metrics["ReadsWithoutCache"] = std::to_string(s_cacheStatistics.readsWithoutCache_);
+        metrics["BranchesAddedToCache"] = std::to_string(s_cacheStatistics.branchesAddedToCache_);
+        metrics["BranchesDroppedFromCache"] = std::to_string(s_cacheStatistics.branchesDroppedFromCache_);
+        metrics["CacheRetrainings"] = std::to_string(s_cacheStatistics.cacheRetrainings_);
+      }
+      Service<JobReport> reportSvc;
+      reportSvc->reportPerformanceSummary("TTreeCacheStatistics", metrics);
+    }
+
     Int_t
     getEntry(TBranch* branch, EntryNumber entryNumber) {
       Int_t n = 0;
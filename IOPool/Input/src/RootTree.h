@@ -89,9 +89,22 @@ namespace edm {
       std::unordered_map<unsigned int,BranchInfo> map_;
     };
 
+    // Counts of how the branches of the Event trees were read, summed over all files.
+    struct CacheStatistics {
+      unsigned long long readsFromCache_ = 0;
+      unsigned long long readsFromLearningCache_ = 0;
+      unsigned long long readsFromTriggerCache_ = 0;
+      unsigned long long readsWithoutCache_ = 0;
+      unsigned long long branchesAddedToCache_ = 0;
+      unsigned long long branchesDroppedFromCache_ = 0;
+      unsigned long long cacheRetrainings_ = 0;
+    };
+
     Int_t getEntry(TBranch* branch, EntryNumber entryNumber);
     Int_t getEntry(TTree* tree, EntryNumber entryNumber);
     std::unique_ptr<TTreeCache> trainCache(TTree* tree, InputFile& file, unsigned int cacheSize, char const* branchNames);
+    // This is a per job report, the statistics of each file are added when the file is closed.
+    void reportCacheStatistics();
   }
 
   class RootTree {
@@ -105,6 +118,7 @@ namespace edm {
              unsigned int cacheSize,
              unsigned int learningEntries,
              bool enablePrefetching,
+             bool parallelUnzip,
              InputType inputType);
     ~RootTree();
 
@@ -196,9 +210,16 @@ namespace edm {
 
   private:
     void setCacheSize(unsigned int cacheSize);
+    // creates the TTreeCache of the file with ROOT's parallel unzip set as for this tree
+    void createCache(Long64_t cacheSize) const;
     void setTreeMaxVirtualSize(int treeMaxVirtualSize);
     void startTraining();
     void stopTraining();
+    // After the learning phase the set of branches in the treeCache_ keeps being adapted at each cluster boundary.
+    inline bool adaptingCache() const;
+    void noteBranchUse(TBranch* branch) const;
+    void adaptCache();
+    void setNextClusterEntry();
 
     std::shared_ptr<InputFile> filePtr_;
 // We use bare pointers for pointers to some ROOT entities.
@@ -217,6 +238,14 @@ namespace edm {
     mutable std::shared_ptr<TTreeCache> rawTriggerTreeCache_;
     mutable std::unordered_set<TBranch*> trainedSet_;
     mutable std::unordered_set<TBranch*> triggerSet_;
+    struct BranchUse {
+      unsigned int lastCluster_ = 0;
+      unsigned int consecutiveClusters_ = 0;
+    };
+    mutable std::unordered_map<TBranch*, BranchUse> branchUse_;
+    unsigned int clusterCount_;
+    EntryNumber nextClusterEntry_;
+    mutable roottree::CacheStatistics cacheStatistics_;
     EntryNumber entries_;
     EntryNumber entryNumber_;
     std::unique_ptr<std::vector<EntryNumber> > entryNumberForIndex_;
@@ -232,6 +261,7 @@ namespace edm {
 // Enable asynchronous I/O in ROOT (done in a separate thread).  Only takes
 // effect on the primary treeCache_; all other caches have this explicitly disabled.
     bool enablePrefetching_;
+    bool parallelUnzip_;
     bool enableTriggerCache_;
     std::unique_ptr<RootDelayedReader> rootDelayedReader_;
 
@@ -0,0 +1,39 @@
+# Configuration file for PoolInputPreOpenTest
+# Reads three copies of PoolInputTest.root with the following files opened in the background.
+# Arguments: number of events to skip, expected number of events,
+# and optionally 'missing' to put a file which does not exist in the middle of the sequence
+
+import FWCore.ParameterSet.Config as cms
+from sys import argv
+from string import atoi
+
+process = cms.Process("TESTPREOPEN")
+process.load("FWCore.Framework.test.cmsExceptionsFatal_cff")
+
+process.maxEvents = cms.untracked.PSet(
+    input = cms.untracked.int32(-1)
+)
+
+files = ['file:PoolInputTest.root', 'file:PoolInputOther.root', 'file:PoolInputThird.root']
+if len(argv) > 4 and argv[4] == 'missing':
+    files.insert(1, 'file:PoolInputPreOpenMissing.root')
+
+process.source = cms.Source("PoolSource",
+    fileNames = cms.untracked.vstring(files),
+    numberOfFilesToPreOpen = cms.untracked.uint32(2),
+    skipEvents = cms.untracked.uint32(atoi(argv[2])),
+    skipBadFiles = cms.untracked.bool(True),
+    duplicateCheckMode = cms.untracked.string('noDuplicateCheck')
+)
+
+process.OtherThing = cms.EDProducer("OtherThingProducer")
+
+process.Analysis = cms.EDAnalyzer("OtherThingAnalyzer")
+
+process.counter = cms.OutputModule("SewerModule",
+    shouldPass = cms.int32(atoi(argv[3])),
+    name = cms.string('preOpen')
+)
+
+process.p = cms.Path(process.OtherThing*process.Analysis)
+process.ep = cms.EndPath(process.counter)
@@ -12,6 +12,12 @@ cmsRun --parameter-set ${LOCAL_TEST_DIR}/PoolInputTest_cfg.py || die 'Failure us
 cmsRun  ${LOCAL_TEST_DIR}/PoolInputTest_noDelay_cfg.py >& ${LOCAL_TMP_DIR}/PoolInputTest_noDelay_cfg.txt || die 'Failure using PoolInputTest_noDelay_cfg.py' $?
 grep 'event delayed read from source' ${LOCAL_TMP_DIR}/PoolInputTest_noDelay_cfg.txt && die 'Failure in PoolInputTest_noDelay_cfg.py, found delay reads from source' 1
 
+cp PoolInputTest.root PoolInputThird.root
+
+cmsRun ${LOCAL_TEST_DIR}/PoolInputPreOpenTest_cfg.py 0 33 || die 'Failure using PoolInputPreOpenTest_cfg.py' $?
+cmsRun ${LOCAL_TEST_DIR}/PoolInputPreOpenTest_cfg.py 15 18 || die 'Failure using PoolInputPreOpenTest_cfg.py skipping events' $?
+cmsRun ${LOCAL_TEST_DIR}/PoolInputPreOpenTest_cfg.py 0 33 missing || die 'Failure using PoolInputPreOpenTest_cfg.py with a missing file' $?
+
 cmsRun ${LOCAL_TEST_DIR}/PrePool2FileInputTest_cfg.py || die 'Failure using PrePool2FileInputTest_cfg.py' $?
 cmsRun ${LOCAL_TEST_DIR}/Pool2FileInputTest_cfg.py || die 'Failure using Pool2FileInputTest_cfg.py' $?
 
@@ -52,6 +52,7 @@ namespace edm {
     int const& splitLevel() const {return splitLevel_;}
     std::string const& basketOrder() const {return basketOrder_;}
     int const& treeMaxVirtualSize() const {return treeMaxVirtualSize_;}
+    bool concurrentBasketFlush() const {return concurrentBasketFlush_;}
     bool const& overrideInputFileSplitLevels() const {return overrideInputFileSplitLevels_;}
     DropMetaData const& dropMetaData() const {return dropMetaData_;}
     std::string const& catalog() const {return catalog_;}
@@ -184,6 +185,7 @@ namespace edm {
     int const splitLevel_;
     std::string basketOrder_;
     int const treeMaxVirtualSize_;
+    bool const concurrentBasketFlush_;
     int whyNotFastClonable_;
     DropMetaData dropMetaData_;
     std::string const moduleLabel_;
@@ -51,6 +51,7 @@ namespace edm {
     splitLevel_(std::min<int>(pset.getUntrackedParameter<int>("splitLevel") + 1, 99)),
     basketOrder_(pset.getUntrackedParameter<std::string>("sortBaskets")),
     treeMaxVirtualSize_(pset.getUntrackedParameter<int>("treeMaxVirtualSize")),
+    concurrentBasketFlush_(pset.getUntrackedParameter<bool>("concurrentBasketFlush")),
     whyNotFastClonable_(pset.getUntrackedParameter<bool>("fastCloning") ? FileBlock::CanFastClone : FileBlock::DisabledInConfigFile),
     dropMetaData_(DropNone),
     moduleLabel_(pset.getParameter<std::string>("@module_label")),
@@ -458,6 +459,10 @@ namespace edm {
                      "Used by ROOT when fast copying. Affects performance.");
     desc.addUntracked<int>("treeMaxVirtualSize", -1)
         ->setComment("Size of ROOT TTree TBasket cache.  Affects performance.");
+    desc.addUntracked<bool>("concurrentBasketFlush", true)
+        ->setComment("True:  Let ROOT fill and compress the baskets of different branches concurrently using TBB tasks.\n"
+                     "       Only has an effect if ROOT implicit multi-threading is enabled by the InitRootHandlers service.\n"
+                     "False: Fill and compress all branches serially on the thread running the output module.");
     desc.addUntracked<bool>("fastCloning", true)
         ->setComment("True:  Allow fast copying, if possible.\n"
                      "False: Disable fast copying.");
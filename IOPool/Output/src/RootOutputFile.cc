@@ -106,14 +106,16 @@ namespace edm {
       pEventEntryInfoVector_(&eventEntryInfoVector_),
       pBranchListIndexes_(nullptr),
       pEventSelectionIDs_(nullptr),
-      eventTree_(filePtr(), InEvent, om_->splitLevel(), om_->treeMaxVirtualSize()),
-      lumiTree_(filePtr(), InLumi, om_->splitLevel(), om_->treeMaxVirtualSize()),
-      runTree_(filePtr(), InRun, om_->splitLevel(), om_->treeMaxVirtualSize()),
+      eventTree_(filePtr(), InEvent, om_->splitLevel(), om_->treeMaxVirtualSize(), om_->concurrentBasketFlush()),
+      lumiTree_(filePtr(), InLumi, om_->splitLevel(), om_->treeMaxVirtualSize(), om_->concurrentBasketFlush()),
+      runTree_(filePtr(), InRun, om_->splitLevel(), om_->treeMaxVirtualSize(), om_->concurrentBasketFlush()),
       treePointers_(),
       dataTypeReported_(false),
       processHistoryRegistry_(),
       parentageIDs_(),
       branchesWithStoredHistory_(),
+      producedBranches_(),
+      producedBranchesFilled_(false),
       wrapperBaseTClass_(TClass::GetClass("edm::WrapperBase")) {
     if (om_->compressionAlgorithm() == std::string("ZLIB")) {
       filePtr_->SetCompressionAlgorithm(ROOT::kZLIB);
@@ -259,6 +261,11 @@ namespace edm {
         message << "some events were skipped because of duplicate checking.\n";
         whyNotFastClonable &= ~(FileBlock::DuplicateEventsRemoved);
       }
+      if((whyNotFastClonable & FileBlock::SubBranchesNotRead) != 0) {
+        message << "some sub-branches of the input file were not read.\n";
+        whyNotFastClonable &= ~(FileBlock::SubBranchesNotRead);
+        isWarning = false;
+      }
       if((whyNotFastClonable & FileBlock::MaxEventsTooSmall) != 0) {
         message << "some events were not copied because of maxEvents limit.\n";
         whyNotFastClonable &= ~(FileBlock::MaxEventsTooSmall);
@@ -703,15 +710,17 @@ namespace edm {
     // which BranchIDs were produced in this process because
     // we may be storing meta data for only those products
     // We do this only for event products.
-    std::set<BranchID> producedBranches;
-    if(doProvenance && branchType == InEvent && om_->dropMetaData() != PoolOutputModule::DropNone) {
+    // The set is the same for all events, so it is built only once.
+    if(doProvenance && branchType == InEvent && om_->dropMetaData() != PoolOutputModule::DropNone && !producedBranchesFilled_) {
       Service<ConstProductRegistry> preg;
       for(auto bd : preg->allBranchDescriptions()) {
         if(bd->produced() && bd->branchType() == InEvent) {
-          producedBranches.insert(bd->branchID());
+          producedBranches_.insert(bd->branchID());
         }
       }
+      producedBranchesFilled_ = true;
     }
+    std::set<BranchID> const& producedBranches = producedBranches_;
 
     // Loop over EDProduct branches, possibly fill the provenance, and write the branch.
     for(auto const& item : items) {
@@ -764,8 +773,9 @@ namespace edm {
                                           std::set<edm::StoredProductProvenance>& oToInsert) {
     StoredProductProvenance toStore;
     toStore.branchID_ = iProv.branchID().id();
-    std::set<edm::StoredProductProvenance>::iterator itFound = oToInsert.find(toStore);
-    if(itFound == oToInsert.end()) {
+    // the position found is the insertion hint for a new entry
+    std::set<edm::StoredProductProvenance>::iterator itFound = oToInsert.lower_bound(toStore);
+    if(itFound == oToInsert.end() || oToInsert.key_comp()(toStore, *itFound)) {
       //get the index to the ParentageID or insert a new value if not already present
       std::pair<std::map<edm::ParentageID,unsigned int>::iterator,bool> i = parentageIDs_.insert(std::make_pair(iProv.parentageID(),static_cast<unsigned int>(parentageIDs_.size())));
       toStore.parentageIDIndex_ = i.first->second;
@@ -777,7 +787,7 @@ namespace edm {
           << "Please report this to the framework hypernews forum 'hn-cms-edmFramework@cern.ch'.\n";
       }
 
-      oToInsert.insert(toStore);
+      oToInsert.insert(itFound, toStore);
       return true;
     }
     return false;
@@ -141,6 +141,8 @@ namespace edm {
     ProcessHistoryRegistry processHistoryRegistry_;
     std::map<ParentageID,unsigned int> parentageIDs_;
     std::set<BranchID> branchesWithStoredHistory_;
+    std::set<BranchID> producedBranches_;
+    bool producedBranchesFilled_;
     edm::propagate_const<TClass*> wrapperBaseTClass_;
   };
 
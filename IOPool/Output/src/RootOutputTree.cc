@@ -90,7 +90,8 @@ namespace edm {
                    std::shared_ptr<TFile> filePtr,
                    BranchType const& branchType,
                    int splitLevel,
-                   int treeMaxVirtualSize) :
+                   int treeMaxVirtualSize,
+                   bool concurrentBasketFlush) :
       filePtr_(filePtr),
       tree_(makeTTree(filePtr.get(), BranchTypeToProductTreeName(branchType), splitLevel)),
       producedBranches_(),
@@ -102,6 +103,8 @@ namespace edm {
       fastCloneAuxBranches_(false) {
 
     if(treeMaxVirtualSize >= 0) tree_->SetMaxVirtualSize(treeMaxVirtualSize);
+    // With implicit MT, TTree::Fill spawns one task per top level branch to fill and compress its baskets
+    tree_->SetImplicitMT(concurrentBasketFlush);
   }
 
   TTree*
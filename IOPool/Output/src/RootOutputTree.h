@@ -26,7 +26,8 @@ namespace edm {
     RootOutputTree(std::shared_ptr<TFile> filePtr,
                    BranchType const& branchType,
                    int splitLevel,
-                   int treeMaxVirtualSize);
+                   int treeMaxVirtualSize,
+                   bool concurrentBasketFlush);
 
     ~RootOutputTree() {}
 
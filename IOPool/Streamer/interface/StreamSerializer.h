@@ -20,6 +20,16 @@
 
 const int init_size = 1024*1024;
 
+// The compressed event data always starts with a header identifying the
+// algorithm so the reader does not need to be told which one was used
+enum StreamerCompressionAlgo {
+  UNCOMPRESSED = 0,
+  ZLIB = 1,
+  LZMA = 2,
+  LZ4 = 3,
+  ZSTD = 4
+};
+
 // Data structure to be shared by all output modules for event serialization
 struct SerializeDataBuffer
 {
@@ -77,7 +87,7 @@ namespace edm
                           ThinnedAssociationsHelper const& thinnedAssociationsHelper);
 
     int serializeEvent(EventForOutput const& event, ParameterSetID const& selectorConfig,
-                       bool use_compression, int compression_level,
+                       StreamerCompressionAlgo compressionAlgo, int compression_level,
                        SerializeDataBuffer &data_buffer);
 
     /**
@@ -89,6 +99,18 @@ namespace edm
                                        unsigned int inputSize,
                                        std::vector<unsigned char> &outputBuffer,
                                        int compressionLevel);
+    static unsigned int compressBufferLZMA(unsigned char *inputBuffer,
+                                           unsigned int inputSize,
+                                           std::vector<unsigned char> &outputBuffer,
+                                           int compressionLevel);
+    static unsigned int compressBufferLZ4(unsigned char *inputBuffer,
+                                          unsigned int inputSize,
+                                          std::vector<unsigned char> &outputBuffer,
+                                          int compressionLevel);
+    static unsigned int compressBufferZSTD(unsigned char *inputBuffer,
+                                           unsigned int inputSize,
+                                           std::vector<unsigned char> &outputBuffer,
+                                           int compressionLevel);
 
   private:
 
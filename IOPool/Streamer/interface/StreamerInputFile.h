@@ -18,13 +18,18 @@ namespace edm {
   class StreamerInputFile {
   public:
 
-    /**Reads a Streamer file */
+    /**Reads a Streamer file.
+       If useMemoryMap is true, local files are mapped into memory and the EventMsgView
+       returned by currentRecord points directly into the mapping instead of into a copy.
+       The view stays valid until the file is closed. */
     explicit StreamerInputFile(std::string const& name,
-      std::shared_ptr<EventSkipperByID> eventSkipperByID = std::shared_ptr<EventSkipperByID>());
+      std::shared_ptr<EventSkipperByID> eventSkipperByID = std::shared_ptr<EventSkipperByID>(),
+      bool useMemoryMap = false);
 
     /** Multiple Streamer files */
     explicit StreamerInputFile(std::vector<std::string> const& names,
-      std::shared_ptr<EventSkipperByID> eventSkipperByID = std::shared_ptr<EventSkipperByID>());
+      std::shared_ptr<EventSkipperByID> eventSkipperByID = std::shared_ptr<EventSkipperByID>(),
+      bool useMemoryMap = false);
 
     ~StreamerInputFile();
 
@@ -44,6 +49,9 @@ namespace edm {
   private:
 
     void openStreamerFile(std::string const& name);
+    /** Returns false if the file could not be mapped so the Storage should be used */
+    bool mapStreamerFile(std::string const& name);
+    void unmapStreamerFile();
     IOSize readBytes(char* buf, IOSize nBytes);
     IOOffset skipBytes(IOSize nBytes);
 
@@ -78,6 +86,11 @@ namespace edm {
 
     edm::propagate_const<std::unique_ptr<Storage>> storage_;
 
+    bool useMemoryMap_;
+    char* mappedData_;  /** Start of the memory mapped file, nullptr if not mapped */
+    IOSize mappedSize_;
+    IOSize mappedPosition_;
+
     bool endOfFile_;
   };
 }
@@ -61,7 +61,39 @@ namespace edm {
                                          unsigned int inputSize,
                                          std::vector<unsigned char>& outputBuffer,
                                          unsigned int expectedFullSize);
+    static unsigned int uncompressBufferROOT(unsigned char* inputBuffer,
+                                             unsigned int inputSize,
+                                             std::vector<unsigned char>& outputBuffer,
+                                             unsigned int expectedFullSize);
+    static unsigned int uncompressBufferZSTD(unsigned char* inputBuffer,
+                                             unsigned int inputSize,
+                                             std::vector<unsigned char>& outputBuffer,
+                                             unsigned int expectedFullSize);
+    ///\return true if the data starts with the header ROOT puts in front of LZMA or LZ4 compressed blocks
+    static bool isBufferROOT(unsigned char const* inputBuffer, unsigned int inputSize);
+    ///\return true if the data starts with the zstd frame magic number
+    static bool isBufferZSTD(unsigned char const* inputBuffer, unsigned int inputSize);
+  private:
+    class EventPrincipalHolder;
+
   protected:
+    /** The result of decompressing and unstreaming one event message */
+    struct DeserializedEvent {
+      std::unique_ptr<SendEvent> sendEvent_;
+      std::unique_ptr<EventPrincipalHolder> eventPrincipalHolder_;
+      unsigned int lumi_ = 0;
+    };
+
+    /** Decompresses and unstreams the event using only the buffers passed in.
+        It does not change the state of the source so different events can be
+        deserialized concurrently as long as each uses its own buffers. */
+    DeserializedEvent unstreamEvent(EventMsgView const& eventView,
+                                    std::vector<unsigned char>& dest,
+                                    TBufferFile& xbuf) const;
+
+    /** Makes iEvent the event which will be read next by the framework */
+    void setDeserializedEvent(DeserializedEvent iEvent);
+
     static void declareStreamers(SendDescs const& descs);
     static void buildClassCache(SendDescs const& descs);
     void resetAfterEndRun();
@@ -46,7 +46,9 @@ namespace edm {
 
     int maxEventSize_;
     bool useCompression_;
+    std::string compressionAlgoStr_;
     int compressionLevel_;
+    StreamerCompressionAlgo compressionAlgo_;
 
     // test luminosity sections
     int lumiSectionInterval_;  
@@ -16,12 +16,16 @@
 #include "IOPool/Streamer/interface/InitMsgBuilder.h"
 #include "FWCore/Framework/interface/ConstProductRegistry.h"
 #include "FWCore/Framework/interface/EventForOutput.h"
+#include "FWCore/MessageLogger/interface/MessageLogger.h"
 #include "FWCore/ParameterSet/interface/Registry.h"
 #include "FWCore/Utilities/interface/Adler32Calculator.h"
 #include "DataFormats/Streamer/interface/StreamedProducts.h"
 #include "FWCore/ServiceRegistry/interface/Service.h"
 
 #include "zlib.h"
+#include "zstd.h"
+#include "Compression.h"
+#include "RZip.h"
 #include <algorithm>
 #include <cstdlib>
 #include <iostream>
@@ -29,6 +33,45 @@
 
 namespace edm {
 
+  namespace {
+    // ROOT compresses at most this many bytes into one block
+    unsigned int const kMaxROOTBlockSize = 0xffffff;
+    // each block starts with a header holding the algorithm and the block sizes
+    unsigned int const kROOTHeaderSize = 9;
+
+    unsigned int compressBufferROOT(unsigned char *inputBuffer,
+                                    unsigned int inputSize,
+                                    std::vector<unsigned char> &outputBuffer,
+                                    int compressionLevel,
+                                    ROOT::ECompressionAlgorithm algorithm) {
+      unsigned int const nBlocks = (inputSize + kMaxROOTBlockSize - 1)/kMaxROOTBlockSize;
+      unsigned long dest_size = inputSize + nBlocks*kROOTHeaderSize;
+      if(outputBuffer.size() < dest_size) outputBuffer.resize(dest_size);
+
+      unsigned int read = 0;
+      unsigned int written = 0;
+      while(read < inputSize) {
+        int srcSize = std::min(inputSize - read, kMaxROOTBlockSize);
+        int tgtSize = outputBuffer.size() - written;
+        int irep = 0;
+        R__zipMultipleAlgorithm(compressionLevel, &srcSize, reinterpret_cast<char*>(inputBuffer + read),
+                                &tgtSize, reinterpret_cast<char*>(&outputBuffer[written]), &irep, algorithm);
+        if(irep <= 0) {
+          // ROOT gives up if the data does not get smaller
+          FDEBUG(9) << "Compression failed for algorithm " << algorithm << std::endl;
+          return 0;
+        }
+        read += srcSize;
+        written += irep;
+      }
+      FDEBUG(1) << " original size = " << inputSize
+                << " final size = " << written
+                << " ratio = " << double(written)/double(inputSize)
+                << std::endl;
+      return written;
+    }
+  }
+
   /**
    * Creates a translator instance for the specified product registry.
    */
@@ -127,7 +170,7 @@ namespace edm {
    */
   int StreamSerializer::serializeEvent(EventForOutput const& event,
                                        ParameterSetID const& selectorConfig,
-                                       bool use_compression, int compression_level,
+                                       StreamerCompressionAlgo compressionAlgo, int compression_level,
                                        SerializeDataBuffer& data_buffer) {
 
     EventSelectionIDVector selectionIDs = event.eventSelectionIDs();
@@ -222,9 +265,24 @@ namespace edm {
     // compress before return if we need to
     // should test if compressed already - should never be?
     //   as double compression can have problems
-    if(use_compression) {
-      unsigned int dest_size =
-        compressBuffer(data_buffer.ptr_, data_buffer.curr_event_size_, data_buffer.comp_buf_, compression_level);
+    if(compressionAlgo != UNCOMPRESSED) {
+      unsigned int dest_size = 0;
+      switch(compressionAlgo) {
+        case ZLIB:
+          dest_size = compressBuffer(data_buffer.ptr_, data_buffer.curr_event_size_, data_buffer.comp_buf_, compression_level);
+          break;
+        case LZMA:
+          dest_size = compressBufferLZMA(data_buffer.ptr_, data_buffer.curr_event_size_, data_buffer.comp_buf_, compression_level);
+          break;
+        case LZ4:
+          dest_size = compressBufferLZ4(data_buffer.ptr_, data_buffer.curr_event_size_, data_buffer.comp_buf_, compression_level);
+          break;
+        case ZSTD:
+          dest_size = compressBufferZSTD(data_buffer.ptr_, data_buffer.curr_event_size_, data_buffer.comp_buf_, compression_level);
+          break;
+        default:
+          break;
+      }
       if(dest_size != 0) {
         data_buffer.ptr_ = &data_buffer.comp_buf_[0]; // reset to point at compressed area
         data_buffer.curr_space_used_ = dest_size;
@@ -278,4 +336,42 @@ namespace edm {
 
     return resultSize;
   }
+
+  unsigned int
+  StreamSerializer::compressBufferLZMA(unsigned char *inputBuffer,
+                                       unsigned int inputSize,
+                                       std::vector<unsigned char> &outputBuffer,
+                                       int compressionLevel) {
+    return compressBufferROOT(inputBuffer, inputSize, outputBuffer, compressionLevel, ROOT::kLZMA);
+  }
+
+  unsigned int
+  StreamSerializer::compressBufferLZ4(unsigned char *inputBuffer,
+                                      unsigned int inputSize,
+                                      std::vector<unsigned char> &outputBuffer,
+                                      int compressionLevel) {
+    return compressBufferROOT(inputBuffer, inputSize, outputBuffer, compressionLevel, ROOT::kLZ4);
+  }
+
+  unsigned int
+  StreamSerializer::compressBufferZSTD(unsigned char *inputBuffer,
+                                       unsigned int inputSize,
+                                       std::vector<unsigned char> &outputBuffer,
+                                       int compressionLevel) {
+    size_t const dest_size = ZSTD_compressBound(inputSize);
+    if(outputBuffer.size() < dest_size) outputBuffer.resize(dest_size);
+
+    // the output starts with the zstd magic number which is used to identify the algorithm when reading
+    size_t const ret = ZSTD_compress(&outputBuffer[0], outputBuffer.size(), inputBuffer, inputSize, compressionLevel);
+    if(ZSTD_isError(ret)) {
+      // the event is then written uncompressed
+      edm::LogError("StreamSerializer") << "ZSTD compression failed: " << ZSTD_getErrorName(ret);
+      return 0;
+    }
+    FDEBUG(1) << " original size = " << inputSize
+              << " final size = " << ret
+              << " ratio = " << double(ret)/double(inputSize)
+              << std::endl;
+    return ret;
+  }
 }
@@ -7,8 +7,11 @@
 #include "FWCore/ParameterSet/interface/ParameterSet.h"
 #include "FWCore/ParameterSet/interface/ConfigurationDescriptions.h"
 #include "FWCore/ParameterSet/interface/ParameterSetDescription.h"
+#include "FWCore/ServiceRegistry/interface/ServiceRegistry.h"
 #include "FWCore/Sources/interface/EventSkipperByID.h"
 
+#include "tbb/task_arena.h"
+
 namespace edm {
 
   StreamerFileReader::StreamerFileReader(ParameterSet const& pset, InputSourceDescription const& desc) :
@@ -16,7 +19,13 @@ namespace edm {
       streamerNames_(pset.getUntrackedParameter<std::vector<std::string> >("fileNames")),
       streamReader_(),
       eventSkipperByID_(EventSkipperByID::create(pset).release()),
-      initialNumberOfEventsToSkip_(pset.getUntrackedParameter<unsigned int>("skipEvents")) {
+      initialNumberOfEventsToSkip_(pset.getUntrackedParameter<unsigned int>("skipEvents")),
+      memoryMapFiles_(pset.getUntrackedParameter<bool>("memoryMapFiles")),
+      numberOfPrefetchedEvents_(pset.getUntrackedParameter<unsigned int>("numberOfPrefetchedEvents")),
+      prefetched_(),
+      unusedPrefetched_(),
+      endOfEvents_(false),
+      newHeaderAtEnd_(false) {
     InputFileCatalog catalog(pset.getUntrackedParameter<std::vector<std::string> >("fileNames"), pset.getUntrackedParameter<std::string>("overrideCatalog"));
     streamerNames_ = catalog.fileNames();
     reset_();
@@ -24,14 +33,28 @@ namespace edm {
   }
 
   StreamerFileReader::~StreamerFileReader() {
+    waitForPrefetchedEvents();
+  }
+
+  StreamerFileReader::PrefetchedEvent::PrefetchedEvent() :
+    message_(),
+    dest_(),
+    xbuf_(TBuffer::kRead, 0),
+    event_(),
+    exception_(),
+    group_(),
+    newHeader_(false) {
   }
 
   void
   StreamerFileReader::reset_() {
+    waitForPrefetchedEvents();
+    endOfEvents_ = false;
+    newHeaderAtEnd_ = false;
     if (streamerNames_.size() > 1) {
-      streamReader_ = std::make_unique<StreamerInputFile>(streamerNames_, eventSkipperByID());
+      streamReader_ = std::make_unique<StreamerInputFile>(streamerNames_, eventSkipperByID(), memoryMapFiles_);
     } else if (streamerNames_.size() == 1) {
-      streamReader_ = std::make_unique<StreamerInputFile>(streamerNames_.at(0), eventSkipperByID());
+      streamReader_ = std::make_unique<StreamerInputFile>(streamerNames_.at(0), eventSkipperByID(), memoryMapFiles_);
     } else {
       throw Exception(errors::FileReadError, "StreamerFileReader::StreamerFileReader")
          << "No fileNames were specified\n";
@@ -45,6 +68,9 @@ namespace edm {
 
 
   bool StreamerFileReader::checkNextEvent() {
+    if(numberOfPrefetchedEvents_ > 0) {
+      return checkNextPrefetchedEvent();
+    }
     EventMsgView const* eview = getNextEvent();
 
     if (newHeader()) {
@@ -61,9 +87,108 @@ namespace edm {
     return true;
   }
 
+  bool
+  StreamerFileReader::checkNextPrefetchedEvent() {
+    prefetchEvents();
+    if(prefetched_.empty()) {
+      if(newHeaderAtEnd_) {
+        newHeaderAtEnd_ = false;
+        deserializeAndMergeWithRegistry(*getHeader(), true);
+      }
+      return false;
+    }
+    auto event = std::move(prefetched_.front());
+    prefetched_.pop_front();
+    if(event->newHeader_) {
+      // all events from the previous file are done so the registry can be changed
+      deserializeAndMergeWithRegistry(*getHeader(), true);
+      startDeserialization(*event);
+    }
+    // keep more events deserializing while the framework processes this one
+    prefetchEvents();
+
+    // do not let this thread pick up unrelated long running tasks while the source is waiting
+    tbb::this_task_arena::isolate([&event]() { event->group_.wait(); });
+    std::exception_ptr exception = event->exception_;
+    event->exception_ = std::exception_ptr();
+    if(not exception) {
+      setDeserializedEvent(std::move(event->event_));
+    }
+    unusedPrefetched_.push_back(std::move(event));
+    if(exception) {
+      std::rethrow_exception(exception);
+    }
+    return true;
+  }
+
+  void
+  StreamerFileReader::prefetchEvents() {
+    // events after a file transition are only deserialized once the new header has been merged
+    while(not endOfEvents_ and prefetched_.size() < numberOfPrefetchedEvents_ and
+          (prefetched_.empty() or not prefetched_.back()->newHeader_)) {
+      EventMsgView const* eview = getNextEvent();
+      bool const header = newHeader();
+      if(eview == nullptr) {
+        endOfEvents_ = true;
+        newHeaderAtEnd_ = header;
+        return;
+      }
+      std::unique_ptr<PrefetchedEvent> event;
+      if(unusedPrefetched_.empty()) {
+        event = std::make_unique<PrefetchedEvent>();
+      } else {
+        event = std::move(unusedPrefetched_.back());
+        unusedPrefetched_.pop_back();
+      }
+      // the view only stays valid until the next read so the message is copied
+      event->message_.assign(eview->startAddress(), eview->startAddress() + eview->size());
+      event->newHeader_ = header;
+      if(not header) {
+        startDeserialization(*event);
+      }
+      prefetched_.push_back(std::move(event));
+    }
+  }
+
+  void
+  StreamerFileReader::startDeserialization(PrefetchedEvent& iEvent) {
+    // the task may run on a thread without the Services of the job
+    ServiceToken token = ServiceRegistry::instance().presentToken();
+    iEvent.group_.run([this, &iEvent, token]() {
+      ServiceRegistry::Operate guard(token);
+      try {
+        EventMsgView view(&iEvent.message_[0]);
+        iEvent.event_ = unstreamEvent(view, iEvent.dest_, iEvent.xbuf_);
+      } catch(...) {
+        iEvent.exception_ = std::current_exception();
+      }
+    });
+  }
+
+  void
+  StreamerFileReader::waitForPrefetchedEvents() {
+    for(auto& event : prefetched_) {
+      tbb::this_task_arena::isolate([&event]() { event->group_.wait(); });
+    }
+    prefetched_.clear();
+  }
+
   void
   StreamerFileReader::skip(int toSkip) {
-    for(int i = 0; i != toSkip; ++i) {
+    // events already read ahead are skipped first
+    while(toSkip > 0 and not prefetched_.empty()) {
+      auto& event = prefetched_.front();
+      if(event->newHeader_) {
+        deserializeAndMergeWithRegistry(*getHeader(), true);
+      }
+      tbb::this_task_arena::isolate([&event]() { event->group_.wait(); });
+      event->exception_ = std::exception_ptr();
+      event->event_ = DeserializedEvent();
+      unusedPrefetched_.push_back(std::move(event));
+      prefetched_.pop_front();
+      --toSkip;
+    }
+    for(int i = 0; i < toSkip; ++i) {
       EventMsgView const* evMsg = getNextEvent();
       if(evMsg == nullptr)  {
         return;
@@ -115,6 +240,10 @@ namespace edm {
     desc.addUntracked<unsigned int>("skipEvents", 0U)
         ->setComment("Skip the first 'skipEvents' events that otherwise would have been processed.");
     desc.addUntracked<std::string>("overrideCatalog", std::string());
+    desc.addUntracked<unsigned int>("numberOfPrefetchedEvents", 0U)
+        ->setComment("If not 0, the source reads this many events ahead and decompresses and unstreams them in parallel tasks so the deserialization is no longer serialized with the source.");
+    desc.addUntracked<bool>("memoryMapFiles", false)
+        ->setComment("If True, local files are memory mapped and events are deserialized directly from the mapping instead of being copied first.");
     //This next parameter is read in the base class, but its default value depends on the derived class, so it is set here.
     desc.addUntracked<bool>("inputFileTransitionsEachEvent", false);
     StreamerInputSource::fillDescription(desc);
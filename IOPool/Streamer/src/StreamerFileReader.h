@@ -4,10 +4,14 @@
 #include "IOPool/Streamer/interface/StreamerInputSource.h"
 #include "FWCore/Utilities/interface/get_underlying_safe.h"
 
+#include <deque>
+#include <exception>
 #include <memory>
 #include <string>
 #include <vector>
 
+#include "tbb/task_group.h"
+
 class EventMsgView;
 class InitMsgView;
 
@@ -34,6 +38,23 @@ namespace edm {
     void genuineCloseFile() override;
     void reset_() override;
 
+    /** Holds a copy of an event message while it is being deserialized in its own task */
+    struct PrefetchedEvent {
+      PrefetchedEvent();
+      std::vector<unsigned char> message_;
+      std::vector<unsigned char> dest_;
+      TBufferFile xbuf_;
+      DeserializedEvent event_;
+      std::exception_ptr exception_;
+      tbb::task_group group_;
+      bool newHeader_; /** the event starts a new file whose header must be merged first */
+    };
+
+    bool checkNextPrefetchedEvent();
+    void prefetchEvents();
+    void startDeserialization(PrefetchedEvent& iEvent);
+    void waitForPrefetchedEvents();
+
     std::shared_ptr<EventSkipperByID const> eventSkipperByID() const {return get_underlying_safe(eventSkipperByID_);}
     std::shared_ptr<EventSkipperByID>& eventSkipperByID() {return get_underlying_safe(eventSkipperByID_);}
 
@@ -41,6 +62,12 @@ namespace edm {
     edm::propagate_const<std::unique_ptr<StreamerInputFile>> streamReader_;
     edm::propagate_const<std::shared_ptr<EventSkipperByID>> eventSkipperByID_;
     int initialNumberOfEventsToSkip_;
+    bool memoryMapFiles_;
+    unsigned int numberOfPrefetchedEvents_;
+    std::deque<std::unique_ptr<PrefetchedEvent>> prefetched_;
+    std::vector<std::unique_ptr<PrefetchedEvent>> unusedPrefetched_;
+    bool endOfEvents_;
+    bool newHeaderAtEnd_;
   };
 } //end-of-namespace-def
 
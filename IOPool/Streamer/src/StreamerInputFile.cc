@@ -10,9 +10,15 @@
 #include "Utilities/StorageFactory/interface/IOFlags.h"
 #include "Utilities/StorageFactory/interface/StorageFactory.h"
 
+#include <algorithm>
 #include <iomanip>
 #include <iostream>
 
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
 namespace edm {
 
   StreamerInputFile::~StreamerInputFile() {
@@ -20,7 +26,8 @@ namespace edm {
   }
 
   StreamerInputFile::StreamerInputFile(std::string const& name,
-                                       std::shared_ptr<EventSkipperByID> eventSkipperByID) :
+                                       std::shared_ptr<EventSkipperByID> eventSkipperByID,
+                                       bool useMemoryMap) :
     startMsg_(),
     currentEvMsg_(),
     headerBuf_(1000*1000),
@@ -35,13 +42,18 @@ namespace edm {
     currProto_(0),
     newHeader_(false),
     storage_(),
+    useMemoryMap_(useMemoryMap),
+    mappedData_(nullptr),
+    mappedSize_(0),
+    mappedPosition_(0),
     endOfFile_(false) {
     openStreamerFile(name);
     readStartMessage();
   }
 
   StreamerInputFile::StreamerInputFile(std::vector<std::string> const& names,
-                                       std::shared_ptr<EventSkipperByID> eventSkipperByID) :
+                                       std::shared_ptr<EventSkipperByID> eventSkipperByID,
+                                       bool useMemoryMap) :
     startMsg_(),
     currentEvMsg_(),
     headerBuf_(1000*1000),
@@ -55,6 +67,11 @@ namespace edm {
     currRun_(0),
     currProto_(0),
     newHeader_(false),
+    storage_(),
+    useMemoryMap_(useMemoryMap),
+    mappedData_(nullptr),
+    mappedSize_(0),
+    mappedPosition_(0),
     endOfFile_(false) {
     openStreamerFile(names.at(0));
     ++currentFile_;
@@ -71,6 +88,12 @@ namespace edm {
     currentFileName_ = name;
     logFileAction("  Initiating request to open file ");
 
+    if(useMemoryMap_ && mapStreamerFile(name)) {
+      currentFileOpen_ = true;
+      logFileAction("  Successfully mapped file ");
+      return;
+    }
+
     IOOffset size = -1;
     if(StorageFactory::get()->check(name, &size)) {
       try {
@@ -93,9 +116,55 @@ namespace edm {
     logFileAction("  Successfully opened file ");
   }
 
+  bool
+  StreamerInputFile::mapStreamerFile(std::string const& name) {
+    // only local files can be mapped, anything else goes through the StorageFactory
+    std::string fileName = name;
+    if(fileName.compare(0, 5, "file:") == 0) {
+      fileName = fileName.substr(5);
+    } else if(fileName.find(':') != std::string::npos) {
+      return false;
+    }
+    int fd = ::open(fileName.c_str(), O_RDONLY);
+    if(fd < 0) {
+      return false;
+    }
+    struct stat info;
+    if(::fstat(fd, &info) != 0 || info.st_size == 0) {
+      ::close(fd);
+      return false;
+    }
+    void* data = ::mmap(nullptr, info.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    // the mapping stays valid after the descriptor is closed
+    ::close(fd);
+    if(data == MAP_FAILED) {
+      return false;
+    }
+    // the file is read front to back so ask the kernel to read ahead aggressively
+    ::madvise(data, info.st_size, MADV_SEQUENTIAL);
+    ::madvise(data, info.st_size, MADV_WILLNEED);
+    mappedData_ = static_cast<char*>(data);
+    mappedSize_ = info.st_size;
+    mappedPosition_ = 0;
+    return true;
+  }
+
+  void
+  StreamerInputFile::unmapStreamerFile() {
+    // the current record points into the mapping
+    currentEvMsg_ = std::shared_ptr<EventMsgView>();
+    ::munmap(mappedData_, mappedSize_);
+    mappedData_ = nullptr;
+    mappedSize_ = 0;
+    mappedPosition_ = 0;
+  }
+
   void
   StreamerInputFile::closeStreamerFile() {
-    if(currentFileOpen_ && storage_) {
+    if(currentFileOpen_ && mappedData_ != nullptr) {
+      unmapStreamerFile();
+      logFileAction("  Closed file ");
+    } else if(currentFileOpen_ && storage_) {
       storage_->close();
       logFileAction("  Closed file ");
     }
@@ -103,6 +172,12 @@ namespace edm {
   }
 
   IOSize StreamerInputFile::readBytes(char *buf, IOSize nBytes) {
+    if(mappedData_ != nullptr) {
+      IOSize n = std::min(nBytes, mappedSize_ - mappedPosition_);
+      std::copy(mappedData_ + mappedPosition_, mappedData_ + mappedPosition_ + n, buf);
+      mappedPosition_ += n;
+      return n;
+    }
     IOSize n = 0;
     try {
       n = storage_->read(buf, nBytes);
@@ -116,6 +191,11 @@ namespace edm {
   }
 
   IOOffset StreamerInputFile::skipBytes(IOSize nBytes) {
+    if(mappedData_ != nullptr) {
+      IOSize n = std::min(nBytes, mappedSize_ - mappedPosition_);
+      mappedPosition_ += n;
+      return n;
+    }
     IOOffset n = 0;
     try {
       // We wish to return the number of bytes skipped, not the final offset.
@@ -225,10 +305,19 @@ namespace edm {
     if(endOfFile_) return 0;
 
     bool eventRead = false;
+    char* eventStart = nullptr;
     while(!eventRead) {
 
       IOSize nWant = sizeof(EventHeader);
-      IOSize nGot = readBytes(&eventBuf_[0], nWant);
+      IOSize nGot = 0;
+      if(mappedData_ != nullptr) {
+        // the event is used directly from the mapped file
+        eventStart = mappedData_ + mappedPosition_;
+        nGot = skipBytes(nWant);
+      } else {
+        eventStart = &eventBuf_[0];
+        nGot = readBytes(eventStart, nWant);
+      }
       if(nGot == 0) {
         // no more data available
         endOfFile_ = true;
@@ -239,7 +328,7 @@ namespace edm {
           << "Failed reading streamer file, first read in readEventMessage\n"
           << "Requested " << nWant << " bytes, read function returned " << nGot << " bytes\n";
       }
-      HeaderView head(&eventBuf_[0]);
+      HeaderView head(eventStart);
       uint32 code = head.code();
 
       // If it is not an event then something is wrong.
@@ -255,13 +344,20 @@ namespace edm {
       }
       eventRead = true;
       if(eventSkipperByID_) {
-        EventHeader *evh = (EventHeader *)(&eventBuf_[0]);
+        EventHeader *evh = (EventHeader *)(eventStart);
         if(eventSkipperByID_->skipIt(convert32(evh->run_), convert32(evh->lumi_), convert64(evh->event_))) {
           eventRead = false;
         }
       }
       nWant = eventSize - sizeof(EventHeader);
-      if(eventRead) {
+      if(eventRead && mappedData_ != nullptr) {
+        nGot = skipBytes(nWant);
+        if(nGot != nWant) {
+          throw Exception(errors::FileReadError, "StreamerInputFile::readEventMessage")
+            << "Failed reading streamer file, mapped file ends inside the event in readEventMessage\n"
+            << "Requested " << nWant << " bytes, only " << nGot << " bytes left in the file\n";
+        }
+      } else if(eventRead) {
         if(eventBuf_.size() < eventSize) eventBuf_.resize(eventSize);
         nGot = readBytes(&eventBuf_[sizeof(EventHeader)], nWant);
         if(nGot != nWant) {
@@ -278,7 +374,10 @@ namespace edm {
         }
       }
     }
-    currentEvMsg_ = std::make_shared<EventMsgView>((void*)&eventBuf_[0]); // propagate_const<T> has no reset() function
+    if(mappedData_ == nullptr) {
+      eventStart = &eventBuf_[0]; // the buffer may have been resized
+    }
+    currentEvMsg_ = std::make_shared<EventMsgView>((void*)eventStart); // propagate_const<T> has no reset() function
     return 1;
   }
 
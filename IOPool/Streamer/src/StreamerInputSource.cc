@@ -17,6 +17,8 @@
 #include "DataFormats/Provenance/interface/ThinnedAssociationsHelper.h"
 
 #include "zlib.h"
+#include "zstd.h"
+#include "RZip.h"
 
 #include "DataFormats/Common/interface/RefCoreStreamer.h"
 #include "FWCore/Utilities/interface/WrappedClassName.h"
@@ -199,6 +201,13 @@ namespace edm {
    */
   void
   StreamerInputSource::deserializeEvent(EventMsgView const& eventView) {
+    setDeserializedEvent(unstreamEvent(eventView, dest_, xbuf_));
+  }
+
+  StreamerInputSource::DeserializedEvent
+  StreamerInputSource::unstreamEvent(EventMsgView const& eventView,
+                                     std::vector<unsigned char>& dest,
+                                     TBufferFile& xbuf) const {
     if(eventView.code() != Header::EVENT)
       throw cms::Exception("StreamTranslation","Event deserialization error")
         << "received wrong message type: expected EVENT, got "
@@ -228,14 +237,20 @@ namespace edm {
         << eventView.adler32_chksum() << " host name = " << eventView.hostName() << std::endl;
     }
     if(origsize != 78 && origsize != 0) {
-      // compressed
-      dest_size = uncompressBuffer(const_cast<unsigned char*>((unsigned char const*)eventView.eventData()),
-                                   eventView.eventLength(), dest_, origsize);
+      // compressed, the algorithm is identified by the header of the compressed data
+      unsigned char* compressedData = const_cast<unsigned char*>((unsigned char const*)eventView.eventData());
+      if(isBufferZSTD(compressedData, eventView.eventLength())) {
+        dest_size = uncompressBufferZSTD(compressedData, eventView.eventLength(), dest, origsize);
+      } else if(isBufferROOT(compressedData, eventView.eventLength())) {
+        dest_size = uncompressBufferROOT(compressedData, eventView.eventLength(), dest, origsize);
+      } else {
+        dest_size = uncompressBuffer(compressedData, eventView.eventLength(), dest, origsize);
+      }
     } else { // not compressed
       // we need to copy anyway the buffer as we are using dest in xbuf
       dest_size = eventView.eventLength();
-      dest_.resize(dest_size);
-      unsigned char* pos = (unsigned char*) &dest_[0];
+      dest.resize(dest_size);
+      unsigned char* pos = (unsigned char*) &dest[0];
       unsigned char const* from = (unsigned char const*) eventView.eventData();
       std::copy(from,from+dest_size,pos);
     }
@@ -243,8 +258,8 @@ namespace edm {
     //             (char const*) &dest[0],kFALSE);
     //TBuffer xbuf(TBuffer::kRead, eventView.eventLength(),
     //             (char const*) eventView.eventData(),kFALSE);
-    xbuf_.Reset();
-    xbuf_.SetBuffer(&dest_[0],dest_size,kFALSE);
+    xbuf.Reset();
+    xbuf.SetBuffer(&dest[0],dest_size,kFALSE);
     RootDebug tracer(10,10);
 
     //We do not yet know which EventPrincipal we will use, therefore
@@ -252,18 +267,27 @@ namespace edm {
     // make a new one instead of reusing the same one becuase when running
     // multi-threaded there will be multiple EventPrincipals being used
     // simultaneously.
-    eventPrincipalHolder_ = std::make_unique<EventPrincipalHolder>(); // propagate_const<T> has no reset() function
-    setRefCoreStreamer(eventPrincipalHolder_.get());
+    DeserializedEvent result;
+    result.lumi_ = eventView.lumi();
+    result.eventPrincipalHolder_ = std::make_unique<EventPrincipalHolder>();
+    setRefCoreStreamer(result.eventPrincipalHolder_.get());
     {
       std::shared_ptr<void> refCoreStreamerGuard(nullptr,[](void*){ setRefCoreStreamer();
         ;});
-      sendEvent_ = std::unique_ptr<SendEvent>((SendEvent*)xbuf_.ReadObjectAny(tc_));
+      result.sendEvent_ = std::unique_ptr<SendEvent>((SendEvent*)xbuf.ReadObjectAny(tc_));
     }
 
-    if(sendEvent_.get() == nullptr) {
+    if(result.sendEvent_.get() == nullptr) {
         throw cms::Exception("StreamTranslation","Event deserialization error")
           << "got a null event from input stream\n";
     }
+    return result;
+  }
+
+  void
+  StreamerInputSource::setDeserializedEvent(DeserializedEvent iEvent) {
+    eventPrincipalHolder_ = std::move(iEvent.eventPrincipalHolder_); // propagate_const<T> has no reset() function
+    sendEvent_ = std::move(iEvent.sendEvent_);
     processHistoryRegistryForUpdate().registerProcessHistory(sendEvent_->processHistory());
 
     FDEBUG(5) << "Got event: " << sendEvent_->aux().id() << " " << sendEvent_->products().size() << std::endl;
@@ -273,9 +297,9 @@ namespace edm {
       setRunAuxiliary(runAuxiliary);
       resetLuminosityBlockAuxiliary();
     }
-    if(!luminosityBlockAuxiliary() || luminosityBlockAuxiliary()->luminosityBlock() != eventView.lumi()) {
+    if(!luminosityBlockAuxiliary() || luminosityBlockAuxiliary()->luminosityBlock() != iEvent.lumi_) {
       LuminosityBlockAuxiliary* luminosityBlockAuxiliary =
-        new LuminosityBlockAuxiliary(runAuxiliary()->run(), eventView.lumi(), sendEvent_->aux().time(), Timestamp::invalidTimestamp());
+        new LuminosityBlockAuxiliary(runAuxiliary()->run(), iEvent.lumi_, sendEvent_->aux().time(), Timestamp::invalidTimestamp());
       luminosityBlockAuxiliary->setProcessHistoryID(sendEvent_->processHistory().id());
       setLuminosityBlockAuxiliary(luminosityBlockAuxiliary);
     }
@@ -387,6 +411,75 @@ namespace edm {
     return (unsigned int) uncompressedSize;
   }
 
+  bool
+  StreamerInputSource::isBufferROOT(unsigned char const* inputBuffer, unsigned int inputSize) {
+    return inputSize >= 2 and
+      ((inputBuffer[0] == 'X' and inputBuffer[1] == 'Z') or (inputBuffer[0] == 'L' and inputBuffer[1] == '4'));
+  }
+
+  bool
+  StreamerInputSource::isBufferZSTD(unsigned char const* inputBuffer, unsigned int inputSize) {
+    // ZSTD_MAGICNUMBER stored little endian
+    return inputSize >= 4 and
+      inputBuffer[0] == 0x28 and inputBuffer[1] == 0xB5 and inputBuffer[2] == 0x2F and inputBuffer[3] == 0xFD;
+  }
+
+  /**
+   * Uncompresses data written by ROOT's compression framework (LZMA or LZ4)
+   * which is made of consecutive blocks each with their own header.
+   */
+  unsigned int
+  StreamerInputSource::uncompressBufferROOT(unsigned char* inputBuffer,
+                                            unsigned int inputSize,
+                                            std::vector<unsigned char>& outputBuffer,
+                                            unsigned int expectedFullSize) {
+    outputBuffer.resize(expectedFullSize);
+    unsigned int read = 0;
+    unsigned int written = 0;
+    while(read < inputSize) {
+      int srcSize = 0;
+      int tgtSize = 0;
+      if(0 != R__unzip_header(&srcSize, inputBuffer + read, &tgtSize) or
+         srcSize <= 0 or read + srcSize > inputSize or written + tgtSize > expectedFullSize) {
+        throw cms::Exception("StreamDeserialization","Uncompression error")
+          << "corrupted compression block header at byte " << read << "\n";
+      }
+      int irep = 0;
+      R__unzip(&srcSize, inputBuffer + read, &tgtSize, &outputBuffer[written], &irep);
+      if(irep != tgtSize) {
+        throw cms::Exception("StreamDeserialization","Uncompression error")
+          << "block at byte " << read << " gave " << irep << " bytes instead of " << tgtSize << "\n";
+      }
+      read += srcSize;
+      written += irep;
+    }
+    if(written != expectedFullSize) {
+      throw cms::Exception("StreamDeserialization","Uncompression error")
+        << "mismatch event lengths should be" << expectedFullSize << " got "
+        << written << "\n";
+    }
+    return written;
+  }
+
+  unsigned int
+  StreamerInputSource::uncompressBufferZSTD(unsigned char* inputBuffer,
+                                            unsigned int inputSize,
+                                            std::vector<unsigned char>& outputBuffer,
+                                            unsigned int expectedFullSize) {
+    outputBuffer.resize(expectedFullSize);
+    size_t const ret = ZSTD_decompress(&outputBuffer[0], expectedFullSize, inputBuffer, inputSize);
+    if(ZSTD_isError(ret)) {
+      throw cms::Exception("StreamDeserialization","Uncompression error")
+        << "Error = " << ZSTD_getErrorName(ret) << "\n ";
+    }
+    if(ret != expectedFullSize) {
+      throw cms::Exception("StreamDeserialization","Uncompression error")
+        << "mismatch event lengths should be" << expectedFullSize << " got "
+        << ret << "\n";
+    }
+    return ret;
+  }
+
   void StreamerInputSource::resetAfterEndRun() {
      // called from an online streamer source to reset after a stop command
      // so an enable command will work
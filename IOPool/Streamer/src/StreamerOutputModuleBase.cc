@@ -8,6 +8,7 @@
 #include "FWCore/ParameterSet/interface/ParameterSet.h"
 #include "FWCore/ParameterSet/interface/ParameterSetDescription.h"
 #include "FWCore/Utilities/interface/DebugMacros.h"
+#include "FWCore/Utilities/interface/Exception.h"
 //#include "FWCore/Utilities/interface/Digest.h"
 #include "FWCore/Version/interface/GetReleaseVersion.h"
 #include "DataFormats/Common/interface/TriggerResults.h"
@@ -21,6 +22,7 @@
 #include <unistd.h>
 #include <vector>
 #include "zlib.h"
+#include "zstd.h"
 
 namespace {
   //A utility function that packs bits from source into bytes, with
@@ -60,7 +62,9 @@ namespace edm {
     selections_(&keptProducts()[InEvent]),
     maxEventSize_(ps.getUntrackedParameter<int>("max_event_size")),
     useCompression_(ps.getUntrackedParameter<bool>("use_compression")),
+    compressionAlgoStr_(ps.getUntrackedParameter<std::string>("compression_algorithm")),
     compressionLevel_(ps.getUntrackedParameter<int>("compression_level")),
+    compressionAlgo_(UNCOMPRESSED),
     lumiSectionInterval_(ps.getUntrackedParameter<int>("lumiSection_interval")),
     serializer_(selections_),
     serializeDataBuffer_(),
@@ -82,15 +86,30 @@ namespace edm {
     timeInSecSinceUTC = static_cast<double>(now.tv_sec) + (static_cast<double>(now.tv_usec)/1000000.0);
 
     if(useCompression_ == true) {
+      int maxCompressionLevel = 9;
+      if(compressionAlgoStr_ == "ZLIB") {
+        compressionAlgo_ = ZLIB;
+      } else if(compressionAlgoStr_ == "LZMA") {
+        compressionAlgo_ = LZMA;
+      } else if(compressionAlgoStr_ == "LZ4") {
+        compressionAlgo_ = LZ4;
+      } else if(compressionAlgoStr_ == "ZSTD") {
+        compressionAlgo_ = ZSTD;
+        maxCompressionLevel = ZSTD_maxCLevel();
+      } else {
+        throw cms::Exception("StreamerOutputModuleBase", "Compression type unknown")
+          << "Unknown compression algorithm '" << compressionAlgoStr_ << "'. Supported compression algorithms are ZLIB, LZMA, LZ4 and ZSTD\n";
+      }
       if(compressionLevel_ <= 0) {
         FDEBUG(9) << "Compression Level = " << compressionLevel_
                   << " no compression" << std::endl;
         compressionLevel_ = 0;
         useCompression_ = false;
-      } else if(compressionLevel_ > 9) {
+        compressionAlgo_ = UNCOMPRESSED;
+      } else if(compressionLevel_ > maxCompressionLevel) {
         FDEBUG(9) << "Compression Level = " << compressionLevel_
-                  << " using max compression level 9" << std::endl;
-        compressionLevel_ = 9;
+                  << " using max compression level " << maxCompressionLevel << std::endl;
+        compressionLevel_ = maxCompressionLevel;
       }
     }
     serializeDataBuffer_.bufs_.resize(maxEventSize_);
@@ -264,7 +283,7 @@ namespace edm {
       setLumiSection();
     }
 
-    serializer_.serializeEvent(e, selectorConfig(), useCompression_, compressionLevel_, serializeDataBuffer_);
+    serializer_.serializeEvent(e, selectorConfig(), compressionAlgo_, compressionLevel_, serializeDataBuffer_);
 
     // resize bufs_ to reflect space used in serializer_ + header
     // I just added an overhead for header of 50000 for now
@@ -291,7 +310,10 @@ namespace edm {
     unsigned char* src = serializeDataBuffer_.bufferPointer();
     std::copy(src,src + src_size, msg->eventAddr());
     msg->setEventLength(src_size);
-    if(useCompression_) msg->setOrigDataSize(serializeDataBuffer_.currentEventSize());
+    // the data is written uncompressed if the compression did not make it smaller
+    if(useCompression_ and src_size != serializeDataBuffer_.currentEventSize()) {
+      msg->setOrigDataSize(serializeDataBuffer_.currentEventSize());
+    }
 
     l1bit_.clear();  //Clear up for the next event to come.
     return msg;
@@ -304,7 +326,9 @@ namespace edm {
     desc.addUntracked<bool>("use_compression", true)
         ->setComment("If True, compression will be used to write streamer file.");
     desc.addUntracked<int>("compression_level", 1)
-        ->setComment("ROOT compression level to use.");
+        ->setComment("Compression level to use. 1 to 9 for ZLIB, LZMA and LZ4, up to 22 for ZSTD.");
+    desc.addUntracked<std::string>("compression_algorithm", "ZLIB")
+        ->setComment("Compression algorithm to use: ZLIB, LZMA, LZ4 or ZSTD. The reader determines the algorithm from the data.");
     desc.addUntracked<int>("lumiSection_interval", 0)
         ->setComment("If 0, use lumi section number from event.\n"
                      "If not 0, the interval in seconds between fake lumi sections.");
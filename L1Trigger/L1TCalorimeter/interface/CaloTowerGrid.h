@@ -0,0 +1,57 @@
+///
+/// \class l1t::CaloTowerGrid
+///
+/// Description: dense (iEta, iPhi) grid of the tower hwPt of an event
+///
+/// Implementation:
+///   filled with a single pass over the towers, in any order, so that the sliding window
+///   algorithms read the towers from a flat array instead of calling CaloTools::getTower for
+///   every position of every window. Positions without a tower read 0, like the null tower
+///   of CaloTools::getTower.
+///
+
+//
+
+#ifndef L1Trigger_L1TCalorimeter_CaloTowerGrid_h
+#define L1Trigger_L1TCalorimeter_CaloTowerGrid_h
+
+#include "DataFormats/L1TCalorimeter/interface/CaloTower.h"
+#include "L1Trigger/L1TCalorimeter/interface/CaloTools.h"
+
+#include <array>
+#include <vector>
+
+namespace l1t {
+
+  class CaloTowerGrid {
+
+  public:
+    explicit CaloTowerGrid(const std::vector<l1t::CaloTower>& towers) {
+      hwPt_.fill(0);
+      for (const auto& tower : towers) {
+        if (inGrid(tower.hwEta(), tower.hwPhi())) hwPt_[index(tower.hwEta(), tower.hwPhi())] = tower.hwPt();
+      }
+    }
+
+    // hwPt of the tower at calo iEta and iPhi in 1..72, 0 if there is none
+    int hwPt(int iEta, int iPhi) const {
+      return inGrid(iEta, iPhi) ? hwPt_[index(iEta, iPhi)] : 0;
+    }
+
+  private:
+    static constexpr int kNEta = 2*CaloTools::kHFEnd + 1;
+
+    static bool inGrid(int iEta, int iPhi) {
+      return iEta >= -CaloTools::kHFEnd && iEta <= CaloTools::kHFEnd && iPhi >= 1 && iPhi <= CaloTools::kNPhi;
+    }
+    static int index(int iEta, int iPhi) {
+      return (iEta + CaloTools::kHFEnd)*CaloTools::kNPhi + iPhi - 1;
+    }
+
+    std::array<int, kNEta*CaloTools::kNPhi> hwPt_;
+
+  };
+
+}
+
+#endif
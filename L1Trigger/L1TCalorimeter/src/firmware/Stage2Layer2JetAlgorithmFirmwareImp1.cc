@@ -9,6 +9,7 @@
 #include "L1Trigger/L1TCalorimeter/interface/Stage2Layer2JetAlgorithmFirmware.h"
 #include "DataFormats/Math/interface/LorentzVector.h"
 #include "L1Trigger/L1TCalorimeter/interface/CaloTools.h"
+#include "L1Trigger/L1TCalorimeter/interface/CaloTowerGrid.h"
 #include "L1Trigger/L1TCalorimeter/interface/AccumulatingSort.h"
 #include "L1Trigger/L1TCalorimeter/interface/BitonicSort.h"
 #include "CondFormats/L1TObjects/interface/CaloParams.h"
@@ -69,6 +70,10 @@ void l1t::Stage2Layer2JetAlgorithmFirmwareImp1::create(const std::vector<l1t::Ca
 						       std::vector<l1t::Jet> & alljets, 
 						       std::string PUSubMethod) {
   
+  // tower Et read by the seeds and the 9x9 windows
+  const CaloTowerGrid grid(towers);
+  const double seedThreshold = floor(params_->jetSeedThreshold()/params_->towerLsbSum());
+
   // etaSide=1 is positive eta, etaSide=-1 is negative eta
   for (int etaSide=1; etaSide>=-1; etaSide-=2) {
     
@@ -106,14 +111,12 @@ void l1t::Stage2Layer2JetAlgorithmFirmwareImp1::create(const std::vector<l1t::Ca
 	  if (jetsRing.size()==18) break;
 	  
 	  // seed tower
-	  const CaloTower& tow = CaloTools::getTower(towers, CaloTools::caloEta(ieta), iphi); 
-	  
-	  int seedEt = tow.hwPt();
+	  int seedEt = grid.hwPt(CaloTools::caloEta(ieta), iphi);
 	  int iEt = seedEt;
 	  bool vetoCandidate = false;
 	  
 	  // check it passes the seed threshold
-	  if(iEt < floor(params_->jetSeedThreshold()/params_->towerLsbSum())) continue;
+	  if(iEt < seedThreshold) continue;
 	  
 	  // loop over towers in this jet
 	  for( int deta = -4; deta < 5; ++deta ) {
@@ -132,8 +135,7 @@ void l1t::Stage2Layer2JetAlgorithmFirmwareImp1::create(const std::vector<l1t::Ca
 	      if (ieta < 0 && ietaTest >=0) ietaTest += 1;
 	   
 	      // check jet mask and sum tower et
-	      const CaloTower& towTest = CaloTools::getTower(towers, CaloTools::caloEta(ietaTest), iphiTest);
-	      towEt = towTest.hwPt();
+	      towEt = grid.hwPt(CaloTools::caloEta(ietaTest), iphiTest);
 	      
               if      (mask_[8-(dphi+4)][deta+4] == 0) continue;
 	      else if (mask_[8-(dphi+4)][deta+4] == 1) vetoCandidate = (seedEt < towEt);
@@ -106,8 +106,10 @@ public:
     }
 
     /// evaluate an algorithm
+    /// the operand tokens and the object combinations of the conditions, only needed for the
+    /// object maps, are only collected if storeObjectMapInfo is true
     void evaluateAlgorithm(const int chipNumber, const std::vector<
-            ConditionEvaluationMap>&);
+            ConditionEvaluationMap>&, const bool storeObjectMapInfo = true);
 
     /// get all the object combinations evaluated to true in the conditions
     /// from the algorithm 
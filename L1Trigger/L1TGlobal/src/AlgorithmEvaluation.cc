@@ -55,7 +55,7 @@ l1t::AlgorithmEvaluation::AlgorithmEvaluation(const GlobalAlgorithm& alg) :
 
 /// evaluate an algorithm
 void l1t::AlgorithmEvaluation::evaluateAlgorithm(const int chipNumber,
-    const std::vector<ConditionEvaluationMap>& conditionResultMaps) {
+    const std::vector<ConditionEvaluationMap>& conditionResultMaps, const bool storeObjectMapInfo) {
 
     // set result to false if there is no expression 
     if (m_rpnVector.empty() ) {
@@ -72,8 +72,10 @@ void l1t::AlgorithmEvaluation::evaluateAlgorithm(const int chipNumber,
     // reserve memory
     int rpnVectorSize = m_rpnVector.size();
     
-    m_algoCombinationVector.reserve(rpnVectorSize);
-    m_operandTokenVector.reserve(rpnVectorSize);
+    if (storeObjectMapInfo) {
+        m_algoCombinationVector.reserve(rpnVectorSize);
+        m_operandTokenVector.reserve(rpnVectorSize);
+    }
 
     // stack containing temporary results
     std::stack<bool, std::vector<bool> > resultStack;
@@ -108,6 +110,10 @@ void l1t::AlgorithmEvaluation::evaluateAlgorithm(const int chipNumber,
 
                     resultStack.push(condResult);
 
+                    if (!storeObjectMapInfo) {
+                        break;
+                    }
+
                     // only conditions are added to /counted in m_operandTokenVector 
                     // opNumber is the index of the condition in the logical expression
                     OperandToken opToken;
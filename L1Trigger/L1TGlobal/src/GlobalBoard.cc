@@ -825,9 +825,14 @@ void l1t::GlobalBoard::runGTL(
     std::vector<GlobalObjectMap> objMapVec;
     if (produceL1GtObjectMapRecord && (iBxInEvent == 0)) objMapVec.reserve(numberPhysTriggers);
 
+    // the operand tokens and combinations of the algorithms are only copied for the object maps
+    // and for the debug printout
+    const bool storeObjectMapInfo = (produceL1GtObjectMapRecord && (iBxInEvent == 0))
+                                    || (m_verbosity && m_isDebugEnabled);
+
     for (CItAlgo itAlgo = algorithmMap.begin(); itAlgo != algorithmMap.end(); itAlgo++) {
         AlgorithmEvaluation gtAlg(itAlgo->second);
-        gtAlg.evaluateAlgorithm((itAlgo->second).algoChipNumber(), m_conditionResultMaps);
+        gtAlg.evaluateAlgorithm((itAlgo->second).algoChipNumber(), m_conditionResultMaps, storeObjectMapInfo);
 
         int algBitNumber = (itAlgo->second).algoBitNumber();
         bool algResult = gtAlg.gtAlgoResult();
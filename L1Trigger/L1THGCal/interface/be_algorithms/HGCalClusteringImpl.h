@@ -31,6 +31,8 @@ public:
                       const l1t::HGCalCluster & clu, 
                       double distXY) const;
 
+    unsigned layerKey( const l1t::HGCalTriggerCell & tc ) const;
+
     void clusterizeDR( const std::vector<edm::Ptr<l1t::HGCalTriggerCell>> & triggerCellsPtrs,
                        l1t::HGCalClusterBxCollection & clusters
         );
@@ -81,27 +81,25 @@ void HGCalTriggerDigiProducer::produce(edm::Event& e, const edm::EventSetup& es)
   const HGCalDigiCollection& bh_digis = *bh_digis_h;
 
   // First find modules containing hits and prepare list of hits for each module
+  // (the collection of a module is only created with its first hit)
   std::unordered_map<uint32_t, HGCalDigiCollection> hit_modules_ee;
   for(const auto& eedata : ee_digis) {
     uint32_t module = triggerGeometry_->getModuleFromCell(eedata.id());
     if(triggerGeometry_->disconnectedModule(module)) continue;
-    auto itr_insert = hit_modules_ee.emplace(module,HGCalDigiCollection());
-    itr_insert.first->second.push_back(eedata);
+    hit_modules_ee[module].push_back(eedata);
   }
   std::unordered_map<uint32_t,HGCalDigiCollection> hit_modules_fh;
   for(const auto& fhdata : fh_digis) {
     uint32_t module = triggerGeometry_->getModuleFromCell(fhdata.id());
     if(triggerGeometry_->disconnectedModule(module)) continue;
-    auto itr_insert = hit_modules_fh.emplace(module, HGCalDigiCollection());
-    itr_insert.first->second.push_back(fhdata);
+    hit_modules_fh[module].push_back(fhdata);
   }
   std::unordered_map<uint32_t,HGCalDigiCollection> hit_modules_bh;
   for(const auto& bhdata : bh_digis) {
     if(DetId(bhdata.id()).det()!=DetId::HGCalHSc && HcalDetId(bhdata.id()).subdetId()!=HcalEndcap) continue;
     uint32_t module = triggerGeometry_->getModuleFromCell(bhdata.id());
     if(triggerGeometry_->disconnectedModule(module)) continue;
-    auto itr_insert = hit_modules_bh.emplace(module, HGCalDigiCollection());
-    itr_insert.first->second.push_back(bhdata);
+    hit_modules_bh[module].push_back(bhdata);
   }
   // loop on modules containing hits and call front-end processing
   // we produce one output trigger digi per module in the FE
@@ -134,7 +132,7 @@ void HGCalTriggerDigiProducer::produce(edm::Event& e, const edm::EventSetup& es)
 
   // get the orphan handle and fe digi collection
   auto fe_digis_handle = e.put(std::move(fe_output));
-  auto fe_digis_coll = *fe_digis_handle;
+  const auto& fe_digis_coll = *fe_digis_handle;
   
   //now we run the emulation of the back-end processor
   backEndProcessor_->reset();
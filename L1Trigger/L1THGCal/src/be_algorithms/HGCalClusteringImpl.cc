@@ -26,6 +26,16 @@ HGCalClusteringImpl::HGCalClusteringImpl(const edm::ParameterSet & conf):
 
 
 /* dR-algorithms */
+/* layer, subdetector and side of a TC, as compared by isPertinent */
+unsigned HGCalClusteringImpl::layerKey( const l1t::HGCalTriggerCell & tc ) const
+{
+
+    HGCalDetId tcDetId( tc.detId() );
+    return ( (tcDetId.subdetId()*2 + (tcDetId.zside()>0 ? 1 : 0))<<8 ) | tcDetId.layer();
+
+}
+
+
 bool HGCalClusteringImpl::isPertinent( const l1t::HGCalTriggerCell & tc, 
                                        const l1t::HGCalCluster & clu, 
                                        double distXY ) const 
@@ -62,6 +72,9 @@ void HGCalClusteringImpl::clusterizeDR( const std::vector<edm::Ptr<l1t::HGCalTri
     /* clustering the TCs */
     std::vector<l1t::HGCalCluster> clustersTmp;
 
+    /* indices of the clusters of each layer, only those can be pertinent for a TC */
+    std::unordered_map<unsigned, std::vector<unsigned>> clustersInLayer;
+
     itc=0;
     for( std::vector<edm::Ptr<l1t::HGCalTriggerCell>>::const_iterator tc = triggerCellsPtrs.begin(); tc != triggerCellsPtrs.end(); ++tc,++itc ){
         double threshold = ((*tc)->subdetId()==HGCHEB ? scintillatorTriggerCellThreshold_ : siliconTriggerCellThreshold_);
@@ -78,7 +91,8 @@ void HGCalClusteringImpl::clusterizeDR( const std::vector<edm::Ptr<l1t::HGCalTri
         double minDist = dr_;
         int targetClu = -1;
 
-        for(unsigned iclu=0; iclu<clustersTmp.size(); iclu++){
+        std::vector<unsigned>& layerClusters = clustersInLayer[layerKey(**tc)];
+        for(unsigned iclu : layerClusters){
 
             if(!this->isPertinent(**tc, clustersTmp.at(iclu), dr_)) continue;
 
@@ -89,7 +103,10 @@ void HGCalClusteringImpl::clusterizeDR( const std::vector<edm::Ptr<l1t::HGCalTri
             }
         }
 
-        if(targetClu<0 && isSeed[itc]) clustersTmp.emplace_back( *tc );
+        if(targetClu<0 && isSeed[itc]){
+            layerClusters.push_back(clustersTmp.size());
+            clustersTmp.emplace_back( *tc );
+        }
         else if(targetClu>=0) clustersTmp.at( targetClu ).addConstituent( *tc );
 
     }
@@ -6,11 +6,17 @@
 #include <vector>
 
 
+// The binary LUT file is memory-mapped read-only and its packed words are decoded on lookup,
+// so that the streams (and the jobs on the same machine) share the pages of the file instead
+// of each holding a decoded copy of the whole table.
 class PtLUTReader {
 public:
   explicit PtLUTReader();
   ~PtLUTReader();
 
+  PtLUTReader(const PtLUTReader&) = delete;
+  PtLUTReader& operator=(const PtLUTReader&) = delete;
+
   typedef uint16_t               content_t;
   typedef uint64_t               address_t;
   typedef std::vector<content_t> table_t;
@@ -22,7 +28,13 @@ public:
   content_t get_version() const { return version_; }
 
 private:
-  mutable table_t ptlut_;
+  void unmap();
+
+  // 64-bit words of the file, each packing four 9-bit entries
+  const uint64_t* ptlut_words_;
+  size_t ptlut_size_;  // number of entries
+  size_t mapped_size_;  // bytes
+  std::string lut_full_path_;
   content_t version_;
   bool ok_;
 };
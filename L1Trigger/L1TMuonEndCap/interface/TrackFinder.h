@@ -46,6 +46,8 @@ private:
 
   bool fwConfig_, useCSC_, useRPC_, useCPPF_, useGEM_;
 
+  bool parallelSectors_;
+
   std::string era_;
 };
 
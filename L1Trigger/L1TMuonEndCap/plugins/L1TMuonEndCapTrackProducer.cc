@@ -66,10 +66,11 @@ void L1TMuonEndCapTrackProducer::produce(edm::Event& iEvent, const edm::EventSet
 
 // Fill 'descriptions' with the allowed parameters
 void L1TMuonEndCapTrackProducer::fillDescriptions(edm::ConfigurationDescriptions& descriptions) {
-  // The following says we do not know what parameters are allowed so do no validation
-  // Please change this to state exactly what you do use, even if it is no parameters
+  // Only the optional parameters are declared, the others are not validated yet
   edm::ParameterSetDescription desc;
-  desc.setUnknown();
+  // process the 12 sector processors concurrently; the output is the same as in the serial mode
+  desc.add<bool>("ParallelSectors", false);
+  desc.setAllowAnything();
   descriptions.addDefault(desc);
 }
 
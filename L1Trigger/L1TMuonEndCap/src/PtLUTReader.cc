@@ -1,13 +1,21 @@
 #include "L1Trigger/L1TMuonEndCap/interface/PtLUTReader.h"
 
-#include <fstream>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <cstdio>
 #include <iostream>
 #include <stdexcept>
 
 #define PTLUT_SIZE (1<<30)
 
 PtLUTReader::PtLUTReader() :
-    ptlut_(),
+    ptlut_words_(nullptr),
+    ptlut_size_(0),
+    mapped_size_(0),
+    lut_full_path_(),
     version_(4),
     ok_(false)
 {
@@ -15,55 +23,80 @@ PtLUTReader::PtLUTReader() :
 }
 
 PtLUTReader::~PtLUTReader() {
+  unmap();
+}
 
+void PtLUTReader::unmap() {
+  if (ptlut_words_ != nullptr) {
+    ::munmap(const_cast<uint64_t*>(ptlut_words_), mapped_size_);
+  }
+  ptlut_words_ = nullptr;
+  ptlut_size_ = 0;
+  mapped_size_ = 0;
+  ok_ = false;
 }
 
 void PtLUTReader::read(const std::string& lut_full_path) {
-  if (ok_)  return;
+  if (ok_ && lut_full_path == lut_full_path_)  return;
+
+  // release the table of a previous call before mapping the new one
+  unmap();
 
   std::cout << "EMTF emulator: attempting to read pT LUT binary file from local area" << std::endl;
   std::cout << lut_full_path << std::endl;
   std::cout << "Non-standard operation; if it fails, now you know why" << std::endl;
   std::cout << "Be sure to check that the 'scale_pt' function still matches this LUT" << std::endl;
-  std::cout << "Loading LUT, this might take a while..." << std::endl;
+  std::cout << "Mapping LUT..." << std::endl;
 
-  std::ifstream infile(lut_full_path, std::ios::binary);
-  if (!infile.good()) {
+  const int fd = ::open(lut_full_path.c_str(), O_RDONLY);
+  struct stat info;
+  if (fd < 0 || ::fstat(fd, &info) != 0) {
+    if (fd >= 0)  ::close(fd);
     char what[256];
     snprintf(what, sizeof(what), "Fail to open %s", lut_full_path.c_str());
     throw std::invalid_argument(what);
   }
 
-  ptlut_.reserve(PTLUT_SIZE);
-
+  // Only the full 64-bit words hold entries
   typedef uint64_t full_word_t;
-  full_word_t full_word;
-  full_word_t sub_word[4] = {0, 0, 0, 0};
-
-  while (infile.read(reinterpret_cast<char*>(&full_word), sizeof(full_word_t))) {
-    sub_word[0] = (full_word>>0)      & 0x1FF;  // 9-bit
-    sub_word[1] = (full_word>>9)      & 0x1FF;
-    sub_word[2] = (full_word>>32)     & 0x1FF;
-    sub_word[3] = (full_word>>(32+9)) & 0x1FF;
-
-    ptlut_.push_back(sub_word[0]);
-    ptlut_.push_back(sub_word[1]);
-    ptlut_.push_back(sub_word[2]);
-    ptlut_.push_back(sub_word[3]);
+  const size_t nwords = info.st_size / sizeof(full_word_t);
+  if (nwords * 4 != PTLUT_SIZE) {
+    ::close(fd);
+    char what[256];
+    snprintf(what, sizeof(what), "ptlut_.size() is %lu != %i", nwords * 4, PTLUT_SIZE);
+    throw std::invalid_argument(what);
   }
-  infile.close();
 
-  if (ptlut_.size() != PTLUT_SIZE) {
+  void* data = ::mmap(nullptr, nwords * sizeof(full_word_t), PROT_READ, MAP_SHARED, fd, 0);
+  // the mapping stays valid after the descriptor is closed
+  ::close(fd);
+  if (data == MAP_FAILED) {
     char what[256];
-    snprintf(what, sizeof(what), "ptlut_.size() is %lu != %i", ptlut_.size(), PTLUT_SIZE);
+    snprintf(what, sizeof(what), "Fail to map %s", lut_full_path.c_str());
     throw std::invalid_argument(what);
   }
+  // the lookups are scattered over the whole table
+  ::madvise(data, nwords * sizeof(full_word_t), MADV_RANDOM);
+
+  ptlut_words_ = static_cast<const full_word_t*>(data);
+  mapped_size_ = nwords * sizeof(full_word_t);
+  ptlut_size_ = PTLUT_SIZE;
+  lut_full_path_ = lut_full_path;
 
-  version_ = ptlut_.at(0);  // address 0 is the pT LUT version number
+  version_ = lookup(0);  // address 0 is the pT LUT version number
   ok_ = true;
   return;
 }
 
 PtLUTReader::content_t PtLUTReader::lookup(const address_t& address) const {
-  return ptlut_.at(address);
+  if (address >= ptlut_size_) {
+    char what[256];
+    snprintf(what, sizeof(what), "pT LUT address %lu out of range %lu", (unsigned long) address, (unsigned long) ptlut_size_);
+    throw std::out_of_range(what);
+  }
+
+  // Each word packs the entries 4*i .. 4*i+3 as 9-bit values at bits 0, 9, 32 and 32+9
+  static const int shifts[4] = {0, 9, 32, 32+9};
+  const uint64_t full_word = ptlut_words_[address >> 2];
+  return (full_word >> shifts[address & 0x3]) & 0x1FF;
 }
@@ -3,6 +3,9 @@
 #include <iostream>
 #include <sstream>
 
+#include "tbb/task_arena.h"
+#include "tbb/tbb.h"
+
 #include "L1Trigger/L1TMuonEndCap/interface/EMTFSubsystemCollector.h"
 
 
@@ -24,6 +27,7 @@ TrackFinder::TrackFinder(const edm::ParameterSet& iConfig, edm::ConsumesCollecto
     useRPC_(iConfig.getParameter<bool>("RPCEnable")),
     useCPPF_(iConfig.getParameter<bool>("CPPFEnable")),
     useGEM_(iConfig.getParameter<bool>("GEMEnable")),
+    parallelSectors_(iConfig.getParameter<bool>("ParallelSectors")),
     era_(iConfig.getParameter<std::string>("Era"))
 {
 
@@ -158,23 +162,51 @@ void TrackFinder::process(
   // Reload pT LUT if necessary
   pt_assign_engine_->load(condition_helper_.get_pt_lut_version(), &(condition_helper_.getForest()));
 
-  // MIN/MAX ENDCAP and TRIGSECTOR set in interface/Common.h
-  for (int endcap = emtf::MIN_ENDCAP; endcap <= emtf::MAX_ENDCAP; ++endcap) {
-    for (int sector = emtf::MIN_TRIGSECTOR; sector <= emtf::MAX_TRIGSECTOR; ++sector) {
-      const int es = (endcap - emtf::MIN_ENDCAP) * (emtf::MAX_TRIGSECTOR - emtf::MIN_TRIGSECTOR + 1) + (sector - emtf::MIN_TRIGSECTOR);
+  // Run-dependent configure. This overwrites many of the configurables passed by the python config file.
+  if (iEvent.isRealData() && fwConfig_) {
+    for (auto& sector_processor : sector_processors_) {
+      sector_processor.configure_by_fw_version(condition_helper_.get_fw_version());
+    }
+  }
 
-      // Run-dependent configure. This overwrites many of the configurables passed by the python config file.
-      if (iEvent.isRealData() && fwConfig_) {
-        sector_processors_.at(es).configure_by_fw_version(condition_helper_.get_fw_version());
-      }
+  // The sectors are independent and only share read-only geometry, LUTs and forests, so they
+  // can be processed concurrently into their own collections. These are appended in the sector
+  // order, so the output is the same as in the sequential mode, which is kept for the debug
+  // printouts.
+  if (parallelSectors_ && verbose_ <= 0) {
+    emtf::sector_array<EMTFHitCollection> sector_hits;
+    emtf::sector_array<EMTFTrackCollection> sector_tracks;
+
+    tbb::this_task_arena::isolate([&] {
+      tbb::parallel_for(0, (int) sector_processors_.size(), [&](int es) {
+        sector_processors_[es].process(
+            iEvent.id().event(),
+            muon_primitives,
+            sector_hits[es],
+            sector_tracks[es]
+        );
+      });
+    });
+
+    for (unsigned es = 0; es < sector_processors_.size(); ++es) {
+      out_hits.insert(out_hits.end(), sector_hits[es].begin(), sector_hits[es].end());
+      out_tracks.insert(out_tracks.end(), sector_tracks[es].begin(), sector_tracks[es].end());
+    }
 
-      // Process
-      sector_processors_.at(es).process(
-          iEvent.id().event(),
-          muon_primitives,
-          out_hits,
-          out_tracks
-      );
+  } else {
+    // MIN/MAX ENDCAP and TRIGSECTOR set in interface/Common.h
+    for (int endcap = emtf::MIN_ENDCAP; endcap <= emtf::MAX_ENDCAP; ++endcap) {
+      for (int sector = emtf::MIN_TRIGSECTOR; sector <= emtf::MAX_TRIGSECTOR; ++sector) {
+        const int es = (endcap - emtf::MIN_ENDCAP) * (emtf::MAX_TRIGSECTOR - emtf::MIN_TRIGSECTOR + 1) + (sector - emtf::MIN_TRIGSECTOR);
+
+        // Process
+        sector_processors_.at(es).process(
+            iEvent.id().event(),
+            muon_primitives,
+            out_hits,
+            out_tracks
+        );
+      }
     }
   }
 
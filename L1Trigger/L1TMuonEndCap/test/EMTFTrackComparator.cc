@@ -0,0 +1,72 @@
+// compare two EMTF emulator outputs, e.g. produced with and without ParallelSectors,
+// and throw if the hits or the tracks differ
+
+#include "FWCore/Framework/interface/global/EDAnalyzer.h"
+#include "FWCore/Framework/interface/Event.h"
+#include "FWCore/ParameterSet/interface/ParameterSet.h"
+#include "FWCore/ParameterSet/interface/ConfigurationDescriptions.h"
+#include "FWCore/ParameterSet/interface/ParameterSetDescription.h"
+#include "FWCore/Utilities/interface/Exception.h"
+#include "DataFormats/Common/interface/Handle.h"
+#include "DataFormats/L1TMuon/interface/EMTFHit.h"
+#include "DataFormats/L1TMuon/interface/EMTFTrack.h"
+
+class EMTFTrackComparator : public edm::global::EDAnalyzer<> {
+public:
+  explicit EMTFTrackComparator(const edm::ParameterSet& conf):
+    referenceHitsToken_(consumes<l1t::EMTFHitCollection>(conf.getParameter<edm::InputTag>("reference"))),
+    testHitsToken_(consumes<l1t::EMTFHitCollection>(conf.getParameter<edm::InputTag>("test"))),
+    referenceTracksToken_(consumes<l1t::EMTFTrackCollection>(conf.getParameter<edm::InputTag>("reference"))),
+    testTracksToken_(consumes<l1t::EMTFTrackCollection>(conf.getParameter<edm::InputTag>("test"))) {}
+
+  static void fillDescriptions(edm::ConfigurationDescriptions& descriptions) {
+    edm::ParameterSetDescription desc;
+    desc.add<edm::InputTag>("reference");
+    desc.add<edm::InputTag>("test");
+    descriptions.add("emtfTrackComparator", desc);
+  }
+
+  void analyze(edm::StreamID, const edm::Event& e, const edm::EventSetup&) const override {
+    edm::Handle<l1t::EMTFHitCollection> referenceHits;
+    e.getByToken(referenceHitsToken_, referenceHits);
+    edm::Handle<l1t::EMTFHitCollection> testHits;
+    e.getByToken(testHitsToken_, testHits);
+
+    if (referenceHits->size() != testHits->size())
+      throw cms::Exception("EMTFMismatch") << "event " << e.id() << ": " << referenceHits->size()
+                                           << " reference hits, " << testHits->size() << " test hits";
+    for (size_t i = 0; i < referenceHits->size(); ++i) {
+      auto const& ref = (*referenceHits)[i];
+      auto const& tst = (*testHits)[i];
+      if (ref.Sector_idx() != tst.Sector_idx() || ref.BX() != tst.BX() || ref.Strip() != tst.Strip() ||
+          ref.Phi_fp() != tst.Phi_fp() || ref.Theta_fp() != tst.Theta_fp())
+        throw cms::Exception("EMTFMismatch") << "event " << e.id() << ", hit " << i << ": different hits";
+    }
+
+    edm::Handle<l1t::EMTFTrackCollection> referenceTracks;
+    e.getByToken(referenceTracksToken_, referenceTracks);
+    edm::Handle<l1t::EMTFTrackCollection> testTracks;
+    e.getByToken(testTracksToken_, testTracks);
+
+    if (referenceTracks->size() != testTracks->size())
+      throw cms::Exception("EMTFMismatch") << "event " << e.id() << ": " << referenceTracks->size()
+                                           << " reference tracks, " << testTracks->size() << " test tracks";
+    for (size_t i = 0; i < referenceTracks->size(); ++i) {
+      auto const& ref = (*referenceTracks)[i];
+      auto const& tst = (*testTracks)[i];
+      if (ref.Sector_idx() != tst.Sector_idx() || ref.BX() != tst.BX() || ref.Mode() != tst.Mode() ||
+          ref.Phi_fp() != tst.Phi_fp() || ref.Theta_fp() != tst.Theta_fp() || ref.Pt() != tst.Pt() ||
+          ref.GMT_pt() != tst.GMT_pt() || ref.GMT_quality() != tst.GMT_quality())
+        throw cms::Exception("EMTFMismatch") << "event " << e.id() << ", track " << i << ": different tracks";
+    }
+  }
+
+private:
+  const edm::EDGetTokenT<l1t::EMTFHitCollection> referenceHitsToken_;
+  const edm::EDGetTokenT<l1t::EMTFHitCollection> testHitsToken_;
+  const edm::EDGetTokenT<l1t::EMTFTrackCollection> referenceTracksToken_;
+  const edm::EDGetTokenT<l1t::EMTFTrackCollection> testTracksToken_;
+};
+
+#include "FWCore/Framework/interface/MakerMacros.h"
+DEFINE_FWK_MODULE(EMTFTrackComparator);
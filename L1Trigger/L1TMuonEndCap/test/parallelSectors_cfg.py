@@ -0,0 +1,47 @@
+# run the EMTF emulator with the serial and the parallel sector loop
+# and check that the hits and the tracks are identical; the input is
+# generated by runtests.sh, which registers this as a unit test
+import FWCore.ParameterSet.Config as cms
+
+process = cms.Process("PARALLELSECTORS")
+
+from FWCore.ParameterSet.VarParsing import VarParsing
+options = VarParsing('analysis')
+options.parseArguments()
+
+if not options.inputFiles:
+    options.inputFiles = ['file:parallelSectors_step1.root']
+
+process.load("FWCore.MessageService.MessageLogger_cfi")
+
+process.maxEvents = cms.untracked.PSet(
+    input = cms.untracked.int32(options.maxEvents)
+)
+
+process.source = cms.Source("PoolSource",
+    fileNames = cms.untracked.vstring(options.inputFiles),
+)
+
+process.load('Configuration.StandardSequences.GeometryRecoDB_cff')
+process.load('Configuration.StandardSequences.MagneticField_cff')
+process.load('Configuration.StandardSequences.FrontierConditions_GlobalTag_cff')
+from Configuration.AlCa.GlobalTag import GlobalTag
+process.GlobalTag = GlobalTag(process.GlobalTag, 'auto:run2_mc', '')
+
+process.load("L1Trigger.L1TMuonEndCap.simEmtfDigis_cfi")
+process.simEmtfDigis.ParallelSectors = False
+process.simEmtfDigisParallel = process.simEmtfDigis.clone(
+    ParallelSectors = True
+)
+
+process.compare = cms.EDAnalyzer("EMTFTrackComparator",
+    reference = cms.InputTag("simEmtfDigis"),
+    test = cms.InputTag("simEmtfDigisParallel")
+)
+
+process.p = cms.Path(process.simEmtfDigis * process.simEmtfDigisParallel * process.compare)
+
+process.options = cms.untracked.PSet(
+      numberOfThreads = cms.untracked.uint32(4),
+      wantSummary = cms.untracked.bool(True)
+)
@@ -0,0 +1,13 @@
+#!/bin/bash
+
+function die { echo $1: status $2 ;  exit $2; }
+
+pushd ${LOCAL_TMP_DIR}
+
+# generate a few single muon events in the endcaps up to the L1 trigger
+# primitives, then run the EMTF emulator with the serial and the parallel
+# sector loop and compare the hits and the tracks
+cmsDriver.py SingleMuPt10_pythia8_cfi --conditions auto:run2_mc --era Run2_2016 -n 20 -s GEN,SIM,DIGI,L1 --eventcontent FEVTDEBUG --datatier GEN-SIM-DIGI --fileout file:parallelSectors_step1.root --python_filename parallelSectors_step1_cfg.py || die 'Failure running cmsDriver' $?
+cmsRun ${LOCAL_TEST_DIR}/parallelSectors_cfg.py || die 'Failure using parallelSectors_cfg.py' $?
+
+popd
@@ -25,13 +25,16 @@
 #include "L1Trigger/TrackTrigger/interface/TTStubAlgorithmRecord.h"
 
 #include "DataFormats/GeometryCommonDetAlgo/interface/MeasurementPoint.h"
+#include "DataFormats/SiStripDetId/interface/StripSubdetector.h"
 #include "Geometry/CommonTopologies/interface/Topology.h"
 #include "Geometry/TrackerGeometryBuilder/interface/PixelGeomDetUnit.h"
 #include "Geometry/CommonTopologies/interface/PixelTopology.h"
 
+#include <cmath>
 #include <memory>
 #include <string>
 #include <map>
+#include <unordered_map>
 #include <typeinfo>
 
 template< typename T >
@@ -49,6 +52,22 @@ class TTStubAlgorithm_official : public TTStubAlgorithm< T >
     std::vector< std::vector< double > > tiltedCut;
     std::vector< double >                barrelNTilt;
 
+    /// Geometry and window of a stack module, which do not depend on the
+    /// clusters, filled once for all the stacks of the tracker
+    struct StackParameters
+    {
+      const PixelTopology* top0;
+      bool   isPS;
+      int    ratio;       /// columns of the inner sensor per column of the outer one
+      double pitchRatio;  /// inner over outer row pitch
+      double delta;
+      int    window;      /// In HALF-STRIP units, -1 if there is no cut for the module
+    };
+    std::unordered_map< uint32_t, StackParameters > stackParameters;
+
+    StackParameters findStackParameters( const DetId& stDetId ) const;
+    int findWindow( const DetId& stDetId ) const;
+
   public:
     /// Constructor
     TTStubAlgorithm_official( const TrackerGeometry* const theTrackerGeom, const TrackerTopology* const theTrackerTopo,
@@ -65,6 +84,15 @@ class TTStubAlgorithm_official : public TTStubAlgorithm< T >
       barrelNTilt = setBarrelNTilt;
       mPerformZMatchingPS = aPerformZMatchingPS;
       mPerformZMatching2S = aPerformZMatching2S;
+
+      for ( const auto& gd : theTrackerGeom->dets() )
+      {
+        DetId detid = gd->geographicalId();
+        if ( detid.subdetId()!=StripSubdetector::TOB && detid.subdetId()!=StripSubdetector::TID ) continue;
+        if ( !theTrackerTopo->isLower(detid) ) continue;
+        DetId stDetId = theTrackerTopo->stack(detid);
+        stackParameters.emplace( stDetId.rawId(), findStackParameters(stDetId) );
+      }
     }
 
     /// Destructor
@@ -102,6 +130,79 @@ template< >
 float TTStubAlgorithm_official< Ref_Phase2TrackerDigi_ >::degradeBend(bool psModule, int window, int bend) const;
 
 
+/// Stack geometry
+template< typename T >
+typename TTStubAlgorithm_official< T >::StackParameters
+TTStubAlgorithm_official< T >::findStackParameters( const DetId& stDetId ) const
+{
+  StackParameters parameters;
+  parameters.isPS = (this->theTrackerGeom_->getDetectorType(stDetId)==TrackerGeometry::ModuleType::Ph2PSP);
+
+  // TODO temporary: should use a method from the topology
+  const GeomDetUnit* det0 = this->theTrackerGeom_->idToDetUnit( stDetId+1 );
+  const GeomDetUnit* det1 = this->theTrackerGeom_->idToDetUnit( stDetId+2 );
+
+  /// Find pixel pitch and topology related information
+  const PixelGeomDetUnit* pix0 = dynamic_cast< const PixelGeomDetUnit* >( det0 );
+  const PixelGeomDetUnit* pix1 = dynamic_cast< const PixelGeomDetUnit* >( det1 );
+  const PixelTopology* top0 = dynamic_cast< const PixelTopology* >( &(pix0->specificTopology()) );
+  const PixelTopology* top1 = dynamic_cast< const PixelTopology* >( &(pix1->specificTopology()) );
+  parameters.top0 = top0;
+  parameters.pitchRatio = top0->pitch().first / top1->pitch().first;
+  parameters.ratio = top0->ncolumns()/top1->ncolumns(); /// This assumes the ratio is integer!
+
+  /// Get the Stack radius and z and displacements
+  double R0 = det0->position().perp();
+  double R1 = det1->position().perp();
+  double Z0 = det0->position().z();
+  double Z1 = det1->position().z();
+
+  double DR = R1-R0;
+  double DZ = Z1-Z0;
+
+  double alpha = atan2(DR,DZ);
+  parameters.delta = sqrt(DR*DR+DZ*DZ)/(R0*sin(alpha)+Z0*cos(alpha));
+
+  parameters.window = this->findWindow( stDetId );
+  return parameters;
+}
+
+/// Window of the layer, ladder or ring of the stack
+template< typename T >
+int TTStubAlgorithm_official< T >::findWindow( const DetId& stDetId ) const
+{
+  if (stDetId.subdetId()==StripSubdetector::TOB)
+  {
+    unsigned int layer = this->theTrackerTopo_->layer(stDetId);
+    int ladder = this->theTrackerTopo_->tobRod(stDetId);
+    int type   = 2*this->theTrackerTopo_->tobSide(stDetId)-3; // -1 for tilted-, 1 for tilted+, 3 for flat
+    double corr=0;
+
+    if (type<3) // Only for tilted modules
+    {
+      if ( layer >= barrelNTilt.size() || layer >= tiltedCut.size() ) return -1;
+      corr   = (barrelNTilt[layer]+1)/2.;
+      ladder = corr-(corr-ladder)*type; // Corrected ring number, bet 0 and barrelNTilt.at(layer), in ascending |z|
+      if ( ladder < 0 || (unsigned int)ladder >= tiltedCut[layer].size() ) return -1;
+      return 2*tiltedCut[layer][ladder];
+    }
+    else // Classis barrel window otherwise
+    {
+      if ( layer >= barrelCut.size() ) return -1;
+      return 2*barrelCut[layer];
+    }
+  }
+  else if (stDetId.subdetId()==StripSubdetector::TID)
+  {
+    unsigned int wheel = this->theTrackerTopo_->tidWheel(stDetId);
+    unsigned int ring  = this->theTrackerTopo_->tidRing(stDetId);
+    if ( wheel >= ringCut.size() || ring >= ringCut[wheel].size() ) return -1;
+    return 2*ringCut[wheel][ring];
+  }
+  return 0;
+}
+
+
 /*! \class   ES_TTStubAlgorithm_official
  *  \brief   Class to declare the algorithm to the framework
  *
@@ -11,8 +11,8 @@
 #include "MagneticField/Layers/src/MagBinFinders.h"
 #include "DetectorDescription/Core/interface/DDCompactView.h"
 
+#include <cstddef>
 #include <vector>
-#include <atomic>
 
 class MagBLayer;
 class MagESector;
@@ -42,6 +42,10 @@ public:
   /// Return field vector at the specified global point
   GlobalVector fieldInTesla(const GlobalPoint & gp) const;
 
+  /// Fill field[i] with the field vector at gp[i], for n points.
+  /// The volume of the previous point is tried first, which is cheap for points along a trajectory.
+  void fieldInTesla(const GlobalPoint * gp, GlobalVector * field, std::size_t n) const;
+
   /// Find a volume
   MagVolume const * findVolume(const GlobalPoint & gp, double tolerance=0.) const;
 
@@ -62,7 +66,11 @@ private:
 
   bool inBarrel(const GlobalPoint& gp) const;
 
-  mutable std::atomic<MagVolume const*> lastVolume; // Cache last volume found
+  GlobalVector fieldNotFound(const GlobalPoint& gp) const;
+
+  // The last volume found is cached per thread (see MagGeometry.cc); the id tells
+  // which geometry the cached volume belongs to.
+  unsigned long long const theId;
 
   std::vector<MagBLayer const*> theBLayers;
   std::vector<MagESector const*> theESectors;
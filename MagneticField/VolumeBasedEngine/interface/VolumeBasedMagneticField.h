@@ -42,6 +42,9 @@ class VolumeBasedMagneticField : public MagneticField {
 
   GlobalVector inTeslaUnchecked ( const GlobalPoint& g) const override;
 
+  /// Fill fields[i] with inTesla(points[i]) for n points, e.g. for all the steps of a propagation
+  void inTesla ( const GlobalPoint* points, GlobalVector* fields, std::size_t n) const;
+
   const MagVolume * findVolume(const GlobalPoint & gp) const;
 
   bool isDefined(const GlobalPoint& gp) const override;
@@ -17,9 +17,24 @@
 #include "MagneticField/Layers/interface/MagVerbosity.h"
 #include "FWCore/MessageLogger/interface/MessageLogger.h"
 
+#include <atomic>
+
 using namespace std;
 using namespace edm;
 
+namespace {
+  std::atomic<unsigned long long> s_nextGeometryId{0};
+
+  // A single cache shared by all threads keeps being overwritten when threads propagate
+  // tracks in different regions, and the cache line bounces between cores. Each thread
+  // therefore remembers the last volume it found itself.
+  struct LastVolumeCache {
+    unsigned long long geometryId = 0;
+    MagVolume const* volume = nullptr;
+  };
+  thread_local LastVolumeCache t_lastVolume;
+}
+
 MagGeometry::MagGeometry(int geomVersion, const std::vector<MagBLayer *>& tbl,
 			 const std::vector<MagESector *>& tes,
 			 const std::vector<MagVolume6Faces*>& tbv,
@@ -31,7 +46,7 @@ MagGeometry::MagGeometry(int geomVersion, const std::vector<MagBLayer const*>& t
 			 const std::vector<MagESector const*>& tes,
 			 const std::vector<MagVolume6Faces const*>& tbv,
 			 const std::vector<MagVolume6Faces const*>& tev) : 
-  lastVolume(nullptr), theBLayers(tbl), theESectors(tes), theBVolumes(tbv), theEVolumes(tev), cacheLastVolume(true), geometryVersion(geomVersion)
+  theId(++s_nextGeometryId), theBLayers(tbl), theESectors(tes), theBVolumes(tbv), theEVolumes(tev), cacheLastVolume(true), geometryVersion(geomVersion)
 {
   vector<double> rBorders;
 
@@ -84,8 +99,21 @@ GlobalVector MagGeometry::fieldInTesla(const GlobalPoint & gp) const {
     return v->fieldInTesla(gp);
   }
   
-  // Fall-back case: no volume found
-  
+  return fieldNotFound(gp);
+}
+
+void MagGeometry::fieldInTesla(const GlobalPoint * gp, GlobalVector * field, std::size_t n) const {
+  MagVolume const * v = nullptr;
+  for (std::size_t i = 0; i < n; ++i) {
+    if (v==nullptr || !v->inside(gp[i])) {
+      v = findVolume(gp[i]);
+    }
+    field[i] = (v!=nullptr ? v->fieldInTesla(gp[i]) : fieldNotFound(gp[i]));
+  }
+}
+
+// Fall-back case: no volume found
+GlobalVector MagGeometry::fieldNotFound(const GlobalPoint & gp) const {
   if (edm::isNotFinite(gp.mag())) {
     LogWarning("InvalidInput") << "Input value invalid (not a number): " << gp << endl;
       
@@ -136,9 +164,9 @@ MagGeometry::findVolume1(const GlobalPoint & gp, double tolerance) const {
 MagVolume const* 
 MagGeometry::findVolume(const GlobalPoint & gp, double tolerance) const{
   // Check volume cache
-  auto lastVolumeCheck = lastVolume.load(std::memory_order_acquire);
-  if (lastVolumeCheck!=nullptr && lastVolumeCheck->inside(gp)){
-    return lastVolumeCheck;
+  LastVolumeCache& cache = t_lastVolume;
+  if (cache.geometryId==theId && cache.volume!=nullptr && cache.volume->inside(gp)){
+    return cache.volume;
   }
 
   MagVolume const* result=nullptr;
@@ -175,7 +203,10 @@ MagGeometry::findVolume(const GlobalPoint & gp, double tolerance) const{
     result = findVolume(gp, 0.03);
   }
 
-  if (cacheLastVolume) lastVolume.store(result,std::memory_order_release);
+  if (cacheLastVolume) {
+    cache.geometryId = theId;
+    cache.volume = result;
+  }
 
   return result;
 }
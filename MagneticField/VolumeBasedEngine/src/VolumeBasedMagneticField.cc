@@ -57,6 +57,19 @@ GlobalVector VolumeBasedMagneticField::inTeslaUnchecked(const GlobalPoint& gp) c
 }
 
 
+void VolumeBasedMagneticField::inTesla(const GlobalPoint* points, GlobalVector* fields, std::size_t n) const {
+  // Points handled by the map are evaluated in runs so that the volume search can reuse the previous volume.
+  std::size_t first = 0;
+  for (std::size_t i = 0; i <= n; ++i) {
+    bool inMap = (i < n) && !(paramField && paramField->isDefined(points[i])) && isDefined(points[i]);
+    if (inMap) continue;
+    field->fieldInTesla(points+first, fields+first, i-first);
+    if (i < n) fields[i] = inTesla(points[i]);
+    first = i+1;
+  }
+}
+
+
 const MagVolume * VolumeBasedMagneticField::findVolume(const GlobalPoint & gp) const
 {
   return field->findVolume(gp);
@@ -38,6 +38,8 @@ static const char * const kAlphabeticOrderOpt ="alphabetic-order";
 static const char * const kAlphabeticOrderCommandOpt ="alphabetic-order,A";
 static const char * const kFormatNamesOpt ="format-names";
 static const char * const kFormatNamesCommandOpt ="format-names,F";
+static const char * const kReadTimeOpt ="read-time";
+static const char * const kReadTimeCommandOpt ="read-time,r";
 
 int main( int argc, char * argv[] ) {
   using namespace boost::program_options;
@@ -57,6 +59,7 @@ int main( int argc, char * argv[] ) {
     ( kOutputCommandOpt, value<string>(), "output file" )
     ( kAlphabeticOrderCommandOpt, "sort by alphabetic order (default: sort by size)" )
     ( kFormatNamesCommandOpt, "format product name as \"product:label (type)\" (default: use full branch name)" )
+    ( kReadTimeCommandOpt, value<int>()->implicit_value(0), "measure the read time of each branch on the first <arg> events (default: all)" )
     ( kPlotCommandOpt, value<string>(), "produce a summary plot" )
     ( kPlotTopCommandOpt, value<int>(), "plot only the <arg> top size branches" )
     ( kSavePlotCommandOpt, value<string>(), "save plot into root file <arg>" )
@@ -106,6 +109,8 @@ int main( int argc, char * argv[] ) {
   
   try {
     me.parseFile(fileName,treeName);
+    if ( vm.count( kReadTimeOpt ) )
+      me.measureReadTime(treeName, vm[kReadTimeOpt].as<int>());
   } catch(perftools::EdmEventSize::Error const & error) {
     std::cerr <<  programName << ":" << error.descr << std::endl;
     return error.code;
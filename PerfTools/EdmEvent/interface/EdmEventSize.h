@@ -18,6 +18,8 @@ namespace perftools {
    *  all its baskets
    *  Estimate the "size in memory" multipling the actual branch size 
    *  by its compression factor
+   *  Optionally measure the time to read each branch, i.e. the time spent
+   *  fetching, decompressing and unstreaming its baskets
    *
    *  \author Vincenzo Innocente
    */
@@ -36,15 +38,17 @@ namespace perftools {
     struct BranchRecord {
       BranchRecord() : 
 	compr_size(0.),  
-	uncompr_size(0.) {}
+	uncompr_size(0.),
+	read_time(0.) {}
       BranchRecord(std::string const & iname,
 		   double compr,  double uncompr) : 
 	fullName(iname), name(iname), 
-	compr_size(compr), uncompr_size(uncompr){}
+	compr_size(compr), uncompr_size(uncompr), read_time(0.){}
       std::string fullName;
       std::string name;
       double compr_size;
       double uncompr_size;
+      double read_time;
     };
 
     typedef std::vector<BranchRecord> Branches;
@@ -57,6 +61,9 @@ namespace perftools {
     /// read file, compute branch size, sort by size
     void parseFile(std::string const & fileName, std::string const & treeName="Events");
 
+    /// measure the read time of each branch on the first "nEvents" events (all if 0)
+    void measureReadTime(std::string const & treeName="Events", int nEvents=0);
+
     /// sort by name
     void sortAlpha();
     
@@ -72,6 +79,7 @@ namespace perftools {
   private:
     std::string m_fileName;
     int m_nEvents;
+    int m_nTimedEvents;
     Branches m_branches;
 
   };
@@ -10,6 +10,8 @@
 #include <ostream>
 #include <limits>
 #include <cassert>
+#include <chrono>
+#include <memory>
 
 #include "Rtypes.h"
 #include "TROOT.h"
@@ -70,15 +72,16 @@ namespace {
 namespace perftools {
 
   EdmEventSize::EdmEventSize() : 
-    m_nEvents(0) {}
+    m_nEvents(0), m_nTimedEvents(0) {}
   
   EdmEventSize::EdmEventSize(std::string const & fileName, std::string const & treeName ) : 
-    m_nEvents(0) {
+    m_nEvents(0), m_nTimedEvents(0) {
     parseFile(fileName);
   }
   
   void EdmEventSize::parseFile(std::string const & fileName, std::string const & treeName) {
     m_fileName = fileName;
+    m_nTimedEvents = 0;
     m_branches.clear();
 
     TFile * file = TFile::Open( fileName.c_str() );
@@ -120,6 +123,34 @@ namespace perftools {
 
   }
   
+  void EdmEventSize::measureReadTime(std::string const & treeName, int nEvents) {
+    std::unique_ptr<TFile> file( TFile::Open( m_fileName.c_str() ) );
+    if( file==nullptr  || ( !(*file).IsOpen() ) )
+      throw Error( "unable to open data file " + m_fileName, 7002);
+
+    TTree * events = dynamic_cast<TTree*> ( file->Get(treeName.c_str()) );
+    if ( events == nullptr )
+      throw Error("object \"" + treeName + "\" is not a TTree in file: " + m_fileName, 7004);
+
+    Long64_t n = events->GetEntries();
+    if ( nEvents > 0 && nEvents < n ) n = nEvents;
+    m_nTimedEvents = n;
+    if ( n == 0 ) return;
+
+    // read one branch at a time without cache, so that each one pays for its own baskets
+    events->SetCacheSize(0);
+    for ( auto & br : m_branches ) {
+      TBranch * b = events->GetBranch( br.fullName.c_str() );
+      if ( b == nullptr ) continue;
+      auto start = std::chrono::steady_clock::now();
+      for ( Long64_t i = 0; i < n; ++i )
+	b->GetEntry(i);
+      std::chrono::duration<double, std::micro> elapsed = std::chrono::steady_clock::now() - start;
+      br.read_time = elapsed.count()/double(n);
+      b->DropBaskets("all");
+    }
+  }
+
   void EdmEventSize::sortAlpha() {
     std::sort(m_branches.begin(),m_branches.end(), 
 	      boost::bind(std::less<std::string>(),
@@ -157,8 +188,10 @@ namespace perftools {
 
   namespace detail {
 
-    void dump(std::ostream& co, EdmEventSize::BranchRecord const & br) {
-      co << br.name << " " <<  br.uncompr_size <<  " " << br.compr_size << "\n"; 
+    void dump(std::ostream& co, EdmEventSize::BranchRecord const & br, bool timed) {
+      co << br.name << " " <<  br.uncompr_size <<  " " << br.compr_size;
+      if (timed) co << " " << br.read_time;
+      co << "\n"; 
     }
   }
 
@@ -166,10 +199,13 @@ namespace perftools {
   void EdmEventSize::dump(std::ostream & co, bool header) const {
     if (header) {
       co << "File " << m_fileName << " Events " << m_nEvents << "\n";
-      co <<"Branch Name | Average Uncompressed Size (Bytes/Event) | Average Compressed Size (Bytes/Event) \n";
+      if (m_nTimedEvents > 0) co << "Read time measured on " << m_nTimedEvents << " Events\n";
+      co <<"Branch Name | Average Uncompressed Size (Bytes/Event) | Average Compressed Size (Bytes/Event) ";
+      if (m_nTimedEvents > 0) co << "| Average Read Time (us/Event) ";
+      co << "\n";
     }
     std::for_each(m_branches.begin(),m_branches.end(),
-		  boost::bind(detail::dump,boost::ref(co),_1));
+		  boost::bind(detail::dump,boost::ref(co),_1,m_nTimedEvents > 0));
   }
 
   namespace detail {
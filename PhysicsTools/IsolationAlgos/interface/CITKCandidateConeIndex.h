@@ -0,0 +1,104 @@
+#ifndef IsolationAlgos_CITKCandidateConeIndex_H
+#define IsolationAlgos_CITKCandidateConeIndex_H
+
+#include "DataFormats/Candidate/interface/Candidate.h"
+#include "DataFormats/Common/interface/View.h"
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+namespace citk {
+  // Grid of (eta, phi) tiles over the candidates used for isolation, built once per event,
+  // with the indices of the candidates of each tile stored contiguously, so that the isolation
+  // cones around the candidates to isolate only look at the tiles they overlap instead of at the
+  // whole collection.
+  // The tiles are at least as large as the largest cone, the candidates outside the eta range
+  // of the grid go to the border tiles. The eta, phi and pt of the candidates are also kept in
+  // flat arrays for the cone queries.
+  class CandidateConeIndex {
+  public:
+    static constexpr double minEta = -5.;
+    static constexpr double maxEta = 5.;
+
+    void fill(const edm::View<reco::Candidate>& candidates, double maxConeSize) {
+      const unsigned n = candidates.size();
+      _etaWidth = std::max(maxConeSize, 0.01);
+      _nEta = std::max(1, (int)std::ceil((maxEta - minEta)/_etaWidth));
+      _nPhi = std::max(1, (int)std::floor(2*M_PI/_etaWidth));
+      _phiWidth = 2*M_PI/_nPhi;
+
+      _eta.resize(n);
+      _phi.resize(n);
+      _pt.resize(n);
+      std::vector<unsigned> bins(n);
+      _offsets.assign(_nEta*_nPhi + 1, 0);
+      for( unsigned i = 0; i < n; ++i ) {
+	const reco::Candidate& cand = candidates[i];
+	_eta[i] = cand.eta();
+	_phi[i] = cand.phi();
+	_pt[i] = cand.pt();
+	bins[i] = etaBin(_eta[i])*_nPhi + phiBin(_phi[i]);
+	++_offsets[bins[i] + 1];
+      }
+      for( unsigned bin = 0; bin + 1 < _offsets.size(); ++bin ) _offsets[bin+1] += _offsets[bin];
+      _indices.resize(n);
+      std::vector<unsigned> next(_offsets.begin(), _offsets.end() - 1);
+      for( unsigned i = 0; i < n; ++i ) _indices[next[bins[i]]++] = i;
+    }
+
+    // indices, in increasing order, of the candidates in the tiles overlapping the window of
+    // half size coneSize around (eta, phi), a superset of the candidates in the cone
+    // coneSize must not be larger than the maxConeSize the index was filled with
+    void candidates(double eta, double phi, double coneSize, std::vector<unsigned>& out) const {
+      out.clear();
+      if( _indices.empty() ) return;
+      // margin for the float rounding of the positions and of the cone sizes
+      coneSize += 1.e-4;
+      const int etaLow = etaBin(eta - coneSize);
+      const int etaHigh = etaBin(eta + coneSize);
+      // one more tile on each side in phi for the rounding at +-pi
+      int phiLow = (int)std::floor((phi - coneSize + M_PI)/_phiWidth) - 1;
+      int phiHigh = (int)std::floor((phi + coneSize + M_PI)/_phiWidth) + 1;
+      if( phiHigh - phiLow + 1 >= _nPhi ) {
+	phiLow = 0;
+	phiHigh = _nPhi - 1;
+      }
+      for( int ieta = etaLow; ieta <= etaHigh; ++ieta ) {
+	for( int k = phiLow; k <= phiHigh; ++k ) {
+	  const unsigned bin = ieta*_nPhi + (k%_nPhi + _nPhi)%_nPhi;
+	  out.insert(out.end(), _indices.begin() + _offsets[bin], _indices.begin() + _offsets[bin+1]);
+	}
+      }
+      // same order, hence same sums, as a loop over the collection
+      std::sort(out.begin(), out.end());
+    }
+
+    const std::vector<float>& eta() const { return _eta; }
+    const std::vector<float>& phi() const { return _phi; }
+    const std::vector<float>& pt() const { return _pt; }
+
+  private:
+    int etaBin(double eta) const {
+      const int ieta = (int)std::floor((eta - minEta)/_etaWidth);
+      return std::min(std::max(ieta, 0), _nEta - 1);
+    }
+    int phiBin(double phi) const {
+      const int iphi = (int)std::floor((phi + M_PI)/_phiWidth);
+      return std::min(std::max(iphi, 0), _nPhi - 1);
+    }
+
+    int _nEta = 1;
+    int _nPhi = 1;
+    double _etaWidth = 1.;
+    double _phiWidth = 2*M_PI;
+
+    std::vector<unsigned> _offsets; // first candidate of each tile, tiles ordered by eta then phi
+    std::vector<unsigned> _indices;
+    std::vector<float> _eta;
+    std::vector<float> _phi;
+    std::vector<float> _pt;
+  };
+}// ns citk
+
+#endif
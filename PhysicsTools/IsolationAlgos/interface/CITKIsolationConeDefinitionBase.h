@@ -11,6 +11,7 @@
 
 #include "FWCore/Framework/interface/ConsumesCollector.h"
 
+#include <cmath>
 #include <unordered_map>
 
 namespace citk {
@@ -34,6 +35,9 @@ namespace citk {
 
     const std::string& name() const { return _name; }
 
+    // only the candidates within coneSize are in the isolation cone
+    float coneSize() const { return std::sqrt(_coneSize2); }
+
     const std::string& additionalCode() const { return _additionalCode; }
 
     //! Destructor
@@ -16,6 +16,7 @@
 #include "DataFormats/Candidate/interface/CandidateFwd.h"
 #include "DataFormats/Candidate/interface/Candidate.h"
 #include "PhysicsTools/IsolationAlgos/interface/CITKIsolationConeDefinitionBase.h"
+#include "PhysicsTools/IsolationAlgos/interface/CITKCandidateConeIndex.h"
 #include "DataFormats/Common/interface/OwnVector.h"
 
 #include "FWCore/Framework/interface/MakerMacros.h"
@@ -54,6 +55,10 @@ namespace citk {
     // indexed by pf candidate type
     std::array<IsoTypes,kNPFTypes> _isolation_types; 
     std::array<std::vector<std::string>,kNPFTypes> _product_names;
+    // largest isolation cone, and tiles of the candidates for the isolation cones
+    float _max_cone_size = 0.f;
+    CandidateConeIndex _cone_index;
+    std::vector<unsigned> _cone_candidates;
   };
 }
 
@@ -97,6 +102,7 @@ namespace citk {
 	  << "list of allowed isolations!.";
       }
       _isolation_types[thetype->second].emplace_back(theisolator);
+      _max_cone_size = std::max(_max_cone_size, theisolator->coneSize());
       const std::string dash("-");
       std::string pname = isotype+dash+coneName+dash+theisolator->additionalCode();
       _product_names[thetype->second].emplace_back(pname);
@@ -133,6 +139,7 @@ namespace citk {
       }
     }
     reco::PFCandidate helper; // to translate pdg id to type    
+    _cone_index.fill(*isolate_with, _max_cone_size);
     // loop over the candidates we are isolating and fill the values
     for( size_t c = 0; c < to_isolate->size(); ++c ) {
       auto cand_to_isolate = to_isolate->ptrAt(c);
@@ -143,7 +150,10 @@ namespace citk {
 	for( auto& value : cand_values[k] ) value = 0.0;
 	++k;
       }
-      for( size_t ic = 0; ic < isolate_with->size(); ++ic ) {
+      // only the candidates around the cones can be in them
+      _cone_index.candidates(cand_to_isolate->eta(), cand_to_isolate->phi(), _max_cone_size,
+			     _cone_candidates);
+      for( const unsigned ic : _cone_candidates ) {
         auto isocand = isolate_with->ptrAt(ic);
 	auto isotype = helper.translatePdgIdToType(isocand->pdgId());	
 	const auto& isolations = _isolation_types[isotype];	
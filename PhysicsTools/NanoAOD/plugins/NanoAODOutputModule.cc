@@ -65,6 +65,7 @@ private:
   bool m_writeProvenance;
   bool m_fakeName; //crab workaround, remove after crab is fixed
   int m_autoFlush;
+  bool m_concurrentBasketFlush;
   edm::ProcessHistoryRegistry m_processHistoryRegistry;
   edm::JobReport::Token m_jrToken;
   std::unique_ptr<TFile> m_file;
@@ -144,6 +145,7 @@ NanoAODOutputModule::NanoAODOutputModule(edm::ParameterSet const& pset):
   m_writeProvenance(pset.getUntrackedParameter<bool>("saveProvenance", true)),
   m_fakeName(pset.getUntrackedParameter<bool>("fakeNameForCrab", false)),
   m_autoFlush(pset.getUntrackedParameter<int>("autoFlush", -10000000)),
+  m_concurrentBasketFlush(pset.getUntrackedParameter<bool>("concurrentBasketFlush", true)),
   m_processHistoryRegistry()
 {
 }
@@ -297,6 +299,9 @@ NanoAODOutputModule::openFile(edm::FileBlock const&) {
   m_tree.reset(new TTree("Events","Events"));
   m_tree->SetAutoSave(0);
   m_tree->SetAutoFlush(0);
+  // with implicit MT, TTree::Fill fills and compresses the baskets of each column in its own task;
+  // this is already the default of a TTree, concurrentBasketFlush = False turns it off
+  m_tree->SetImplicitMT(m_concurrentBasketFlush);
   m_commonBranches.branch(*m_tree);
 
   m_lumiTree.reset(new TTree("LuminosityBlocks","LuminosityBlocks"));
@@ -356,6 +361,11 @@ NanoAODOutputModule::fillDescriptions(edm::ConfigurationDescriptions& descriptio
         ->setComment("Change the OutputModule name in the fwk job report to fake PoolOutputModule. This is needed to run on cran (and publish) till crab is fixed");
   desc.addUntracked<int>("autoFlush", -10000000)
         ->setComment("Autoflush parameter for ROOT file");
+  desc.addUntracked<bool>("concurrentBasketFlush", true)
+        ->setComment("True:  Let ROOT fill and compress the baskets of different branches of the Events tree concurrently using TBB tasks,\n"
+                     "       which is the default of a TTree.\n"
+                     "       Only has an effect if ROOT implicit multi-threading is enabled by the InitRootHandlers service.\n"
+                     "False: Fill and compress all branches serially on the thread running the output module.");
 
   //replace with whatever you want to get from the EDM by default
   const std::vector<std::string> keep = {"drop *", "keep nanoaodFlatTable_*Table_*_*", "keep edmTriggerResults_*_*_*", "keep nanoaodMergeableCounterTable_*Table_*_*", "keep nanoaodUniqueString_nanoMetadata_*_*"};
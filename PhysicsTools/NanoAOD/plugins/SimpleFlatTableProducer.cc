@@ -76,7 +76,7 @@ class SimpleFlatTableProducerBase : public edm::stream::EDProducer<> {
             public:
                 Variable(const std::string & aname, nanoaod::FlatTable::ColumnType atype, const edm::ParameterSet & cfg) : 
                     VariableBase(aname, atype, cfg) {}
-                virtual void fill(std::vector<const T *> selobjs, nanoaod::FlatTable & out) const = 0;
+                virtual void fill(const std::vector<const T *> & selobjs, nanoaod::FlatTable & out) const = 0;
         };
         template<typename StringFunctor, typename ValType>
             class FuncVariable : public Variable {
@@ -84,7 +84,7 @@ class SimpleFlatTableProducerBase : public edm::stream::EDProducer<> {
                     FuncVariable(const std::string & aname, nanoaod::FlatTable::ColumnType atype, const edm::ParameterSet & cfg) :
                         Variable(aname, atype, cfg), func_(cfg.getParameter<std::string>("expr"), true) {}
                     ~FuncVariable() override {}
-                    void fill(std::vector<const T *> selobjs, nanoaod::FlatTable & out) const override {
+                    void fill(const std::vector<const T *> & selobjs, nanoaod::FlatTable & out) const override {
                         std::vector<ValType> vals(selobjs.size());
                         for (unsigned int i = 0, n = vals.size(); i < n; ++i) {
                             vals[i] = func_(*selobjs[i]);
@@ -162,14 +162,14 @@ class SimpleFlatTableProducer : public SimpleFlatTableProducerBase<T, edm::View<
             public:
                 ExtVariable(const std::string & aname, nanoaod::FlatTable::ColumnType atype, const edm::ParameterSet & cfg) : 
                     base::VariableBase(aname, atype, cfg) {}
-                virtual void fill(const edm::Event & iEvent, std::vector<edm::Ptr<T>> selptrs, nanoaod::FlatTable & out) const = 0;
+                virtual void fill(const edm::Event & iEvent, const std::vector<edm::Ptr<T>> & selptrs, nanoaod::FlatTable & out) const = 0;
         };
         template<typename TIn, typename ValType=TIn>
         class ValueMapVariable : public ExtVariable {
             public:
                 ValueMapVariable(const std::string & aname, nanoaod::FlatTable::ColumnType atype, const edm::ParameterSet & cfg, edm::ConsumesCollector && cc) : 
                     ExtVariable(aname, atype, cfg), token_(cc.consumes<edm::ValueMap<TIn>>(cfg.getParameter<edm::InputTag>("src"))) {}
-                void fill(const edm::Event & iEvent, std::vector<edm::Ptr<T>> selptrs, nanoaod::FlatTable & out) const override {
+                void fill(const edm::Event & iEvent, const std::vector<edm::Ptr<T>> & selptrs, nanoaod::FlatTable & out) const override {
                     edm::Handle<edm::ValueMap<TIn>> vmap;
                     iEvent.getByToken(token_, vmap);
                     std::vector<ValType> vals(selptrs.size());   
@@ -93,6 +93,10 @@ namespace pat {
     std::vector<std::string> labelPostfixesToStrip_, labels_;
     Operation                   loader_;
 
+    // value maps of the current event, only fetched once for all the objects of the event
+    std::vector<edm::Handle<typename Operation::product_type> > userDataHandles_;
+    edm::Event::CacheIdentifier_t cacheIdentifier_ = 0;
+
   };
 
 }
@@ -141,21 +145,24 @@ pat::PATUserDataMerger<ObjectType, Operation>::add(ObjectType & patObject,
 						   const edm::EventSetup& iSetup)
 {
 
-  typename std::vector<edm::EDGetTokenT<typename Operation::product_type> >::const_iterator token_begin = userDataSrcTokens_.begin(), token_it = userDataSrcTokens_.begin(), token_end = userDataSrcTokens_.end();
+  if ( iEvent.cacheIdentifier() != cacheIdentifier_ ) {
+    userDataHandles_.resize( userDataSrcTokens_.size() );
+    for ( size_t i = 0; i < userDataSrcTokens_.size(); ++i ) {
+      // Get the objects by label
+      if ( labels_[i].empty() ) continue;
+      iEvent.getByToken( userDataSrcTokens_[i], userDataHandles_[i] );
+    }
+    cacheIdentifier_ = iEvent.cacheIdentifier();
+  }
 
-  for ( ; token_it != token_end; ++token_it ) {
-    const std::string & encoded = (labels_.at(token_it - token_begin));
+  edm::Ptr<reco::Candidate> recoObject = patObject.originalObjectRef();
+  for ( size_t i = 0; i < userDataSrcTokens_.size(); ++i ) {
+    const std::string & encoded = labels_[i];
+    if ( encoded.empty() ) continue;
 
-    // Declare the object handles:
     // ValueMap containing the values, or edm::Ptr's to the UserData that
     //   is associated to those PAT Objects
-    edm::Handle<typename Operation::product_type> userData;
-
-    // Get the objects by label
-    if ( encoded.empty() ) continue;
-    iEvent.getByToken( *token_it, userData );
-
-    edm::Ptr<reco::Candidate> recoObject = patObject.originalObjectRef();
+    const edm::Handle<typename Operation::product_type> & userData = userDataHandles_[i];
     loader_.addData( patObject, encoded, (*userData)[recoObject]);
 
   }
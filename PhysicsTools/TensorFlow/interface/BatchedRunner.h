@@ -0,0 +1,72 @@
+/*
+ * Runner that evaluates the inputs of several events, submitted by different streams, in a single
+ * batched session call.
+ * Based on TensorFlow C++ API 1.3.
+ */
+
+#ifndef PHYSICSTOOLS_TENSORFLOW_BATCHEDRUNNER_H
+#define PHYSICSTOOLS_TENSORFLOW_BATCHEDRUNNER_H
+
+#include "PhysicsTools/TensorFlow/interface/TensorFlow.h"
+
+#include "FWCore/Concurrency/interface/WaitingTaskWithArenaHolder.h"
+#include "FWCore/Framework/interface/EventBatcher.h"
+#include "FWCore/Utilities/interface/StreamID.h"
+
+#include <chrono>
+#include <map>
+#include <mutex>
+#include <vector>
+
+namespace tensorflow
+{
+
+// The streams are gathered with an edm::EventBatcher, so that the runner is meant to be shared by
+// the stream copies of an edm::ExternalWork module, e.g. via its GlobalCache, and used in acquire.
+// Once maxBatchEvents streams submitted their inputs, or when the first one waited for maxLatency,
+// the inputs are concatenated along their first dimension, the session is run once, and the
+// outputs are split back to the streams before their holders are done waiting. Errors are
+// forwarded to all the streams of the batch.
+// The session is not owned and must outlive the runner.
+class BatchedRunner
+{
+public:
+    // constantInputs are passed unchanged to each session call, e.g. learning phase flags
+    BatchedRunner(Session* session, const std::vector<std::string>& inputNames,
+        const std::vector<std::string>& outputNames, unsigned int maxBatchEvents,
+        std::chrono::microseconds maxLatency, const NamedTensorList& constantInputs = {});
+
+    BatchedRunner(const BatchedRunner&) = delete;
+    BatchedRunner& operator=(const BatchedRunner&) = delete;
+
+    // queues the inputs of the event of the stream, which must all have the same size of the first
+    // dimension, and fills the outputs with the corresponding rows once the batch is evaluated
+    // outputs must stay valid until the holder is done waiting
+    // inputs without rows are not queued, the holder is done immediately and outputs left empty
+    void submit(edm::StreamID streamID, std::vector<Tensor> inputs, std::vector<Tensor>* outputs,
+        edm::WaitingTaskWithArenaHolder holder);
+
+private:
+    struct Request
+    {
+        Request() : outputs(nullptr) {}
+
+        std::vector<Tensor> inputs;
+        std::vector<Tensor>* outputs;
+    };
+
+    void runBatch(const std::vector<edm::StreamID>& streamIDs);
+
+    Session* session_;
+    const std::vector<std::string> inputNames_;
+    const std::vector<std::string> outputNames_;
+    const NamedTensorList constantInputs_;
+
+    std::mutex mutex_; // protects the insertion of new streams in requests_
+    std::map<unsigned int, Request> requests_;
+    edm::EventBatcher batcher_;
+};
+
+} // namespace tensorflow
+
+#endif // PHYSICSTOOLS_TENSORFLOW_BATCHEDRUNNER_H
@@ -0,0 +1,152 @@
+/*
+ * Runner that evaluates the inputs of several events, submitted by different streams, in a single
+ * batched session call.
+ * Based on TensorFlow C++ API 1.3.
+ */
+
+#include "PhysicsTools/TensorFlow/interface/BatchedRunner.h"
+
+#include "tensorflow/core/framework/tensor_util.h"
+
+#include <exception>
+
+namespace tensorflow
+{
+
+BatchedRunner::BatchedRunner(Session* session, const std::vector<std::string>& inputNames,
+    const std::vector<std::string>& outputNames, unsigned int maxBatchEvents,
+    std::chrono::microseconds maxLatency, const NamedTensorList& constantInputs)
+    : session_(session)
+    , inputNames_(inputNames)
+    , outputNames_(outputNames)
+    , constantInputs_(constantInputs)
+    , batcher_(maxBatchEvents, maxLatency,
+          [this](const std::vector<edm::StreamID>& streamIDs) { runBatch(streamIDs); })
+{
+    if (session_ == nullptr)
+    {
+        throw cms::Exception("InvalidSession") << "cannot create a batched runner without session";
+    }
+    if (maxBatchEvents == 0)
+    {
+        throw cms::Exception("InvalidBatchSize") << "the maximum number of batched events must be positive";
+    }
+}
+
+void BatchedRunner::submit(edm::StreamID streamID, std::vector<Tensor> inputs,
+    std::vector<Tensor>* outputs, edm::WaitingTaskWithArenaHolder holder)
+{
+    if (inputs.size() != inputNames_.size())
+    {
+        throw cms::Exception("InvalidInput") << "numbers of input names and tensors not equal";
+    }
+    outputs->clear();
+
+    const int64 nRows = inputs.empty() ? 0 : inputs[0].dim_size(0);
+    for (const Tensor& input : inputs)
+    {
+        if (input.dims() == 0 || input.dim_size(0) != nRows)
+        {
+            throw cms::Exception("InvalidInput")
+                << "all the inputs must have the same size of the first dimension";
+        }
+    }
+
+    // nothing to evaluate
+    if (nRows == 0)
+    {
+        holder.doneWaiting(std::exception_ptr());
+        return;
+    }
+
+    // a stream has at most one event in flight, so only the insertion needs the lock
+    Request* request;
+    {
+        std::lock_guard<std::mutex> guard(mutex_);
+        request = &requests_[streamID.value()];
+    }
+    request->inputs = std::move(inputs);
+    request->outputs = outputs;
+
+    batcher_.add(streamID, std::move(holder));
+}
+
+void BatchedRunner::runBatch(const std::vector<edm::StreamID>& streamIDs)
+{
+    std::vector<Request*> batch;
+    batch.reserve(streamIDs.size());
+    {
+        std::lock_guard<std::mutex> guard(mutex_);
+        for (const edm::StreamID& streamID : streamIDs)
+        {
+            batch.push_back(&requests_[streamID.value()]);
+        }
+    }
+
+    // merge the inputs of the events
+    NamedTensorList inputs;
+    for (size_t i = 0; i < inputNames_.size(); i++)
+    {
+        if (batch.size() == 1)
+        {
+            inputs.push_back(NamedTensor(inputNames_[i], batch[0]->inputs[i]));
+            continue;
+        }
+
+        std::vector<Tensor> parts;
+        parts.reserve(batch.size());
+        for (const Request* request : batch)
+        {
+            parts.push_back(request->inputs[i]);
+        }
+        Tensor merged;
+        Status status = tensor::Concat(parts, &merged);
+        if (!status.ok())
+        {
+            throw cms::Exception("InvalidInput")
+                << "error while batching input '" << inputNames_[i] << "': " << status.ToString();
+        }
+        inputs.push_back(NamedTensor(inputNames_[i], merged));
+    }
+    inputs.insert(inputs.end(), constantInputs_.begin(), constantInputs_.end());
+
+    std::vector<Tensor> outputs;
+    run(session_, inputs, outputNames_, &outputs);
+
+    // split the outputs back to the events
+    if (batch.size() == 1)
+    {
+        *batch[0]->outputs = std::move(outputs);
+        batch[0]->inputs.clear();
+        return;
+    }
+
+    std::vector<int64> sizes;
+    sizes.reserve(batch.size());
+    for (const Request* request : batch)
+    {
+        sizes.push_back(request->inputs[0].dim_size(0));
+    }
+    for (size_t i = 0; i < outputs.size(); i++)
+    {
+        std::vector<Tensor> parts;
+        Status status = tensor::Split(outputs[i], sizes, &parts);
+        if (!status.ok())
+        {
+            throw cms::Exception("InvalidRun")
+                << "error while splitting output '" << outputNames_[i] << "': " << status.ToString();
+        }
+        for (size_t j = 0; j < batch.size(); j++)
+        {
+            batch[j]->outputs->push_back(std::move(parts[j]));
+        }
+    }
+
+    // release the input buffers until the next event of the streams
+    for (Request* request : batch)
+    {
+        request->inputs.clear();
+    }
+}
+
+} // namespace tensorflow
@@ -0,0 +1,100 @@
+/*
+ * Tests for the evaluation of models compiled ahead of time, using the test_graph_tfadd model
+ * compiled with tfcompile from test_graph_tfadd.pb and test_graph_tfadd.config.pbtxt.
+ */
+
+#include <cppunit/extensions/HelperMacros.h>
+
+#include "FWCore/PluginManager/interface/PluginManager.h"
+#include "FWCore/PluginManager/interface/standard.h"
+#include "FWCore/Utilities/interface/Exception.h"
+#include "PhysicsTools/TensorFlowAOT/interface/AOTModel.h"
+
+#include "PhysicsTools/TensorFlow/test/test_graph_tfadd/header.h"
+
+DEFINE_TF_AOT_MODEL(test_graph_tfadd);
+
+class testAOTModel : public CppUnit::TestFixture
+{
+    CPPUNIT_TEST_SUITE(testAOTModel);
+    CPPUNIT_TEST(checkAll);
+    CPPUNIT_TEST_SUITE_END();
+
+public:
+    void setUp();
+    void tearDown() {}
+    void checkAll();
+};
+
+CPPUNIT_TEST_SUITE_REGISTRATION(testAOTModel);
+
+namespace
+{
+tensorflow::Tensor makeInput(tensorflow::int32 value, tensorflow::int64 rows = 1)
+{
+    tensorflow::Tensor tensor(tensorflow::DT_INT32, { rows });
+    for (tensorflow::int64 i = 0; i < rows; i++)
+    {
+        tensor.vec<tensorflow::int32>()(i) = value;
+    }
+    return tensor;
+}
+}
+
+void testAOTModel::setUp()
+{
+    if (!edmplugin::PluginManager::isAvailable())
+    {
+        edmplugin::PluginManager::configure(edmplugin::standard::config());
+    }
+}
+
+void testAOTModel::checkAll()
+{
+    std::unique_ptr<tensorflow::AOTModel> model(tensorflow::createAOTModel("test_graph_tfadd"));
+    std::vector<tensorflow::Tensor> outputs;
+
+    // the example of tfadd_t.cpp through the AOTModel interface
+    tensorflow::run(model.get(), { { "x", makeInput(123) }, { "y", makeInput(456) } }, { "sum" },
+        &outputs);
+    CPPUNIT_ASSERT(outputs.size() == 1);
+    CPPUNIT_ASSERT(outputs[0].dims() == 1 && outputs[0].dim_size(0) == 1);
+    CPPUNIT_ASSERT(outputs[0].vec<tensorflow::int32>()(0) == 579);
+
+    // the name based overload, with the inputs in the other order
+    tensorflow::run(model.get(), { "y", "x" }, { makeInput(32), makeInput(10) }, { "sum" },
+        &outputs);
+    CPPUNIT_ASSERT(outputs.size() == 1);
+    CPPUNIT_ASSERT(outputs[0].vec<tensorflow::int32>()(0) == 42);
+
+    // unknown model, inputs and outputs
+    CPPUNIT_ASSERT_THROW(tensorflow::createAOTModel("not_a_model"), cms::Exception);
+    CPPUNIT_ASSERT_THROW(tensorflow::run(model.get(), { { "x", makeInput(1) }, { "z", makeInput(2) } },
+        { "sum" }, &outputs), cms::Exception);
+    CPPUNIT_ASSERT_THROW(tensorflow::run(model.get(), { { "x", makeInput(1) }, { "y", makeInput(2) } },
+        { "product" }, &outputs), cms::Exception);
+
+    // missing and repeated inputs
+    CPPUNIT_ASSERT_THROW(tensorflow::run(model.get(), { { "x", makeInput(1) } }, { "sum" }, &outputs),
+        cms::Exception);
+    CPPUNIT_ASSERT_THROW(tensorflow::run(model.get(), { { "x", makeInput(1) }, { "x", makeInput(2) } },
+        { "sum" }, &outputs), cms::Exception);
+
+    // more rows than the compiled batch size, and a wrong type
+    CPPUNIT_ASSERT_THROW(tensorflow::run(model.get(), { { "x", makeInput(1, 2) }, { "y", makeInput(2, 2) } },
+        { "sum" }, &outputs), cms::Exception);
+    tensorflow::Tensor floatInput(tensorflow::DT_FLOAT, { 1 });
+    floatInput.vec<float>()(0) = 1.f;
+    CPPUNIT_ASSERT_THROW(tensorflow::run(model.get(), { { "x", floatInput }, { "y", makeInput(2) } },
+        { "sum" }, &outputs), cms::Exception);
+
+    // inputs which disagree on the number of rows
+    CPPUNIT_ASSERT_THROW(tensorflow::run(model.get(), { { "x", makeInput(1, 0) }, { "y", makeInput(2) } },
+        { "sum" }, &outputs), cms::Exception);
+    CPPUNIT_ASSERT_THROW(tensorflow::run(model.get(), { { "x", makeInput(1) }, { "y", makeInput(2, 0) } },
+        { "sum" }, &outputs), cms::Exception);
+
+    // the model can be run again after the failures
+    tensorflow::run(model.get(), { { "x", makeInput(1) }, { "y", makeInput(2) } }, { "sum" }, &outputs);
+    CPPUNIT_ASSERT(outputs[0].vec<tensorflow::int32>()(0) == 3);
+}
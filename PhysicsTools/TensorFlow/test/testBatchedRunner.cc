@@ -0,0 +1,171 @@
+/*
+ * Tests for the evaluation of graphs via the batched runner.
+ * Based on TensorFlow C++ API 1.3.
+ */
+
+#include <boost/filesystem.hpp>
+#include <cppunit/extensions/HelperMacros.h>
+#include <atomic>
+#include <stdexcept>
+
+#include "tbb/task.h"
+
+#include "FWCore/Concurrency/interface/WaitingTask.h"
+#include "FWCore/Concurrency/interface/WaitingTaskWithArenaHolder.h"
+#include "PhysicsTools/TensorFlow/interface/BatchedRunner.h"
+
+std::string cmsswPath(std::string path)
+{
+    if (path.size() > 0 && path.substr(0, 1) != "/")
+    {
+        path = "/" + path;
+    }
+
+    std::string base = std::string(std::getenv("CMSSW_BASE"));
+    std::string releaseBase = std::string(std::getenv("CMSSW_RELEASE_BASE"));
+
+    return (boost::filesystem::exists(base.c_str()) ? base : releaseBase) + path;
+}
+
+namespace
+{
+std::shared_ptr<tbb::task> makeWaitTask()
+{
+    std::shared_ptr<tbb::task> waitTask{ new (tbb::task::allocate_root()) tbb::empty_task{},
+        [](tbb::task* iTask) { tbb::task::destroy(*iTask); } };
+    waitTask->set_ref_count(2);
+    return waitTask;
+}
+
+edm::WaitingTaskWithArenaHolder makeHolder(tbb::task* iWaitTask, std::atomic<unsigned int>& iNExceptions)
+{
+    return edm::WaitingTaskWithArenaHolder(edm::make_waiting_task(tbb::task::allocate_root(),
+        [iWaitTask, &iNExceptions](std::exception_ptr const* iPtr) {
+            if (iPtr)
+            {
+                ++iNExceptions;
+            }
+            iWaitTask->decrement_ref_count();
+        }));
+}
+}
+
+class testBatchedRunner : public CppUnit::TestFixture
+{
+    CPPUNIT_TEST_SUITE(testBatchedRunner);
+    CPPUNIT_TEST(checkAll);
+    CPPUNIT_TEST_SUITE_END();
+
+public:
+    std::string dataPath;
+
+    void setUp();
+    void tearDown();
+    void checkAll();
+
+};
+
+CPPUNIT_TEST_SUITE_REGISTRATION(testBatchedRunner);
+
+void testBatchedRunner::setUp()
+{
+    dataPath = cmsswPath("/test/" + std::string(getenv("SCRAM_ARCH"))
+        + "/" + boost::filesystem::unique_path().string());
+
+    // create the graph
+    std::string testPath = cmsswPath("/src/PhysicsTools/TensorFlow/test");
+    std::string cmd = "python " + testPath + "/createconstantgraph.py " + dataPath;
+    std::array<char, 128> buffer;
+    std::string result;
+    std::shared_ptr<FILE> pipe(popen(cmd.c_str(), "r"), pclose);
+    if (!pipe)
+    {
+        throw std::runtime_error("popen() failed!");
+    }
+    while (!feof(pipe.get()))
+    {
+        if (fgets(buffer.data(), 128, pipe.get()) != NULL)
+        {
+            result += buffer.data();
+        }
+    }
+    std::cout << std::endl
+              << result << std::endl;
+}
+
+void testBatchedRunner::tearDown()
+{
+    if (boost::filesystem::exists(dataPath))
+    {
+        boost::filesystem::remove_all(dataPath);
+    }
+}
+
+void testBatchedRunner::checkAll()
+{
+    std::string pbFile = dataPath + "/constantgraph.pb";
+
+    // load the graph and create the session
+    tensorflow::setLogging();
+    tensorflow::GraphDef* graphDef = tensorflow::loadGraphDef(pbFile);
+    CPPUNIT_ASSERT(graphDef != nullptr);
+    tensorflow::Session* session = tensorflow::createSession(graphDef);
+    CPPUNIT_ASSERT(session != nullptr);
+
+    // the scale is not batched
+    tensorflow::Tensor scale(tensorflow::DT_FLOAT, {});
+    scale.scalar<float>()() = 1.0;
+
+    tensorflow::Tensor input(tensorflow::DT_FLOAT, { 2, 10 });
+    for (size_t i = 0; i < 10; i++)
+    {
+        input.matrix<float>()(0, i) = float(i);
+        input.matrix<float>()(1, i) = 1.;
+    }
+
+    const edm::StreamID streamID = edm::StreamID::invalidStreamID();
+    std::atomic<unsigned int> nExceptions{ 0 };
+    {
+        // the partial batch is evaluated once the latency is over
+        tensorflow::BatchedRunner runner(session, { "input" }, { "output" }, 4,
+            std::chrono::milliseconds(1), { { "scale", scale } });
+
+        std::vector<tensorflow::Tensor> outputs;
+        auto waitTask = makeWaitTask();
+        runner.submit(streamID, { input }, &outputs, makeHolder(waitTask.get(), nExceptions));
+        waitTask->wait_for_all();
+        CPPUNIT_ASSERT(nExceptions == 0);
+        CPPUNIT_ASSERT(outputs.size() == 1);
+        CPPUNIT_ASSERT(outputs[0].dim_size(0) == 2);
+        CPPUNIT_ASSERT(outputs[0].matrix<float>()(0, 0) == 46.);
+        CPPUNIT_ASSERT(outputs[0].matrix<float>()(1, 0) == 11.);
+
+        // nothing is evaluated without rows
+        outputs.clear();
+        tensorflow::Tensor empty(tensorflow::DT_FLOAT, { 0, 10 });
+        waitTask = makeWaitTask();
+        runner.submit(streamID, { empty }, &outputs, makeHolder(waitTask.get(), nExceptions));
+        waitTask->wait_for_all();
+        CPPUNIT_ASSERT(nExceptions == 0);
+        CPPUNIT_ASSERT(outputs.empty());
+
+        // wrong number of inputs
+        CPPUNIT_ASSERT_THROW(runner.submit(streamID, {}, &outputs, edm::WaitingTaskWithArenaHolder()),
+            cms::Exception);
+    }
+    {
+        // a full batch is evaluated right away, the errors are passed to the holders
+        tensorflow::BatchedRunner runner(session, { "foo" }, { "output" }, 1,
+            std::chrono::seconds(100), { { "scale", scale } });
+
+        std::vector<tensorflow::Tensor> outputs;
+        auto waitTask = makeWaitTask();
+        runner.submit(streamID, { input }, &outputs, makeHolder(waitTask.get(), nExceptions));
+        waitTask->wait_for_all();
+        CPPUNIT_ASSERT(nExceptions == 1);
+    }
+
+    // cleanup
+    CPPUNIT_ASSERT(tensorflow::closeSession(session));
+    delete graphDef;
+}
@@ -0,0 +1,87 @@
+/*
+ * Models compiled ahead of time with tfcompile, evaluated without a TensorFlow session.
+ * Based on the XlaCompiledCpuFunction interface of the classes generated by tfcompile.
+ * Only the tensor types of TensorFlow are used, not its session or graph libraries.
+ */
+
+#ifndef PHYSICSTOOLS_TENSORFLOWAOT_AOTMODEL_H
+#define PHYSICSTOOLS_TENSORFLOWAOT_AOTMODEL_H
+
+#include "tensorflow/core/framework/tensor.h"
+
+#include "FWCore/PluginManager/interface/PluginFactory.h"
+
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace tensorflow
+{
+
+// same as in PhysicsTools/TensorFlow/interface/TensorFlow.h, so that both can be used together
+typedef std::pair<std::string, Tensor> NamedTensor;
+typedef std::vector<NamedTensor> NamedTensorList;
+
+// base class of the classes generated by tfcompile
+class XlaCompiledCpuFunction;
+
+typedef edmplugin::PluginFactory<XlaCompiledCpuFunction*()> AOTModelFactory;
+
+// A model compiled to a shared object, with the fixed shapes of the tf2xla config. The compiled
+// class must be generated with the name to index maps and the program shape, and registered with
+// DEFINE_TF_AOT_MODEL in a plugin, e.g.
+//     #include "MyPackage/MySubpackage/data/my_model/header.h"
+//     DEFINE_TF_AOT_MODEL(my_model);
+// An instance owns its buffers, so that it must not be run by several threads at once, like
+// sessions it is meant to be owned by the stream copies of a module.
+class AOTModel
+{
+public:
+    // creates the model registered under name, throws a cms exception when it is unknown
+    explicit AOTModel(const std::string& name);
+    ~AOTModel();
+
+    AOTModel(const AOTModel&) = delete;
+    AOTModel& operator=(const AOTModel&) = delete;
+
+    // run the model with inputs and outputNames, and store output tensors
+    // the inputs must have the compiled shapes, except for a first dimension smaller than the
+    // compiled batch size, in which case they are padded with zeros and the outputs of the same
+    // batch size only keep the rows of the inputs; the first dimension is the batch for all the
+    // inputs with at least one dimension, so they must all have the same number of rows and the
+    // same compiled batch size
+    // throws a cms exception when not successful
+    void run(const NamedTensorList& inputs, const std::vector<std::string>& outputNames,
+        std::vector<Tensor>* outputs);
+
+private:
+    std::string name_;
+    std::unique_ptr<XlaCompiledCpuFunction> function_;
+
+    std::vector<DataType> argTypes_;
+    std::vector<TensorShape> argShapes_;
+    std::vector<DataType> resultTypes_;
+    std::vector<TensorShape> resultShapes_;
+};
+
+// return a new model registered under name
+// transfers ownership
+AOTModel* createAOTModel(const std::string& name);
+
+// run the model with inputs and outputNames, and store output tensors
+// throws a cms exception when not successful
+void run(AOTModel* model, const NamedTensorList& inputs,
+    const std::vector<std::string>& outputNames, std::vector<Tensor>* outputs);
+
+// run the model with inputNames, inputTensors and outputNames, and store output tensors
+// throws a cms exception when not successful
+void run(AOTModel* model, const std::vector<std::string>& inputNames,
+    const std::vector<Tensor>& inputTensors, const std::vector<std::string>& outputNames,
+    std::vector<Tensor>* outputs);
+
+} // namespace tensorflow
+
+#define DEFINE_TF_AOT_MODEL(type) DEFINE_EDM_PLUGIN(tensorflow::AOTModelFactory, type, #type)
+
+#endif // PHYSICSTOOLS_TENSORFLOWAOT_AOTMODEL_H
@@ -0,0 +1,218 @@
+/*
+ * Models compiled ahead of time with tfcompile, evaluated without a TensorFlow session.
+ * Based on the XlaCompiledCpuFunction interface of the classes generated by tfcompile.
+ */
+
+#include "PhysicsTools/TensorFlowAOT/interface/AOTModel.h"
+
+#include "tensorflow/compiler/tf2xla/xla_compiled_cpu_function.h"
+#include "tensorflow/compiler/xla/xla_data.pb.h"
+
+#include "FWCore/Utilities/interface/Exception.h"
+
+#include <cstring>
+
+EDM_REGISTER_PLUGINFACTORY(tensorflow::AOTModelFactory, "TensorFlowAOTModelFactory");
+
+namespace tensorflow
+{
+
+namespace
+{
+
+DataType toDataType(const std::string& modelName, xla::PrimitiveType type)
+{
+    switch (type)
+    {
+        case xla::PRED:
+            return DT_BOOL;
+        case xla::S32:
+            return DT_INT32;
+        case xla::S64:
+            return DT_INT64;
+        case xla::F32:
+            return DT_FLOAT;
+        case xla::F64:
+            return DT_DOUBLE;
+        default:
+            throw cms::Exception("InvalidAOTModel") << "unsupported element type "
+                << xla::PrimitiveType_Name(type) << " in model '" << modelName << "'";
+    }
+}
+
+TensorShape toTensorShape(const xla::Shape& shape)
+{
+    TensorShape tensorShape;
+    for (int i = 0; i < shape.dimensions_size(); i++)
+    {
+        tensorShape.AddDim(shape.dimensions(i));
+    }
+    return tensorShape;
+}
+
+} // namespace
+
+AOTModel::AOTModel(const std::string& name)
+    : name_(name)
+    , function_(AOTModelFactory::get()->tryToCreate(name))
+{
+    if (!function_)
+    {
+        throw cms::Exception("InvalidAOTModel") << "no compiled model registered as '" << name << "'";
+    }
+
+    // the shapes are needed to check the inputs and to create the outputs
+    const xla::ProgramShape* programShape = function_->ProgramShape();
+    if (programShape == nullptr)
+    {
+        throw cms::Exception("InvalidAOTModel")
+            << "model '" << name << "' was compiled without its program shape";
+    }
+    for (int i = 0; i < programShape->parameters_size(); i++)
+    {
+        argTypes_.push_back(toDataType(name_, programShape->parameters(i).element_type()));
+        argShapes_.push_back(toTensorShape(programShape->parameters(i)));
+    }
+    const xla::Shape& result = programShape->result();
+    if (result.element_type() == xla::TUPLE)
+    {
+        for (int i = 0; i < result.tuple_shapes_size(); i++)
+        {
+            resultTypes_.push_back(toDataType(name_, result.tuple_shapes(i).element_type()));
+            resultShapes_.push_back(toTensorShape(result.tuple_shapes(i)));
+        }
+    }
+    else
+    {
+        resultTypes_.push_back(toDataType(name_, result.element_type()));
+        resultShapes_.push_back(toTensorShape(result));
+    }
+}
+
+AOTModel::~AOTModel()
+{
+}
+
+void AOTModel::run(const NamedTensorList& inputs, const std::vector<std::string>& outputNames,
+    std::vector<Tensor>* outputs)
+{
+    // copy the inputs to the buffers of the arguments, padding the batches with zeros
+    std::vector<bool> filled(argShapes_.size(), false);
+    int64 nRows = -1;
+    int64 batchSize = -1;
+    for (const NamedTensor& input : inputs)
+    {
+        const int index = function_->LookupArgIndex(input.first);
+        if (index < 0)
+        {
+            throw cms::Exception("InvalidInput")
+                << "model '" << name_ << "' has no input '" << input.first << "'";
+        }
+        if (filled[index])
+        {
+            throw cms::Exception("InvalidInput") << "input '" << input.first << "' given twice";
+        }
+        filled[index] = true;
+
+        const Tensor& tensor = input.second;
+        const TensorShape& argShape = argShapes_[index];
+        bool compatible = tensor.dtype() == argTypes_[index] && tensor.dims() == argShape.dims();
+        for (int d = 1; compatible && d < argShape.dims(); d++)
+        {
+            compatible = tensor.dim_size(d) == argShape.dim_size(d);
+        }
+        // all the inputs with a first dimension must agree on the rows and on the batch size,
+        // whether they are padded or not
+        if (compatible && argShape.dims() > 0)
+        {
+            compatible = tensor.dim_size(0) <= argShape.dim_size(0)
+                && (nRows < 0 || (nRows == tensor.dim_size(0) && batchSize == argShape.dim_size(0)));
+            nRows = tensor.dim_size(0);
+            batchSize = argShape.dim_size(0);
+        }
+        if (!compatible)
+        {
+            throw cms::Exception("InvalidInput") << "input '" << input.first << "' of shape "
+                << tensor.shape().DebugString() << " and type " << DataTypeString(tensor.dtype())
+                << " does not fit the compiled shape " << argShape.DebugString() << " and type "
+                << DataTypeString(argTypes_[index]) << " of model '" << name_ << "'";
+        }
+
+        char* data = static_cast<char*>(function_->arg_data(index));
+        const StringPiece bytes = tensor.tensor_data();
+        std::memcpy(data, bytes.data(), bytes.size());
+        const size_t argBytes = argShape.num_elements() * DataTypeSize(argTypes_[index]);
+        std::memset(data + bytes.size(), 0, argBytes - bytes.size());
+    }
+    for (size_t i = 0; i < filled.size(); i++)
+    {
+        if (!filled[i])
+        {
+            throw cms::Exception("InvalidInput")
+                << "missing input " << i << " of model '" << name_ << "'";
+        }
+    }
+
+    if (!function_->Run())
+    {
+        throw cms::Exception("InvalidRun")
+            << "error while running model '" << name_ << "': " << function_->error_msg();
+    }
+
+    // copy the results, only keeping the rows of the inputs
+    outputs->clear();
+    for (const std::string& outputName : outputNames)
+    {
+        const int index = function_->LookupResultIndex(outputName);
+        if (index < 0)
+        {
+            throw cms::Exception("InvalidRun")
+                << "model '" << name_ << "' has no output '" << outputName << "'";
+        }
+
+        Tensor output(resultTypes_[index], resultShapes_[index]);
+        const StringPiece bytes = output.tensor_data();
+        std::memcpy(const_cast<char*>(bytes.data()), function_->result_data(index), bytes.size());
+        if (nRows >= 0 && nRows < batchSize && output.dims() > 0 && output.dim_size(0) == batchSize)
+        {
+            output = output.Slice(0, nRows);
+        }
+        outputs->push_back(output);
+    }
+}
+
+AOTModel* createAOTModel(const std::string& name)
+{
+    return new AOTModel(name);
+}
+
+void run(AOTModel* model, const NamedTensorList& inputs,
+    const std::vector<std::string>& outputNames, std::vector<Tensor>* outputs)
+{
+    if (model == nullptr)
+    {
+        throw cms::Exception("InvalidAOTModel") << "cannot run empty model";
+    }
+
+    model->run(inputs, outputNames, outputs);
+}
+
+void run(AOTModel* model, const std::vector<std::string>& inputNames,
+    const std::vector<Tensor>& inputTensors, const std::vector<std::string>& outputNames,
+    std::vector<Tensor>* outputs)
+{
+    if (inputNames.size() != inputTensors.size())
+    {
+        throw cms::Exception("InvalidInput") << "numbers of input names and tensors not equal";
+    }
+
+    NamedTensorList inputs;
+    for (size_t i = 0; i < inputNames.size(); i++)
+    {
+        inputs.push_back(NamedTensor(inputNames[i], inputTensors[i]));
+    }
+
+    run(model, inputs, outputNames, outputs);
+}
+
+} // namespace tensorflow
@@ -40,6 +40,8 @@ struct PreprocessParams {
   unsigned var_length = 0;
   std::vector<std::string> var_names;
   std::unordered_map<std::string, VarInfo> var_info_map;
+  // infos of var_names, in the same order
+  std::vector<VarInfo> var_infos;
 
   VarInfo get_info(const std::string &name) const {
     auto item = var_info_map.find(name);
@@ -70,10 +72,11 @@ class DeepBoostedJetTagsProducer : public edm::stream::EDProducer<edm::GlobalCac
     void produce(edm::Event&, const edm::EventSetup&) override;
     void endStream() override {}
 
-    std::vector<float> center_norm_pad(const std::vector<float>& input,
+    // writes target_length values to out
+    void center_norm_pad(const std::vector<float>& input,
         float center, float scale,
-        unsigned target_length, float pad_value=0,
-        float min=0, float max=-1);
+        unsigned target_length, std::vector<float>::iterator out, float pad_value=0,
+        float min=0, float max=-1) const;
     void make_inputs(const reco::DeepBoostedJetTagInfo &taginfo);
 
     const edm::EDGetTokenT< TagInfoCollection > src_;
@@ -81,6 +84,7 @@ class DeepBoostedJetTagsProducer : public edm::stream::EDProducer<edm::GlobalCac
     std::vector<std::string> input_names_; // names of each input group - the ordering is important!
     std::vector<std::vector<unsigned int>> input_shapes_; // shapes of each input group
     std::unordered_map<std::string, PreprocessParams> prep_info_map_; // preprocessing info for each input group
+    std::vector<const PreprocessParams*> prep_params_; // preprocessing info of input_names_, in the same order
 
     std::vector<std::vector<float>> data_;
     std::unique_ptr<mxnet::cpp::Predictor> predictor_;
@@ -109,7 +113,9 @@ DeepBoostedJetTagsProducer::DeepBoostedJetTagsProducer(const edm::ParameterSet&
       double median = var_pset.getParameter<double>("median");
       double upper = var_pset.getParameter<double>("upper");
       prep_params.var_info_map[var_name] = PreprocessParams::VarInfo(median, upper);
+      prep_params.var_infos.push_back(prep_params.var_info_map[var_name]);
     }
+    prep_params_.push_back(&prep_params);
 
     // create data storage with a fixed size vector initilized w/ 0
     unsigned len = prep_params.var_length * prep_params.var_names.size();
@@ -224,19 +230,22 @@ void DeepBoostedJetTagsProducer::produce(edm::Event& iEvent, const edm::EventSet
   for (unsigned jet_n=0; jet_n<tag_infos->size(); ++jet_n){
 
     const auto& taginfo = (*tag_infos)[jet_n];
-    std::vector<float> outputs(flav_names_.size(), 0); // init as all zeros
+    const auto & jet_ref = tag_infos->at(jet_n).jet();
 
     if (!taginfo.features().empty()){
       // convert inputs
       make_inputs(taginfo);
-      // run prediction and get outputs
-      outputs = predictor_->predict(data_);
+      // run prediction and get outputs, owned by the predictor
+      const auto & outputs = predictor_->predict(data_);
       assert(outputs.size() == flav_names_.size());
-    }
-
-    const auto & jet_ref = tag_infos->at(jet_n).jet();
-    for (std::size_t flav_n=0; flav_n < flav_names_.size(); flav_n++) {
-      (*(output_tags[flav_n]))[jet_ref] = outputs[flav_n];
+      for (std::size_t flav_n=0; flav_n < flav_names_.size(); flav_n++) {
+        (*(output_tags[flav_n]))[jet_ref] = outputs[flav_n];
+      }
+    } else {
+      // all zeros
+      for (std::size_t flav_n=0; flav_n < flav_names_.size(); flav_n++) {
+        (*(output_tags[flav_n]))[jet_ref] = 0;
+      }
     }
 
   }
@@ -259,42 +268,40 @@ void DeepBoostedJetTagsProducer::produce(edm::Event& iEvent, const edm::EventSet
 
 }
 
-std::vector<float> DeepBoostedJetTagsProducer::center_norm_pad(
+void DeepBoostedJetTagsProducer::center_norm_pad(
     const std::vector<float>& input, float center, float norm_factor,
-    unsigned target_length, float pad_value, float min, float max) {
-  // do variable shifting/scaling/padding/clipping in one go
+    unsigned target_length, std::vector<float>::iterator out, float pad_value, float min, float max) const {
+  // do variable shifting/scaling/padding/clipping in one go, directly in the input array
 
   assert(min<=pad_value && pad_value<=max);
 
-  std::vector<float> out(target_length, pad_value);
-  for (unsigned i=0; i<input.size() && i<target_length; ++i){
+  const unsigned n = std::min<std::size_t>(input.size(), target_length);
+  for (unsigned i=0; i<n; ++i){
     out[i] = std::clamp((input[i] - center) * norm_factor, min, max);
   }
-  return out;
+  std::fill(out + n, out + target_length, pad_value);
 
 }
 
 void DeepBoostedJetTagsProducer::make_inputs(const reco::DeepBoostedJetTagInfo& taginfo) {
   for (unsigned igroup = 0; igroup<input_names_.size(); ++igroup) {
-    const auto &group_name = input_names_[igroup];
     auto &group_values = data_[igroup];
-    const auto& prep_params = prep_info_map_.at(group_name);
-    // first reset group_values to 0
-    std::fill(group_values.begin(), group_values.end(), 0);
+    const auto& prep_params = *prep_params_[igroup];
     unsigned curr_pos = 0;
-    // transform/pad
-    for (const auto &varname : prep_params.var_names){
+    // transform/pad, each variable fills its var_length values of group_values
+    for (unsigned ivar = 0; ivar<prep_params.var_names.size(); ++ivar){
+      const auto &varname = prep_params.var_names[ivar];
       const auto &raw_value = taginfo.features().get(varname);
-      const auto &info = prep_params.get_info(varname);
+      const auto &info = prep_params.var_infos[ivar];
       const float pad = 0; // pad w/ zero
-      auto val = center_norm_pad(raw_value, info.center, info.norm_factor, prep_params.var_length, pad, -5, 5);
-      std::copy(val.begin(), val.end(), group_values.begin()+curr_pos);
+      auto val = group_values.begin()+curr_pos;
+      center_norm_pad(raw_value, info.center, info.norm_factor, prep_params.var_length, val, pad, -5, 5);
       curr_pos += prep_params.var_length;
 
       if (debug_){
         std::cout << " -- var=" << varname << ", center=" << info.center << ", scale=" << info.norm_factor << ", pad=" << pad << std::endl;
-        std::cout << "values (first 7 and last 3): " << val.at(0) << ", " << val.at(1) << ", " << val.at(2) << ", " << val.at(3) << ", " << val.at(4) << ", " << val.at(5) << ", " << val.at(6) << " ... "
-            << val.at(prep_params.var_length-3) << ", " << val.at(prep_params.var_length-2) << ", " << val.at(prep_params.var_length-1) << std::endl;
+        std::cout << "values (first 7 and last 3): " << val[0] << ", " << val[1] << ", " << val[2] << ", " << val[3] << ", " << val[4] << ", " << val[5] << ", " << val[6] << " ... "
+            << val[prep_params.var_length-3] << ", " << val[prep_params.var_length-2] << ", " << val[prep_params.var_length-1] << std::endl;
       }
 
     }
@@ -1,4 +1,5 @@
 
+#include "FWCore/Concurrency/interface/WaitingTaskWithArenaHolder.h"
 #include "FWCore/Framework/interface/Frameworkfwd.h"
 #include "FWCore/Framework/interface/stream/EDProducer.h"
 
@@ -15,6 +16,7 @@
 #include "DataFormats/BTauReco/interface/DeepDoubleBTagInfo.h"
 
 #include "PhysicsTools/TensorFlow/interface/TensorFlow.h"
+#include "PhysicsTools/TensorFlow/interface/BatchedRunner.h"
 
 #include "RecoBTag/TensorFlow/interface/tensor_fillers.h"
 
@@ -26,14 +28,27 @@
 // make use of a cache struct that can be extended in the future if nedded. In addition, the graph
 // is protected via std::atomic, which should not affect the performance as it is only accessed in
 // the module constructor and not in the actual produce loop.
+// When the jets of several events are evaluated together, the cache also holds the session shared
+// by the streams and the runner gathering their inputs.
 struct DeepDoubleBTFCache {
-  DeepDoubleBTFCache() : graphDef(nullptr) {
+  DeepDoubleBTFCache() : graphDef(nullptr), session(nullptr) {
+  }
+
+  ~DeepDoubleBTFCache() {
+    // the runner is stopped before the session is closed
+    runner.reset();
+    if (session != nullptr) {
+      tensorflow::closeSession(session);
+    }
   }
 
   std::atomic<tensorflow::GraphDef*> graphDef;
+  tensorflow::Session* session;
+  std::unique_ptr<tensorflow::BatchedRunner> runner;
 };
 
-class DeepDoubleBTFJetTagsProducer : public edm::stream::EDProducer<edm::GlobalCache<DeepDoubleBTFCache>> {
+class DeepDoubleBTFJetTagsProducer : public edm::stream::EDProducer<edm::GlobalCache<DeepDoubleBTFCache>,
+                                                                    edm::ExternalWork> {
 
   public:
     explicit DeepDoubleBTFJetTagsProducer(const edm::ParameterSet&, const DeepDoubleBTFCache*);
@@ -59,9 +74,19 @@ class DeepDoubleBTFJetTagsProducer : public edm::stream::EDProducer<edm::GlobalC
     typedef reco::JetTagCollection JetTagCollection;
 
     void beginStream(edm::StreamID) override {}
+    void acquire(edm::Event const&, edm::EventSetup const&, edm::WaitingTaskWithArenaHolder) override;
     void produce(edm::Event&, const edm::EventSetup&) override;
     void endStream() override {}
 
+    std::vector<tensorflow::TensorShape> input_sizes(int64_t n_batch_jets) const;
+    // zeroes the input tensors and fills them with the jets from first_jet on
+    void fill_inputs(const TagInfoCollection& tag_infos, std::size_t first_jet,
+                     tensorflow::NamedTensorList& input_tensors) const;
+    // sets the discriminators of the jets from first_jet on
+    void set_outputs(const TagInfoCollection& tag_infos, std::size_t first_jet,
+                     const std::vector<tensorflow::Tensor>& outputs,
+                     std::vector<std::unique_ptr<JetTagCollection>>& output_tags) const;
+
     const edm::EDGetTokenT< TagInfoCollection > src_;
     std::vector<std::pair<std::string,std::vector<unsigned int>>> flav_pairs_;
     std::vector<std::string> input_names_;
@@ -74,6 +99,8 @@ class DeepDoubleBTFJetTagsProducer : public edm::stream::EDProducer<edm::GlobalC
     std::vector<tensorflow::Tensor> lp_tensors_;
     // flag to evaluate model batch or jet by jet
     bool batch_eval_;
+    // outputs of the jets of the event, when evaluated together with other events
+    std::vector<tensorflow::Tensor> batched_outputs_;
 };
 
 DeepDoubleBTFJetTagsProducer::DeepDoubleBTFJetTagsProducer(const edm::ParameterSet& iConfig,
@@ -91,8 +118,10 @@ DeepDoubleBTFJetTagsProducer::DeepDoubleBTFJetTagsProducer(const edm::ParameterS
   tensorflow::SessionOptions sessionOptions;
   tensorflow::setThreading(sessionOptions, nThreads, singleThreadPool);
 
-  // create the session using the meta graph from the cache
-  session_ = tensorflow::createSession(cache->graphDef, sessionOptions);
+  // create the session using the meta graph from the cache, unless the runner of the cache is used
+  if (!cache->runner) {
+    session_ = tensorflow::createSession(cache->graphDef, sessionOptions);
+  }
 
   // get output names from flav_table
   const auto & flav_pset = iConfig.getParameter<edm::ParameterSet>("flav_table");
@@ -146,6 +175,10 @@ void DeepDoubleBTFJetTagsProducer::fillDescriptions(edm::ConfigurationDescriptio
   }
 
   desc.add<bool>("batch_eval", false);
+  // evaluate the jets of several events in one session call, once this many events are gathered
+  // or after the latency budget, 0 to evaluate each event separately
+  desc.add<unsigned int>("max_batch_events", 0);
+  desc.add<unsigned int>("batch_latency_us", 1000);
 
   desc.add<unsigned int>("nThreads", 1);
   desc.add<std::string>("singleThreadPool", "no_threads");
@@ -166,6 +199,25 @@ std::unique_ptr<DeepDoubleBTFCache> DeepDoubleBTFJetTagsProducer::initializeGlob
   DeepDoubleBTFCache* cache = new DeepDoubleBTFCache();
   cache->graphDef = tensorflow::loadGraphDef(pbFile);
 
+  // the runner shared by the streams, with a single threaded session
+  const unsigned int max_batch_events = iConfig.getParameter<unsigned int>("max_batch_events");
+  if (max_batch_events > 0) {
+    cache->session = tensorflow::createSession(cache->graphDef, 1);
+
+    tensorflow::NamedTensorList lp_tensors;
+    for (const auto & lp_name : iConfig.getParameter<std::vector<std::string>>("lp_names")) {
+      tensorflow::Tensor t(tensorflow::DT_BOOL, {});
+      t.scalar<bool>()() = false;
+      lp_tensors.emplace_back(lp_name, t);
+    }
+    cache->runner = std::make_unique<tensorflow::BatchedRunner>(cache->session,
+      iConfig.getParameter<std::vector<std::string>>("input_names"),
+      iConfig.getParameter<std::vector<std::string>>("output_names"),
+      max_batch_events,
+      std::chrono::microseconds(iConfig.getParameter<unsigned int>("batch_latency_us")),
+      lp_tensors);
+  }
+
   return std::unique_ptr<DeepDoubleBTFCache>(cache);
 }
 
@@ -176,6 +228,103 @@ void DeepDoubleBTFJetTagsProducer::globalEndJob(const DeepDoubleBTFCache* cache)
   }
 }
 
+std::vector<tensorflow::TensorShape> DeepDoubleBTFJetTagsProducer::input_sizes(int64_t n_batch_jets) const
+{
+  return {
+    {n_batch_jets, 1, 27},     // input_1 - global double-b features
+    {n_batch_jets, 60, 8},     // input_2 - charged pf
+    {n_batch_jets, 5, 2},      // input_3 - vertices 
+  };
+}
+
+void DeepDoubleBTFJetTagsProducer::fill_inputs(const TagInfoCollection& tag_infos, std::size_t first_jet,
+  tensorflow::NamedTensorList& input_tensors) const
+{
+  // tensors have to be zeroed before filling per batch
+  for (std::size_t i=0; i <= kVertices; i++) {
+    input_tensors[i].second.flat<float>().setZero();
+  }
+
+  const std::size_t n_batch_jets = input_tensors.at(kGlobal).second.dim_size(0);
+  for (std::size_t jet_bn=0; jet_bn < n_batch_jets; jet_bn++) {
+
+    // global jet index (jet_bn is the jet batch index)
+    std::size_t jet_n = first_jet + jet_bn;
+
+    // jet and other global features
+    const auto & features = tag_infos.at(jet_n).features();
+    db_tensor_filler(input_tensors.at(kGlobal).second, jet_bn, features);
+
+    // c_pf candidates
+    auto max_c_pf_n = std::min(features.c_pf_features.size(),
+      (std::size_t) input_tensors.at(kChargedCandidates).second.dim_size(1));
+    for (std::size_t c_pf_n=0; c_pf_n < max_c_pf_n; c_pf_n++) {
+      const auto & c_pf_features = features.c_pf_features.at(c_pf_n);
+      c_pf_reduced_tensor_filler(input_tensors.at(kChargedCandidates).second,
+                                 jet_bn, c_pf_n, c_pf_features);
+    }
+
+    // sv candidates
+    auto max_sv_n = std::min(features.sv_features.size(),
+      (std::size_t) input_tensors.at(kVertices).second.dim_size(1));
+    for (std::size_t sv_n=0; sv_n < max_sv_n; sv_n++) {
+      const auto & sv_features = features.sv_features.at(sv_n);
+      sv_reduced_tensor_filler(input_tensors.at(kVertices).second,
+                               jet_bn, sv_n, sv_features);
+    }
+  }
+}
+
+void DeepDoubleBTFJetTagsProducer::set_outputs(const TagInfoCollection& tag_infos, std::size_t first_jet,
+  const std::vector<tensorflow::Tensor>& outputs,
+  std::vector<std::unique_ptr<JetTagCollection>>& output_tags) const
+{
+  // set output values for flavour probs
+  const auto & flavour = outputs.at(kJetFlavour).matrix<float>();
+  for (std::size_t jet_bn=0; jet_bn < (std::size_t) flavour.dimension(0); jet_bn++) {
+
+    // global jet index (jet_bn is the jet batch index)
+    std::size_t jet_n = first_jet + jet_bn;
+
+    const auto & jet_ref = tag_infos.at(jet_n).jet();
+    for (std::size_t flav_n=0; flav_n < flav_pairs_.size(); flav_n++) {
+      const auto & flav_pair = flav_pairs_.at(flav_n);
+      float o_sum = 0.;
+      for (const unsigned int & ind : flav_pair.second) {
+        o_sum += flavour(jet_bn, ind);
+      }
+      (*(output_tags.at(flav_n)))[jet_ref] = o_sum;
+    }
+  }
+}
+
+void DeepDoubleBTFJetTagsProducer::acquire(edm::Event const& iEvent, edm::EventSetup const& iSetup,
+  edm::WaitingTaskWithArenaHolder waitingTaskHolder)
+{
+  // without a runner the jets are evaluated in produce
+  batched_outputs_.clear();
+  if (!globalCache()->runner) {
+    return;
+  }
+
+  edm::Handle<TagInfoCollection> tag_infos;
+  iEvent.getByToken(src_, tag_infos);
+
+  // all the jets of the event in one batch, to be merged with those of other events
+  const int64_t n_jets = tag_infos->size();
+  tensorflow::NamedTensorList input_tensors;
+  for (const auto & input_size : input_sizes(n_jets)) {
+    input_tensors.emplace_back(std::string(), tensorflow::Tensor(tensorflow::DT_FLOAT, input_size));
+  }
+  fill_inputs(*tag_infos, 0, input_tensors);
+
+  std::vector<tensorflow::Tensor> inputs;
+  for (auto & input_tensor : input_tensors) {
+    inputs.push_back(std::move(input_tensor.second));
+  }
+  globalCache()->runner->submit(iEvent.streamID(), std::move(inputs), &batched_outputs_, std::move(waitingTaskHolder));
+}
+
 void DeepDoubleBTFJetTagsProducer::produce(edm::Event& iEvent, const edm::EventSetup& iSetup)
 {
 
@@ -195,90 +344,45 @@ void DeepDoubleBTFJetTagsProducer::produce(edm::Event& iEvent, const edm::EventS
   }
 
   const int64_t n_jets = tag_infos->size();
-  // either all jets or one per batch for the time being
-  const int64_t n_batch_jets = batch_eval_ ?  n_jets : 1;
-  
-
-  std::vector<tensorflow::TensorShape> input_sizes {
-    {n_batch_jets, 1, 27},     // input_1 - global double-b features
-    {n_batch_jets, 60, 8},     // input_2 - charged pf
-    {n_batch_jets, 5, 2},      // input_3 - vertices 
-  };
-
-  // create a list of named tensors, i.e. a vector of (string, Tensor) pairs, with proper size to
-  // prevent element copying that would occur via push_back's
-  // the default Tensor constructor creates a scalar so this should be fine w.r.t. to memory
-  tensorflow::NamedTensorList input_tensors;
-  input_tensors.resize(input_sizes.size() + lp_tensors_.size());
-
-  // add actual input tensors that hold physics information
-  for (std::size_t i=0; i < input_sizes.size(); i++) {
-    input_tensors[i] = tensorflow::NamedTensor(
-      input_names_[i], tensorflow::Tensor(tensorflow::DT_FLOAT, input_sizes.at(i)));
-  }
+  if (globalCache()->runner) {
+    // already evaluated together with the jets of other events
+    if (n_jets > 0) {
+      set_outputs(*tag_infos, 0, batched_outputs_, output_tags);
+    }
+  } else if (n_jets > 0) {
+    // either all jets or one per batch for the time being
+    const int64_t n_batch_jets = batch_eval_ ?  n_jets : 1;
 
-  // add learning-phase tensors behind them
-  for (std::size_t i=0; i < lp_tensors_.size(); i++) {
-    input_tensors[input_sizes.size() + i] = tensorflow::NamedTensor(lp_names_[i], lp_tensors_[i]);
-  }
+    std::vector<tensorflow::TensorShape> input_sizes = this->input_sizes(n_batch_jets);
 
-  std::size_t n_batches = n_jets/n_batch_jets; // either 1 or n_jets
-  for (std::size_t batch_n=0; batch_n < n_batches; batch_n++) {
+    // create a list of named tensors, i.e. a vector of (string, Tensor) pairs, with proper size to
+    // prevent element copying that would occur via push_back's
+    // the default Tensor constructor creates a scalar so this should be fine w.r.t. to memory
+    tensorflow::NamedTensorList input_tensors;
+    input_tensors.resize(input_sizes.size() + lp_tensors_.size());
 
-    // tensors have to be zeroed before filling per batch
+    // add actual input tensors that hold physics information
     for (std::size_t i=0; i < input_sizes.size(); i++) {
-      input_tensors[i].second.flat<float>().setZero();
+      input_tensors[i] = tensorflow::NamedTensor(
+        input_names_[i], tensorflow::Tensor(tensorflow::DT_FLOAT, input_sizes.at(i)));
     }
 
-    // fill values of the input tensors
-    for (std::size_t jet_bn=0; jet_bn < (std::size_t) n_batch_jets; jet_bn++) {
+    // add learning-phase tensors behind them
+    for (std::size_t i=0; i < lp_tensors_.size(); i++) {
+      input_tensors[input_sizes.size() + i] = tensorflow::NamedTensor(lp_names_[i], lp_tensors_[i]);
+    }
 
-      // global jet index (jet_bn is the jet batch index)
-      std::size_t jet_n = batch_n*n_batch_jets + jet_bn;
+    std::size_t n_batches = n_jets/n_batch_jets; // either 1 or n_jets
+    for (std::size_t batch_n=0; batch_n < n_batches; batch_n++) {
 
-      // jet and other global features
-      const auto & features = tag_infos->at(jet_n).features();
-      db_tensor_filler(input_tensors.at(kGlobal).second, jet_bn, features);
+      // fill values of the input tensors
+      fill_inputs(*tag_infos, batch_n*n_batch_jets, input_tensors);
 
-        
-      // c_pf candidates
-      auto max_c_pf_n = std::min(features.c_pf_features.size(),
-        (std::size_t) input_sizes.at(kChargedCandidates).dim_size(1));
-      for (std::size_t c_pf_n=0; c_pf_n < max_c_pf_n; c_pf_n++) {
-        const auto & c_pf_features = features.c_pf_features.at(c_pf_n);
-        c_pf_reduced_tensor_filler(input_tensors.at(kChargedCandidates).second,
-                           jet_bn, c_pf_n, c_pf_features);
-      }
-      
-      // sv candidates
-      auto max_sv_n = std::min(features.sv_features.size(),
-        (std::size_t) input_sizes.at(kVertices).dim_size(1));
-      for (std::size_t sv_n=0; sv_n < max_sv_n; sv_n++) {
-        const auto & sv_features = features.sv_features.at(sv_n);
-        sv_reduced_tensor_filler(input_tensors.at(kVertices).second,
-                         jet_bn, sv_n, sv_features);
-      }
-      
-    }
-    // run the session
-    std::vector<tensorflow::Tensor> outputs;
-    tensorflow::run(session_, input_tensors, output_names_, &outputs);
-    
-    // set output values for flavour probs
-    for (std::size_t jet_bn=0; jet_bn < (std::size_t) n_batch_jets; jet_bn++) {
-
-      // global jet index (jet_bn is the jet batch index)
-      std::size_t jet_n = batch_n*n_batch_jets + jet_bn;
-
-      const auto & jet_ref = tag_infos->at(jet_n).jet();
-      for (std::size_t flav_n=0; flav_n < flav_pairs_.size(); flav_n++) {
-        const auto & flav_pair = flav_pairs_.at(flav_n);
-        float o_sum = 0.;
-        for (const unsigned int & ind : flav_pair.second) {
-          o_sum += outputs.at(kJetFlavour).matrix<float>()(jet_bn, ind);
-        }
-        (*(output_tags.at(flav_n)))[jet_ref] = o_sum;
-      }
+      // run the session
+      std::vector<tensorflow::Tensor> outputs;
+      tensorflow::run(session_, input_tensors, output_names_, &outputs);
+
+      set_outputs(*tag_infos, batch_n*n_batch_jets, outputs, output_tags);
     }
   }
 
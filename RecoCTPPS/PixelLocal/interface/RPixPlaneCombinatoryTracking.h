@@ -51,7 +51,7 @@ class RPixPlaneCombinatoryTracking : public RPixDetTrackFinder{
         HitReferences tmpHitPlaneMap,
         const PointInPlaneList &tmpHitVector,
         PointAndReferenceMap &outputMap);
-    PointAndReferenceMap produceAllHitCombination(PlaneCombinations inputPlaneCombination);
+    PointAndReferenceMap produceAllHitCombination(const PlaneCombinations &inputPlaneCombination);
     bool calculatePointOnDetector(CTPPSPixelLocalTrack *track, CTPPSPixelDetId planeId, GlobalPoint &planeLineIntercept);
     static bool functionForPlaneOrdering(
         PointAndReferencePair a,
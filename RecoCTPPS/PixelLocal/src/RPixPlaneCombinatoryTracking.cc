@@ -113,7 +113,7 @@ void RPixPlaneCombinatoryTracking::getHitCombinations(
 //------------------------------------------------------------------------------------------------//
 
 RPixPlaneCombinatoryTracking::PointAndReferenceMap
-RPixPlaneCombinatoryTracking::produceAllHitCombination(PlaneCombinations inputPlaneCombination){
+RPixPlaneCombinatoryTracking::produceAllHitCombination(const PlaneCombinations &inputPlaneCombination){
   
   PointAndReferenceMap mapOfAllPoints;
   CTPPSPixelDetId tmpRpId = romanPotId_; //in order to avoid to modify the data member
@@ -131,7 +131,8 @@ RPixPlaneCombinatoryTracking::produceAllHitCombination(PlaneCombinations inputPl
     for( const auto & plane : planeCombination){
       tmpRpId.setPlane(plane);
       CTPPSPixelDetId planeDetId = tmpRpId;
-      if(hitMap_->find(planeDetId) == hitMap_->end()){
+      auto planeHits = hitMap_->find(planeDetId);
+      if(planeHits == hitMap_->end()){
         if(verbosity_>2) edm::LogInfo("RPixPlaneCombinatoryTracking")<<"No data on arm "<<planeDetId.arm()<<" station "<<planeDetId.station()
                                   <<" rp " <<planeDetId.rp()<<" plane "<<planeDetId.plane();
         allPlaneAsHits = false;
@@ -142,7 +143,7 @@ RPixPlaneCombinatoryTracking::produceAllHitCombination(PlaneCombinations inputPl
              <<"selectedCombinationHitOnPlane contains already detId "<<planeDetId
              <<"Error in the algorithm which created all the possible plane combinations";
       }
-      selectedCombinationHitOnPlane[planeDetId] = (*hitMap_)[planeDetId];
+      selectedCombinationHitOnPlane[planeDetId] = planeHits->second;
     }
     if(!allPlaneAsHits) continue;
     
@@ -136,33 +136,40 @@ namespace {
     PFECALSuperClusterAlgo::clustering_type _type;
     bool dynamic_dphi;
     double etawidthSuperCluster_ = .0 , phiwidthSuperCluster_ = .0;
+    // the seed position is tested against every remaining cluster
+    const double seedEta_, seedPhi_;
     IsClustered(const CalibClusterPtr s, 
 		PFECALSuperClusterAlgo::clustering_type ct,
 		const bool dyn_dphi) : 
-      the_seed(s), _type(ct), dynamic_dphi(dyn_dphi) {}
+      the_seed(s), _type(ct), dynamic_dphi(dyn_dphi),
+      seedEta_(s->eta()), seedPhi_(s->phi()) {}
     bool operator()(const CalibClusterPtr& x) { 
+      const double xEta = x->eta(), xPhi = x->phi();
+      // the box eta window is the cheapest test: apply it first
+      if( _type == PFECALSuperClusterAlgo::kBOX && 
+	  !(std::abs(seedEta_-xEta)<etawidthSuperCluster_) ) return false;
+
       const double dphi = 
-	std::abs(TVector2::Phi_mpi_pi(the_seed->phi() - x->phi()));        
+	std::abs(TVector2::Phi_mpi_pi(seedPhi_ - xPhi));        
       const bool passes_dphi = 
 	( (!dynamic_dphi && dphi < phiwidthSuperCluster_ ) || 
-	  (dynamic_dphi && MK::inDynamicDPhiWindow(the_seed->eta(),
-						   the_seed->phi(),
+	  (dynamic_dphi && MK::inDynamicDPhiWindow(seedEta_,
+						   seedPhi_,
 						   x->energy_nocalib(),
-						   x->eta(),
-						   x->phi()) ) );
+						   xEta,
+						   xPhi) ) );
 
       switch( _type ) {
       case PFECALSuperClusterAlgo::kBOX:
-	return ( std::abs(the_seed->eta()-x->eta())<etawidthSuperCluster_ && 
-		 passes_dphi   );
+	return passes_dphi;
 	break;
       case PFECALSuperClusterAlgo::kMustache:
 	return ( passes_dphi && 
-		 MK::inMustache(the_seed->eta(), 
-				the_seed->phi(),
+		 MK::inMustache(seedEta_, 
+				seedPhi_,
 				x->energy_nocalib(),
-				x->eta(),
-				x->phi()            ));
+				xEta,
+				xPhi            ));
 	break;
       default: 
 	return false;
@@ -89,6 +89,8 @@ void EgammaHLTPFChargedIsolationProducer::produce(edm::StreamID sid, edm::Event&
       math::XYZVector candDirectionWrtVtx(candRef->superCluster()->x() - beamSpotPosition.x(),
 					  candRef->superCluster()->y() - beamSpotPosition.y(),
 					  candRef->superCluster()->z() - beamSpotPosition.z());
+      const double candEta = candDirectionWrtVtx.Eta();
+      const double candPhi = candDirectionWrtVtx.Phi();
       
       float sum = 0;
 
@@ -101,15 +103,16 @@ void EgammaHLTPFChargedIsolationProducer::produce(edm::StreamID sid, edm::Event&
 
 	  if(pfc.pt() < ptMin_) continue;
         
+	  // cone first, the track impact parameters only for the candidates inside
+	  float dR = deltaR(candEta, candPhi, pfc.momentum().Eta(), pfc.momentum().Phi());
+	  if(dR > drMax_ || dR < dRveto) continue;
+	
 	  float dz = fabs(pfc.trackRef()->dz(beamSpotPosition));
 	  if(dz > dzMax_) continue;
 	
 	  float dxy = fabs(pfc.trackRef()->dxy(beamSpotPosition));
 	  if(fabs(dxy) > dxyMax_) continue;
 	
-	  float dR = deltaR(candDirectionWrtVtx.Eta(), candDirectionWrtVtx.Phi(), pfc.momentum().Eta(), pfc.momentum().Phi());
-	  if(dR > drMax_ || dR < dRveto) continue;
-	
 	  sum += pfc.pt();
 	}
       }
@@ -133,6 +136,8 @@ void EgammaHLTPFChargedIsolationProducer::produce(edm::StreamID sid, edm::Event&
 	dRveto = drVetoBarrel_;
       else
 	dRveto = drVetoEndcap_;
+      const double eleEta = eleRef->eta();
+      const double elePhi = eleRef->phi();
       
       float sum = 0;
 
@@ -145,15 +150,15 @@ void EgammaHLTPFChargedIsolationProducer::produce(edm::StreamID sid, edm::Event&
 
 	  if(pfc.pt() < ptMin_) continue;
         
+	  float dR = deltaR(eleEta, elePhi, pfc.momentum().Eta(), pfc.momentum().Phi());
+	  if(dR > drMax_ || dR < dRveto) continue;
+	
  	  float dz = fabs(pfc.trackRef()->dz(eleRef->vertex()));
  	  if(dz > dzMax_) continue;
 	  
  	  float dxy = fabs(pfc.trackRef()->dxy(eleRef->vertex()));
  	  if(fabs(dxy) > dxyMax_) continue;
 	  
-	  float dR = deltaR(eleRef->eta(), eleRef->phi(), pfc.momentum().Eta(), pfc.momentum().Phi());
-	  if(dR > drMax_ || dR < dRveto) continue;
-	
 	  sum += pfc.pt();
 	}
       }
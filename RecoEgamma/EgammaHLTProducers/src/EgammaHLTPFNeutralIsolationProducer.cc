@@ -118,6 +118,7 @@ void EgammaHLTPFNeutralIsolationProducer::produce(edm::StreamID sid, edm::Event&
 	dRVeto = drVetoEndcap_;
 	etaStrip = etaStripEndcap_;
       }
+      const math::XYZPoint& scPosition = candRef->superCluster()->position();
       
       float sum = 0;
 
@@ -138,14 +139,16 @@ void EgammaHLTPFNeutralIsolationProducer::produce(edm::StreamID sid, edm::Event&
 	  
 	  // Shift the RecoEcalCandidate direction vector according to the PF vertex
 	  const math::XYZPoint& pfvtx = pfc.vertex();
-	  math::XYZVector candDirectionWrtVtx(candRef->superCluster()->x() - pfvtx.x(),
-					      candRef->superCluster()->y() - pfvtx.y(),
-					      candRef->superCluster()->z() - pfvtx.z());
+	  math::XYZVector candDirectionWrtVtx(scPosition.x() - pfvtx.x(),
+					      scPosition.y() - pfvtx.y(),
+					      scPosition.z() - pfvtx.z());
+	  const double candEta = candDirectionWrtVtx.Eta();
+	  const double pfcEta = pfc.momentum().Eta();
 	  
-	  float dEta = fabs(candDirectionWrtVtx.Eta() - pfc.momentum().Eta());
+	  float dEta = fabs(candEta - pfcEta);
 	  if(dEta < etaStrip) continue;
 	  
-	  float dR = deltaR(candDirectionWrtVtx.Eta(), candDirectionWrtVtx.Phi(), pfc.momentum().Eta(), pfc.momentum().Phi());
+	  float dR = deltaR(candEta, candDirectionWrtVtx.Phi(), pfcEta, pfc.momentum().Phi());
 	  if(dR > drMax_ || dR < dRVeto) continue;
 	  
 	  sum += pfc.pt();
@@ -199,10 +202,11 @@ void EgammaHLTPFNeutralIsolationProducer::produce(edm::StreamID sid, edm::Event&
 	      continue;
 	  }
 	  
-	  float dEta = fabs(eleRef->eta() - pfc.momentum().Eta());
+	  const double pfcEta = pfc.momentum().Eta();
+	  float dEta = fabs(eleRef->eta() - pfcEta);
 	  if(dEta < etaStrip) continue;
 	  
-	  float dR = deltaR(eleRef->eta(), eleRef->phi(), pfc.momentum().Eta(), pfc.momentum().Phi());
+	  float dR = deltaR(eleRef->eta(), eleRef->phi(), pfcEta, pfc.momentum().Phi());
 	  if(dR > drMax_ || dR < dRVeto) continue;
 	  
 	  sum += pfc.pt();
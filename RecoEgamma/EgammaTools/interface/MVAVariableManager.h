@@ -79,14 +79,14 @@ class MVAVariableManager {
     // For edm::EventBase with getByLabel
     float getValue(int index, const edm::Ptr<ParticleType>& ptclPtr, const edm::EventBase& iEvent) const {
         float value;
-        MVAVariableInfo varInfo = variableInfos_[index];
+        const MVAVariableInfo& varInfo = variableInfos_[index];
         if (varInfo.fromVariableHelper >= 0) {
             edm::Handle<edm::ValueMap<float>> vMap;
-            iEvent.getByLabel(edm::InputTag(formulas_[index]), vMap);
+            iEvent.getByLabel(helperInputTags_[varInfo.fromVariableHelper], vMap);
             value = (*vMap)[ptclPtr];
         } else if (varInfo.isGlobalVariable >= 0) {
             edm::Handle<double> valueHandle;
-            iEvent.getByLabel(edm::InputTag(formulas_[index]), valueHandle);
+            iEvent.getByLabel(globalInputTags_[varInfo.isGlobalVariable], valueHandle);
             value = *valueHandle;
         } else {
             value = functions_[index](*ptclPtr);
@@ -103,7 +103,7 @@ class MVAVariableManager {
     // For edm::Event where getByToken is possible
     float getValue(int index, const edm::Ptr<ParticleType>& ptclPtr, const edm::Event& iEvent) const {
         float value;
-        MVAVariableInfo varInfo = variableInfos_[index];
+        const MVAVariableInfo& varInfo = variableInfos_[index];
         if (varInfo.fromVariableHelper >= 0) {
             edm::Handle<edm::ValueMap<float>> vMap;
             iEvent.getByToken(helperTokens_[varInfo.fromVariableHelper], vMap);
@@ -205,7 +205,8 @@ class MVAVariableManager {
     std::vector<std::string> names_;
     std::map<std::string, int> indexMap_;
 
-    // To store the MVAVariableHelper input tags needed for the variables in this container
+    // To store the MVAVariableHelper input tags needed for the variables in this container,
+    // parsed once from the formulas and indexed by fromVariableHelper and isGlobalVariable
     std::vector<edm::InputTag> helperInputTags_;
     std::vector<edm::InputTag> globalInputTags_;
 
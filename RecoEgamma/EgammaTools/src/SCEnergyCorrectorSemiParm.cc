@@ -115,15 +115,17 @@ std::pair<double, double> SCEnergyCorrectorSemiParm::getCorrections(const reco::
   const double raw_energy = sc.rawEnergy();   
   const int numberOfClusters =  sc.clusters().size();
 
-  std::vector<float> localCovariances = EcalClusterTools::localCovariances(seedCluster,recHits,topo) ;
-  
   if (not isHLT_) {
     std::array<float, 29> eval;  
     
-    const float eLeft = EcalClusterTools::eLeft(seedCluster,recHits,topo);
-    const float eRight = EcalClusterTools::eRight(seedCluster,recHits,topo);
-    const float eTop = EcalClusterTools::eTop(seedCluster,recHits,topo);
-    const float eBottom = EcalClusterTools::eBottom(seedCluster,recHits,topo);
+    std::vector<float> localCovariances = EcalClusterTools::localCovariances(seedCluster,recHits,topo) ;
+
+    // the shower shapes below are all around the seed crystal: find it once
+    const std::pair<DetId, float> seedMax = EcalClusterTools::getMaximum(seedCluster,recHits);
+    const float eLeft = EcalClusterTools::matrixEnergy(seedCluster,recHits,topo,seedMax.first,-1,-1,0,0);
+    const float eRight = EcalClusterTools::matrixEnergy(seedCluster,recHits,topo,seedMax.first,1,1,0,0);
+    const float eTop = EcalClusterTools::matrixEnergy(seedCluster,recHits,topo,seedMax.first,0,0,1,1);
+    const float eBottom = EcalClusterTools::matrixEnergy(seedCluster,recHits,topo,seedMax.first,0,0,-1,-1);
     
     float sigmaIetaIeta = sqrt(localCovariances[0]);
     float sigmaIetaIphi = std::numeric_limits<float>::max();
@@ -185,9 +187,9 @@ std::pair<double, double> SCEnergyCorrectorSemiParm::getCorrections(const reco::
     eval[1]  = raw_energy;
     eval[2]  = sc.etaWidth();
     eval[3]  = sc.phiWidth();
-    eval[4]  = EcalClusterTools::e3x3(seedCluster,recHits,topo)/raw_energy; 
+    eval[4]  = EcalClusterTools::matrixEnergy(seedCluster,recHits,topo,seedMax.first,-1,1,-1,1)/raw_energy; 
     eval[5]  = seedCluster.energy()/raw_energy;
-    eval[6]  = EcalClusterTools::eMax(seedCluster,recHits)/raw_energy;
+    eval[6]  = seedMax.second/raw_energy;
     eval[7]  = EcalClusterTools::e2nd(seedCluster,recHits)/raw_energy;
     eval[8] = (eLeft + eRight != 0.f  ? (eLeft-eRight)/(eLeft+eRight) : 0.f);
     eval[9] = (eTop  + eBottom != 0.f ? (eTop-eBottom)/(eTop+eBottom) : 0.f);
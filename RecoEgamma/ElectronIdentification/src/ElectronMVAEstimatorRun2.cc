@@ -92,6 +92,7 @@ mvaValue( const edm::Ptr<reco::Candidate>& candPtr, const edm::EventBase & iEven
   if (iCategory < 0) return -999;
 
   std::vector<float> vars;
+  vars.reserve(nVariables_[iCategory]);
 
   for (int i = 0; i < nVariables_[iCategory]; ++i) {
       vars.push_back(mvaVarMngr_.getValue(variables_[iCategory][i], gsfPtr, iEvent));
@@ -67,6 +67,7 @@ void HIPixelClusterVtxProducer::produce(edm::Event& ev, const edm::EventSetup& e
 
     // loop over pixel rechits
     std::vector<VertexHit> vhits;
+    vhits.reserve(hits->data().size());
     for(SiPixelRecHitCollection::DataContainer::const_iterator hit = hits->data().begin(), 
           end = hits->data().end(); hit != end; ++hit) {
       if (!hit->isValid())
@@ -92,10 +93,7 @@ void HIPixelClusterVtxProducer::produce(edm::Event& ev, const edm::EventSetup& e
           continue;
       }
 
-      LocalPoint lpos = LocalPoint(hit->localPosition().x(),
-				   hit->localPosition().y(),
-				   hit->localPosition().z());
-      GlobalPoint gpos = pgdu->toGlobal(lpos);
+      GlobalPoint gpos = pgdu->toGlobal(hit->localPosition());
       VertexHit vh;
       vh.z = gpos.z(); 
       vh.r = gpos.perp(); 
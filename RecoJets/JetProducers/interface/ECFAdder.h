@@ -18,7 +18,10 @@ class ECFAdder : public edm::stream::EDProducer<> {
     explicit ECFAdder(const edm::ParameterSet& iConfig);
     
     void produce(edm::Event & iEvent, const edm::EventSetup & iSetup) override;
-    float getECF(unsigned index, const edm::Ptr<reco::Jet> & object) const;
+    // fills FJparticles with the constituents of the jet, descending into the subjets
+    void getConstituents(const edm::Ptr<reco::Jet> & object, std::vector<fastjet::PseudoJet> & FJparticles) const;
+    // jet is the join of the nConstituents constituents
+    float getECF(unsigned index, const fastjet::PseudoJet & jet, size_t nConstituents) const;
 
     static void fillDescriptions(edm::ConfigurationDescriptions & descriptions);
     
@@ -48,7 +48,9 @@ class NjettinessAdder : public edm::stream::EDProducer<> {
     ~NjettinessAdder() override {}
     
     void produce(edm::Event & iEvent, const edm::EventSetup & iSetup) override ;
-    float getTau(unsigned num, const edm::Ptr<reco::Jet> & object) const;
+    // fills FJparticles with the constituents of the jet
+    void getConstituents(const edm::Ptr<reco::Jet> & object, std::vector<fastjet::PseudoJet> & FJparticles) const;
+    float getTau(unsigned num, const std::vector<fastjet::PseudoJet> & FJparticles) const;
     
  private:	
     edm::InputTag                          src_;
@@ -24,6 +24,7 @@ void FixedGridRhoProducerFastjet::produce(edm::Event& iEvent, const edm::EventSe
    edm::Handle< edm::View<reco::Candidate> > pfColl;
    iEvent.getByToken(input_pfcoll_token_, pfColl);
    std::vector<fastjet::PseudoJet> inputs;
+   inputs.reserve(pfColl->size());
    for ( edm::View<reco::Candidate>::const_iterator ibegin = pfColl->begin(),
 	   iend = pfColl->end(), i = ibegin; i != iend; ++i ){
      inputs.push_back( fastjet::PseudoJet(i->px(), i->py(), i->pz(), i->energy()) );
@@ -78,37 +78,40 @@ void NjettinessAdder::produce(edm::Event & iEvent, const edm::EventSetup & iSetu
   // read input collection
   edm::Handle<edm::View<reco::Jet> > jets;
   iEvent.getByToken(src_token_, jets);
-  
-  for ( std::vector<unsigned>::const_iterator n = Njets_.begin(); n != Njets_.end(); ++n )
-    {
-      std::ostringstream tauN_str;
-      tauN_str << "tau" << *n;
 
-      // prepare room for output
-      std::vector<float> tauN;
-      tauN.reserve(jets->size());
+  // prepare room for output
+  std::vector<std::vector<float> > tauN(Njets_.size());
+  for ( auto & taus : tauN ) taus.reserve(jets->size());
 
-      for ( typename edm::View<reco::Jet>::const_iterator jetIt = jets->begin() ; jetIt != jets->end() ; ++jetIt ) {
+  // the constituents of each jet are converted once for all the values of N
+  std::vector<fastjet::PseudoJet> FJparticles;
+  for ( typename edm::View<reco::Jet>::const_iterator jetIt = jets->begin() ; jetIt != jets->end() ; ++jetIt ) {
 
-	edm::Ptr<reco::Jet> jetPtr = jets->ptrAt(jetIt - jets->begin());
+    edm::Ptr<reco::Jet> jetPtr = jets->ptrAt(jetIt - jets->begin());
+    getConstituents( jetPtr, FJparticles );
 
-	float t=getTau( *n, jetPtr );
+    for ( unsigned i = 0; i < Njets_.size(); ++i )
+      tauN[i].push_back( getTau( Njets_[i], FJparticles ) );
+  }
 
-	tauN.push_back(t);
-      }
+  for ( unsigned i = 0; i < Njets_.size(); ++i )
+    {
+      std::ostringstream tauN_str;
+      tauN_str << "tau" << Njets_[i];
 
       auto outT = std::make_unique<edm::ValueMap<float>>();
       edm::ValueMap<float>::Filler fillerT(*outT);
-      fillerT.insert(jets, tauN.begin(), tauN.end());
+      fillerT.insert(jets, tauN[i].begin(), tauN[i].end());
       fillerT.fill();
 
       iEvent.put(std::move(outT),tauN_str.str());
     }
 }
 
-float NjettinessAdder::getTau(unsigned num, const edm::Ptr<reco::Jet> & object) const
+void NjettinessAdder::getConstituents(const edm::Ptr<reco::Jet> & object, std::vector<fastjet::PseudoJet> & FJparticles) const
 {
-  std::vector<fastjet::PseudoJet> FJparticles;
+  FJparticles.clear();
+  FJparticles.reserve(object->numberOfDaughters());
   for (unsigned k = 0; k < object->numberOfDaughters(); ++k)
     {
       const reco::CandidatePtr & dp = object->daughterPtr(k);
@@ -117,7 +120,10 @@ float NjettinessAdder::getTau(unsigned num, const edm::Ptr<reco::Jet> & object)
       else
 	edm::LogWarning("MissingJetConstituent") << "Jet constituent required for N-subjettiness computation is missing!";
     }
+}
 
+float NjettinessAdder::getTau(unsigned num, const std::vector<fastjet::PseudoJet> & FJparticles) const
+{
   return routine_->getTau(num, FJparticles); 
 }
 
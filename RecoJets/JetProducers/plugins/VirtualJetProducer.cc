@@ -318,6 +318,7 @@ void VirtualJetProducer::produce(edm::Event& iEvent,const edm::EventSetup& iSetu
       output( iEvent, iSetup );
       return;
     }
+    inputs_.reserve(inputsHandle->size());
     for (size_t i = 0; i < inputsHandle->size(); ++i) {
       inputs_.push_back(inputsHandle->ptrAt(i));
     }
@@ -332,6 +333,7 @@ void VirtualJetProducer::produce(edm::Event& iEvent,const edm::EventSetup& iSetu
 	output( iEvent, iSetup );
 	return;
       }
+      inputs_.reserve(pfinputsHandleAsFwdPtr->size());
       for (size_t i = 0; i < pfinputsHandleAsFwdPtr->size(); ++i) {
 	if ( (*pfinputsHandleAsFwdPtr)[i].ptr().isAvailable() ) {
 	  inputs_.push_back( (*pfinputsHandleAsFwdPtr)[i].ptr() );
@@ -345,6 +347,7 @@ void VirtualJetProducer::produce(edm::Event& iEvent,const edm::EventSetup& iSetu
 	output( iEvent, iSetup );
 	return;
       }
+      inputs_.reserve(packedinputsHandleAsFwdPtr->size());
       for (size_t i = 0; i < packedinputsHandleAsFwdPtr->size(); ++i) {
 	if ( (*packedinputsHandleAsFwdPtr)[i].ptr().isAvailable() ) {
 	  inputs_.push_back( (*packedinputsHandleAsFwdPtr)[i].ptr() );
@@ -358,6 +361,7 @@ void VirtualJetProducer::produce(edm::Event& iEvent,const edm::EventSetup& iSetu
 	output( iEvent, iSetup );
 	return;
       }
+      inputs_.reserve(geninputsHandleAsFwdPtr->size());
       for (size_t i = 0; i < geninputsHandleAsFwdPtr->size(); ++i) {
 	if ( (*geninputsHandleAsFwdPtr)[i].ptr().isAvailable() ) {
 	  inputs_.push_back( (*geninputsHandleAsFwdPtr)[i].ptr() );
@@ -371,6 +375,7 @@ void VirtualJetProducer::produce(edm::Event& iEvent,const edm::EventSetup& iSetu
 	output( iEvent, iSetup );
 	return;
       }
+      inputs_.reserve(packedgeninputsHandleAsFwdPtr->size());
       for (size_t i = 0; i < packedgeninputsHandleAsFwdPtr->size(); ++i) {
 	if ( (*packedgeninputsHandleAsFwdPtr)[i].ptr().isAvailable() ) {
 	  inputs_.push_back( (*packedgeninputsHandleAsFwdPtr)[i].ptr() );
@@ -608,10 +613,14 @@ void VirtualJetProducer::writeJets( edm::Event & iEvent, edm::EventSetup const&
   if (doRhoFastjet_) {
     // declare jet collection without the two jets, 
     // for unbiased background estimation.
+    // only copy the leading jets rather than the whole collection
     std::vector<fastjet::PseudoJet> fjexcluded_jets;
-    fjexcluded_jets=fjJets_;
-    
-    if(fjexcluded_jets.size()>2) fjexcluded_jets.resize(nExclude_);
+    if(fjJets_.size()>2) {
+      fjexcluded_jets.assign(fjJets_.begin(), fjJets_.begin()+std::min<size_t>(nExclude_,fjJets_.size()));
+      fjexcluded_jets.resize(nExclude_);
+    } else {
+      fjexcluded_jets=fjJets_;
+    }
     
     if(doFastJetNonUniform_){
       auto rhos = std::make_unique<std::vector<double>>();
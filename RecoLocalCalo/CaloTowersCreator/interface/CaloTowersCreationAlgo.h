@@ -122,6 +122,9 @@ public:
   // The key is the calotower id.
   void makeHcalDropChMap();
 
+  // forget the cached tower of each cell, to be called when the constituents map changes
+  void resetTowerIds();
+
   void makeEcalBadChs();
 
   void begin();
@@ -244,6 +247,9 @@ private:
 
   /// looks for a given tower in the internal cache.  If it can't find it, it makes it.
   MetaTower & find(const CaloTowerDetId & id);
+
+  /// tower of a cell, cached for the ECAL and HCAL cells by their dense index
+  CaloTowerDetId towerOf(const DetId & id);
   
   /// helper method to look up the appropriate threshold & weight
   void getThresholdAndWeight(const DetId & detId, double & threshold, double & weight) const;
@@ -343,9 +349,15 @@ private:
 
   // Number of channels in the tower that were not used in RecHit production (dead/off,...).
   // These channels are added to the other "bad" channels found in the recHit collection. 
-  typedef std::map<CaloTowerDetId, std::pair<short int,bool>> HcalDropChMap;
+  // Indexed by the dense index of the tower.
+  typedef std::vector<std::pair<short int,bool>> HcalDropChMap;
   HcalDropChMap hcalDropChMap;
 
+  // Raw id of the tower of each EB, EE and HCAL cell (EB, then EE, then HCAL
+  // dense indices), filled when the cell is first seen
+  static constexpr uint32_t kUnknownTower = 0xFFFFFFFF;
+  std::vector<uint32_t> theTowerIds;
+
   // Number of bad Ecal channel in each tower
   //unsigned short ecalBadChs[CaloTowerDetId::kSizeForDenseIndexing];
   std::vector<unsigned short> ecalBadChs;
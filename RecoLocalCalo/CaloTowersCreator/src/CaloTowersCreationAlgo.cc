@@ -5,6 +5,8 @@
 #include "Geometry/CaloGeometry/interface/CaloCellGeometry.h"
 #include "Geometry/CaloGeometry/interface/CaloSubdetectorGeometry.h"
 #include "Geometry/CaloGeometry/interface/CaloGeometry.h"
+#include "DataFormats/EcalDetId/interface/EBDetId.h"
+#include "DataFormats/EcalDetId/interface/EEDetId.h"
 #include "FWCore/MessageLogger/interface/MessageLogger.h"
 #include "Math/Interpolator.h"
 #include <cmath>
@@ -329,6 +331,16 @@ void CaloTowersCreationAlgo::setGeometry(const CaloTowerTopology* cttopo, const
   ecalBadChs.resize(theTowerTopology->sizeForDenseIndexing(),0);
 }
 
+void CaloTowersCreationAlgo::resetTowerIds() {
+  // without a topology the cells are not cached, towerOf then always asks the constituents map
+  if (theHcalTopology == nullptr) {
+    theTowerIds.clear();
+    return;
+  }
+  theTowerIds.assign(EBDetId::kSizeForDenseIndexing + EEDetId::kSizeForDenseIndexing + theHcalTopology->ncells(),
+		     kUnknownTower);
+}
+
 void CaloTowersCreationAlgo::begin() {
   theTowerMap.clear();
   theTowerMapSize=0;
@@ -542,7 +554,7 @@ void CaloTowersCreationAlgo::assignHitHcal(const CaloRecHit * recHit) {
     // bad channels are counted regardless of energy threshold
 
     if (chStatusForCT == CaloTowersCreationAlgo::BadChan) {
-      CaloTowerDetId towerDetId = theTowerConstituentsMap->towerOf(detId);
+      CaloTowerDetId towerDetId = towerOf(detId);
       if (towerDetId.null()) return;
       MetaTower & tower28 = find(towerDetId);
       CaloTowerDetId towerDetId29(towerDetId.ieta()+towerDetId.zside(),
@@ -554,7 +566,7 @@ void CaloTowersCreationAlgo::assignHitHcal(const CaloRecHit * recHit) {
 
     else if (0.5*energy >= threshold) {  // not bad channel: use energy if above threshold
       
-      CaloTowerDetId towerDetId = theTowerConstituentsMap->towerOf(detId);
+      CaloTowerDetId towerDetId = towerOf(detId);
       if (towerDetId.null()) return;
       MetaTower & tower28 = find(towerDetId);
       CaloTowerDetId towerDetId29(towerDetId.ieta()+towerDetId.zside(),
@@ -606,7 +618,7 @@ void CaloTowersCreationAlgo::assignHitHcal(const CaloRecHit * recHit) {
 
     if(hcalDetId.subdet() == HcalOuter) {
 
-      CaloTowerDetId towerDetId = theTowerConstituentsMap->towerOf(detId);
+      CaloTowerDetId towerDetId = towerOf(detId);
       if (towerDetId.null()) return;
       MetaTower & tower = find(towerDetId);
 
@@ -641,14 +653,14 @@ void CaloTowersCreationAlgo::assignHitHcal(const CaloRecHit * recHit) {
     else if(hcalDetId.subdet() == HcalForward) {
 
       if (chStatusForCT == CaloTowersCreationAlgo::BadChan) {
-        CaloTowerDetId towerDetId = theTowerConstituentsMap->towerOf(detId);
+        CaloTowerDetId towerDetId = towerOf(detId);
         if (towerDetId.null()) return;
         MetaTower & tower = find(towerDetId);
         tower.numBadHcalCells += 1;
       }
       
       else if (energy >= threshold)  {
-        CaloTowerDetId towerDetId = theTowerConstituentsMap->towerOf(detId);
+        CaloTowerDetId towerDetId = towerOf(detId);
         if (towerDetId.null()) return;
         MetaTower & tower = find(towerDetId);
 
@@ -686,13 +698,13 @@ void CaloTowersCreationAlgo::assignHitHcal(const CaloRecHit * recHit) {
     else {
       // HCAL situation normal in HB/HE
       if (chStatusForCT == CaloTowersCreationAlgo::BadChan) {
-        CaloTowerDetId towerDetId = theTowerConstituentsMap->towerOf(detId);
+        CaloTowerDetId towerDetId = towerOf(detId);
         if (towerDetId.null()) return;
         MetaTower & tower = find(towerDetId);
         tower.numBadHcalCells += 1;
       }
       else if (energy >= threshold) {
-        CaloTowerDetId towerDetId = theTowerConstituentsMap->towerOf(detId);
+        CaloTowerDetId towerDetId = towerOf(detId);
         if (towerDetId.null()) return;
         MetaTower & tower = find(towerDetId);
         tower.E_had += e;
@@ -781,7 +793,7 @@ void CaloTowersCreationAlgo::assignHitEcal(const EcalRecHit * recHit) {
     else  passEmThreshold = (energy >= threshold);
   }
 
-  CaloTowerDetId towerDetId = theTowerConstituentsMap->towerOf(detId);
+  CaloTowerDetId towerDetId = towerOf(detId);
   if (towerDetId.null()) return;
   MetaTower & tower = find(towerDetId);
 
@@ -838,7 +850,7 @@ void CaloTowersCreationAlgo::assignHitEcal(const EcalRecHit * recHit) {
 // Must be rewritten for full functionality.
 void CaloTowersCreationAlgo::rescale(const CaloTower * ct) {
   double threshold, weight;
-  CaloTowerDetId towerDetId = theTowerConstituentsMap->towerOf(ct->id());
+  CaloTowerDetId towerDetId = towerOf(ct->id());
   if (towerDetId.null()) return;
   MetaTower & tower = find(towerDetId);
 
@@ -897,6 +909,22 @@ CaloTowersCreationAlgo::MetaTower & CaloTowersCreationAlgo::find(const CaloTower
   return mt;
 }
 
+CaloTowerDetId CaloTowersCreationAlgo::towerOf(const DetId & id) {
+  uint32_t index = kUnknownTower;
+  if (id.det() == DetId::Ecal) {
+    if (id.subdetId() == EcalBarrel) index = EBDetId(id).hashedIndex();
+    else if (id.subdetId() == EcalEndcap) index = EBDetId::kSizeForDenseIndexing + EEDetId(id).hashedIndex();
+  } else if (id.det() == DetId::Hcal && theHcalTopology != nullptr) {
+    const uint32_t dense = theHcalTopology->detId2denseId(id);
+    if (dense < theHcalTopology->ncells())
+      index = EBDetId::kSizeForDenseIndexing + EEDetId::kSizeForDenseIndexing + dense;
+  }
+  if (index >= theTowerIds.size()) return theTowerConstituentsMap->towerOf(id);
+  uint32_t & tid = theTowerIds[index];
+  if (tid == kUnknownTower) tid = theTowerConstituentsMap->towerOf(id).rawId();
+  return CaloTowerDetId(tid);
+}
+
 
 void CaloTowersCreationAlgo::convert(const CaloTowerDetId& id, const MetaTower& mt,
                                      CaloTowerCollection & collection) 
@@ -943,8 +971,7 @@ void CaloTowersCreationAlgo::convert(const CaloTowerDetId& id, const MetaTower&
     if(metaContains.empty()) return;
 
     if (missingHcalRescaleFactorForEcal > 0 && E_had == 0 && E_em > 0) {
-        auto match = hcalDropChMap.find(id);
-        if (match != hcalDropChMap.end() && match->second.second) {
+        if (!hcalDropChMap.empty() && hcalDropChMap[theTowerTopology->denseIndex(id)].second) {
             E_had = missingHcalRescaleFactorForEcal * E_em;
             E += E_had;
         }
@@ -1117,8 +1144,7 @@ void CaloTowersCreationAlgo::convert(const CaloTowerDetId& id, const MetaTower&
     unsigned int numProbEcalChan = mt.numProbEcalCells;
 
     // now add dead/off/... channels not used in RecHit reconstruction for HCAL 
-    HcalDropChMap::iterator dropChItr = hcalDropChMap.find(id);
-    if (dropChItr != hcalDropChMap.end()) numBadHcalChan += dropChItr->second.first;
+    if (!hcalDropChMap.empty()) numBadHcalChan += hcalDropChMap[theTowerTopology->denseIndex(id)].first;
     
 
     // for ECAL the number of all bad channels is obtained here -----------------------
@@ -1614,7 +1640,7 @@ void CaloTowersCreationAlgo::makeHcalDropChMap() {
   // This method fills the map of number of dead channels for the calotower,
   // The key of the map is CaloTowerDetId.
   // By definition these channels are not going to be in the RecHit collections.
-  hcalDropChMap.clear();
+  hcalDropChMap.assign(theTowerTopology->sizeForDenseIndexing(),std::make_pair(0,false));
   std::vector<DetId> allChanInStatusCont = theHcalChStatus->getAllChannels();
 
 #ifdef EDM_ML_DEBUG
@@ -1627,9 +1653,10 @@ void CaloTowersCreationAlgo::makeHcalDropChMap() {
 
       DetId id = theHcalTopology->mergedDepthDetId(HcalDetId(*it));
       
-      CaloTowerDetId twrId = theTowerConstituentsMap->towerOf(id);
+      CaloTowerDetId twrId = towerOf(id);
+      if (twrId.null()) continue;
       
-      hcalDropChMap[twrId].first +=1;
+      hcalDropChMap[theTowerTopology->denseIndex(twrId)].first +=1;
       
       HcalDetId hid(*it);
 	  
@@ -1640,17 +1667,18 @@ void CaloTowersCreationAlgo::makeHcalDropChMap() {
 	bool merge = theHcalTopology->mergedDepth29(hid);
 	if (merge) {
           CaloTowerDetId twrId29(twrId.ieta()+twrId.zside(), twrId.iphi());
-          hcalDropChMap[twrId29].first +=1;
+          hcalDropChMap[theTowerTopology->denseIndex(twrId29)].first +=1;
 	}
       }
     }
   }
   // now I know how many bad channels, but I also need to know if there's any good ones
   if (missingHcalRescaleFactorForEcal > 0) {
-      for (auto & pair : hcalDropChMap) {
-          if (pair.second.first == 0) continue; // unexpected, but just in case
+      for (unsigned int ind = 0; ind < hcalDropChMap.size(); ++ind) {
+          auto & pair = hcalDropChMap[ind];
+          if (pair.first == 0) continue; // no dropped channel in this tower
           int ngood = 0, nbad = 0;
-          for (DetId id : theTowerConstituentsMap->constituentsOf(pair.first)) {
+          for (DetId id : theTowerConstituentsMap->constituentsOf(theTowerTopology->detIdFromDenseIndex(ind))) {
               if (id.det() != DetId::Hcal) continue;
               HcalDetId hid(id);
               if (hid.subdet() != HcalBarrel && hid.subdet() != HcalEndcap) continue;
@@ -1658,14 +1686,14 @@ void CaloTowersCreationAlgo::makeHcalDropChMap() {
               if (dbStatusFlag == 0 || ! theHcalSevLvlComputer->dropChannel(dbStatusFlag)) {
                   ngood += 1;
               } else {
-                  nbad += 1; // recount, since pair.second.first may include HO
+                  nbad += 1; // recount, since pair.first may include HO
               }
           }
           if (nbad > 0 && nbad >= ngood) {
               //uncomment for debug (may be useful to tune the criteria above)
-              //CaloTowerDetId id(pair.first);
+              //CaloTowerDetId id(theTowerTopology->detIdFromDenseIndex(ind));
               //std::cout << "CaloTower at ieta = " << id.ieta() << ", iphi " << id.iphi() << ": set Hcal as not efficient (ngood =" << ngood << ", nbad = " << nbad << ")" << std::endl;
-              pair.second.second = true;
+              pair.second = true;
           }
       }
   }
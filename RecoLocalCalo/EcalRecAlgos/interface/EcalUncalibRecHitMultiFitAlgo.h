@@ -13,6 +13,7 @@
 #include "CondFormats/EcalObjects/interface/EcalPedestals.h"
 #include "CondFormats/EcalObjects/interface/EcalGainRatios.h"
 #include "RecoLocalCalo/EcalRecAlgos/interface/PulseChiSqSNNLS.h"
+#include "RecoLocalCalo/EcalRecAlgos/interface/PulseChiSqBatch.h"
 
 
 #include "TMatrixDSym.h"
@@ -35,6 +36,14 @@ class EcalUncalibRecHitMultiFitAlgo
   void setAddPedestalUncertainty(double x) { _addPedestalUncertainty = x; }
   void setSimplifiedNoiseModelForGainSwitch(bool b) { _simplifiedNoiseModelForGainSwitch = b; }
   void setGainSwitchUseMaxSample(bool b) { _gainSwitchUseMaxSample = b; }
+  bool doPrefit() const { return _doPrefit; }
+
+  /// true if the prefit of the channel can be made in a PulseChiSqBatch (no gain switch and no dynamic pedestals)
+  bool batchablePrefit(const EcalDataFrame& dataFrame) const;
+  /// fills a lane of the batch with the samples, in-time pulse and covariance of the prefit of the channel
+  void fillPrefit(PulseChiSqBatch& batch, unsigned int lane, const EcalDataFrame& dataFrame, const EcalPedestals::Item * aped, const SampleMatrixGainArray &noisecors, const FullSampleVector &fullpulse, const FullSampleMatrix &fullpulsecov) const;
+  /// the rechit of makeRecHit from a lane of a fitted batch, false if the prefit chi2 is too large and the full fit is needed
+  bool prefitRecHit(const PulseChiSqBatch& batch, unsigned int lane, const EcalDataFrame& dataFrame, const EcalPedestals::Item * aped, EcalUncalibratedRecHit& rh) const;
   
  private:
    PulseChiSqSNNLS _pulsefunc;
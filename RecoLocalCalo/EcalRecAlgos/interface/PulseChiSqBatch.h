@@ -0,0 +1,45 @@
+#ifndef RecoLocalCalo_EcalRecAlgos_PulseChiSqBatch_h
+#define RecoLocalCalo_EcalRecAlgos_PulseChiSqBatch_h
+
+/** \class PulseChiSqBatch
+  *  One pulse (in-time) fit of PulseChiSqSNNLS, made for kLanes channels at once.
+  *  The samples, pulse template and covariance of the channels are stored
+  *  interleaved, element k of lane n at k*kLanes+n, so that every step of the
+  *  10x10 Cholesky decomposition and of the solution is a loop over the lanes
+  *  with compile-time bounds which the compiler vectorizes.
+  *
+  *  The result is that of PulseChiSqSNNLS::DoFit with the single bx 0, no
+  *  pedestal or step columns, one iteration and no error computation, i.e.
+  *  the prefit of EcalUncalibRecHitMultiFitAlgo.
+  */
+
+#include "RecoLocalCalo/EcalRecAlgos/interface/EigenMatrixTypes.h"
+
+class PulseChiSqBatch {
+ public:
+  static constexpr unsigned int kLanes = 8;
+  static constexpr unsigned int kSamples = SampleVectorSize;
+  static constexpr unsigned int kCovSize = kSamples*(kSamples+1)/2;
+
+  /// index of (i,j) in the packed lower triangle
+  static constexpr unsigned int cov(unsigned int i, unsigned int j) { return i>=j ? i*(i+1)/2+j : j*(j+1)/2+i; }
+
+  void setSample(unsigned int lane, unsigned int i, double x) { _samples[i*kLanes+lane] = x; }
+  void setPulse(unsigned int lane, unsigned int i, double x) { _pulse[i*kLanes+lane] = x; }
+  void setCov(unsigned int lane, unsigned int i, unsigned int j, double x) { _cov[cov(i,j)*kLanes+lane] = x; }
+
+  /// fits all the lanes, the ones not filled since the last fit are padded with a copy of lane 0
+  void fit(unsigned int nFilled);
+
+  double amplitude(unsigned int lane) const { return _amplitude[lane]; }
+  double chiSq(unsigned int lane) const { return _chisq[lane]; }
+
+ private:
+  alignas(64) double _samples[kSamples*kLanes];
+  alignas(64) double _pulse[kSamples*kLanes];
+  alignas(64) double _cov[kCovSize*kLanes];
+  alignas(64) double _amplitude[kLanes];
+  alignas(64) double _chisq[kLanes];
+};
+
+#endif
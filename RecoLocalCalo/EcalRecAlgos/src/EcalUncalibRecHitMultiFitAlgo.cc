@@ -5,6 +5,8 @@
 #include "CondFormats/EcalObjects/interface/EcalPedestals.h"
 #include "CondFormats/EcalObjects/interface/EcalGainRatios.h"
 
+#include <cmath>
+
 EcalUncalibRecHitMultiFitAlgo::EcalUncalibRecHitMultiFitAlgo() : 
   _computeErrors(true),
   _doPrefit(false),
@@ -225,3 +227,42 @@ EcalUncalibratedRecHit EcalUncalibRecHitMultiFitAlgo::makeRecHit(const EcalDataF
   return rh;
 }
 
+
+bool EcalUncalibRecHitMultiFitAlgo::batchablePrefit(const EcalDataFrame& dataFrame) const {
+  bool hasGainSwitch = dataFrame.isSaturated() || dataFrame.hasSwitchToGain6() || dataFrame.hasSwitchToGain1();
+  return _doPrefit && !hasGainSwitch && !_dynamicPedestals;
+}
+
+void EcalUncalibRecHitMultiFitAlgo::fillPrefit(PulseChiSqBatch& batch, unsigned int lane, const EcalDataFrame& dataFrame, const EcalPedestals::Item * aped, const SampleMatrixGainArray &noisecors, const FullSampleVector &fullpulse, const FullSampleMatrix &fullpulsecov) const {
+
+  // as in makeRecHit for a channel in gain 12 with static pedestal
+  const unsigned int nsample = EcalDataFrame::MAXSAMPLES;
+  const unsigned int iSampleMax = 5;
+  for(unsigned int iSample = 0; iSample < nsample; iSample++) {
+    batch.setSample(lane, iSample, (double)(dataFrame.sample(iSample).adc()) - aped->mean_x12);
+  }
+  
+  // pulse of bx 0, and covariance of PulseChiSqSNNLS::updateCov with the initial amplitude, the maximum sample
+  const double ampsq = std::pow((double)(dataFrame.sample(iSampleMax).adc()) - aped->mean_x12, 2);
+  const double pedsq = _addPedestalUncertainty>0. ? _addPedestalUncertainty*_addPedestalUncertainty : 0.;
+  const unsigned int firstsamplet = 3;
+  const unsigned int offset = 4;
+  for(unsigned int i = 0; i < nsample; i++) {
+    batch.setPulse(lane, i, fullpulse.coeff(i+offset));
+    for(unsigned int j = 0; j <= i; j++) {
+      double c = aped->rms_x12*aped->rms_x12*noisecors[0].coeff(i,j) + pedsq;
+      if (ampsq!=0. && j>=firstsamplet) c += ampsq*fullpulsecov.coeff(i+offset,j+offset);
+      batch.setCov(lane, i, j, c);
+    }
+  }
+}
+
+bool EcalUncalibRecHitMultiFitAlgo::prefitRecHit(const PulseChiSqBatch& batch, unsigned int lane, const EcalDataFrame& dataFrame, const EcalPedestals::Item * aped, EcalUncalibratedRecHit& rh) const {
+  const double chisq = batch.chiSq(lane);
+  if (!(chisq < _prefitMaxChiSq)) return false;
+
+  uint32_t flags = 0;
+  rh = EcalUncalibratedRecHit( dataFrame.id(), batch.amplitude(lane), aped->mean_x12, 0., chisq, flags );
+  rh.setAmplitudeError(0.);
+  return true;
+}
@@ -0,0 +1,69 @@
+#include "RecoLocalCalo/EcalRecAlgos/interface/PulseChiSqBatch.h"
+
+#include <algorithm>
+#include <cmath>
+
+void PulseChiSqBatch::fit(unsigned int nFilled) {
+  constexpr unsigned int N = kLanes;
+  constexpr unsigned int S = kSamples;
+
+  for (unsigned int lane=nFilled; lane<N; ++lane) {
+    for (unsigned int i=0; i<S; ++i) {
+      _samples[i*N+lane] = _samples[i*N];
+      _pulse[i*N+lane] = _pulse[i*N];
+    }
+    for (unsigned int k=0; k<kCovSize; ++k) _cov[k*N+lane] = _cov[k*N];
+  }
+
+  // Cholesky decomposition cov = L L^T, in place
+  double * __restrict__ L = _cov;
+  alignas(64) double invdiag[S*N];
+  for (unsigned int j=0; j<S; ++j) {
+    for (unsigned int k=0; k<j; ++k)
+      for (unsigned int n=0; n<N; ++n) L[cov(j,j)*N+n] -= L[cov(j,k)*N+n]*L[cov(j,k)*N+n];
+    for (unsigned int n=0; n<N; ++n) {
+      L[cov(j,j)*N+n] = std::sqrt(L[cov(j,j)*N+n]);
+      invdiag[j*N+n] = 1./L[cov(j,j)*N+n];
+    }
+    for (unsigned int i=j+1; i<S; ++i) {
+      for (unsigned int k=0; k<j; ++k)
+        for (unsigned int n=0; n<N; ++n) L[cov(i,j)*N+n] -= L[cov(i,k)*N+n]*L[cov(j,k)*N+n];
+      for (unsigned int n=0; n<N; ++n) L[cov(i,j)*N+n] *= invdiag[j*N+n];
+    }
+  }
+
+  // L^-1 pulse and L^-1 samples
+  alignas(64) double yp[S*N];
+  alignas(64) double ys[S*N];
+  for (unsigned int i=0; i<S; ++i) {
+    for (unsigned int n=0; n<N; ++n) {
+      yp[i*N+n] = _pulse[i*N+n];
+      ys[i*N+n] = _samples[i*N+n];
+    }
+    for (unsigned int k=0; k<i; ++k)
+      for (unsigned int n=0; n<N; ++n) {
+        yp[i*N+n] -= L[cov(i,k)*N+n]*yp[k*N+n];
+        ys[i*N+n] -= L[cov(i,k)*N+n]*ys[k*N+n];
+      }
+    for (unsigned int n=0; n<N; ++n) {
+      yp[i*N+n] *= invdiag[i*N+n];
+      ys[i*N+n] *= invdiag[i*N+n];
+    }
+  }
+
+  // non negative amplitude and chi2 = |L^-1 (pulse*amplitude - samples)|^2
+  alignas(64) double aTa[N];
+  alignas(64) double aTb[N];
+  for (unsigned int n=0; n<N; ++n) { aTa[n] = 0.; aTb[n] = 0.; _chisq[n] = 0.; }
+  for (unsigned int i=0; i<S; ++i)
+    for (unsigned int n=0; n<N; ++n) {
+      aTa[n] += yp[i*N+n]*yp[i*N+n];
+      aTb[n] += yp[i*N+n]*ys[i*N+n];
+    }
+  for (unsigned int n=0; n<N; ++n) _amplitude[n] = std::max(0.,aTb[n]/aTa[n]);
+  for (unsigned int i=0; i<S; ++i)
+    for (unsigned int n=0; n<N; ++n) {
+      double r = yp[i*N+n]*_amplitude[n] - ys[i*N+n];
+      _chisq[n] += r*r;
+    }
+}
@@ -22,6 +22,9 @@
 #include <FWCore/ParameterSet/interface/ParameterSetDescription.h>
 #include <FWCore/ParameterSet/interface/EmptyGroupDescription.h>
 
+#include <array>
+#include <vector>
+
 EcalUncalibRecHitWorkerMultiFit::EcalUncalibRecHitWorkerMultiFit(const edm::ParameterSet&ps,edm::ConsumesCollector& c) :
   EcalUncalibRecHitWorkerBaseClass(ps,c)
 {
@@ -284,8 +287,65 @@ EcalUncalibRecHitWorkerMultiFit::run( const edm::Event & evt,
     FullSampleVector fullpulse(FullSampleVector::Zero());
     FullSampleMatrix fullpulsecov(FullSampleMatrix::Zero());
 
+    // the prefits of the channels without gain switch are made first, PulseChiSqBatch::kLanes at a time;
+    // for each digi 0 = not prefitted, 1 = prefit too bad (full fit needed), 2 = prefit rechit in prefitHits
+    std::vector<char> prefitStatus;
+    std::vector<EcalUncalibratedRecHit> prefitHits;
+    if (multiFitMethod_.doPrefit()) {
+        prefitStatus.assign(digis.size(), 0);
+        prefitHits.resize(digis.size());
+
+        PulseChiSqBatch batch;
+        std::array<unsigned int, PulseChiSqBatch::kLanes> laneDigi;
+        std::array<const EcalPedestals::Item *, PulseChiSqBatch::kLanes> lanePed;
+        unsigned int nLanes = 0;
+        auto fitBatch = [&]() {
+            batch.fit(nLanes);
+            for (unsigned int lane = 0; lane < nLanes; ++lane) {
+                unsigned int idg = laneDigi[lane];
+                bool good = multiFitMethod_.prefitRecHit(batch, lane, digis[idg], lanePed[lane], prefitHits[idg]);
+                prefitStatus[idg] = good ? 2 : 1;
+            }
+            nLanes = 0;
+        };
+
+        unsigned int idg = 0;
+        for (auto itdg = digis.begin(); itdg != digis.end(); ++itdg, ++idg) {
+            if (!multiFitMethod_.batchablePrefit(*itdg)) continue;
+
+            DetId detid(itdg->id());
+            const EcalPedestals::Item * aped = nullptr;
+            const EcalPulseShapes::Item * aPulse = nullptr;
+            const EcalPulseCovariances::Item * aPulseCov = nullptr;
+            if (barrel) {
+                unsigned int hashedIndex = EBDetId(detid).hashedIndex();
+                aped       = &peds->barrel(hashedIndex);
+                aPulse     = &pulseshapes->barrel(hashedIndex);
+                aPulseCov  = &pulsecovariances->barrel(hashedIndex);
+            } else {
+                unsigned int hashedIndex = EEDetId(detid).hashedIndex();
+                aped       = &peds->endcap(hashedIndex);
+                aPulse     = &pulseshapes->endcap(hashedIndex);
+                aPulseCov  = &pulsecovariances->endcap(hashedIndex);
+            }
+
+            for (int i=0; i<EcalPulseShape::TEMPLATESAMPLES; ++i)
+                fullpulse(i+7) = aPulse->pdfval[i];
+            for(int i=0; i<EcalPulseShape::TEMPLATESAMPLES;i++)
+            for(int j=0; j<EcalPulseShape::TEMPLATESAMPLES;j++)
+                fullpulsecov(i+7,j+7) = aPulseCov->covval[i][j];
+
+            multiFitMethod_.fillPrefit(batch, nLanes, *itdg, aped, noisecor(barrel), fullpulse, fullpulsecov);
+            laneDigi[nLanes] = idg;
+            lanePed[nLanes] = aped;
+            if (++nLanes == PulseChiSqBatch::kLanes) fitBatch();
+        }
+        if (nLanes > 0) fitBatch();
+    }
+
     result.reserve(result.size() + digis.size());
-    for (auto itdg = digis.begin(); itdg != digis.end(); ++itdg)
+    unsigned int idg = 0;
+    for (auto itdg = digis.begin(); itdg != digis.end(); ++itdg, ++idg)
     {
         DetId detid(itdg->id());
 
@@ -371,7 +431,16 @@ EcalUncalibRecHitWorkerMultiFit::run( const edm::Event & evt,
             // multifit
             const SampleMatrixGainArray &noisecors = noisecor(barrel);
             
-            result.push_back(multiFitMethod_.makeRecHit(*itdg, aped, aGain, noisecors, fullpulse, fullpulsecov, activeBX));
+            if (!prefitStatus.empty() && prefitStatus[idg] == 2) {
+                result.push_back(prefitHits[idg]);
+            } else if (!prefitStatus.empty() && prefitStatus[idg] == 1) {
+                // the prefit was already made above, go straight to the full fit
+                multiFitMethod_.setDoPrefit(false);
+                result.push_back(multiFitMethod_.makeRecHit(*itdg, aped, aGain, noisecors, fullpulse, fullpulsecov, activeBX));
+                multiFitMethod_.setDoPrefit(true);
+            } else {
+                result.push_back(multiFitMethod_.makeRecHit(*itdg, aped, aGain, noisecors, fullpulse, fullpulsecov, activeBX));
+            }
             auto & uncalibRecHit = result.back();
             
             // === time computation ===
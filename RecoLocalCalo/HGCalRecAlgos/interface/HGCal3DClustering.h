@@ -12,8 +12,7 @@
 #include "RecoLocalCalo/HGCalRecAlgos/interface/RecHitTools.h"
 #include "RecoLocalCalo/HGCalRecAlgos/interface/ClusterTools.h"
 #include "RecoLocalCalo/HGCalRecAlgos/interface/HGCalImagingAlgo.h"
-
-#include "KDTreeLinkerAlgoT.h"
+#include "RecoLocalCalo/HGCalRecAlgos/interface/HGCalLayerTiles.h"
 
 class HGCal3DClustering
 {
@@ -26,9 +25,8 @@ public:
  HGCal3DClustering(const edm::ParameterSet& conf, edm::ConsumesCollector& sumes, const std::vector<double>& radii_in, uint32_t min_clusters) :
   radii(radii_in),
   minClusters(min_clusters),
-  points(2*(maxlayer+1)),
-  minpos(2*(maxlayer+1),{ {0.0f,0.0f} }),
-  maxpos(2*(maxlayer+1),{ {0.0f,0.0f} }),
+  layerClusters(2*(maxlayer+1)),
+  tiles(2*(maxlayer+1)),
   es(0),
   zees(2*(maxlayer+1),0.),
   clusterTools(std::make_unique<hgcal::ClusterTools>(conf,sumes))
@@ -50,17 +48,13 @@ private:
 
   void organizeByLayer(const reco::HGCalMultiCluster::ClusterCollection &);
   void reset(){
-    for( auto& it: points)
+    for( auto& it: layerClusters)
       {
-        it.clear();
-        std::vector<KDNode>().swap(it);
+        it.ind.clear();
+        it.x.clear();
+        it.y.clear();
       }
     std::fill(zees.begin(), zees.end(), 0.);
-    for(unsigned int i = 0; i < minpos.size(); i++)
-      {
-	minpos[i][0]=0.;minpos[i][1]=0.;
-	maxpos[i][0]=0.;maxpos[i][1]=0.;
-      }
   }
   void layerIntersection(std::array<double,3> &to, const std::array<double,3> &from) const;
 
@@ -69,18 +63,16 @@ private:
 
   std::vector<double> radii;
   uint32_t minClusters;
-  struct ClusterRef {
-    int ind;
-    float z;
-    ClusterRef(int ind_i, float z_i): ind(ind_i),z(z_i){}
-    ClusterRef(): ind(-1),z(0.){}
+  struct ClustersOnLayer {
+    std::vector<int> ind; /*!< index of the clusters in the sorted list es. */
+    std::vector<float> x;
+    std::vector<float> y;
   };
+  /// links the clusters of one endcap, seeded in the order of es, and returns the multiclusters with the index of their seed
+  std::vector<std::pair<unsigned int, reco::HGCalMultiCluster> > linkEndcap(const reco::HGCalMultiCluster::ClusterCollection &, bool positiveZ, std::vector<int> &vused) const;
 
-  typedef KDTreeLinkerAlgo<ClusterRef,2> KDTree;
-  typedef KDTreeNodeInfoT<ClusterRef,2> KDNode;
-  std::vector< std::vector<KDNode> > points;
-  std::vector<std::array<float,2> > minpos;
-  std::vector<std::array<float,2> > maxpos;
+  std::vector<ClustersOnLayer> layerClusters; /*!< clusters of each layer, the layers of the positive endcap are after those of the negative one. */
+  std::vector<HGCalLayerTiles> tiles; /*!< tiles indexing layerClusters, filled at each call. */
   std::vector<size_t> es; /*!< vector to contain sorted indices of all clusters. */
   std::vector<float> zees; /*!< vector to contain z position of each layer. */
   std::unique_ptr<hgcal::ClusterTools> clusterTools; /*!< instance of tools to simplify cluster access. */
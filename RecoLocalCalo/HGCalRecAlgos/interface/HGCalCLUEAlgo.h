@@ -0,0 +1,122 @@
+#ifndef RecoLocalCalo_HGCalRecAlgos_HGCalCLUEAlgo_h
+#define RecoLocalCalo_HGCalRecAlgos_HGCalCLUEAlgo_h
+
+#include "DataFormats/DetId/interface/DetId.h"
+#include "DataFormats/HGCRecHit/interface/HGCRecHitCollections.h"
+#include "DataFormats/EgammaReco/interface/BasicCluster.h"
+
+#include "RecoLocalCalo/HGCalRecAlgos/interface/RecHitTools.h"
+#include "RecoLocalCalo/HGCalRecAlgos/interface/HGCalClusteringAlgoBase.h"
+#include "RecoLocalCalo/HGCalRecAlgos/interface/HGCalLayerTiles.h"
+
+// C/C++ headers
+#include <vector>
+
+/** Density based clustering of the HGCal layers, with the same local density rho
+ *  and distance to the nearest higher density cell delta as HGCalImagingAlgo.
+ *  The neighbours are found on a fixed grid of tiles per layer (HGCalLayerTiles)
+ *  instead of KD trees and the cells are stored as a structure of arrays, so that
+ *  rho and delta are computed independently for each cell, in parallel over the
+ *  layers and over the cells of a layer.
+ *
+ *  The nearest higher is only searched within outlierDeltaFactor times the critical
+ *  distance delta_c: a cell without a higher density cell there is a seed if its
+ *  density is above the threshold and an outlier otherwise. All the other cells
+ *  follow their nearest higher, the clusters have no halo and the energy sharing
+ *  (getClusters(true)) is not supported.
+ */
+class HGCalCLUEAlgo : public HGCalClusteringAlgoBase
+{
+
+public:
+
+  HGCalCLUEAlgo(const std::vector<double>& vecDeltas_in, double kappa_in, double ecut_in,
+                double outlierDeltaFactor_in,
+                reco::CaloCluster::AlgoId algoId_in,
+                bool dependSensor_in,
+                const std::vector<double>& dEdXweights_in,
+                const std::vector<double>& thicknessCorrection_in,
+                const std::vector<double>& fcPerMip_in,
+                double fcPerEle_in,
+                const std::vector<double>& nonAgedNoises_in,
+                double noiseMip_in,
+                VerbosityLevel the_verbosity = pERROR);
+
+  ~HGCalCLUEAlgo() override {}
+
+  void populate(const HGCRecHitCollection &hits) override;
+  void makeClusters() override;
+  std::vector<reco::BasicCluster> getClusters(bool) override;
+  void getEventSetup(const edm::EventSetup& es) override {
+    rhtools_.getEventSetup(es);
+  }
+  void reset() override;
+
+  void computeThreshold();
+
+private:
+
+  struct CellsOnLayer {
+    std::vector<DetId> detid;
+    std::vector<float> x;
+    std::vector<float> y;
+    std::vector<float> z;
+    std::vector<float> weight;
+    std::vector<float> sigmaNoise;
+
+    std::vector<float> rho;
+    std::vector<float> delta;
+    std::vector<int> nearestHigher;
+    std::vector<int> clusterIndex;
+
+    void clear() {
+      detid.clear(); x.clear(); y.clear(); z.clear(); weight.clear(); sigmaNoise.clear();
+      rho.clear(); delta.clear(); nearestHigher.clear(); clusterIndex.clear();
+    }
+  };
+
+  float criticalDistance(unsigned int layerId) const;
+  // total order of the cells of a layer by density, the index breaks the ties
+  static bool isHigher(const CellsOnLayer& cells, int j, int i) {
+    return cells.rho[j] > cells.rho[i] || (cells.rho[j] == cells.rho[i] && j < i);
+  }
+  float calculateLocalDensity(const HGCalLayerTiles&, unsigned int layerId, float delta_c);   //return max density
+  void calculateDistanceToHigher(const HGCalLayerTiles&, unsigned int layerId, float delta_c);
+  int findAndAssignClusters(unsigned int layerId, float delta_c, float maxdensity);
+
+  // the two parameters used to identify clusters
+  std::vector<double> vecDeltas_;
+  double kappa_;
+
+  // the hit energy cutoff
+  double ecut_;
+
+  // range of the nearest higher search, in units of delta_c
+  double outlierDeltaFactor_;
+
+  hgcal::RecHitTools rhtools_;
+
+  // the algo id
+  reco::CaloCluster::AlgoId algoId_;
+
+  // various parameters used for calculating the noise levels for a given sensor (and whether to use them)
+  bool dependSensor_;
+  std::vector<double> dEdXweights_;
+  std::vector<double> thicknessCorrection_;
+  std::vector<double> fcPerMip_;
+  double fcPerEle_;
+  std::vector<double> nonAgedNoises_;
+  double noiseMip_;
+  std::vector<std::vector<double> > thresholds_;
+  std::vector<std::vector<double> > v_sigmaNoise_;
+
+  // initialization bool
+  bool initialized_;
+
+  // the cells of each layer, the layers of the positive endcap are after those of the negative one
+  std::vector<CellsOnLayer> cells_;
+  std::vector<int> numberOfClustersPerLayer_;
+
+};
+
+#endif
@@ -0,0 +1,49 @@
+#ifndef RecoLocalCalo_HGCalRecAlgos_HGCalClusteringAlgoBase_h
+#define RecoLocalCalo_HGCalRecAlgos_HGCalClusteringAlgoBase_h
+
+#include "FWCore/Framework/interface/EventSetup.h"
+#include "DataFormats/HGCRecHit/interface/HGCRecHitCollections.h"
+#include "DataFormats/EgammaReco/interface/BasicCluster.h"
+
+// C/C++ headers
+#include <vector>
+
+// interface of the algorithms making the 2D clusters of the HGCal layers,
+// used by HGCalLayerClusterProducer
+class HGCalClusteringAlgoBase
+{
+
+public:
+
+  enum VerbosityLevel { pDEBUG = 0, pWARNING = 1, pINFO = 2, pERROR = 3 };
+
+  virtual ~HGCalClusteringAlgoBase() {}
+
+  virtual void populate(const HGCRecHitCollection &hits) = 0;
+  virtual void makeClusters() = 0;
+  virtual std::vector<reco::BasicCluster> getClusters(bool) = 0;
+  virtual void getEventSetup(const edm::EventSetup& es) = 0;
+  virtual void reset() = 0;
+
+  void setVerbosity(VerbosityLevel the_verbosity)
+  {
+    verbosity_ = the_verbosity;
+  }
+
+  //max number of layers
+  static const unsigned int maxlayer = 52;
+
+protected:
+
+  HGCalClusteringAlgoBase(VerbosityLevel the_verbosity) : verbosity_(the_verbosity) {}
+
+  // last layer per subdetector
+  static const unsigned int lastLayerEE = 28;
+  static const unsigned int lastLayerFH = 40;
+
+  // The verbosity level
+  VerbosityLevel verbosity_;
+
+};
+
+#endif
@@ -15,6 +15,7 @@
 #include "DataFormats/EgammaReco/interface/BasicCluster.h"
 
 #include "RecoLocalCalo/HGCalRecAlgos/interface/RecHitTools.h"
+#include "RecoLocalCalo/HGCalRecAlgos/interface/HGCalClusteringAlgoBase.h"
 
 // C/C++ headers
 #include <string>
@@ -41,18 +42,16 @@ std::vector<size_t> sorted_indices(const std::vector<T> &v) {
         return idx;
 }
 
-class HGCalImagingAlgo
+class HGCalImagingAlgo : public HGCalClusteringAlgoBase
 {
 
 
 public:
 
-enum VerbosityLevel { pDEBUG = 0, pWARNING = 1, pINFO = 2, pERROR = 3 };
-
-HGCalImagingAlgo() : vecDeltas_(), kappa_(1.), ecut_(0.),
+HGCalImagingAlgo() : HGCalClusteringAlgoBase(pERROR), vecDeltas_(), kappa_(1.), ecut_(0.),
         sigma2_(1.0),
         algoId_(reco::CaloCluster::undefined),
-        verbosity_(pERROR),initialized_(false){
+        initialized_(false){
 }
 
 HGCalImagingAlgo(const std::vector<double>& vecDeltas_in, double kappa_in, double ecut_in,
@@ -64,7 +63,7 @@ HGCalImagingAlgo(const std::vector<double>& vecDeltas_in, double kappa_in, doubl
                  double fcPerEle_in,
                  const std::vector<double>& nonAgedNoises_in,
                  double noiseMip_in,
-                 VerbosityLevel the_verbosity = pERROR) :
+                 VerbosityLevel the_verbosity = pERROR) : HGCalClusteringAlgoBase(the_verbosity),
         vecDeltas_(vecDeltas_in), kappa_(kappa_in),
         ecut_(ecut_in),
         sigma2_(1.0),
@@ -76,7 +75,6 @@ HGCalImagingAlgo(const std::vector<double>& vecDeltas_in, double kappa_in, doubl
         fcPerEle_(fcPerEle_in),
         nonAgedNoises_(nonAgedNoises_in),
         noiseMip_(noiseMip_in),
-        verbosity_(the_verbosity),
         initialized_(false),
         points_(2*(maxlayer+1)),
         minpos_(2*(maxlayer+1),{
@@ -96,7 +94,8 @@ HGCalImagingAlgo(const std::vector<double>& vecDeltas_in, double kappa_in, doubl
                  double fcPerEle_in,
                  const std::vector<double>& nonAgedNoises_in,
                  double noiseMip_in,
-                 VerbosityLevel the_verbosity = pERROR) : vecDeltas_(vecDeltas_in), kappa_(kappa_in),
+                 VerbosityLevel the_verbosity = pERROR) : HGCalClusteringAlgoBase(the_verbosity),
+        vecDeltas_(vecDeltas_in), kappa_(kappa_in),
         ecut_(ecut_in),
         sigma2_(std::pow(showerSigma,2.0)),
         algoId_(algoId_in),
@@ -107,7 +106,6 @@ HGCalImagingAlgo(const std::vector<double>& vecDeltas_in, double kappa_in, doubl
         fcPerEle_(fcPerEle_in),
         nonAgedNoises_(nonAgedNoises_in),
         noiseMip_(noiseMip_in),
-        verbosity_(the_verbosity),
         initialized_(false),
         points_(2*(maxlayer+1)),
 	minpos_(2*(maxlayer+1),{
@@ -117,27 +115,22 @@ HGCalImagingAlgo(const std::vector<double>& vecDeltas_in, double kappa_in, doubl
 {
 }
 
-virtual ~HGCalImagingAlgo()
-{
-}
-
-void setVerbosity(VerbosityLevel the_verbosity)
+~HGCalImagingAlgo() override
 {
-        verbosity_ = the_verbosity;
 }
 
-void populate(const HGCRecHitCollection &hits);
+void populate(const HGCRecHitCollection &hits) override;
 // this is the method that will start the clusterisation (it is possible to invoke this method more than once - but make sure it is with
 // different hit collections (or else use reset)
-void makeClusters();
+void makeClusters() override;
 // this is the method to get the cluster collection out
-std::vector<reco::BasicCluster> getClusters(bool);
+std::vector<reco::BasicCluster> getClusters(bool) override;
 // needed to switch between EE and HE with the same algorithm object (to get a single cluster collection)
-void getEventSetup(const edm::EventSetup& es){
+void getEventSetup(const edm::EventSetup& es) override {
         rhtools_.getEventSetup(es);
 }
 // use this if you want to reuse the same cluster object but don't want to accumulate clusters (hardly useful?)
-void reset(){
+void reset() override {
         clusters_v_.clear();
         layerClustersPerLayer_.clear();
         for( auto& it: points_)
@@ -156,14 +149,7 @@ void computeThreshold();
 /// point in the space
 typedef math::XYZPoint Point;
 
-//max number of layers
-static const unsigned int maxlayer = 52;
-
-
 private:
-// last layer per subdetector
-static const unsigned int lastLayerEE = 28;
-static const unsigned int lastLayerFH = 40;
 
 // The two parameters used to identify clusters
 std::vector<double> vecDeltas_;
@@ -194,9 +180,6 @@ double noiseMip_;
 std::vector<std::vector<double> > thresholds_;
 std::vector<std::vector<double> > v_sigmaNoise_;
 
-// The verbosity level
-VerbosityLevel verbosity_;
-
 // initialization bool
 bool initialized_;
 
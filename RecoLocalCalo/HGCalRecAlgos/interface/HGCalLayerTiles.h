@@ -0,0 +1,80 @@
+#ifndef RecoLocalCalo_HGCalRecAlgos_HGCalLayerTiles_h
+#define RecoLocalCalo_HGCalRecAlgos_HGCalLayerTiles_h
+
+// C/C++ headers
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <vector>
+
+// fixed grid of square tiles covering a HGCal layer in x-y, the indices of the
+// cells of each tile are stored contiguously (compressed sparse rows), so that
+// the grid is two flat arrays of integers
+class HGCalLayerTiles
+{
+
+public:
+
+  static constexpr float minX = -285.f;
+  static constexpr float maxX = 285.f;
+  static constexpr float minY = -285.f;
+  static constexpr float maxY = 285.f;
+  static constexpr float tileSize = 5.f;
+  static constexpr int nColumns = 114; // (maxX-minX)/tileSize
+  static constexpr int nRows = 114;    // (maxY-minY)/tileSize
+  static constexpr int nTiles = nColumns*nRows;
+
+  HGCalLayerTiles() : offsets_(nTiles+1, 0) {}
+
+  // bin the cells of coordinates x and y, the cells outside the grid go to the border tiles
+  void fill(const std::vector<float>& x, const std::vector<float>& y)
+  {
+    std::vector<int> bins(x.size());
+    std::fill(offsets_.begin(), offsets_.end(), 0);
+    for (unsigned int i = 0; i < x.size(); ++i) {
+      bins[i] = getGlobalBinByBin(getXBin(x[i]), getYBin(y[i]));
+      ++offsets_[bins[i]+1];
+    }
+    for (int bin = 0; bin < nTiles; ++bin)
+      offsets_[bin+1] += offsets_[bin];
+    cells_.resize(x.size());
+    std::vector<int> next(offsets_.begin(), offsets_.end()-1);
+    for (unsigned int i = 0; i < x.size(); ++i)
+      cells_[next[bins[i]]++] = i;
+  }
+
+  int getXBin(float x) const
+  {
+    int xBin = std::floor((x-minX)/tileSize);
+    return std::min(std::max(xBin, 0), nColumns-1);
+  }
+
+  int getYBin(float y) const
+  {
+    int yBin = std::floor((y-minY)/tileSize);
+    return std::min(std::max(yBin, 0), nRows-1);
+  }
+
+  int getGlobalBinByBin(int xBin, int yBin) const
+  {
+    return xBin + yBin*nColumns;
+  }
+
+  // first and last x bins, then first and last y bins, of the tiles overlapping a box
+  std::array<int,4> searchBox(float xMin, float xMax, float yMin, float yMax) const
+  {
+    return std::array<int,4>{{ getXBin(xMin), getXBin(xMax), getYBin(yMin), getYBin(yMax) }};
+  }
+
+  // range of the indices of the cells in a tile
+  const int* begin(int globalBin) const { return cells_.data() + offsets_[globalBin]; }
+  const int* end(int globalBin) const { return cells_.data() + offsets_[globalBin+1]; }
+
+private:
+
+  std::vector<int> offsets_;
+  std::vector<int> cells_;
+
+};
+
+#endif
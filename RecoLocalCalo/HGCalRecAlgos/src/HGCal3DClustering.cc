@@ -1,6 +1,9 @@
 #include "RecoLocalCalo/HGCalRecAlgos/interface/HGCal3DClustering.h"
 #include "DataFormats/Math/interface/deltaR.h"
 
+#include "tbb/task_arena.h"
+#include "tbb/tbb.h"
+
 
 namespace {
   std::vector<size_t> sorted_indices(const reco::HGCalMultiCluster::ClusterCollection& v) {
@@ -28,23 +31,14 @@ void HGCal3DClustering::organizeByLayer(const reco::HGCalMultiCluster::ClusterCo
   for(unsigned int i = 0; i < es_size; ++i) {
      int layer = rhtools_.getLayerWithOffset(thecls[es[i]]->hitsAndFractions()[0].first);
     layer += int(thecls[es[i]]->z()>0)*(maxlayer+1);
-    float x = thecls[es[i]]->x();
-    float y = thecls[es[i]]->y();
     float z = thecls[es[i]]->z();
-    points[layer].emplace_back(ClusterRef(i,z),x,y);
+    layerClusters[layer].ind.push_back(i);
+    layerClusters[layer].x.push_back(thecls[es[i]]->x());
+    layerClusters[layer].y.push_back(thecls[es[i]]->y());
     if(zees[layer]==0.) {
       // At least one cluster for layer at z
       zees[layer] = z;
     }
-    if(points[layer].empty()){
-      minpos[layer][0] = x; minpos[layer][1] = y;
-      maxpos[layer][0] = x; maxpos[layer][1] = y;
-    }else{
-      minpos[layer][0] = std::min(x,minpos[layer][0]);
-      minpos[layer][1] = std::min(y,minpos[layer][1]);
-      maxpos[layer][0] = std::max(x,maxpos[layer][0]);
-      maxpos[layer][1] = std::max(y,maxpos[layer][1]);
-    }
   }
 }
 std::vector<reco::HGCalMultiCluster> HGCal3DClustering::makeClusters(const reco::HGCalMultiCluster::ClusterCollection &thecls) {
@@ -52,22 +46,48 @@ std::vector<reco::HGCalMultiCluster> HGCal3DClustering::makeClusters(const reco:
   organizeByLayer(thecls);
   std::vector<reco::HGCalMultiCluster> thePreClusters;
 
-  std::vector<KDTree> hit_kdtree(2*(maxlayer+1));
-  for (unsigned int i = 0; i <= 2*maxlayer+1; ++i) {
-    KDTreeBox bounds(minpos[i][0],maxpos[i][0],
-		     minpos[i][1],maxpos[i][1]);
-    hit_kdtree[i].build(points[i],bounds);
-  }
+  tbb::this_task_arena::isolate([&] {
+    tbb::parallel_for(0U, 2*maxlayer+2, [&](unsigned int i) {
+      tiles[i].fill(layerClusters[i].x, layerClusters[i].y);
+    });
+  });
+
+  // a multicluster only has clusters of the endcap of its seed, so that the
+  // two endcaps are linked independently
   std::vector<int> vused(es.size(),0);
-  unsigned int used = 0;
+  std::array<std::vector<std::pair<unsigned int, reco::HGCalMultiCluster> >, 2> endcapClusters;
+  tbb::this_task_arena::isolate([&] {
+    tbb::parallel_for(0, 2, [&](int side) {
+      endcapClusters[side] = linkEndcap(thecls, side==1, vused);
+    });
+  });
+
+  // merge back in the order of the seeds
+  thePreClusters.reserve(endcapClusters[0].size()+endcapClusters[1].size());
+  auto neg = endcapClusters[0].begin(), pos = endcapClusters[1].begin();
+  while(neg != endcapClusters[0].end() || pos != endcapClusters[1].end()) {
+    auto& next = (pos == endcapClusters[1].end() || (neg != endcapClusters[0].end() && neg->first < pos->first)) ? neg : pos;
+    thePreClusters.push_back(std::move(next->second));
+    ++next;
+  }
+
+  return thePreClusters;
+
+}
+
+std::vector<std::pair<unsigned int, reco::HGCalMultiCluster> >
+HGCal3DClustering::linkEndcap(const reco::HGCalMultiCluster::ClusterCollection &thecls, bool positiveZ,
+			      std::vector<int> &vused) const {
+  std::vector<std::pair<unsigned int, reco::HGCalMultiCluster> > thePreClusters;
+  std::vector<int> found;
 
   unsigned int es_size = es.size();
   for(unsigned int i = 0; i < es_size; ++i) {
+    if((thecls[es[i]]->z()>0) != positiveZ) continue;
     if(vused[i]==0) {
       reco::HGCalMultiCluster temp;
       temp.push_back(thecls[es[i]]);
       vused[i]=(thecls[es[i]]->z()>0)? 1 : -1;
-      ++used;
       // Starting from cluster es[i] at from[0] - from[1] - from[2]
       std::array<double,3> from{ {thecls[es[i]]->x(),thecls[es[i]]->y(),thecls[es[i]]->z()} };
       unsigned int firstlayer = int(thecls[es[i]]->z()>0)*(maxlayer+1);
@@ -79,24 +99,31 @@ std::vector<reco::HGCalMultiCluster> HGCal3DClustering::makeClusters(const reco:
 	}
 	std::array<double,3> to{ {0.,0.,zees[j]} };
 	layerIntersection(to,from);
-        unsigned int layer = j > maxlayer ? (j-(maxlayer+1)) : j; //maps back from index used for KD trees to actual layer
+        unsigned int layer = j > maxlayer ? (j-(maxlayer+1)) : j; //maps back from index used for the tiles to actual layer
         float radius = 9999.;
         if(layer <= lastLayerEE) radius = radii[0];
         else if(layer <= lastLayerFH) radius = radii[1];
         else if(layer <= lastLayerBH) radius = radii[2];
         else assert(radius<100. && "nonsense layer value - cannot assign multicluster radius");
         float radius2 = radius*radius;
-	KDTreeBox search_box(float(to[0])-radius,float(to[0])+radius,
-			     float(to[1])-radius,float(to[1])+radius);
-	std::vector<KDNode> found;
+	std::array<int,4> search_box = tiles[j].searchBox(float(to[0])-radius,float(to[0])+radius,
+							   float(to[1])-radius,float(to[1])+radius);
 	// at layer j in box float(to[0])+/-radius - float(to[1])+/-radius
-	hit_kdtree[j].search(search_box,found);
-	// found found.size() clusters within box
-	for(unsigned int k = 0; k < found.size(); k++){
-	  if(vused[found[k].data.ind]==0 && distReal2(thecls[es[found[k].data.ind]],to)<radius2){
-	    temp.push_back(thecls[es[found[k].data.ind]]);
-	    vused[found[k].data.ind]=vused[i];
-	    ++used;
+	found.clear();
+	for(int xBin = search_box[0]; xBin <= search_box[1]; ++xBin) {
+	  for(int yBin = search_box[2]; yBin <= search_box[3]; ++yBin) {
+	    const int bin = tiles[j].getGlobalBinByBin(xBin,yBin);
+	    for(const int* k = tiles[j].begin(bin); k != tiles[j].end(bin); ++k) {
+	      found.push_back(layerClusters[j].ind[*k]);
+	    }
+	  }
+	}
+	// add the clusters in decreasing energy, whatever their tile
+	std::sort(found.begin(), found.end());
+	for(int ind : found){
+	  if(vused[ind]==0 && distReal2(thecls[es[ind]],to)<radius2){
+	    temp.push_back(thecls[es[ind]]);
+	    vused[ind]=vused[i];
 	  }
 	}
 
@@ -106,10 +133,9 @@ std::vector<reco::HGCalMultiCluster> HGCal3DClustering::makeClusters(const reco:
 	if (std::abs(position.z()) <= 0.) continue;
 	// only store multiclusters that pass the energy threshold in getMultiClusterPosition
 	// giving them a position inside the HGCal
-	thePreClusters.push_back(temp);
-	auto& back = thePreClusters.back();
-	back.setPosition(position);
-	back.setEnergy(clusterTools->getMultiClusterEnergy(back));
+	temp.setPosition(position);
+	temp.setEnergy(clusterTools->getMultiClusterEnergy(temp));
+	thePreClusters.emplace_back(i, std::move(temp));
       }
 
     }
@@ -117,7 +143,6 @@ std::vector<reco::HGCalMultiCluster> HGCal3DClustering::makeClusters(const reco:
   }
 
   return thePreClusters;
-
 }
 
 void HGCal3DClustering::layerIntersection(std::array<double,3> &to,
@@ -0,0 +1,307 @@
+#include "RecoLocalCalo/HGCalRecAlgos/interface/HGCalCLUEAlgo.h"
+
+#include "DataFormats/CaloRecHit/interface/CaloID.h"
+#include "tbb/task_arena.h"
+#include "tbb/tbb.h"
+
+#include <algorithm>
+#include <cmath>
+#include <iostream>
+#include <limits>
+#include <numeric>
+
+HGCalCLUEAlgo::HGCalCLUEAlgo(const std::vector<double>& vecDeltas_in, double kappa_in, double ecut_in,
+                             double outlierDeltaFactor_in,
+                             reco::CaloCluster::AlgoId algoId_in,
+                             bool dependSensor_in,
+                             const std::vector<double>& dEdXweights_in,
+                             const std::vector<double>& thicknessCorrection_in,
+                             const std::vector<double>& fcPerMip_in,
+                             double fcPerEle_in,
+                             const std::vector<double>& nonAgedNoises_in,
+                             double noiseMip_in,
+                             VerbosityLevel the_verbosity) :
+  HGCalClusteringAlgoBase(the_verbosity),
+  vecDeltas_(vecDeltas_in), kappa_(kappa_in), ecut_(ecut_in),
+  outlierDeltaFactor_(outlierDeltaFactor_in),
+  algoId_(algoId_in),
+  dependSensor_(dependSensor_in),
+  dEdXweights_(dEdXweights_in),
+  thicknessCorrection_(thicknessCorrection_in),
+  fcPerMip_(fcPerMip_in),
+  fcPerEle_(fcPerEle_in),
+  nonAgedNoises_(nonAgedNoises_in),
+  noiseMip_(noiseMip_in),
+  initialized_(false),
+  cells_(2 * (maxlayer + 1)),
+  numberOfClustersPerLayer_(2 * (maxlayer + 1), 0)
+{
+}
+
+void HGCalCLUEAlgo::reset() {
+  for (auto &cells : cells_)
+    cells.clear();
+  std::fill(numberOfClustersPerLayer_.begin(), numberOfClustersPerLayer_.end(), 0);
+}
+
+void HGCalCLUEAlgo::populate(const HGCRecHitCollection &hits) {
+  // loop over all hits and store the cells above threshold, as in
+  // HGCalImagingAlgo::populate
+
+  if (dependSensor_) {
+    // for each layer and wafer calculate the thresholds (sigmaNoise and energy)
+    // once
+    computeThreshold();
+  }
+
+  for (unsigned int i = 0; i < hits.size(); ++i) {
+
+    const HGCRecHit &hgrh = hits[i];
+    DetId detid = hgrh.detid();
+    unsigned int layer = rhtools_.getLayerWithOffset(detid);
+    // set sigmaNoise default value 1 to use kappa value directly in case of
+    // sensor-independent thresholds
+    float sigmaNoise = 1.f;
+    if (dependSensor_) {
+      int thickness_index = rhtools_.getSiThickIndex(detid);
+      if (thickness_index == -1)
+        thickness_index = 3;
+      double storedThreshold = thresholds_[layer - 1][thickness_index];
+      sigmaNoise = v_sigmaNoise_[layer - 1][thickness_index];
+
+      if (hgrh.energy() < storedThreshold)
+        continue; // this sets the ZS threshold at ecut times the sigma noise
+                  // for the sensor
+    }
+    if (!dependSensor_ && hgrh.energy() < ecut_)
+      continue;
+
+    // map layers from positive endcap (z) to layer + maxlayer+1 to prevent
+    // mixing up hits from different sides
+    layer += int(rhtools_.zside(detid) > 0) * (maxlayer + 1);
+
+    const GlobalPoint position(rhtools_.getPosition(detid));
+    CellsOnLayer &cells = cells_[layer];
+    cells.detid.push_back(detid);
+    cells.x.push_back(position.x());
+    cells.y.push_back(position.y());
+    cells.z.push_back(position.z());
+    cells.weight.push_back(hgrh.energy());
+    cells.sigmaNoise.push_back(sigmaNoise);
+  } // end loop hits
+}
+
+void HGCalCLUEAlgo::makeClusters() {
+  // the layers and, within a layer, the cells are independent until the
+  // clusters are assigned
+  tbb::this_task_arena::isolate([&] {
+    tbb::parallel_for(size_t(0), size_t(2 * maxlayer + 2), [&](size_t i) {
+      CellsOnLayer &cells = cells_[i];
+      const unsigned int numberOfCells = cells.detid.size();
+      cells.rho.assign(numberOfCells, 0.f);
+      cells.delta.assign(numberOfCells, std::numeric_limits<float>::max());
+      cells.nearestHigher.assign(numberOfCells, -1);
+      cells.clusterIndex.assign(numberOfCells, -1);
+      if (numberOfCells == 0)
+        return;
+
+      HGCalLayerTiles tiles;
+      tiles.fill(cells.x, cells.y);
+
+      // maps back from the index of the endcap layers to the actual layer
+      const unsigned int actualLayer = i > maxlayer ? (i - (maxlayer + 1)) : i;
+      const float delta_c = criticalDistance(actualLayer);
+
+      float maxdensity = calculateLocalDensity(tiles, i, delta_c);
+      calculateDistanceToHigher(tiles, i, delta_c);
+      numberOfClustersPerLayer_[i] = findAndAssignClusters(i, delta_c, maxdensity);
+    });
+  });
+}
+
+std::vector<reco::BasicCluster> HGCalCLUEAlgo::getClusters(bool) {
+
+  reco::CaloID caloID = reco::CaloID::DET_HGCAL_ENDCAP;
+  std::vector<reco::BasicCluster> clusters;
+  clusters.reserve(std::accumulate(numberOfClustersPerLayer_.begin(), numberOfClustersPerLayer_.end(), 0));
+
+  std::vector<std::vector<int>> cellsIdInCluster;
+  std::vector<std::pair<DetId, float>> thisCluster;
+  for (unsigned int layerId = 0; layerId < cells_.size(); ++layerId) {
+    const CellsOnLayer &cells = cells_[layerId];
+    cellsIdInCluster.clear();
+    cellsIdInCluster.resize(numberOfClustersPerLayer_[layerId]);
+    for (unsigned int i = 0; i < cells.clusterIndex.size(); ++i) {
+      if (cells.clusterIndex[i] >= 0)
+        cellsIdInCluster[cells.clusterIndex[i]].push_back(i);
+    }
+
+    for (auto const &cl : cellsIdInCluster) {
+      // energy-weighted position, all cells of a cluster have fraction 1
+      double energy = 0., x = 0., y = 0., z = 0.;
+      for (int i : cl) {
+        const double weight = cells.weight[i];
+        energy += weight;
+        x += cells.x[i] * weight;
+        y += cells.y[i] * weight;
+        z += cells.z[i] * weight;
+        thisCluster.emplace_back(cells.detid[i], 1.f);
+      }
+      math::XYZPoint position(0., 0., 0.);
+      if (energy != 0.)
+        position = math::XYZPoint(x / energy, y / energy, z / energy);
+
+      if (verbosity_ < pINFO) {
+        std::cout << "******** NEW CLUSTER (CLUE) ********" << std::endl;
+        std::cout << "No. of cells = " << cl.size() << std::endl;
+        std::cout << "     Energy     = " << energy << std::endl;
+        std::cout << "     Phi        = " << position.phi() << std::endl;
+        std::cout << "     Eta        = " << position.eta() << std::endl;
+        std::cout << "*****************************" << std::endl;
+      }
+      clusters.emplace_back(energy, position, caloID, thisCluster, algoId_);
+      thisCluster.clear();
+    }
+  }
+  return clusters;
+}
+
+float HGCalCLUEAlgo::criticalDistance(unsigned int layer) const {
+  if (layer <= lastLayerEE)
+    return vecDeltas_[0];
+  else if (layer <= lastLayerFH)
+    return vecDeltas_[1];
+  else
+    return vecDeltas_[2];
+}
+
+float HGCalCLUEAlgo::calculateLocalDensity(const HGCalLayerTiles &tiles,
+                                           unsigned int layerId,
+                                           float delta_c) {
+  CellsOnLayer &cells = cells_[layerId];
+  const unsigned int numberOfCells = cells.detid.size();
+  const float delta_c2 = delta_c * delta_c;
+
+  // rho is the energy within delta_c of the cell, the cell included
+  tbb::parallel_for(0U, numberOfCells, [&](unsigned int i) {
+    std::array<int, 4> search_box =
+        tiles.searchBox(cells.x[i] - delta_c, cells.x[i] + delta_c,
+                        cells.y[i] - delta_c, cells.y[i] + delta_c);
+    float rho = 0.f;
+    for (int xBin = search_box[0]; xBin <= search_box[1]; ++xBin) {
+      for (int yBin = search_box[2]; yBin <= search_box[3]; ++yBin) {
+        const int bin = tiles.getGlobalBinByBin(xBin, yBin);
+        for (const int *j = tiles.begin(bin); j != tiles.end(bin); ++j) {
+          const float dx = cells.x[i] - cells.x[*j];
+          const float dy = cells.y[i] - cells.y[*j];
+          if (dx * dx + dy * dy < delta_c2)
+            rho += cells.weight[*j];
+        }
+      }
+    }
+    cells.rho[i] = rho;
+  });
+
+  return *std::max_element(cells.rho.begin(), cells.rho.end());
+}
+
+void HGCalCLUEAlgo::calculateDistanceToHigher(const HGCalLayerTiles &tiles,
+                                              unsigned int layerId,
+                                              float delta_c) {
+  CellsOnLayer &cells = cells_[layerId];
+  const unsigned int numberOfCells = cells.detid.size();
+  const float dm = outlierDeltaFactor_ * delta_c;
+
+  // delta stays at its maximum for the cells without a higher density cell
+  // within dm
+  tbb::parallel_for(0U, numberOfCells, [&](unsigned int i) {
+    std::array<int, 4> search_box = tiles.searchBox(
+        cells.x[i] - dm, cells.x[i] + dm, cells.y[i] - dm, cells.y[i] + dm);
+    float dist2 = dm * dm;
+    int nearestHigher = -1;
+    for (int xBin = search_box[0]; xBin <= search_box[1]; ++xBin) {
+      for (int yBin = search_box[2]; yBin <= search_box[3]; ++yBin) {
+        const int bin = tiles.getGlobalBinByBin(xBin, yBin);
+        for (const int *j = tiles.begin(bin); j != tiles.end(bin); ++j) {
+          if (!isHigher(cells, *j, i))
+            continue;
+          const float dx = cells.x[i] - cells.x[*j];
+          const float dy = cells.y[i] - cells.y[*j];
+          const float tmp = dx * dx + dy * dy;
+          if (tmp < dist2 || (tmp == dist2 && nearestHigher >= 0 && *j < nearestHigher)) {
+            dist2 = tmp;
+            nearestHigher = *j;
+          }
+        }
+      }
+    }
+    if (nearestHigher >= 0) {
+      cells.delta[i] = std::sqrt(dist2);
+      cells.nearestHigher[i] = nearestHigher;
+    }
+  });
+}
+
+int HGCalCLUEAlgo::findAndAssignClusters(unsigned int layerId, float delta_c,
+                                         float maxdensity) {
+  CellsOnLayer &cells = cells_[layerId];
+  const unsigned int numberOfCells = cells.detid.size();
+
+  // the nearest higher of a cell comes before it when the cells are ordered by
+  // decreasing density, so that a single pass assigns all the followers
+  std::vector<int> rs(numberOfCells);
+  std::iota(rs.begin(), rs.end(), 0);
+  std::sort(rs.begin(), rs.end(),
+            [&cells](int i, int j) { return isHigher(cells, i, j); });
+
+  int nClustersOnLayer = 0;
+  for (int i : rs) {
+    // the seed threshold is kappa times the noise, or a fraction 1/kappa of
+    // the highest density of the layer for sensor-independent thresholds
+    const bool aboveThreshold =
+        dependSensor_ ? cells.rho[i] >= kappa_ * cells.sigmaNoise[i]
+                      : cells.rho[i] * kappa_ >= maxdensity;
+    if (cells.delta[i] > delta_c && aboveThreshold) {
+      cells.clusterIndex[i] = nClustersOnLayer++;
+    } else if (cells.nearestHigher[i] >= 0) {
+      cells.clusterIndex[i] = cells.clusterIndex[cells.nearestHigher[i]];
+    }
+    // else an outlier, not in any cluster
+  }
+
+  if (verbosity_ < pINFO) {
+    std::cout << "Layer " << layerId << ": " << nClustersOnLayer
+              << " clusters from " << numberOfCells << " cells" << std::endl;
+  }
+  return nClustersOnLayer;
+}
+
+void HGCalCLUEAlgo::computeThreshold() {
+  // same thresholds as HGCalImagingAlgo::computeThreshold: the first 3
+  // indices address the thicknesses of the Silicon sensors and the fourth
+  // one the Scintillators
+
+  if (initialized_)
+    return; // only need to calculate thresholds once
+
+  initialized_ = true;
+
+  std::vector<double> dummy;
+  const unsigned maxNumberOfThickIndices = 3;
+  dummy.resize(maxNumberOfThickIndices + 1, 0); // +1 to accomodate for the Scintillators
+  thresholds_.resize(maxlayer, dummy);
+  v_sigmaNoise_.resize(maxlayer, dummy);
+
+  for (unsigned ilayer = 1; ilayer <= maxlayer; ++ilayer) {
+    for (unsigned ithick = 0; ithick < maxNumberOfThickIndices; ++ithick) {
+      float sigmaNoise =
+          0.001f * fcPerEle_ * nonAgedNoises_[ithick] * dEdXweights_[ilayer] /
+          (fcPerMip_[ithick] * thicknessCorrection_[ithick]);
+      thresholds_[ilayer - 1][ithick] = sigmaNoise * ecut_;
+      v_sigmaNoise_[ilayer - 1][ithick] = sigmaNoise;
+    }
+    float scintillators_sigmaNoise = 0.001f * noiseMip_ * dEdXweights_[ilayer];
+    thresholds_[ilayer - 1][maxNumberOfThickIndices] = ecut_ * scintillators_sigmaNoise;
+    v_sigmaNoise_[ilayer - 1][maxNumberOfThickIndices] = scintillators_sigmaNoise;
+  }
+}
@@ -5,6 +5,7 @@
 #include "FWCore/Framework/interface/Frameworkfwd.h"
 #include "FWCore/Framework/interface/stream/EDProducer.h"
 #include "FWCore/MessageLogger/interface/MessageLogger.h"
+#include "FWCore/Utilities/interface/Exception.h"
 
 #include "FWCore/Framework/interface/Event.h"
 #include "FWCore/Framework/interface/MakerMacros.h"
@@ -19,6 +20,7 @@
 #include "RecoParticleFlow/PFClusterProducer/interface/PFClusterEnergyCorrectorBase.h"
 
 #include "RecoLocalCalo/HGCalRecAlgos/interface/HGCalImagingAlgo.h"
+#include "RecoLocalCalo/HGCalRecAlgos/interface/HGCalCLUEAlgo.h"
 #include "RecoLocalCalo/HGCalRecAlgos/interface/HGCalDepthPreClusterer.h"
 
 #include "FWCore/Framework/interface/ESHandle.h"
@@ -43,7 +45,7 @@ class HGCalLayerClusterProducer : public edm::stream::EDProducer<> {
 
   reco::CaloCluster::AlgoId algoId;
 
-  std::unique_ptr<HGCalImagingAlgo> algo;
+  std::unique_ptr<HGCalClusteringAlgoBase> algo;
   bool doSharing;
   std::string detector;
 
@@ -86,7 +88,15 @@ HGCalLayerClusterProducer::HGCalLayerClusterProducer(const edm::ParameterSet &ps
   }
 
 
-  if(doSharing){
+  const std::string algoType = ps.getParameter<std::string>("algo");
+  if(algoType=="CLUE") {
+    if(doSharing)
+      throw cms::Exception("Configuration") << "HGCalLayerClusterProducer: the energy sharing (doSharing) is only available with the Imaging algorithm";
+    double outlierDeltaFactor = ps.getParameter<double>("outlierDeltaFactor");
+    algo = std::make_unique<HGCalCLUEAlgo>(vecDeltas, kappa, ecut, outlierDeltaFactor, algoId, dependSensor, dEdXweights, thicknessCorrection, fcPerMip, fcPerEle, nonAgedNoises, noiseMip, verbosity);
+  }else if(algoType!="Imaging") {
+    throw cms::Exception("Configuration") << "HGCalLayerClusterProducer: unknown algo " << algoType << ", valid ones are Imaging and CLUE";
+  }else if(doSharing){
     double showerSigma =  ps.getParameter<double>("showerSigma");
     algo = std::make_unique<HGCalImagingAlgo>(vecDeltas, kappa, ecut, showerSigma, algoId, dependSensor, dEdXweights, thicknessCorrection, fcPerMip, fcPerEle, nonAgedNoises, noiseMip, verbosity);
   }else{
@@ -104,6 +114,7 @@ void HGCalLayerClusterProducer::fillDescriptions(edm::ConfigurationDescriptions&
   // hgcalLayerClusters
   edm::ParameterSetDescription desc;
   desc.add<std::string>("detector", "all");
+  desc.add<std::string>("algo", "Imaging")->setComment("Imaging (KD trees) or CLUE (tiles)");
   desc.add<bool>("doSharing", false);
   desc.add<std::vector<double>>("deltac", {
     2.0,
@@ -113,6 +124,7 @@ void HGCalLayerClusterProducer::fillDescriptions(edm::ConfigurationDescriptions&
   desc.add<bool>("dependSensor", true);
   desc.add<double>("ecut", 3.0);
   desc.add<double>("kappa", 9.0);
+  desc.add<double>("outlierDeltaFactor", 2.0)->setComment("CLUE only: range of the nearest higher density search, in units of deltac");
   desc.addUntracked<unsigned int>("verbosity", 3);
   desc.add<edm::InputTag>("HGCEEInput", edm::InputTag("HGCalRecHit","HGCEERecHits"));
   desc.add<edm::InputTag>("HGCFHInput", edm::InputTag("HGCalRecHit","HGCHEFRecHits"));
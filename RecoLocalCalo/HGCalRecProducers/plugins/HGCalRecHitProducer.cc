@@ -90,16 +90,19 @@ HGCalRecHitProducer::produce(edm::Event& evt, const edm::EventSetup& es) {
   worker_->set(es);
   
   // loop over uncalibrated rechits to make calibrated ones
+  eeRecHits->reserve(eeUncalibRecHits->size());
   for(auto it  = eeUncalibRecHits->begin(); it != eeUncalibRecHits->end(); ++it) {
     worker_->run(evt, *it, *eeRecHits);
   }
   
   // loop over uncalibrated rechits to make calibrated ones
+  hefRecHits->reserve(hefUncalibRecHits->size());
   for(auto it  = hefUncalibRecHits->begin(); it != hefUncalibRecHits->end(); ++it) {
     worker_->run(evt, *it, *hefRecHits);
   }
   
   // loop over uncalibrated rechits to make calibrated ones
+  hebRecHits->reserve(hebUncalibRecHits->size());
   for(auto it  = hebUncalibRecHits->begin(); it != hebUncalibRecHits->end(); ++it) {
     worker_->run(evt, *it, *hebRecHits);
   }
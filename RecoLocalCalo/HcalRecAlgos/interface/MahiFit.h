@@ -153,6 +153,7 @@ class MahiFit
   void updatePulseShape(double itQ, FullSampleVector &pulseShape, 
 			FullSampleVector &pulseDeriv,
 			FullSampleMatrix &pulseCov) const;
+  void pulseShapeAtTime(double t0, std::array<double, MaxSVSize> &pulseShape) const;
 
   double calculateArrivalTime() const;
   double calculateChiSq() const;
@@ -203,7 +204,18 @@ class MahiFit
   //for pulse shapes
   int cntsetPulseShape_;
   std::unique_ptr<FitterFuncs::PulseShapeFunctor> psfPtr_;
-  std::unique_ptr<ROOT::Math::Functor> pfunctor_;
+
+  // PulseShapeFunctor interpolates the pulse linearly within the half-ns cells (k/2, (k+1)/2],
+  // the shape and its slope are cached for the cells of the pulse times asked so far
+  struct PulseShapeCell {
+    bool filled = false;
+    std::array<double, MaxSVSize> value;
+    std::array<double, MaxSVSize> slope;
+  };
+  static constexpr double pulseTableMin_ = -50.;
+  static constexpr double pulseTableCellSize_ = 0.5;
+  static constexpr int pulseTableCells_ = 200;
+  mutable std::vector<PulseShapeCell> pulseShapeTable_;
 
 }; 
 #endif
@@ -44,6 +44,11 @@ namespace FitterFuncs{
      void getPulseShape(std::array<double,HcalConst::maxSamples>& fillPulseShape) { 
        fillPulseShape = pulse_shape_;
      }
+
+     /// unit height pulse shape for a pulse at pulseTime, without the chi2 evaluation of singlePulseShapeFunc
+     void getPulseShape(double pulseTime, std::array<double,HcalConst::maxSamples>& fillPulseShape) {
+       funcShape(fillPulseShape, pulseTime, 1.0, 0.0);
+     }
      
    private:
      std::array<float,HcalConst::maxPSshapeBin> pulse_hist;
@@ -1,6 +1,8 @@
 #include "RecoLocalCalo/HcalRecAlgos/interface/MahiFit.h" 
 #include "FWCore/MessageLogger/interface/MessageLogger.h"
 
+#include <cmath>
+
 MahiFit::MahiFit() :
   fullTSSize_(19), 
   fullTSofInterest_(8)
@@ -260,18 +262,9 @@ void MahiFit::updatePulseShape(double itQ, FullSampleVector &pulseShape, FullSam
   nnlsWork_.pulseM.fill(0);
   nnlsWork_.pulseP.fill(0);
 
-  const double xx[4]={t0, 1.0, 0.0, 3};
-  const double xxm[4]={-nnlsWork_.dt+t0, 1.0, 0.0, 3};
-  const double xxp[4]={ nnlsWork_.dt+t0, 1.0, 0.0, 3};
-
-  (*pfunctor_)(&xx[0]);
-  psfPtr_->getPulseShape(nnlsWork_.pulseN);
-
-  (*pfunctor_)(&xxm[0]);
-  psfPtr_->getPulseShape(nnlsWork_.pulseM);
-  
-  (*pfunctor_)(&xxp[0]);
-  psfPtr_->getPulseShape(nnlsWork_.pulseP);
+  pulseShapeAtTime(t0, nnlsWork_.pulseN);
+  pulseShapeAtTime(-nnlsWork_.dt+t0, nnlsWork_.pulseM);
+  pulseShapeAtTime( nnlsWork_.dt+t0, nnlsWork_.pulseP);
 
   //in the 2018+ case where the sample of interest (SOI) is in TS3, add an extra offset to align 
   //with previous SOI=TS4 case assumed by psfPtr_->getPulseShape()
@@ -322,6 +315,35 @@ void MahiFit::updateCov() const {
   nnlsWork_.covDecomp.compute(nnlsWork_.invCovMat);
 }
 
+void MahiFit::pulseShapeAtTime(double t0, std::array<double, MaxSVSize> &pulseShape) const {
+
+  if (!(t0 > pulseTableMin_ && t0 <= pulseTableMin_ + pulseTableCells_*pulseTableCellSize_)) {
+    psfPtr_->getPulseShape(t0, pulseShape);
+    return;
+  }
+
+  int k = std::ceil((t0 - pulseTableMin_)/pulseTableCellSize_) - 1;
+  k = std::min(std::max(k, 0), pulseTableCells_ - 1);
+  const double tLow = pulseTableMin_ + k*pulseTableCellSize_;
+
+  PulseShapeCell &cell = pulseShapeTable_[k];
+  if (!cell.filled) {
+    // two points inside the cell, away from the kinks at its ends
+    std::array<double, MaxSVSize> high;
+    psfPtr_->getPulseShape(tLow + 0.25*pulseTableCellSize_, cell.value);
+    psfPtr_->getPulseShape(tLow + 0.75*pulseTableCellSize_, high);
+    for (unsigned int iTS=0; iTS<MaxSVSize; ++iTS) {
+      cell.slope[iTS] = (high[iTS] - cell.value[iTS])/(0.5*pulseTableCellSize_);
+      cell.value[iTS] -= 0.25*pulseTableCellSize_*cell.slope[iTS];
+    }
+    cell.filled = true;
+  }
+
+  for (unsigned int iTS=0; iTS<MaxSVSize; ++iTS) {
+    pulseShape[iTS] = cell.value[iTS] + (t0 - tLow)*cell.slope[iTS];
+  }
+}
+
 double MahiFit::calculateArrivalTime() const {
 
   nnlsWork_.residuals = nnlsWork_.pulseMat*nnlsWork_.ampVec - nnlsWork_.amplitudes;
@@ -480,7 +502,7 @@ void MahiFit::resetPulseShapeTemplate(const HcalPulseShapes::Shape& ps) {
   // the uncertainty terms calculated inside PulseShapeFunctor are used for Method 2 only
   psfPtr_.reset(new FitterFuncs::PulseShapeFunctor(ps,false,false,false,
 						   1,0,0,10));
-  pfunctor_ = std::unique_ptr<ROOT::Math::Functor>( new ROOT::Math::Functor(psfPtr_.get(),&FitterFuncs::PulseShapeFunctor::singlePulseShapeFunc, 3) );
+  pulseShapeTable_.assign(pulseTableCells_, PulseShapeCell());
 
 
 }
@@ -7,15 +7,18 @@
 
 #include "CSCSegAlgoRU.h"
 #include "CSCSegFit.h"
+#include "CSCSegAlgoShowering.h"
 #include "Geometry/CSCGeometry/interface/CSCLayer.h"
 #include "DataFormats/GeometryVector/interface/GlobalPoint.h"
 #include "DataFormats/Math/interface/deltaPhi.h"
 #include "FWCore/ParameterSet/interface/ParameterSet.h"
 #include "FWCore/MessageLogger/interface/MessageLogger.h"
+#include "FWCore/Utilities/interface/Exception.h"
 #include <algorithm>
 #include <cmath>
 #include <iostream>
 #include <string>
+#include <utility>
 
 CSCSegAlgoRU::CSCSegAlgoRU(const edm::ParameterSet& ps)
   : CSCSegmentAlgorithm(ps), myName("CSCSegAlgoRU"){
@@ -29,6 +32,27 @@ CSCSegAlgoRU::CSCSegAlgoRU(const edm::ParameterSet& ps)
   chi2Max = ps.getParameter<double>("chi2Max");
   wideSeg = ps.getParameter<double>("wideSeg");
   minLayersApart = ps.getParameter<int>("minLayersApart");
+  // the combinatorics explode in showering chambers: above this number of hits
+  // only the showering segment (with the CSCSegAlgoShowering parameters)
+  // is built. Both are optional so that existing configurations keep the previous output
+  const int maxRecHits = ps.existsAs<int>("maxRecHitsInChamber") ?
+    ps.getParameter<int>("maxRecHitsInChamber") : 150;
+  if (maxRecHits < 0)
+    throw cms::Exception("Configuration") << myName << ": maxRecHitsInChamber must not be negative, got " << maxRecHits;
+  maxRecHitsInChamber = maxRecHits;
+  const bool useShowering = ps.existsAs<bool>("useShowering") ?
+    ps.getParameter<bool>("useShowering") : false;
+  if (useShowering) {
+    // the RU psets do not carry the showering cuts: use those of the ST psets for the missing ones
+    edm::ParameterSet showerPSet(ps);
+    const std::pair<const char*, double> showerDefaults[] = {
+      {"dRPhiFineMax", 8.0}, {"dPhiFineMax", 0.025}, {"tanThetaMax", 1.2}, {"tanPhiMax", 0.5},
+      {"maxRatioResidualPrune", 3.0}, {"maxDTheta", 999.0}, {"maxDPhi", 999.0}};
+    for (auto const& def : showerDefaults) {
+      if (!showerPSet.existsAs<double>(def.first)) showerPSet.addParameter<double>(def.first, def.second);
+    }
+    showering_ = std::make_unique<CSCSegAlgoShowering>(showerPSet);
+  }
  
   LogDebug("CSC") << myName << " has algorithm cuts set to: \n"
 		  << "--------------------------------------------------------------------\n"
@@ -52,12 +76,27 @@ CSCSegAlgoRU::CSCSegAlgoRU(const edm::ParameterSet& ps)
   }
 }
 
+CSCSegAlgoRU::~CSCSegAlgoRU() = default;
+
+std::vector<CSCSegment> CSCSegAlgoRU::run(const CSCChamber* aChamber, const ChamberHitContainer& rechits) {
+  if (rechits.size() > maxRecHitsInChamber) {
+    std::vector<CSCSegment> segments;
+    if (showering_) {
+      CSCSegment segShower = showering_->showerSeg(aChamber, rechits);
+      // returns nothing if chi2 == -1 (see comment in SegAlgoShowering)
+      if (segShower.nRecHits() >= 3 && segShower.chi2() != -1) segments.push_back(segShower);
+    }
+    return segments;
+  }
+  return buildSegments(aChamber, rechits);
+}
+
 std::vector<CSCSegment> CSCSegAlgoRU::buildSegments(const CSCChamber* aChamber, const ChamberHitContainer& urechits) const {
   ChamberHitContainer rechits = urechits;
   LayerIndex layerIndex(rechits.size());
   int recHits_per_layer[6] = {0,0,0,0,0,0};
   //skip events with high multiplicity of hits
-  if (rechits.size()>150){
+  if (rechits.size()>maxRecHitsInChamber){
     return std::vector<CSCSegment>();
   }
   int iadd = 0;
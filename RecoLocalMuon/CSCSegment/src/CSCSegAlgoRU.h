@@ -28,10 +28,12 @@
 #include <Math/SVector.h>
 #include <Math/SMatrix.h>
 
+#include <memory>
 #include <vector>
 
 
 class CSCSegFit;
+class CSCSegAlgoShowering;
 
 class CSCSegAlgoRU : public CSCSegmentAlgorithm {
 
@@ -65,7 +67,7 @@ public:
     /// Constructor
     explicit CSCSegAlgoRU(const edm::ParameterSet& ps);
     /// Destructor
-    ~CSCSegAlgoRU() override {};
+    ~CSCSegAlgoRU() override;
 
     /**
      * Build track segments in this chamber (this is where the actual
@@ -76,9 +78,11 @@ public:
     //    std::vector<CSCSegment> assambleRechitsInSegments(const ChamberHitContainer& rechits, int iadd, BoolContainer& used, BoolContainer& used3p, int *recHits_per_layer, const LayerIndex& layerIndex, std::vector<CSCSegment> segments);
 
     /**
-     * Here we must implement the algorithm
+     * Here we must implement the algorithm. Chambers with more than
+     * maxRecHitsInChamber hits are not combined: they get the segment of
+     * CSCSegAlgoShowering if useShowering is set, and none otherwise.
      */
-    std::vector<CSCSegment> run(const CSCChamber* aChamber, const ChamberHitContainer& rechits) override{ return buildSegments(aChamber, rechits); }
+    std::vector<CSCSegment> run(const CSCChamber* aChamber, const ChamberHitContainer& rechits) override;
 
 private:
     struct AlgoState {
@@ -162,6 +166,8 @@ private:
     float wideSeg;
     int minLayersApart;
     bool debugInfo;
+    unsigned int maxRecHitsInChamber;
+    std::unique_ptr<CSCSegAlgoShowering> showering_;
 
 };
 
@@ -79,8 +79,13 @@ class Phase2TrackerClusterizer : public edm::stream::EDProducer<> {
 #endif
         auto outputClusters = std::make_unique<Phase2TrackerCluster1DCollectionNew>();
 
+        // There are at most as many clusters as digis
+        size_t nDigis(0);
+        for (auto const & DSViter : *digis) nDigis += DSViter.size();
+        outputClusters->reserve(digis->size(), nDigis);
+
         // Go over all the modules
-        for (auto DSViter : *digis) {
+        for (auto const & DSViter : *digis) {
             DetId detId(DSViter.detId());
 
             Phase2TrackerCluster1DCollectionNew::FastFiller clusters(*outputClusters, DSViter.detId());
@@ -0,0 +1,255 @@
+//----------------------------------------------------------------------------
+//! \class PixelSparseClusterizer
+//! \brief Threshold-based pixel clustering on the sorted list of pixels
+//!
+//! See PixelSparseClusterizer.h
+//----------------------------------------------------------------------------
+
+// Our own includes
+#include "PixelSparseClusterizer.h"
+
+#include "FWCore/Utilities/interface/Exception.h"
+
+// STL
+#include <algorithm>
+#include <cassert>
+#include <numeric>
+
+#include "tbb/blocked_range.h"
+#include "tbb/enumerable_thread_specific.h"
+#include "tbb/parallel_for.h"
+
+namespace {
+  unsigned int findRoot(std::vector<unsigned int>& parent, unsigned int i) {
+    while (parent[i] != i) {
+      parent[i] = parent[parent[i]];   // path halving
+      i = parent[i];
+    }
+    return i;
+  }
+
+  // the root is always the first pixel of the group in (column, row) order
+  void unite(std::vector<unsigned int>& parent, unsigned int i, unsigned int j) {
+    auto ri = findRoot(parent, i);
+    auto rj = findRoot(parent, j);
+    if (ri < rj) parent[rj] = ri;
+    else if (rj < ri) parent[ri] = rj;
+  }
+
+  bool byRow(SiPixelCluster const & cl1, SiPixelCluster const & cl2) {
+    return cl1.minPixelRow() < cl2.minPixelRow();
+  }
+}
+
+PixelSparseClusterizer::PixelSparseClusterizer(edm::ParameterSet const& conf) :
+  PixelThresholdClusterizer(conf)
+{
+  if (conf.getParameter<bool>("SplitClusters"))
+    throw cms::Exception("Configuration") << "PixelSparseClusterizer does not support SplitClusters = True";
+}
+
+PixelSparseClusterizer::~PixelSparseClusterizer() {}
+
+//----------------------------------------------------------------------------
+//!  Convert the digis to electrons and keep the ones above the pixel threshold,
+//!  sorted by (column, row). As in the buffer of PixelThresholdClusterizer, a
+//!  digi repeated in the same DetUnit replaces the previous one.
+//----------------------------------------------------------------------------
+void PixelSparseClusterizer::fill_pixels( DigiIterator begin, DigiIterator end, std::vector<Pixel>& pixels )
+{
+  pixels.clear();
+  theElectrons.resize(end-begin);
+  calibrate_digis(begin, end, theElectrons.data());
+
+  int i = 0;
+  for (DigiIterator di = begin; di != end; ++di) {
+    int adc = std::max(theElectrons[i++], 100);   // see PixelThresholdClusterizer::copy_to_buffer
+    if (adc >= thePixelThreshold)
+      pixels.push_back( Pixel{ (uint32_t(di->column()) << 16) | uint32_t(di->row()), adc, adc >= theSeedThreshold } );
+  }
+
+  std::stable_sort(pixels.begin(), pixels.end(), [](Pixel const& a, Pixel const& b) { return a.key < b.key; });
+  auto last = std::unique(pixels.rbegin(), pixels.rend(), [](Pixel const& a, Pixel const& b) { return a.key == b.key; });
+  pixels.erase(pixels.begin(), last.base());
+}
+
+//----------------------------------------------------------------------------
+//!  Same for the pixels of clusters to be reclustered, pixels appearing in
+//!  several clusters have their charges added.
+//----------------------------------------------------------------------------
+void PixelSparseClusterizer::fill_pixels( ClusterIterator begin, ClusterIterator end, std::vector<Pixel>& pixels ) const
+{
+  pixels.clear();
+  for (ClusterIterator ci = begin; ci != end; ++ci) {
+    for (int i = 0; i < ci->size(); ++i) {
+      const SiPixelCluster::Pixel pixel = ci->pixel(i);
+      int adc = pixel.adc;
+      if (adc >= thePixelThreshold)
+        pixels.push_back( Pixel{ (uint32_t(pixel.y) << 16) | uint32_t(pixel.x), adc, adc >= theSeedThreshold } );
+    }
+  }
+
+  std::sort(pixels.begin(), pixels.end(), [](Pixel const& a, Pixel const& b) { return a.key < b.key; });
+  auto out = pixels.begin();
+  for (auto in = pixels.begin(); in != pixels.end(); ++in) {
+    if (out != pixels.begin() && (out-1)->key == in->key) {
+      (out-1)->adc += in->adc;
+      (out-1)->seed |= in->seed;
+    } else {
+      *out++ = *in;
+    }
+  }
+  pixels.erase(out, pixels.end());
+}
+
+//----------------------------------------------------------------------------
+//!  \brief Group the adjacent pixels and make the clusters.
+//!  The pixels must be sorted by (column, row) without duplicates.
+//----------------------------------------------------------------------------
+void PixelSparseClusterizer::find_clusters( const std::vector<Pixel>& pixels, int clusterThreshold,
+                                            Scratch& scratch, std::vector<SiPixelCluster>& clusters ) const
+{
+  clusters.clear();
+  const unsigned int n = pixels.size();
+  if (n == 0) return;
+
+  auto& parent = scratch.parent;
+  parent.resize(n);
+  std::iota(parent.begin(), parent.end(), 0);
+
+  // the neighbours of pixel i preceding it are the previous pixel if it is in
+  // the same column and the next row, and the pixels of column-1 with rows in
+  // [row-1, row+1], found in [prevBegin, prevEnd) which only moves forward.
+  unsigned int colBegin = 0, prevBegin = 0, prevEnd = 0;
+  for (unsigned int i = 0; i < n; ++i) {
+    const int col = pixels[i].col();
+    const int row = pixels[i].row();
+    if (i == 0 || pixels[i-1].col() != col) {
+      if (i > 0 && pixels[i-1].col() == col-1) { prevBegin = colBegin; prevEnd = i; }
+      else { prevBegin = prevEnd = i; }
+      colBegin = i;
+    } else if (pixels[i-1].row() == row-1) {
+      unite(parent, i, i-1);
+    }
+    while (prevBegin < prevEnd && pixels[prevBegin].row() < row-1) ++prevBegin;
+    for (unsigned int j = prevBegin; j < prevEnd && pixels[j].row() <= row+1; ++j)
+      unite(parent, i, j);
+  }
+
+  // counting sort of the pixels by group, keeping the (column, row) order inside each group
+  auto& offsets = scratch.offsets;
+  auto& members = scratch.members;
+  offsets.assign(n+1, 0);
+  for (unsigned int i = 0; i < n; ++i) {
+    parent[i] = findRoot(parent, i);
+    ++offsets[parent[i]+1];
+  }
+  std::partial_sum(offsets.begin(), offsets.end(), offsets.begin());
+  members.resize(n);
+  for (unsigned int i = 0; i < n; ++i)
+    members[offsets[parent[i]]++] = i;
+  // offsets[root] is now the end of the group, which starts at the end of the previous one
+
+  bool usedCleared = false;
+  unsigned int groupBegin = 0;
+  for (unsigned int root = 0; root < n; ++root) {
+    if (parent[root] != root) continue;
+    const unsigned int groupEnd = offsets[root];
+    bool groupHasSeed = false;
+    for (auto k = groupBegin; k < groupEnd && !groupHasSeed; ++k) groupHasSeed = pixels[members[k]].seed;
+
+    if (groupHasSeed && groupEnd - groupBegin <= AccretionCluster::MAXSIZE) {
+      AccretionCluster acluster;
+      for (auto k = groupBegin; k < groupEnd; ++k) {
+        const Pixel& p = pixels[members[k]];
+        acluster.add(SiPixelCluster::PixelPos(p.row(), p.col()), p.adc);
+      }
+      SiPixelCluster cluster(acluster.isize, acluster.adc, acluster.x, acluster.y, acluster.xmin, acluster.ymin);
+      if (cluster.charge() >= clusterThreshold)
+        clusters.push_back(std::move(cluster));
+    } else if (groupHasSeed) {
+      // as in PixelThresholdClusterizer::make_cluster, a cluster is grown from each seed
+      // not used yet, up to MAXSIZE pixels; the pixels left over go to the following seeds
+      auto& used = scratch.used;
+      if (!usedCleared) { used.assign(n, false); usedCleared = true; }
+      for (auto k = groupBegin; k < groupEnd; ++k) {
+        const unsigned int s = members[k];
+        if (!pixels[s].seed || used[s]) continue;
+        AccretionCluster acluster;
+        acluster.add(SiPixelCluster::PixelPos(pixels[s].row(), pixels[s].col()), pixels[s].adc);
+        used[s] = true;
+        while (!acluster.empty()) {
+          auto curInd = acluster.top(); acluster.pop();
+          for (int c = std::max(0, int(acluster.y[curInd])-1); c < int(acluster.y[curInd])+2; ++c) {
+            for (int r = std::max(0, int(acluster.x[curInd])-1); r < int(acluster.x[curInd])+2; ++r) {
+              const uint32_t key = (uint32_t(c) << 16) | uint32_t(r);
+              auto it = std::lower_bound(pixels.begin(), pixels.end(), key, [](Pixel const& p, uint32_t value) { return p.key < value; });
+              if (it == pixels.end() || it->key != key) continue;
+              const unsigned int j = it - pixels.begin();
+              if (used[j]) continue;
+              if (!acluster.add(SiPixelCluster::PixelPos(r, c), it->adc)) goto endClus;
+              used[j] = true;
+            }
+          }
+        }
+      endClus:
+        SiPixelCluster cluster(acluster.isize, acluster.adc, acluster.x, acluster.y, acluster.xmin, acluster.ymin);
+        if (cluster.charge() >= clusterThreshold)
+          clusters.push_back(std::move(cluster));
+      }
+    }
+    groupBegin = groupEnd;
+  }
+
+  // sort by row (x)
+  std::stable_sort(clusters.begin(), clusters.end(), byRow);
+}
+
+void PixelSparseClusterizer::clusterizeDetUnit( const edm::DetSet<PixelDigi> & input,
+                                                const PixelGeomDetUnit * pixDet,
+                                                const TrackerTopology* tTopo,
+                                                const std::vector<short>& badChannels,
+                                                edmNew::DetSetVector<SiPixelCluster>::FastFiller& output)
+{
+  assert(output.empty());
+  auto clusterThreshold = setup_detid(input.detId(), tTopo);
+  fill_pixels(input.begin(), input.end(), thePixels);
+  find_clusters(thePixels, clusterThreshold, theScratch, theFound);
+  for (auto& cluster : theFound) output.push_back(std::move(cluster));
+}
+
+void PixelSparseClusterizer::clusterizeDetUnit( const edmNew::DetSet<SiPixelCluster> & input,
+                                                const PixelGeomDetUnit * pixDet,
+                                                const TrackerTopology* tTopo,
+                                                const std::vector<short>& badChannels,
+                                                edmNew::DetSetVector<SiPixelCluster>::FastFiller& output)
+{
+  assert(output.empty());
+  auto clusterThreshold = setup_detid(input.detId(), tTopo);
+  fill_pixels(input.begin(), input.end(), thePixels);
+  find_clusters(thePixels, clusterThreshold, theScratch, theFound);
+  for (auto& cluster : theFound) output.push_back(std::move(cluster));
+}
+
+void PixelSparseClusterizer::clusterizeDetUnits( const std::vector<const edm::DetSet<PixelDigi>*> & inputs,
+                                                 const TrackerTopology* tTopo,
+                                                 std::vector<std::vector<SiPixelCluster>> & clusters)
+{
+  const unsigned int n = inputs.size();
+  clusters.resize(n);
+
+  // the gain calibration service caches the last DetUnit, so this part stays serial
+  std::vector<std::vector<Pixel>> pixels(n);
+  std::vector<int> thresholds(n);
+  for (unsigned int i = 0; i < n; ++i) {
+    thresholds[i] = setup_detid(inputs[i]->detId(), tTopo);
+    fill_pixels(inputs[i]->begin(), inputs[i]->end(), pixels[i]);
+  }
+
+  tbb::enumerable_thread_specific<Scratch> scratches;
+  tbb::parallel_for(tbb::blocked_range<unsigned int>(0, n), [&](tbb::blocked_range<unsigned int> const& range) {
+    auto& scratch = scratches.local();
+    for (auto i = range.begin(); i != range.end(); ++i)
+      find_clusters(pixels[i], thresholds[i], scratch, clusters[i]);
+  });
+}
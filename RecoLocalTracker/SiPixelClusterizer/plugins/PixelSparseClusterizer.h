@@ -0,0 +1,84 @@
+#ifndef RecoLocalTracker_SiPixelClusterizer_PixelSparseClusterizer_H
+#define RecoLocalTracker_SiPixelClusterizer_PixelSparseClusterizer_H
+
+//-----------------------------------------------------------------------
+//! \class PixelSparseClusterizer
+//! \brief Threshold-based clustering working on the list of pixels only.
+//!
+//! Finds the same clusters as PixelThresholdClusterizer (same thresholds
+//! and calibration) without filling and clearing a dense nrow * ncol
+//! buffer for each DetUnit. The pixels above threshold are sorted by
+//! (column, row), so the neighbours of a pixel preceding it in this order
+//! are either the previous pixel of the same column or a contiguous range
+//! of the previous column; they are merged with a union-find. Connected
+//! groups containing at least one seed are turned into clusters.
+//!
+//! The pixels of a cluster are stored in (column, row) order instead of
+//! the order in which the accretion from the seed found them. Groups
+//! larger than AccretionCluster::MAXSIZE are clustered as in
+//! PixelThresholdClusterizer, growing a cluster of at most MAXSIZE pixels
+//! from each seed not used yet. SplitClusters is not supported.
+//!
+//! clusterizeDetUnits processes all the DetUnits of an event: the
+//! calibration, which uses the (not thread safe) gain calibration
+//! service, is done first for all of them and the clustering then runs
+//! in a parallel loop over the DetUnits.
+//-----------------------------------------------------------------------
+
+#include "PixelThresholdClusterizer.h"
+
+#include <cstdint>
+#include <vector>
+
+class dso_hidden PixelSparseClusterizer final : public PixelThresholdClusterizer {
+ public:
+
+  PixelSparseClusterizer(edm::ParameterSet const& conf);
+  ~PixelSparseClusterizer() override;
+
+  void clusterizeDetUnit( const edm::DetSet<PixelDigi> & input,
+                          const PixelGeomDetUnit * pixDet,
+                          const TrackerTopology* tTopo,
+                          const std::vector<short>& badChannels,
+                          edmNew::DetSetVector<SiPixelCluster>::FastFiller& output) override;
+  void clusterizeDetUnit( const edmNew::DetSet<SiPixelCluster> & input,
+                          const PixelGeomDetUnit * pixDet,
+                          const TrackerTopology* tTopo,
+                          const std::vector<short>& badChannels,
+                          edmNew::DetSetVector<SiPixelCluster>::FastFiller& output) override;
+
+  //! Clusterize several DetUnits at once, the clusters of inputs[i] are stored
+  //! in clusters[i] sorted by row (x) as the FastFiller of clusterizeDetUnit would be.
+  void clusterizeDetUnits( const std::vector<const edm::DetSet<PixelDigi>*> & inputs,
+                           const TrackerTopology* tTopo,
+                           std::vector<std::vector<SiPixelCluster>> & clusters);
+
+ private:
+
+  struct Pixel {
+    uint32_t key;   // (column << 16) | row
+    int adc;        // in electrons
+    bool seed;
+    int row() const { return key & 0xFFFF; }
+    int col() const { return key >> 16; }
+  };
+
+  struct Scratch {
+    std::vector<unsigned int> parent;
+    std::vector<unsigned int> offsets;
+    std::vector<unsigned int> members;
+    std::vector<bool> used;         // only for the groups larger than MAXSIZE
+  };
+
+  void fill_pixels( DigiIterator begin, DigiIterator end, std::vector<Pixel>& pixels );
+  void fill_pixels( ClusterIterator begin, ClusterIterator end, std::vector<Pixel>& pixels ) const;
+  void find_clusters( const std::vector<Pixel>& pixels, int clusterThreshold,
+                      Scratch& scratch, std::vector<SiPixelCluster>& clusters ) const;
+
+  std::vector<int> theElectrons;          // scratch for the calibration
+  std::vector<Pixel> thePixels;           // scratch for clusterizeDetUnit
+  Scratch theScratch;
+  std::vector<SiPixelCluster> theFound;
+};
+
+#endif
@@ -123,6 +123,14 @@ bool PixelThresholdClusterizer::setup(const PixelGeomDetUnit * pixDet)
   
   return true;   
 }
+int PixelThresholdClusterizer::setup_detid(uint32_t detid, const TrackerTopology* tTopo)
+{
+  theDetid = detid;
+
+  // Set separate cluster threshold for L1 (needed for phase1)
+  theLayer = (DetId(theDetid).subdetId()==1) ? tTopo->pxbLayer(theDetid) : 0;
+  return (theLayer==1) ? theClusterThreshold_L1 : theClusterThreshold;
+}
 //----------------------------------------------------------------------------
 //!  \brief Cluster pixels.
 //!  This method operates on a matrix of pixels
@@ -147,12 +155,7 @@ void PixelThresholdClusterizer::clusterizeDetUnitT( const T & input,
   if ( !setup(pixDet) ) 
     return;
   
-  theDetid = input.detId();
-  
-  // Set separate cluster threshold for L1 (needed for phase1)
-  auto clusterThreshold = theClusterThreshold;
-  theLayer = (DetId(theDetid).subdetId()==1) ? tTopo->pxbLayer(theDetid) : 0;
-  if (theLayer==1) clusterThreshold = theClusterThreshold_L1;
+  auto clusterThreshold = setup_detid(input.detId(), tTopo);
   
   //  Copy PixelDigis to the buffer array; select the seed pixels
   //  on the way, and store them in theSeeds.
@@ -236,7 +239,43 @@ void PixelThresholdClusterizer::copy_to_buffer( DigiIterator begin, DigiIterator
   }
 #endif
   int electron[end-begin]; // pixel charge in electrons 
-  memset(electron, 0, sizeof(electron));
+  calibrate_digis(begin, end, electron);
+
+  int i=0;
+#ifdef PIXELREGRESSION
+  static std::atomic<int> eqD=0;
+#endif
+  for(DigiIterator di = begin; di != end; ++di) {
+    int row = di->row();
+    int col = di->column();
+    int adc = electron[i++]; // this is in electrons 
+
+#ifdef PIXELREGRESSION
+    int adcOld = calibrate(di->adc(),col,row);
+    //assert(adc==adcOld);
+    if (adc!=adcOld) std::cout << "VI " << eqD  <<' '<< ic  <<' '<< end-begin <<' '<< i <<' '<< di->adc() <<' ' << adc <<' '<< adcOld << std::endl; else ++eqD;
+#endif
+
+    if(adc<100) adc=100; // put all negative pixel charges into the 100 elec bin 
+    /* This is semi-random good number. The exact number (in place of 100) is irrelevant from the point 
+       of view of the final cluster charge since these are typically >= 20000.
+    */
+
+    if ( adc >= thePixelThreshold) {
+      theBuffer.set_adc( row, col, adc);
+      if ( adc >= theSeedThreshold) theSeeds.push_back( SiPixelCluster::PixelPos(row,col) );
+    }
+  }
+  assert(i==(end-begin));
+
+}
+
+//----------------------------------------------------------------------------
+//! \brief Convert the adc counts of the PixelDigis of the current DetUnit to electrons.
+//----------------------------------------------------------------------------
+void PixelThresholdClusterizer::calibrate_digis( DigiIterator begin, DigiIterator end, int* electron )
+{
+  memset(electron, 0, (end-begin)*sizeof(int));
 
   if (doPhase2Calibration) {
     int i = 0;
@@ -267,33 +306,6 @@ void PixelThresholdClusterizer::copy_to_buffer( DigiIterator begin, DigiIterator
     }
   }
 
-  int i=0;
-#ifdef PIXELREGRESSION
-  static std::atomic<int> eqD=0;
-#endif
-  for(DigiIterator di = begin; di != end; ++di) {
-    int row = di->row();
-    int col = di->column();
-    int adc = electron[i++]; // this is in electrons 
-
-#ifdef PIXELREGRESSION
-    int adcOld = calibrate(di->adc(),col,row);
-    //assert(adc==adcOld);
-    if (adc!=adcOld) std::cout << "VI " << eqD  <<' '<< ic  <<' '<< end-begin <<' '<< i <<' '<< di->adc() <<' ' << adc <<' '<< adcOld << std::endl; else ++eqD;
-#endif
-
-    if(adc<100) adc=100; // put all negative pixel charges into the 100 elec bin 
-    /* This is semi-random good number. The exact number (in place of 100) is irrelevant from the point 
-       of view of the final cluster charge since these are typically >= 20000.
-    */
-
-    if ( adc >= thePixelThreshold) {
-      theBuffer.set_adc( row, col, adc);
-      if ( adc >= theSeedThreshold) theSeeds.push_back( SiPixelCluster::PixelPos(row,col) );
-    }
-  }
-  assert(i==(end-begin));
-
 }
 
 void PixelThresholdClusterizer::copy_to_buffer( ClusterIterator begin, ClusterIterator end )
@@ -56,7 +56,7 @@
 #include <vector>
 
 
-class dso_hidden PixelThresholdClusterizer final : public PixelClusterizerBase {
+class dso_hidden PixelThresholdClusterizer : public PixelClusterizerBase {
  public:
 
   PixelThresholdClusterizer(edm::ParameterSet const& conf);
@@ -76,7 +76,7 @@ class dso_hidden PixelThresholdClusterizer final : public PixelClusterizerBase {
 
   static void fillDescriptions(edm::ConfigurationDescriptions & descriptions);
 
- private:
+ protected:
 
   template<typename T>
   void clusterizeDetUnitT( const T & input,
@@ -120,6 +120,10 @@ class dso_hidden PixelThresholdClusterizer final : public PixelClusterizerBase {
   const bool doSplitClusters;
   //! Private helper methods:
   bool setup(const PixelGeomDetUnit * pixDet);
+  //! Set theDetid, theLayer and return the cluster threshold of the DetUnit
+  int setup_detid(uint32_t detid, const TrackerTopology* tTopo);
+  //! Convert the adc counts to electrons, the DetUnit must have been set up with setup_detid
+  void calibrate_digis( DigiIterator begin, DigiIterator end, int* electron );
   void copy_to_buffer( DigiIterator begin, DigiIterator end );   
   void copy_to_buffer( ClusterIterator begin, ClusterIterator end );
   void clear_buffer( DigiIterator begin, DigiIterator end );
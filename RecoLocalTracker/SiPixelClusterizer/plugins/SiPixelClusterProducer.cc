@@ -14,6 +14,7 @@
 // Our own stuff
 #include "SiPixelClusterProducer.h"
 #include "PixelThresholdClusterizer.h"
+#include "PixelSparseClusterizer.h"
 
 // Geometry
 #include "Geometry/Records/interface/TrackerDigiGeometryRecord.h"
@@ -51,6 +52,7 @@
     theSiPixelGainCalibration_(nullptr), 
     clusterMode_( conf.getUntrackedParameter<std::string>("ClusterMode","PixelThresholdClusterizer") ),
     clusterizer_(nullptr),          // the default, in case we fail to make one
+    sparseClusterizer_(nullptr),
     readyToCluster_(false),   // since we obviously aren't
     maxTotalClusters_( conf.getParameter<int32_t>( "maxNumberOfClusters" ) ),
     payloadType_( conf.getParameter<std::string>( "payloadType" ) )
@@ -115,6 +117,8 @@
     // on each DetUnit
     if ( clusterMode_ == "PixelThresholdReclusterizer" )
       run(*inputClusters, geom, *output );
+    else if ( sparseClusterizer_ )
+      runEventWide(*inputDigi, geom, *output );
     else
       run(*inputDigi, geom, *output );
 
@@ -136,11 +140,18 @@
       clusterizer_->setSiPixelGainCalibrationService(theSiPixelGainCalibration_);
       readyToCluster_ = true;
     } 
+    else if ( clusterMode_ == "PixelSparseClusterizer" ) {
+      sparseClusterizer_ = new PixelSparseClusterizer(conf);
+      clusterizer_ = sparseClusterizer_;
+      clusterizer_->setSiPixelGainCalibrationService(theSiPixelGainCalibration_);
+      readyToCluster_ = true;
+    }
     else {
       edm::LogError("SiPixelClusterProducer") << "[SiPixelClusterProducer]:"
 		<<" choice " << clusterMode_ << " is invalid.\n"
 		<< "Possible choices:\n" 
-		<< "    PixelThresholdClusterizer";
+		<< "    PixelThresholdClusterizer\n"
+		<< "    PixelSparseClusterizer";
       readyToCluster_ = false;
     }
   }
@@ -212,6 +223,44 @@
 
 
 
+  //---------------------------------------------------------------------------
+  //!  Same as run, but the DetUnits are given to the clusterizer all together
+  //!  so it can process them concurrently.
+  //---------------------------------------------------------------------------
+  void SiPixelClusterProducer::runEventWide(const edm::DetSetVector<PixelDigi>   & input,
+                                            const edm::ESHandle<TrackerGeometry> & geom,
+                                            edmNew::DetSetVector<SiPixelCluster> & output) {
+    std::vector<const edm::DetSet<PixelDigi>*> detSets;
+    detSets.reserve(input.size());
+    for (auto const& detSet : input) {
+      if (! dynamic_cast<const PixelGeomDetUnit*>(geom->idToDetUnit(DetId(detSet.detId())))) {
+	// Fatal error!  TO DO: throw an exception!
+	assert(0);
+      }
+      detSets.push_back(&detSet);
+    }
+
+    std::vector<std::vector<SiPixelCluster>> clusters;
+    sparseClusterizer_->clusterizeDetUnits(detSets, tTopo_, clusters);
+
+    int numberOfClusters = 0;
+    for (unsigned int i = 0; i < detSets.size(); ++i) {
+      if (clusters[i].empty()) continue;
+      {
+      edmNew::DetSetVector<SiPixelCluster>::FastFiller spc(output, detSets[i]->detId());
+      for (auto& cluster : clusters[i]) spc.push_back(std::move(cluster));
+      numberOfClusters += spc.size();
+      }
+      if ((maxTotalClusters_ >= 0) && (numberOfClusters > maxTotalClusters_)) {
+        edm::LogError("TooManyClusters") <<  "Limit on the number of clusters exceeded. An empty cluster collection will be produced instead.\n";
+        edmNew::DetSetVector<SiPixelCluster> empty;
+        empty.swap(output);
+        break;
+      }
+    }
+  }
+
+
 #include "FWCore/PluginManager/interface/ModuleDef.h"
 #include "FWCore/Framework/interface/MakerMacros.h"
 
@@ -30,6 +30,8 @@
 
 #include "PixelClusterizerBase.h"
 
+class PixelSparseClusterizer;
+
 //#include "Geometry/CommonDetUnit/interface/TrackingGeometry.h"
 
 #include "Geometry/TrackerGeometryBuilder/interface/TrackerGeometry.h"
@@ -66,6 +68,11 @@
              const edm::ESHandle<TrackerGeometry> & geom,
              edmNew::DetSetVector<SiPixelCluster> & output);
 
+    //! Clusterize all the DetUnits at once, for the clusterizers supporting it
+    void runEventWide(const edm::DetSetVector<PixelDigi>   & input,
+                      const edm::ESHandle<TrackerGeometry> & geom,
+                      edmNew::DetSetVector<SiPixelCluster> & output);
+
   private:
     edm::EDGetTokenT<SiPixelClusterCollectionNew>  tPixelClusters;
     edm::EDGetTokenT<edm::DetSetVector<PixelDigi>> tPixelDigi;
@@ -73,6 +80,7 @@
     SiPixelGainCalibrationServiceBase * theSiPixelGainCalibration_;
     const std::string clusterMode_;         // user's choice of the clusterizer
     PixelClusterizerBase * clusterizer_;    // what we got (for now, one ptr to base class)
+    PixelSparseClusterizer * sparseClusterizer_; // same as clusterizer_ if it can process whole events
     bool readyToCluster_;                   // needed clusterizers valid => good to go!
     const TrackerTopology* tTopo_;          // needed to get correct layer number
 
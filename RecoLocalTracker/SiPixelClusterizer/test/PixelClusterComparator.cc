@@ -0,0 +1,74 @@
+// compare two pixel cluster collections, e.g. produced by PixelThresholdClusterizer
+// and PixelSparseClusterizer, and throw if the clusters differ; the order of the
+// pixels inside a cluster and of the clusters with the same minimum row is ignored
+
+#include "FWCore/Framework/interface/global/EDAnalyzer.h"
+#include "FWCore/Framework/interface/Event.h"
+#include "FWCore/ParameterSet/interface/ParameterSet.h"
+#include "FWCore/ParameterSet/interface/ConfigurationDescriptions.h"
+#include "FWCore/ParameterSet/interface/ParameterSetDescription.h"
+#include "FWCore/Utilities/interface/Exception.h"
+#include "DataFormats/Common/interface/DetSetVectorNew.h"
+#include "DataFormats/Common/interface/Handle.h"
+#include "DataFormats/SiPixelCluster/interface/SiPixelCluster.h"
+
+#include <algorithm>
+#include <tuple>
+#include <vector>
+
+class PixelClusterComparator : public edm::global::EDAnalyzer<> {
+public:
+  explicit PixelClusterComparator(const edm::ParameterSet& conf):
+    referenceToken_(consumes<edmNew::DetSetVector<SiPixelCluster>>(conf.getParameter<edm::InputTag>("reference"))),
+    testToken_(consumes<edmNew::DetSetVector<SiPixelCluster>>(conf.getParameter<edm::InputTag>("test"))) {}
+
+  static void fillDescriptions(edm::ConfigurationDescriptions& descriptions) {
+    edm::ParameterSetDescription desc;
+    desc.add<edm::InputTag>("reference");
+    desc.add<edm::InputTag>("test");
+    descriptions.add("pixelClusterComparator", desc);
+  }
+
+  void analyze(edm::StreamID, const edm::Event& e, const edm::EventSetup&) const override {
+    edm::Handle<edmNew::DetSetVector<SiPixelCluster>> reference;
+    e.getByToken(referenceToken_, reference);
+    edm::Handle<edmNew::DetSetVector<SiPixelCluster>> test;
+    e.getByToken(testToken_, test);
+
+    if (reference->size() != test->size())
+      throw cms::Exception("PixelClusterMismatch") << "event " << e.id() << ": " << reference->size()
+                                                   << " reference modules, " << test->size() << " test modules";
+
+    for (auto ref = reference->begin(), tst = test->begin(); ref != reference->end(); ++ref, ++tst) {
+      if (ref->detId() != tst->detId())
+        throw cms::Exception("PixelClusterMismatch") << "event " << e.id() << ": modules " << ref->detId()
+                                                     << " and " << tst->detId();
+      if (canonical(*ref) != canonical(*tst))
+        throw cms::Exception("PixelClusterMismatch") << "event " << e.id() << ": different clusters on " << ref->detId();
+    }
+  }
+
+private:
+  typedef std::vector<std::tuple<int,int,int>> Pixels;   // (row, column, adc)
+
+  static std::vector<Pixels> canonical(edmNew::DetSet<SiPixelCluster> const& clusters) {
+    std::vector<Pixels> result;
+    for (auto const& cluster : clusters) {
+      Pixels pixels;
+      for (int i = 0; i < cluster.size(); ++i) {
+        auto pixel = cluster.pixel(i);
+        pixels.emplace_back(pixel.x, pixel.y, pixel.adc);
+      }
+      std::sort(pixels.begin(), pixels.end());
+      result.push_back(std::move(pixels));
+    }
+    std::sort(result.begin(), result.end());
+    return result;
+  }
+
+  const edm::EDGetTokenT<edmNew::DetSetVector<SiPixelCluster>> referenceToken_;
+  const edm::EDGetTokenT<edmNew::DetSetVector<SiPixelCluster>> testToken_;
+};
+
+#include "FWCore/Framework/interface/MakerMacros.h"
+DEFINE_FWK_MODULE(PixelClusterComparator);
@@ -0,0 +1,12 @@
+#!/bin/bash
+
+function die { echo $1: status $2 ;  exit $2; }
+
+pushd ${LOCAL_TMP_DIR}
+
+# generate a few ttbar events up to the digis, then make the pixel clusters
+# with PixelThresholdClusterizer and PixelSparseClusterizer and compare them
+cmsDriver.py TTbar_13TeV_TuneCUETP8M1_cfi --conditions auto:run2_mc --era Run2_2016 --beamspot NominalCollision2015 -n 3 -s GEN,SIM,DIGI --eventcontent FEVTDEBUG --datatier GEN-SIM-DIGI --fileout file:sparseClusterizer_step1.root --python_filename sparseClusterizer_step1_cfg.py || die 'Failure running cmsDriver' $?
+cmsRun ${LOCAL_TEST_DIR}/sparseClusterizer_cfg.py || die 'Failure using sparseClusterizer_cfg.py' $?
+
+popd
@@ -0,0 +1,35 @@
+# run the pixel clusterizer with PixelThresholdClusterizer and with
+# PixelSparseClusterizer and check that the clusters are identical; the
+# input is generated by runtests.sh, which registers this as a unit test
+import FWCore.ParameterSet.Config as cms
+from Configuration.StandardSequences.Eras import eras
+
+process = cms.Process("SPARSECLUSTERS", eras.Run2_2016)
+
+process.load("FWCore.MessageService.MessageLogger_cfi")
+process.load('Configuration.StandardSequences.GeometryRecoDB_cff')
+process.load('Configuration.StandardSequences.MagneticField_cff')
+process.load('Configuration.StandardSequences.FrontierConditions_GlobalTag_cff')
+from Configuration.AlCa.GlobalTag import GlobalTag
+process.GlobalTag = GlobalTag(process.GlobalTag, 'auto:run2_mc', '')
+
+process.maxEvents = cms.untracked.PSet(
+    input = cms.untracked.int32(-1)
+)
+
+process.source = cms.Source("PoolSource",
+    fileNames = cms.untracked.vstring('file:sparseClusterizer_step1.root')
+)
+
+process.load("RecoLocalTracker.SiPixelClusterizer.SiPixelClusterizer_cfi")
+process.siPixelClusters.src = "simSiPixelDigis"
+process.siPixelClustersSparse = process.siPixelClusters.clone(
+    ClusterMode = 'PixelSparseClusterizer'
+)
+
+process.compare = cms.EDAnalyzer("PixelClusterComparator",
+    reference = cms.InputTag("siPixelClusters"),
+    test = cms.InputTag("siPixelClustersSparse")
+)
+
+process.p = cms.Path(process.siPixelClusters * process.siPixelClustersSparse * process.compare)
@@ -70,6 +70,10 @@ class StripClusterizerAlgorithm {
   virtual void addFed(State & state, sistrip::FEDZSChannelUnpacker & unpacker, uint16_t ipair, output_t::TSFastFiller & out)  const {}
   virtual void stripByStripAdd(State & state, uint16_t strip, uint8_t adc, output_t::TSFastFiller & out)  const {}
   virtual void stripByStripEnd(State & state, output_t::TSFastFiller & out)  const {}
+  //! n strips (in increasing order) at once, e.g. all those of a FED channel
+  virtual void stripByStripAdd(State & state, const uint16_t* strips, const uint8_t* adcs, unsigned int n, output_t::TSFastFiller & out) const {
+    for (unsigned int i = 0; i < n; ++i) stripByStripAdd(state, strips[i], adcs[i], out);
+  }
 
 
   struct InvalidChargeException : public cms::Exception { public: InvalidChargeException(const SiStripDigi&); };
@@ -42,6 +42,10 @@ class ThreeThresholdAlgorithm final : public StripClusterizerAlgorithm {
 
   void stripByStripEnd(State & state, output_t::TSFastFiller & out) const override { endCandidate(state,out);}
 
+  void stripByStripAdd(State & state, const uint16_t* strips, const uint8_t* adcs, unsigned int n, output_t::TSFastFiller & out) const override {
+    addStrips(state, strips, adcs, n, out);
+  }
+
 
  private:
 
@@ -61,6 +65,9 @@ class ThreeThresholdAlgorithm final : public StripClusterizerAlgorithm {
     void clearCandidate(State & state) const { state.candidateLacksSeed = true;  state.noiseSquared = 0;  state.ADCs.clear();}
     void addToCandidate(State & state, const SiStripDigi& digi) const { addToCandidate(state, digi.strip(),digi.adc());}
     void addToCandidate(State & state, uint16_t strip, uint8_t adc) const;
+    void addGoodToCandidate(State & state, uint16_t strip, uint8_t adc, float noise, bool seed) const;
+    //the thresholds of n strips are computed first on flat arrays, then the candidates are built
+    template<class T> void addStrips(State & state, const uint16_t* strips, const uint8_t* adcs, unsigned int n, T& out) const;
     void appendBadNeighbors(State & state) const;
     void applyGains(State & state) const;
 
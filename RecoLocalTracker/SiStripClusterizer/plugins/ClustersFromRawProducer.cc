@@ -359,7 +359,15 @@ namespace {
     return out;
   }
 
-  class StripByStripAdder {
+  //the strips of a FED channel, given to the clusterizer in one go
+  struct StripBatch {
+    static constexpr unsigned int kMaxStrips = 256;
+    uint16_t strips[kMaxStrips];
+    uint8_t adcs[kMaxStrips];
+    unsigned int n = 0;
+  };
+
+  class StripCollector {
   public:
     typedef std::output_iterator_tag iterator_category;
     typedef void value_type;
@@ -367,24 +375,22 @@ namespace {
     typedef void pointer;
     typedef void reference;
 
-    StripByStripAdder(StripClusterizerAlgorithm& clusterizer,
-                      StripClusterizerAlgorithm::State& state,
-                      StripClusterizerAlgorithm::output_t::TSFastFiller& record)
-      : clusterizer_(clusterizer), state_(state), record_(record) {}
+    explicit StripCollector(StripBatch& batch) : batch_(&batch) {}
 
-    StripByStripAdder& operator= ( SiStripDigi digi )
+    StripCollector& operator= ( SiStripDigi digi )
     {
-      clusterizer_.stripByStripAdd(state_, digi.strip(), digi.adc(), record_);
+      if UNLIKELY(batch_->n == StripBatch::kMaxStrips) 
+        throw cms::Exception("InvalidChannel") << "more than " << StripBatch::kMaxStrips << " strips in a FED channel";
+      batch_->strips[batch_->n] = digi.strip();
+      batch_->adcs[batch_->n++] = digi.adc();
       return *this;
     }
 
-    StripByStripAdder& operator*  ()    { return *this; }
-    StripByStripAdder& operator++ ()    { return *this; }
-    StripByStripAdder& operator++ (int) { return *this; }
+    StripCollector& operator*  ()    { return *this; }
+    StripCollector& operator++ ()    { return *this; }
+    StripCollector& operator++ (int) { return *this; }
   private:
-    StripClusterizerAlgorithm& clusterizer_;
-    StripClusterizerAlgorithm::State& state_;
-    StripClusterizerAlgorithm::output_t::TSFastFiller& record_;
+    StripBatch* batch_;
   };
 }
 
@@ -444,9 +450,9 @@ try { // edmNew::CapacityExaustedException
     if LIKELY( ( mode > sistrip::READOUT_MODE_VIRGIN_RAW ) && ( mode < sistrip::READOUT_MODE_SPY ) && ( mode != sistrip::READOUT_MODE_PROC_RAW ) ) {
       // ZS modes
       try {
-        auto perStripAdder = StripByStripAdder(clusterizer, state, record);
+        StripBatch batch;
         if LIKELY( ! hybridZeroSuppressed_ ) {
-          unpackZS(buffer->channel(fedCh), mode, ipair*256, perStripAdder);
+          unpackZS(buffer->channel(fedCh), mode, ipair*256, StripCollector(batch));
         } else {
           const uint32_t id = conn->detId();
           edm::DetSet<SiStripDigi> unpDigis{id}; unpDigis.reserve(256);
@@ -455,8 +461,9 @@ try { // edmNew::CapacityExaustedException
           rawAlgos.convertHybridDigiToRawDigiVector(unpDigis, workRawDigis);
           edm::DetSet<SiStripDigi> suppDigis{id};
           rawAlgos.suppressHybridData(id, ipair*2, workRawDigis, suppDigis);
-          std::copy(std::begin(suppDigis), std::end(suppDigis), perStripAdder);
+          std::copy(std::begin(suppDigis), std::end(suppDigis), StripCollector(batch));
         }
+        clusterizer.stripByStripAdd(state, batch.strips, batch.adcs, batch.n, record);
       } catch (edmNew::CapacityExaustedException const&) {
         throw;
       } catch (const cms::Exception& e) {
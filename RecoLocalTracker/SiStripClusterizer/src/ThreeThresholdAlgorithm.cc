@@ -39,11 +39,53 @@ clusterizeDetUnit_(const digiDetSet& digis, output_t::TSFastFiller& output) cons
     ApvCleaner.clean(digis,scan,end);
   }
 
+  thread_local std::vector<uint16_t> strips;
+  thread_local std::vector<uint8_t> adcs;
+  strips.clear();
+  adcs.clear();
+  for( ; scan != end; ++scan) {
+    strips.push_back(scan->strip());
+    adcs.push_back(scan->adc());
+  }
+
   State state(det);
-  while( scan != end ) {
-    while( scan != end  && !candidateEnded(state, scan->strip() ) ) 
-      addToCandidate( state, *scan++);
-    endCandidate(state, output);
+  addStrips(state, strips.data(), adcs.data(), strips.size(), output);
+  endCandidate(state, output);
+}
+
+namespace {
+  struct StripFlags {
+    std::vector<float> noise;
+    std::vector<uint8_t> good;  // above the channel threshold and not bad
+    std::vector<uint8_t> seed;
+  };
+}
+
+template<class T>
+inline
+void ThreeThresholdAlgorithm::
+addStrips(State & state, const uint16_t* strips, const uint8_t* adcs, unsigned int n, T& out) const {
+  thread_local StripFlags flags;
+  flags.noise.resize(n);
+  flags.good.resize(n);
+  flags.seed.resize(n);
+  float * noise = flags.noise.data();
+  uint8_t * good = flags.good.data();
+  uint8_t * seed = flags.seed.data();
+
+  auto const & det = state.det();
+  for(unsigned int i = 0; i < n; ++i) noise[i] = det.noise(strips[i]);
+  for(unsigned int i = 0; i < n; ++i) {
+    good[i] = adcs[i] >= static_cast<uint8_t>( noise[i] * ChannelThreshold);
+    seed[i] = adcs[i] >= static_cast<uint8_t>( noise[i] * SeedThreshold);
+  }
+  //the quality is only looked up for the strips above threshold, as in addToCandidate
+  for(unsigned int i = 0; i < n; ++i) if(good[i]) good[i] = !det.bad(strips[i]);
+
+  //the end of a candidate depends on the holes, i.e. on all the strips
+  for(unsigned int i = 0; i < n; ++i) {
+    if(candidateEnded(state, strips[i])) endCandidate(state, out);
+    if(good[i]) addGoodToCandidate(state, strips[i], adcs[i], noise[i], seed[i]);
   }
 }
 
@@ -67,12 +109,18 @@ addToCandidate(State & state, uint16_t strip, uint8_t adc) const {
   if(  adc < static_cast<uint8_t>( Noise * ChannelThreshold) || state.det().bad(strip) )
     return;
 
-  if(state.candidateLacksSeed) state.candidateLacksSeed  =  adc < static_cast<uint8_t>( Noise * SeedThreshold);
+  addGoodToCandidate(state, strip, adc, Noise, adc >= static_cast<uint8_t>( Noise * SeedThreshold));
+}
+
+inline 
+void ThreeThresholdAlgorithm::
+addGoodToCandidate(State & state, uint16_t strip, uint8_t adc, float noise, bool seed) const { 
+  if(state.candidateLacksSeed) state.candidateLacksSeed  =  !seed;
   if(state.ADCs.empty()) state.lastStrip = strip - 1; // begin candidate
   while( ++state.lastStrip < strip ) state.ADCs.push_back(0); // pad holes
 
   state.ADCs.push_back( adc );
-  state.noiseSquared += Noise*Noise;
+  state.noiseSquared += noise*noise;
 }
 
 template <class T>
@@ -17,6 +17,7 @@ Implementation:
 
 #include "RecoMET/METAlgorithms/interface/METSignificance.h"
 #include <unordered_set>
+#include <vector>
 
 namespace {
 	struct ptr_hash : public std::unary_function<reco::CandidatePtr, std::size_t> {
@@ -80,10 +81,13 @@ metsig::METSignificance::getCovariance(const edm::View<reco::Jet>& jets,
      }
    }
    // subtract jets out of sumPt
+   std::vector<bool> cleanJets;
+   cleanJets.reserve(jets.size());
    for(const auto& jet : jets) {
 
      // disambiguate jets and leptons
-     if(!cleanJet(jet, leptons) ) continue;
+     cleanJets.push_back(cleanJet(jet, leptons));
+     if(!cleanJets.back() ) continue;
      for( unsigned int n=0; n < jet.numberOfSourceCandidatePtrs(); n++){
        if( jet.sourceCandidatePtr(n).isNonnull() and jet.sourceCandidatePtr(n).isAvailable() ){
 
@@ -93,6 +97,11 @@ metsig::METSignificance::getCovariance(const edm::View<reco::Jet>& jets,
 
    }
 
+   // footprint momenta for the dP4 recovery, dereferenced once
+   std::vector<reco::Candidate::LorentzVector> footprintP4;
+   footprintP4.reserve(footprint.size());
+   for( const auto& it : footprint) footprintP4.push_back(it->p4());
+
    // calculate sumPt
    double sumPt = 0;
    for(size_t i = 0; i< pfCandidates->size();  ++i) {
@@ -102,8 +111,9 @@ metsig::METSignificance::getCovariance(const edm::View<reco::Jet>& jets,
      if(footprint.find( pfCandidates->ptrAt(i) )==footprint.end()) {
 
        //dP4 recovery
-       for( const auto& it : footprint) {
-	 if( (it->p4()-(*pfCandidates)[i].p4()).Et2()<0.000025 ){
+       const reco::Candidate::LorentzVector& p4 = (*pfCandidates)[i].p4();
+       for( const auto& fp4 : footprintP4) {
+	 if( (fp4-p4).Et2()<0.000025 ){
 	   cleancand = false;
 	   break;
 	 }
@@ -116,10 +126,11 @@ metsig::METSignificance::getCovariance(const edm::View<reco::Jet>& jets,
    }
    
    // add jets to metsig covariance matrix and subtract them from sumPt
-   for(const auto& jet : jets) {
+   for(size_t ij = 0; ij < jets.size(); ++ij) {
+     const auto& jet = jets[ij];
      
      // disambiguate jets and leptons
-     if(!cleanJet(jet, leptons) ) continue;
+     if(!cleanJets[ij] ) continue;
 
       double jpt  = jet.pt();
       double jeta = jet.eta();
@@ -183,47 +183,26 @@ MuonCandidate::CandidateContainer L3MuonTrajectoryBuilder::trajectories(const Tr
 //
 std::vector<L3MuonTrajectoryBuilder::TrackCand> L3MuonTrajectoryBuilder::makeTkCandCollection(const TrackCand& staCand) {
   const std::string category = "Muon|RecoMuon|L3MuonTrajectoryBuilder|makeTkCandCollection";
-  std::vector<TrackCand> tkCandColl;
   std::vector<TrackCand> tkTrackCands;
   
-//  for (auto&& tkTrack: allTrackerTracks){
-//    auto tkCand = TrackCand((Trajectory*)(0),tkTrack);
+  // Loop over allTrackerTracks, making a TrackCand for each track passing the filters
   for ( unsigned int position = 0; position != allTrackerTracks->size(); ++position ) {
-    reco::TrackRef tkTrackRef(allTrackerTracks,position);
-    TrackCand tkCand = TrackCand((Trajectory*)nullptr,tkTrackRef);
-    tkCandColl.push_back(tkCand);
-  }
-
-  //Loop over TrackCand collection made from allTrackerTracks in previous step
-  for (auto&& tkCand: tkCandColl){
-	  auto& tk = tkCand.second;
-	  bool canUseL3MTS = false;
-	  // check the seedRef is non-null first; and then
-	  if (tk->seedRef().isNonnull()){
-		  auto a = dynamic_cast<const L3MuonTrajectorySeed*>(tk->seedRef().get());
-		  canUseL3MTS = a != nullptr;
-	  }
-    if (canUseL3MTS){
-    	edm::Ref<L3MuonTrajectorySeedCollection> l3seedRef = tk->seedRef().castTo<edm::Ref<L3MuonTrajectorySeedCollection> >() ;
-    	// May still need provenance here, so using trackref:
-    	reco::TrackRef staTrack = l3seedRef->l2Track();
-    	if( staTrack == (staCand.second) ) {
-    		// Apply filters (dxy, chi2 cut)
-    		double tk_vtx;
-    		if( theUseVertex ) tk_vtx = tk->dxy(vtx.position());
-    		else tk_vtx = tk->dxy(beamSpot.position());
-    		if( fabs(tk_vtx) > theDXYBeamSpot || tk->normalizedChi2() > theMaxChi2 ) continue;
-    		tkTrackCands.push_back(tkCand);
-    	}
-    }
-    else{
-    	// We will try to match all tracker tracks with the muon:
-        double tk_vtx;
-        if( theUseVertex ) tk_vtx = tk->dxy(vtx.position());
-        else tk_vtx = tk->dxy(beamSpot.position());
-        if( fabs(tk_vtx) > theDXYBeamSpot || tk->normalizedChi2() > theMaxChi2 ) continue;
-        tkTrackCands.push_back(tkCand);
+    reco::TrackRef tk(allTrackerTracks,position);
+    // check the seedRef is non-null first; and then
+    if (tk->seedRef().isNonnull() && dynamic_cast<const L3MuonTrajectorySeed*>(tk->seedRef().get()) != nullptr) {
+      edm::Ref<L3MuonTrajectorySeedCollection> l3seedRef = tk->seedRef().castTo<edm::Ref<L3MuonTrajectorySeedCollection> >() ;
+      // May still need provenance here, so using trackref:
+      reco::TrackRef staTrack = l3seedRef->l2Track();
+      if( staTrack != (staCand.second) ) continue;
     }
+    // else we will try to match all tracker tracks with the muon
+
+    // Apply filters (dxy, chi2 cut)
+    double tk_vtx;
+    if( theUseVertex ) tk_vtx = tk->dxy(vtx.position());
+    else tk_vtx = tk->dxy(beamSpot.position());
+    if( fabs(tk_vtx) > theDXYBeamSpot || tk->normalizedChi2() > theMaxChi2 ) continue;
+    tkTrackCands.push_back(TrackCand((Trajectory*)nullptr,tk));
   }
 
   return tkTrackCands;
@@ -33,6 +33,8 @@
 
 #include "RecoMuon/MuonIdentification/interface/MuonKinkFinder.h"
 
+#include <unordered_map>
+
 MuonIdProducer::MuonIdProducer(const edm::ParameterSet& iConfig):
 muIsoExtractorCalo_(nullptr),muIsoExtractorTrack_(nullptr),muIsoExtractorJet_(nullptr)
 {
@@ -1018,6 +1020,17 @@ void MuonIdProducer::fillArbitrationInfo( reco::MuonCollection* pOutputMuons, un
    std::vector<std::pair<reco::MuonChamberMatch*,reco::MuonSegmentMatch*> > stationPairs;     // for station segment sorting
    std::vector<std::pair<reco::MuonChamberMatch*,reco::MuonSegmentMatch*> > arbitrationPairs; // for muon segment arbitration
 
+   // chamber matches of the muons of muonType per chamber, in muon then match order:
+   // identical segments are in the same chamber, so only these are looked at for arbitration
+   std::unordered_map<uint32_t, std::vector<std::pair<unsigned int,reco::MuonChamberMatch*> > > chambersById;
+   for( unsigned int muonIndex = 0; muonIndex < pOutputMuons->size(); ++muonIndex )
+   {
+     auto& muon = pOutputMuons->at(muonIndex);
+     if ( !(muon.type() & muonType) ) continue;
+     for ( auto& chamber : muon.matches() )
+       chambersById[chamber.id.rawId()].push_back(std::make_pair(muonIndex, &chamber));
+   }
+
    // muonIndex1
    for( unsigned int muonIndex1 = 0; muonIndex1 < pOutputMuons->size(); ++muonIndex1 )
    {
@@ -1042,34 +1055,29 @@ void MuonIdProducer::fillArbitrationInfo( reco::MuonCollection* pOutputMuons, un
            // find identical segments with which to arbitrate
            // tracker muons only
            if (muon1.type() & muonType) {
-             // muonIndex2
-             for( unsigned int muonIndex2 = muonIndex1+1; muonIndex2 < pOutputMuons->size(); ++muonIndex2 )
+             // muonIndex2, chamberIter2
+             for ( const auto& muonChamber2 : chambersById[chamber1.id.rawId()] )
              {
-               auto& muon2 = pOutputMuons->at(muonIndex2);
-               // tracker muons only
-               if ( !(muon2.type() & muonType) ) continue;
-               // chamberIter2
-               for ( auto& chamber2 : muon2.matches() )
+               if ( muonChamber2.first <= muonIndex1 ) continue;
+               reco::MuonChamberMatch& chamber2 = *muonChamber2.second;
+               // segmentIter2
+               std::vector<reco::MuonSegmentMatch> * segmentMatches2 = getSegmentMatches(chamber2, muonType);
+               for ( auto& segment2 : *segmentMatches2 )
                {
-                 // segmentIter2
-                 std::vector<reco::MuonSegmentMatch> * segmentMatches2 = getSegmentMatches(chamber2, muonType);
-                 for ( auto& segment2 : *segmentMatches2 )
+                 if(segment2.isMask()) continue; // has already been arbitrated
+                 if(approxEqual(segment2.x      , segment1.x      ) &&
+                    approxEqual(segment2.y      , segment1.y      ) &&
+                    approxEqual(segment2.dXdZ   , segment1.dXdZ   ) &&
+                    approxEqual(segment2.dYdZ   , segment1.dYdZ   ) &&
+                    approxEqual(segment2.xErr   , segment1.xErr   ) &&
+                    approxEqual(segment2.yErr   , segment1.yErr   ) &&
+                    approxEqual(segment2.dXdZErr, segment1.dXdZErr) &&
+                    approxEqual(segment2.dYdZErr, segment1.dYdZErr))
                  {
-                   if(segment2.isMask()) continue; // has already been arbitrated
-                   if(approxEqual(segment2.x      , segment1.x      ) &&
-                      approxEqual(segment2.y      , segment1.y      ) &&
-                      approxEqual(segment2.dXdZ   , segment1.dXdZ   ) &&
-                      approxEqual(segment2.dYdZ   , segment1.dYdZ   ) &&
-                      approxEqual(segment2.xErr   , segment1.xErr   ) &&
-                      approxEqual(segment2.yErr   , segment1.yErr   ) &&
-                      approxEqual(segment2.dXdZErr, segment1.dXdZErr) &&
-                      approxEqual(segment2.dYdZErr, segment1.dYdZErr))
-                   {
-                     arbitrationPairs.push_back(std::make_pair(&chamber2, &segment2));
-                   }
-                 } // segmentIter2
-               } // chamberIter2
-             } // muonIndex2
+                   arbitrationPairs.push_back(std::make_pair(&chamber2, &segment2));
+                 }
+               } // segmentIter2
+             } // muonIndex2, chamberIter2
            }
 
            // arbitration segment sort
@@ -104,7 +104,8 @@ buildClusters(const reco::PFClusterCollection& input,
     seedPFClustersFromTopo(topocluster,seedable,clustersInTopo);
     const unsigned tolScal = 
       std::pow(std::max(1.0,clustersInTopo.size()-1.0),2.0);
-    growPFClusters(topocluster,seedable,tolScal,0,tolScal,clustersInTopo);
+    const pfclustering::TopoHitTable topoHits = makeTopoHitTable(topocluster,seedable);
+    growPFClusters(topocluster,topoHits,tolScal,0,tolScal,clustersInTopo);
     // step added by Josh Bendavid, removes low-fraction clusters
     // did not impact position resolution with fraction cut of 1e-7
     // decreases the size of each pf cluster considerably
@@ -145,13 +146,50 @@ seedPFClustersFromTopo(const reco::PFCluster& topo,
   }
 }
 
+pfclustering::TopoHitTable Basic2DGenericPFlowClusterizer::
+makeTopoHitTable(const reco::PFCluster& topo,
+		 const std::vector<bool>& seedable) const {
+  using namespace pfclustering;
+  // the positions, norms and seed flags of the rechits do not change
+  // between the iterations, look them up once per topo cluster
+  auto energyNorm = [this](const reco::PFRecHitFraction& rhf) {
+    const reco::PFRecHitRef& refhit = rhf.recHitRef();
+    int cell_layer = (int)refhit->layer();
+    if( cell_layer == PFLayer::HCAL_BARREL2 && 
+	std::abs(refhit->positionREP().eta()) > 0.34 ) {
+      cell_layer *= 100;
+    }  
+
+    double recHitEnergyNorm=0.;
+    auto const& recHitEnergyNormDepthPair = _recHitEnergyNorms.find(cell_layer)->second;
+
+    for (unsigned int j=0; j<recHitEnergyNormDepthPair.second.size(); ++j) {
+      int depth=recHitEnergyNormDepthPair.first[j];
+
+      if( ( cell_layer == PFLayer::HCAL_BARREL1 && refhit->depth()== depth)
+	  || ( cell_layer == PFLayer::HCAL_ENDCAP && refhit->depth()== depth)
+	  || ( cell_layer != PFLayer::HCAL_ENDCAP && cell_layer != PFLayer::HCAL_BARREL1)
+	  ) recHitEnergyNorm = recHitEnergyNormDepthPair.second[j];
+    }
+    return recHitEnergyNorm;
+  };
+  return TopoHitTable(topo.recHitFractions(), edm::soa::column_fillers(
+    PosX::filler([](const reco::PFRecHitFraction& rhf) { return (double)rhf.recHitRef()->position().x(); }),
+    PosY::filler([](const reco::PFRecHitFraction& rhf) { return (double)rhf.recHitRef()->position().y(); }),
+    PosZ::filler([](const reco::PFRecHitFraction& rhf) { return (double)rhf.recHitRef()->position().z(); }),
+    RawDetId::filler([](const reco::PFRecHitFraction& rhf) { return (uint32_t)rhf.recHitRef()->detId(); }),
+    Seedable::filler([&seedable](const reco::PFRecHitFraction& rhf) { return (bool)seedable[rhf.recHitRef().key()]; }),
+    EnergyNorm::filler(energyNorm)));
+}
+
 void Basic2DGenericPFlowClusterizer::
 growPFClusters(const reco::PFCluster& topo,
-	       const std::vector<bool>& seedable,
+	       const pfclustering::TopoHitTable& topoHits,
 	       const unsigned toleranceScaling,
 	       const unsigned iter,
 	       double diff,
 	       reco::PFClusterCollection& clusters) const {
+  using namespace pfclustering;
   if( iter >= _maxIterations ) {
     LOGDRESSED("Basic2DGenericPFlowClusterizer:growAndStabilizePFClusters")
       <<"reached " << _maxIterations << " iterations, terminated position "
@@ -173,38 +211,39 @@ growPFClusters(const reco::PFCluster& topo,
     }
     cluster.resetHitsAndFractions();
   }
-  // loop over topo cluster and grow current PFCluster hypothesis 
-  std::vector<double> dist2, frac;
-  double fractot = 0;
-  for( const reco::PFRecHitFraction& rhf : topo.recHitFractions() ) {
-    const reco::PFRecHitRef& refhit = rhf.recHitRef();
-    int cell_layer = (int)refhit->layer();
-    if( cell_layer == PFLayer::HCAL_BARREL2 && 
-	std::abs(refhit->positionREP().eta()) > 0.34 ) {
-      cell_layer *= 100;
-    }  
-
-    math::XYZPoint topocellpos_xyz(refhit->position());
-    dist2.clear(); frac.clear(); fractot = 0;
-
-    double recHitEnergyNorm=0.;
-    auto const& recHitEnergyNormDepthPair = _recHitEnergyNorms.find(cell_layer)->second;
+  // the cluster positions and energies stay fixed while the rechits are shared
+  const ClusterTable clus(clusters, edm::soa::column_fillers(
+    PosX::filler([](const reco::PFCluster& c) { return c.position().x(); }),
+    PosY::filler([](const reco::PFCluster& c) { return c.position().y(); }),
+    PosZ::filler([](const reco::PFCluster& c) { return c.position().z(); }),
+    Energy::filler([](const reco::PFCluster& c) { return c.energy(); }),
+    RawDetId::filler([](const reco::PFCluster& c) { return c.seed().rawId(); })));
+  const double* clus_x = clus.column<PosX>().begin();
+  const double* clus_y = clus.column<PosY>().begin();
+  const double* clus_z = clus.column<PosZ>().begin();
+  const double* clus_energy = clus.column<Energy>().begin();
+  const uint32_t* clus_seed = clus.column<RawDetId>().begin();
+  const unsigned nclus = clusters.size();
 
-    for (unsigned int j=0; j<recHitEnergyNormDepthPair.second.size(); ++j) {
-      int depth=recHitEnergyNormDepthPair.first[j];
-
-      if( ( cell_layer == PFLayer::HCAL_BARREL1 && refhit->depth()== depth)
-	  || ( cell_layer == PFLayer::HCAL_ENDCAP && refhit->depth()== depth)
-	  || ( cell_layer != PFLayer::HCAL_ENDCAP && cell_layer != PFLayer::HCAL_BARREL1)
-	  ) recHitEnergyNorm = recHitEnergyNormDepthPair.second[j];
-    }
+  // loop over topo cluster and grow current PFCluster hypothesis 
+  std::vector<double> dist2(nclus), frac(nclus);
+  const auto& recHitFractions = topo.recHitFractions();
+  for( unsigned ihit = 0; ihit < topoHits.size(); ++ihit ) {
+    const double hit_x = topoHits.get<PosX>(ihit);
+    const double hit_y = topoHits.get<PosY>(ihit);
+    const double hit_z = topoHits.get<PosZ>(ihit);
+    const uint32_t hit_detId = topoHits.get<RawDetId>(ihit);
+    const bool hit_seedable = topoHits.get<Seedable>(ihit);
+    const double recHitEnergyNorm = topoHits.get<EnergyNorm>(ihit);
 
     // add rechits to clusters, calculating fraction based on distance
-    for( auto& cluster : clusters ) {      
-      const math::XYZPoint& clusterpos_xyz = cluster.position();
-      const math::XYZVector deltav = clusterpos_xyz - topocellpos_xyz;
-      const double d2 = deltav.Mag2()/_showerSigma2;
-      dist2.emplace_back( d2 );
+    double fractot = 0;
+    for( unsigned i = 0; i < nclus; ++i ) {
+      const double dx = clus_x[i] - hit_x;
+      const double dy = clus_y[i] - hit_y;
+      const double dz = clus_z[i] - hit_z;
+      const double d2 = (dx*dx + dy*dy + dz*dz)/_showerSigma2;
+      dist2[i] = d2;
       if( d2 > 100 ) {
 	LOGDRESSED("Basic2DGenericPFlowClusterizer:growAndStabilizePFClusters")
 	  << "Warning! :: pfcluster-topocell distance is too large! d= "
@@ -213,19 +252,19 @@ growPFClusters(const reco::PFCluster& topo,
 
       // fraction assignment logic
       double fraction;
-      if( refhit->detId() == cluster.seed() && _excludeOtherSeeds ) {
+      if( hit_detId == clus_seed[i] && _excludeOtherSeeds ) {
 	fraction = 1.0;	
-      } else if ( seedable[refhit.key()] && _excludeOtherSeeds ) {
+      } else if ( hit_seedable && _excludeOtherSeeds ) {
 	fraction = 0.0;
       } else {
-	fraction = cluster.energy()/recHitEnergyNorm * vdt::fast_expf( -0.5*d2 );
+	fraction = clus_energy[i]/recHitEnergyNorm * vdt::fast_expf( -0.5*d2 );
       }      
       fractot += fraction;
-      frac.emplace_back(fraction);
+      frac[i] = fraction;
     }
-    for( unsigned i = 0; i < clusters.size(); ++i ) {      
+    for( unsigned i = 0; i < nclus; ++i ) {      
       if( fractot > _minFracTot || 
-	  ( refhit->detId() == clusters[i].seed() && fractot > 0.0 ) ) {
+	  ( hit_detId == clus_seed[i] && fractot > 0.0 ) ) {
 	frac[i]/=fractot;
       } else {
 	continue;
@@ -242,7 +281,7 @@ growPFClusters(const reco::PFCluster& topo,
       // they create fake photons, in general.
       // (PJ, 16/09/08) 
       if( dist2[i] < 100.0 || frac[i] > 0.9999 ) {	
-	clusters[i].addRecHitFraction(reco::PFRecHitFraction(refhit,frac[i]));
+	clusters[i].addRecHitFraction(reco::PFRecHitFraction(recHitFractions[ihit].recHitRef(),frac[i]));
       }
     }
   }
@@ -264,7 +303,7 @@ growPFClusters(const reco::PFCluster& topo,
   }
   diff = std::sqrt(diff2);
   dist2.clear(); frac.clear(); clus_prev_pos.clear();// avoid badness
-  growPFClusters(topo,seedable,toleranceScaling,iter+1,diff,clusters);
+  growPFClusters(topo,topoHits,toleranceScaling,iter+1,diff,clusters);
 }
 
 void Basic2DGenericPFlowClusterizer::
@@ -3,9 +3,26 @@
 
 #include "RecoParticleFlow/PFClusterProducer/interface/PFClusterBuilderBase.h"
 #include "DataFormats/ParticleFlowReco/interface/PFRecHitFraction.h"
+#include "FWCore/SOA/interface/Column.h"
+#include "FWCore/SOA/interface/Table.h"
 
 #include <unordered_map>
 
+// flat columns of the rechits of a topo cluster and of the clusters being grown
+// in it, the rows of the rechit table follow the rechit fractions of the topo cluster
+namespace pfclustering {
+  SOA_DECLARE_COLUMN(PosX, double, "x");
+  SOA_DECLARE_COLUMN(PosY, double, "y");
+  SOA_DECLARE_COLUMN(PosZ, double, "z");
+  SOA_DECLARE_COLUMN(RawDetId, uint32_t, "detId");
+  SOA_DECLARE_COLUMN(Seedable, bool, "seedable");
+  SOA_DECLARE_COLUMN(EnergyNorm, double, "recHitEnergyNorm");
+  SOA_DECLARE_COLUMN(Energy, double, "energy");
+
+  using TopoHitTable = edm::soa::Table<PosX, PosY, PosZ, RawDetId, Seedable, EnergyNorm>;
+  using ClusterTable = edm::soa::Table<PosX, PosY, PosZ, Energy, RawDetId>;
+}
+
 class Basic2DGenericPFlowClusterizer : public PFClusterBuilderBase {
   typedef Basic2DGenericPFlowClusterizer B2DGPF;
  public:
@@ -41,8 +58,11 @@ class Basic2DGenericPFlowClusterizer : public PFClusterBuilderBase {
 			      const std::vector<bool>&,
 			      reco::PFClusterCollection&) const;
 
+  pfclustering::TopoHitTable makeTopoHitTable(const reco::PFCluster&,
+					      const std::vector<bool>&) const;
+
   void growPFClusters(const reco::PFCluster&,
-		      const std::vector<bool>&,
+		      const pfclustering::TopoHitTable&,
 		      const unsigned toleranceScaling,
 		      const unsigned iter,
 		      double dist,
@@ -72,6 +72,24 @@ class PFEGammaAlgo {
   typedef std::unordered_map<unsigned int, std::vector<unsigned int> > AsscMap;
   typedef std::vector<std::pair<const reco::PFBlockElement*,
     const reco::PFBlockElement*> > ElementMap;
+
+  // the elements linked to each element of a block, in the order of
+  // PFBlock::associatedElements with LINKTEST_ALL (increasing distance),
+  // computed once per block from its link data
+  class BlockAssociations {
+  public:
+    typedef std::pair<float,unsigned> Association;
+    void fill(const reco::PFBlockRef& block);
+    const reco::PFBlock& block() const { return *block_; }
+    const Association* begin(unsigned i) const { return associations_.data() + offsets_[i]; }
+    const Association* end(unsigned i) const { return associations_.data() + offsets_[i+1]; }
+    // same as PFBlock::dist, -1 if the elements are not linked
+    float dist(unsigned i, unsigned j) const;
+  private:
+    reco::PFBlockRef block_;
+    std::vector<unsigned> offsets_;
+    std::vector<Association> associations_;
+  };
   typedef std::unordered_map<const PFGSFElement*, 
     std::vector<PFKFFlaggedElement> > GSFToTrackMap;
   typedef std::unordered_map<const PFClusterElement*, 
@@ -199,6 +217,7 @@ private:
   edm::Handle<reco::PFCluster::EEtoPSAssociation> eetops_;
   reco::PFBlockRef _currentblock;
   reco::PFBlock::LinkData _currentlinks;  
+  BlockAssociations _currentassociations;
   // keep a map of pf indices to the splayed block for convenience
   // sadly we're mashing together two ways of thinking about the block
   std::vector<std::vector<PFFlaggedElement> > _splayedblock; 
@@ -522,6 +522,10 @@ void PFAlgo::reconstructParticles( const reco::PFBlockCollection& blocks ) {
 
   // loop on blocks that are not single ecal, 
   // and not single hcal.
+  // the blocks are processed one after the other: the candidates of a block
+  // are indexed in pfCandidates_ while they are built, the electron and photon
+  // algorithms keep the results of the last block, and the energy calibrations
+  // evaluate shared TF1s, which are not safe to call from several threads
 
   unsigned nblcks = 0;
   for( IBR io = otherBlockRefs.begin(); io!=otherBlockRefs.end(); ++io) {
@@ -11,6 +11,9 @@
 #include <algorithm>
 #include "TMath.h"
 
+#include "tbb/task_arena.h"
+#include "tbb/tbb.h"
+
 using namespace std;
 using namespace reco;
 
@@ -153,37 +156,54 @@ PFBlockAlgo::~PFBlockAlgo() {
 
 void PFBlockAlgo::findBlocks() {
   // Glowinski & Gouzevitch
-  for( const auto& kdtree : kdtrees_ ) {
-    kdtree->process();
-  }  
+  // the trees are independent: each of them only sets the multilinks of the
+  // elements of one of its two types, and the trees have different types
+  tbb::this_task_arena::isolate([&] {
+    tbb::parallel_for(size_t(0), kdtrees_.size(), [&](size_t i) {
+      kdtrees_[i]->process();
+    });
+  });
   // !Glowinski & Gouzevitch
   // the blocks have not been passed to the event, and need to be cleared
   if( blocks_.get() ) blocks_->clear();
   else                blocks_.reset( new reco::PFBlockCollection );
   blocks_->reserve(elements_.size());
 
-  QuickUnion qu(bare_elements_.size());
+  // the links of each element with the next ones are tested in parallel, then
+  // merged in the order of the elements so that the blocks do not depend on
+  // the scheduling
   const auto elem_size = bare_elements_.size();
-  for( unsigned i = 0; i < elem_size; ++i ) {
-    for( unsigned j = 0; j < elem_size; ++j ) {
-      if( qu.connected(i,j) || j == i ) continue;
-      if( !linkTests_[linkTestSquare_[bare_elements_[i]->type()][bare_elements_[j]->type()]] ) {
-        j = ranges_[bare_elements_[j]->type()].second;
-        continue;
-      }
-      auto p1(bare_elements_[i]), p2(bare_elements_[j]);
-      const PFBlockElement::Type type1 = p1->type();
-      const PFBlockElement::Type type2 = p2->type();
-      const unsigned index = linkTestSquare_[type1][type2];
-      if( linkTests_[index]->linkPrefilter(p1,p2) ) {
-        const double dist = linkTests_[index]->testLink(p1,p2);
-        // compute linking info if it is possible
-        if( dist > -0.5 ) {
-          qu.unite(i,j);
+  std::vector<std::vector<unsigned> > linked(elem_size);
+  tbb::this_task_arena::isolate([&] {
+    tbb::parallel_for(0U, (unsigned)elem_size, [&](unsigned i) {
+      for( unsigned j = 0; j < elem_size; ++j ) {
+        if( j == i ) continue;
+        if( !linkTests_[linkTestSquare_[bare_elements_[i]->type()][bare_elements_[j]->type()]] ) {
+          j = ranges_[bare_elements_[j]->type()].second;
+          continue;
+        }
+        auto p1(bare_elements_[i]), p2(bare_elements_[j]);
+        const PFBlockElement::Type type1 = p1->type();
+        const PFBlockElement::Type type2 = p2->type();
+        const unsigned index = linkTestSquare_[type1][type2];
+        if( linkTests_[index]->linkPrefilter(p1,p2) ) {
+          const double dist = linkTests_[index]->testLink(p1,p2);
+          // compute linking info if it is possible
+          if( dist > -0.5 ) {
+            linked[i].push_back(j);
+          }
         }
       }
+    });
+  });
+
+  QuickUnion qu(bare_elements_.size());
+  for( unsigned i = 0; i < elem_size; ++i ) {
+    for( unsigned j : linked[i] ) {
+      if( !qu.connected(i,j) ) qu.unite(i,j);
     }
   }
+  linked.clear();
   
   std::unordered_multimap<unsigned,unsigned> blocksmap(elements_.size());
   std::vector<unsigned> keys;
@@ -198,36 +218,38 @@ void PFBlockAlgo::findBlocks() {
     blocksmap.emplace(key,i);
   }
 
-  PFBlockLink::Type linktype = PFBlockLink::NONE;
-  PFBlock::LinkTest linktest = PFBlock::LINKTEST_RECHIT;
-  for( auto key : keys ) {
-    blocks_->push_back( reco::PFBlock() );
-    auto range = blocksmap.equal_range(key);
-    auto& the_block = blocks_->back();
-    ElementList::value_type::pointer p1(bare_elements_[range.first->second]);
-    the_block.addElement(p1);
-    const unsigned block_size = blocksmap.count(key) + 1;
-    //reserve up to 1M or 8MB; pay rehash cost for more
-    std::unordered_map<std::pair<unsigned int,unsigned int>, PFBlockLink > links(min(1000000u,block_size*block_size));
-    auto itr = range.first;
-    ++itr;
-    for( ; itr != range.second; ++itr ) {
-      ElementList::value_type::pointer p2(bare_elements_[itr->second]);
-      const PFBlockElement::Type type1 = p1->type();
-      const PFBlockElement::Type type2 = p2->type();        
-      the_block.addElement(p2);
-      linktest = PFBlock::LINKTEST_RECHIT; //rechit by default 
-      linktype = static_cast<PFBlockLink::Type>(1<<(type1-1)|1<<(type2-1));
-      const unsigned index = linkTestSquare_[type1][type2];
-      if( nullptr != linkTests_[index] ) {
-        const double dist = linkTests_[index]->testLink(p1,p2);
-        links.emplace( std::make_pair(p1->index(), p2->index()) ,
-                       PFBlockLink( linktype, linktest, dist,
-                                    p1->index(), p2->index() ) );
+  // each element belongs to a single block, the blocks are filled in parallel
+  blocks_->resize(keys.size());
+  tbb::this_task_arena::isolate([&] {
+    tbb::parallel_for(size_t(0), keys.size(), [&](size_t iblock) {
+      const unsigned key = keys[iblock];
+      auto range = blocksmap.equal_range(key);
+      auto& the_block = (*blocks_)[iblock];
+      ElementList::value_type::pointer p1(bare_elements_[range.first->second]);
+      the_block.addElement(p1);
+      const unsigned block_size = blocksmap.count(key) + 1;
+      //reserve up to 1M or 8MB; pay rehash cost for more
+      std::unordered_map<std::pair<unsigned int,unsigned int>, PFBlockLink > links(min(1000000u,block_size*block_size));
+      auto itr = range.first;
+      ++itr;
+      for( ; itr != range.second; ++itr ) {
+        ElementList::value_type::pointer p2(bare_elements_[itr->second]);
+        const PFBlockElement::Type type1 = p1->type();
+        const PFBlockElement::Type type2 = p2->type();        
+        the_block.addElement(p2);
+        const PFBlock::LinkTest linktest = PFBlock::LINKTEST_RECHIT; //rechit by default 
+        const PFBlockLink::Type linktype = static_cast<PFBlockLink::Type>(1<<(type1-1)|1<<(type2-1));
+        const unsigned index = linkTestSquare_[type1][type2];
+        if( nullptr != linkTests_[index] ) {
+          const double dist = linkTests_[index]->testLink(p1,p2);
+          links.emplace( std::make_pair(p1->index(), p2->index()) ,
+                         PFBlockLink( linktype, linktest, dist,
+                                      p1->index(), p2->index() ) );
+        }
       }
-    }
-    packLinks( the_block, links );    
-  }
+      packLinks( the_block, links );    
+    });
+  });
   
   bare_elements_.clear();
   elements_.clear();
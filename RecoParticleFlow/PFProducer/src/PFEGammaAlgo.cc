@@ -184,7 +184,7 @@ namespace {
   }; 
   
   template<bool useConvs=false>
-  bool elementNotCloserToOther(const reco::PFBlockRef& block,
+  bool elementNotCloserToOther(const PFEGammaAlgo::BlockAssociations& links,
 			       const PFBlockElement::Type& keytype,
 			       const size_t key, 
 			       const PFBlockElement::Type& valtype,
@@ -192,16 +192,17 @@ namespace {
 			       const float EoPin_cut = 1.0e6) {
     constexpr reco::PFBlockElement::TrackType ConvType =
 	reco::PFBlockElement::T_FROM_GAMMACONV;
+    const reco::PFBlock& block = links.block();
     // this is inside out but I just want something that works right now
     switch( keytype ) {
     case reco::PFBlockElement::GSF:
       {
 	const reco::PFBlockElementGsfTrack* elemasgsf  =  
 	  docast(const reco::PFBlockElementGsfTrack*,
-		 &(block->elements()[key]));
+		 &(block.elements()[key]));
 	if( elemasgsf && valtype == PFBlockElement::ECAL ) {
 	  const ClusterElement* elemasclus =
-	 reinterpret_cast<const ClusterElement*>(&(block->elements()[test]));
+	 reinterpret_cast<const ClusterElement*>(&(block.elements()[test]));
 	  float cluster_e = elemasclus->clusterRef()->correctedEnergy();
 	  float trk_pin   = elemasgsf->Pin().P();
 	  if( cluster_e / trk_pin > EoPin_cut ) {
@@ -216,10 +217,10 @@ namespace {
       {
 	const reco::PFBlockElementTrack* elemaskf  = 
 	  docast(const reco::PFBlockElementTrack*,
-		 &(block->elements()[key]));
+		 &(block.elements()[key]));
 	if( elemaskf && valtype == PFBlockElement::ECAL ) {
 	  const ClusterElement* elemasclus =
-	  reinterpret_cast<const ClusterElement*>(&(block->elements()[test]));
+	  reinterpret_cast<const ClusterElement*>(&(block.elements()[test]));
 	  float cluster_e = elemasclus->clusterRef()->correctedEnergy();
 	  float trk_pin   = 
 	    std::sqrt(elemaskf->trackRef()->innerMomentum().mag2());
@@ -235,26 +236,25 @@ namespace {
       break;
     }	        
 
-    const float dist = 
-      block->dist(key,test,block->linkData(),reco::PFBlock::LINKTEST_ALL);
+    const float dist = links.dist(key,test);
     if( dist == -1.0f ) return false; // don't associate non-linked elems
-    std::multimap<double, unsigned> dists_to_val; 
-    block->associatedElements(test,block->linkData(),dists_to_val,keytype,
-			      reco::PFBlock::LINKTEST_ALL); 
   
-    for( const auto& valdist : dists_to_val ) {
+    for( auto assc = links.begin(test); assc != links.end(test); ++assc ) {
+      const auto& valdist = *assc;
       const size_t idx = valdist.second;
+      // the associated elements of the key type
+      if( valdist.first < 0 || block.elements()[idx].type() != keytype ) continue;
       // check track types for conversion info
       switch( keytype ) {
       case reco::PFBlockElement::GSF:
 	{
 	  const reco::PFBlockElementGsfTrack* elemasgsf  =  
 	    docast(const reco::PFBlockElementGsfTrack*,
-		   &(block->elements()[idx]));
+		   &(block.elements()[idx]));
 	  if( !useConvs && elemasgsf->trackType(ConvType) ) return false;
 	  if( elemasgsf && valtype == PFBlockElement::ECAL ) {
 	    const ClusterElement* elemasclus =
-	      docast(const ClusterElement*,&(block->elements()[test]));
+	      docast(const ClusterElement*,&(block.elements()[test]));
 	    float cluster_e = elemasclus->clusterRef()->correctedEnergy();
 	    float trk_pin   = elemasgsf->Pin().P();
 	    if( cluster_e / trk_pin > EoPin_cut ) continue;
@@ -265,11 +265,11 @@ namespace {
 	{
 	  const reco::PFBlockElementTrack* elemaskf  = 
 	    docast(const reco::PFBlockElementTrack*,
-		   &(block->elements()[idx]));
+		   &(block.elements()[idx]));
 	  if( !useConvs && elemaskf->trackType(ConvType) ) return false;
 	  if( elemaskf && valtype == PFBlockElement::ECAL ) {
 	    const ClusterElement* elemasclus =
-	    reinterpret_cast<const ClusterElement*>(&(block->elements()[test]));
+	    reinterpret_cast<const ClusterElement*>(&(block.elements()[test]));
 	    float cluster_e = elemasclus->clusterRef()->correctedEnergy();
 	    float trk_pin   = 
 	      std::sqrt(elemaskf->trackRef()->innerMomentum().mag2());
@@ -321,28 +321,23 @@ namespace {
 	   bool useConv=false>
   struct NotCloserToOther : public PFFlaggedElementMatcher {
     const reco::PFBlockElement* comp;
-    const reco::PFBlockRef& block;
-    const reco::PFBlock::LinkData& links;   
+    const PFEGammaAlgo::BlockAssociations& links;   
     const float EoPin_cut;
-    NotCloserToOther(const reco::PFBlockRef& b,
-		     const reco::PFBlock::LinkData& l,
+    NotCloserToOther(const PFEGammaAlgo::BlockAssociations& l,
 		     const PFFlaggedElement* e,
 		     const float EoPcut=1.0e6): comp(e->first), 
-						block(b), 
 						links(l),
 						EoPin_cut(EoPcut) { 
     }
-    NotCloserToOther(const reco::PFBlockRef& b,
-		     const reco::PFBlock::LinkData& l,
+    NotCloserToOther(const PFEGammaAlgo::BlockAssociations& l,
 		     const reco::PFBlockElement* e,
 		     const float EoPcut=1.0e6): comp(e), 
-						block(b), 
 						links(l),
 						EoPin_cut(EoPcut) {
     }
     bool operator () (const PFFlaggedElement& e) {        
       if( !e.second || valtype != e.first->type() ) return false;      
-      return elementNotCloserToOther<useConv>(block,
+      return elementNotCloserToOther<useConv>(links,
 					      keytype,comp->index(),
 					      valtype,e.first->index(),
 					      EoPin_cut);
@@ -380,7 +375,8 @@ namespace {
   };
   
   bool isROLinkedByClusterOrTrack(const PFEGammaAlgo::ProtoEGObject& RO1,
-				  const PFEGammaAlgo::ProtoEGObject& RO2 ) {
+				  const PFEGammaAlgo::ProtoEGObject& RO2,
+				  const PFEGammaAlgo::BlockAssociations& blk ) {
     // also don't allow ROs where both have clusters
     // and GSF tracks to merge (10 Dec 2013)
     if(!RO1.primaryGSFs.empty() && !RO2.primaryGSFs.empty()) {
@@ -397,7 +393,6 @@ namespace {
 	return false;
       }
     }
-    const reco::PFBlockRef& blk = RO1.parentBlock;    
     bool not_closer;
     // check links track -> cluster
     for( const auto& cluster: RO1.ecalclusters ) {
@@ -511,11 +506,13 @@ namespace {
   
   struct TestIfROMergableByLink : public POMatcher {
     const PFEGammaAlgo::ProtoEGObject& comp;
-    TestIfROMergableByLink(const PFEGammaAlgo::ProtoEGObject& RO) :
-      comp(RO) {}
+    const PFEGammaAlgo::BlockAssociations& links;
+    TestIfROMergableByLink(const PFEGammaAlgo::ProtoEGObject& RO,
+			   const PFEGammaAlgo::BlockAssociations& l) :
+      comp(RO), links(l) {}
     bool operator() (const PFEGammaAlgo::ProtoEGObject& ro) {      
-      const bool result = ( isROLinkedByClusterOrTrack(comp,ro) || 
-			    isROLinkedByClusterOrTrack(ro,comp)   );      
+      const bool result = ( isROLinkedByClusterOrTrack(comp,ro,links) || 
+			    isROLinkedByClusterOrTrack(ro,comp,links)   );      
       return result;      
     }
   }; 
@@ -599,7 +596,8 @@ namespace {
   
   // sets the cluster best associated to the GSF track
   // leave it null if no GSF track
-  void setROElectronCluster(PFEGammaAlgo::ProtoEGObject& RO) {
+  void setROElectronCluster(PFEGammaAlgo::ProtoEGObject& RO,
+			    const PFEGammaAlgo::BlockAssociations& parent) {
     if( RO.ecalclusters.empty() ) return;
     RO.lateBrem = -1;
     RO.firstBrem = -1;
@@ -607,7 +605,6 @@ namespace {
     const reco::PFBlockElementBrem *firstBrem = nullptr, *lastBrem = nullptr;
     const reco::PFBlockElementCluster *bremCluster = nullptr, *gsfCluster = nullptr,
       *kfCluster = nullptr, *gsfCluster_noassc = nullptr;
-    const reco::PFBlockRef& parent = RO.parentBlock;
     int nBremClusters = 0;
     constexpr float maxDist = 1e6;
     float mDist_gsf(maxDist), mDist_gsf_noassc(maxDist), mDist_kf(maxDist);
@@ -640,10 +637,8 @@ namespace {
 						    kf.first->index(),
 						    cluster.first->type(),
 						    cluster.first->index());
-	const float dist = parent->dist(cluster.first->index(),
-					kf.first->index(),
-					parent->linkData(),
-					reco::PFBlock::LINKTEST_ALL);
+	const float dist = parent.dist(cluster.first->index(),
+				       kf.first->index());
 	if( hasclu && dist < mDist_kf ) {
 	  kfCluster = cluster.first;
 	  mDist_kf = dist;
@@ -826,6 +821,58 @@ bool PFEGammaAlgo::isAMuon(const reco::PFBlockElement& pfbe) {
   return false;
 }
 
+void PFEGammaAlgo::BlockAssociations::fill(const reco::PFBlockRef& block) {
+  block_ = block;
+  const unsigned nelems = block->elements().size();
+  const reco::PFBlock::LinkData& linkData = block->linkData();
+  // the link data is indexed by the upper triangle of the element matrix,
+  // row after row (PFBlock::matrix2vector)
+  auto rowStart = [nelems](unsigned i) { return i*nelems - i*(i+1)/2; };
+  std::vector<std::pair<unsigned,unsigned> > pairs;
+  pairs.reserve(linkData.size());
+  unsigned row = 0;
+  for( const auto& link : linkData ) {
+    while( row + 1 < nelems && link.first >= rowStart(row+1) ) ++row;
+    pairs.emplace_back(row, link.first - rowStart(row) + row + 1);
+  }
+  offsets_.assign(nelems+1,0);
+  for( const auto& ij : pairs ) {
+    ++offsets_[ij.first+1];
+    ++offsets_[ij.second+1];
+  }
+  for( unsigned i = 0; i < nelems; ++i ) offsets_[i+1] += offsets_[i];
+  associations_.resize(offsets_[nelems]);
+  // the elements are entered by increasing index for each element, so that
+  // the stable sort keeps the order of the multimap for equal distances
+  std::vector<unsigned> next(offsets_.begin(),offsets_.end()-1);
+  unsigned ilink = 0;
+  for( const auto& link : linkData ) {
+    const unsigned i = pairs[ilink].first, j = pairs[ilink].second;
+    ++ilink;
+    associations_[next[j]++] = Association(link.second.distance,i);
+  }
+  ilink = 0;
+  for( const auto& link : linkData ) {
+    const unsigned i = pairs[ilink].first, j = pairs[ilink].second;
+    ++ilink;
+    associations_[next[i]++] = Association(link.second.distance,j);
+  }
+  for( unsigned i = 0; i < nelems; ++i ) {
+    std::stable_sort(associations_.begin()+offsets_[i],
+		     associations_.begin()+offsets_[i+1],
+		     [](const Association& a, const Association& b)
+		     { return a.first < b.first; });
+  }
+}
+
+float PFEGammaAlgo::BlockAssociations::dist(unsigned i, unsigned j) const {
+  if( i == j || i+1 >= offsets_.size() || j+1 >= offsets_.size() ) return -1.0f;
+  for( auto assc = begin(i); assc != end(i); ++assc ) {
+    if( assc->second == j ) return assc->first;
+  }
+  return -1.0f;
+}
+
 void PFEGammaAlgo::buildAndRefineEGObjects(const pfEGHelpers::HeavyObjectCache* hoc,
                                            const reco::PFBlockRef& block) {
   LOGVERB("PFEGammaAlgo") 
@@ -838,6 +885,7 @@ void PFEGammaAlgo::buildAndRefineEGObjects(const pfEGHelpers::HeavyObjectCache*
 
   _currentblock = block;
   _currentlinks = block->linkData();
+  _currentassociations.fill(block);
   //LOGDRESSED("PFEGammaAlgo") << *_currentblock << std::endl;
   LOGVERB("PFEGammaAlgo") << "Splaying block" << std::endl;  
   //unwrap the PF block into a fast access map
@@ -945,7 +993,7 @@ void PFEGammaAlgo::buildAndRefineEGObjects(const pfEGHelpers::HeavyObjectCache*
 	       const PFClusterFlaggedElement& b) 
 	    { return ( a.first->clusterRef()->correctedEnergy() > 
 		       b.first->clusterRef()->correctedEnergy() ) ; });
-    setROElectronCluster(RO);
+    setROElectronCluster(RO,_currentassociations);
   }
 
   LOGDRESSED("PFEGammaAlgo")
@@ -1150,9 +1198,9 @@ initializeProtoCands(std::list<PFEGammaAlgo::ProtoEGObject>& egobjs) {
      << "Precalculated cluster multiplicities: " 
      << nscclusters << ' ' << nscpsclusters << std::endl;
    NotCloserToOther<reco::PFBlockElement::SC,reco::PFBlockElement::ECAL> 
-     ecalClustersInSC(_currentblock,_currentlinks,thesc);
+     ecalClustersInSC(_currentassociations,thesc);
    NotCloserToOther<reco::PFBlockElement::SC,reco::PFBlockElement::HGCAL> 
-     hgcalClustersInSC(_currentblock,_currentlinks,thesc);
+     hgcalClustersInSC(_currentassociations,thesc);
    auto ecalfirstnotinsc = std::partition(ecalbegin,ecalend,ecalClustersInSC);
    auto hgcalfirstnotinsc = std::partition(hgcalbegin,hgcalend,hgcalClustersInSC);
    //reset the begin and end iterators
@@ -1466,7 +1514,7 @@ initializeProtoCands(std::list<PFEGammaAlgo::ProtoEGObject>& egobjs) {
      // if one has a merge shuffle it to the front of the list
      // if there are no merges left to do we can terminate
      for( auto it1 = ROs.begin(); it1 != ROs.end(); ++it1 ) {
-       TestIfROMergableByLink mergeTest(*it1);
+       TestIfROMergableByLink mergeTest(*it1,_currentassociations);
        auto find_start = it1; ++find_start;
        auto has_merge = std::find_if(find_start,ROs.end(),mergeTest);
        if( has_merge != ROs.end() && it1 != ROs.begin() ) {
@@ -1475,7 +1523,7 @@ initializeProtoCands(std::list<PFEGammaAlgo::ProtoEGObject>& egobjs) {
        }
      }// ensure mergables are shuffled to the front
      ProtoEGObject& thefront = ROs.front();
-     TestIfROMergableByLink mergeTest(thefront);
+     TestIfROMergableByLink mergeTest(thefront,_currentassociations);
      auto mergestart = ROs.begin(); ++mergestart;    
      auto nomerge = std::partition(mergestart,ROs.end(),mergeTest);
      if( nomerge != mergestart ) {
@@ -1563,7 +1611,7 @@ linkRefinableObjectGSFTracksToKFs(ProtoEGObject& RO) {
     // don't process SC-only ROs or secondary seeded ROs
     if( RO.electronSeed.isNull() || seedtk->trackType(convType) ) continue;
     NotCloserToOther<reco::PFBlockElement::GSF,reco::PFBlockElement::TRACK>
-      gsfTrackToKFs(_currentblock,_currentlinks,seedtk);
+      gsfTrackToKFs(_currentassociations,seedtk);
     // get KF tracks not closer to another and not already used
     auto notlinked = std::partition(KFbegin,KFend,gsfTrackToKFs);
     // attach tracks and set as used
@@ -1604,7 +1652,7 @@ linkRefinableObjectPrimaryKFsToSecondaryKFs(ProtoEGObject& RO) {
 	<< std::endl;
     }
     NotCloserToOther<reco::PFBlockElement::TRACK,reco::PFBlockElement::TRACK,true>
-	kfTrackToKFs(_currentblock,_currentlinks,primkf);
+	kfTrackToKFs(_currentassociations,primkf);
     // get KF tracks not closer to another and not already used
     auto notlinked = std::partition(KFbegin,KFend,kfTrackToKFs);
     // attach tracks and set as used
@@ -1634,7 +1682,7 @@ linkRefinableObjectPrimaryGSFTrackToECAL(ProtoEGObject& RO) {
   auto ECALend = _splayedblock[reco::PFBlockElement::ECAL].end();
   for( auto& primgsf : RO.primaryGSFs ) {    
     NotCloserToOther<reco::PFBlockElement::GSF,reco::PFBlockElement::ECAL>
-      gsfTracksToECALs(_currentblock,_currentlinks,primgsf.first);
+      gsfTracksToECALs(_currentassociations,primgsf.first);
     CompatibleEoPOut eoverp_test(primgsf.first);
     // get set of matching ecals not already in SC
     auto notmatched_blk = std::partition(ECALbegin,ECALend,gsfTracksToECALs);
@@ -1685,7 +1733,7 @@ linkRefinableObjectPrimaryGSFTrackToHCAL(ProtoEGObject& RO) {
   auto HCALend = _splayedblock[reco::PFBlockElement::HCAL].end();
   for( auto& primgsf : RO.primaryGSFs ) {
     NotCloserToOther<reco::PFBlockElement::GSF,reco::PFBlockElement::HCAL>
-      gsfTracksToHCALs(_currentblock,_currentlinks,primgsf.first);
+      gsfTracksToHCALs(_currentassociations,primgsf.first);
     CompatibleEoPOut eoverp_test(primgsf.first);
     auto notmatched = std::partition(HCALbegin,HCALend,gsfTracksToHCALs);    
     for( auto hcal = HCALbegin; hcal != notmatched; ++hcal ) { 
@@ -1718,9 +1766,9 @@ PFEGammaAlgo::linkKFTrackToECAL(const KFFlaggedElement& kfflagged,
   auto ECALbegin = _splayedblock[reco::PFBlockElement::ECAL].begin();
   auto ECALend = _splayedblock[reco::PFBlockElement::ECAL].end();  
   NotCloserToOther<reco::PFBlockElement::TRACK,reco::PFBlockElement::ECAL>
-    kfTrackToECALs(_currentblock,_currentlinks,kfflagged.first);      
+    kfTrackToECALs(_currentassociations,kfflagged.first);      
   NotCloserToOther<reco::PFBlockElement::GSF,reco::PFBlockElement::ECAL>
-    kfTrackGSFToECALs(_currentblock,_currentlinks,kfflagged.first);
+    kfTrackGSFToECALs(_currentassociations,kfflagged.first);
   //get the ECAL elements not used and not closer to another KF
   auto notmatched_sc = std::partition(currentECAL.begin(),
 				      currentECAL.end(),
@@ -1779,7 +1827,7 @@ linkRefinableObjectBremTangentsToECAL(ProtoEGObject& RO) {
     auto ECALbegin = _splayedblock[reco::PFBlockElement::ECAL].begin();
     auto ECALend = _splayedblock[reco::PFBlockElement::ECAL].end();
     NotCloserToOther<reco::PFBlockElement::BREM,reco::PFBlockElement::ECAL>
-      BremToECALs(_currentblock,_currentlinks,bremflagged.first);
+      BremToECALs(_currentassociations,bremflagged.first);
     // check for late brem using clusters already in the SC
     auto RSCBegin = RO.ecalclusters.begin();
     auto RSCEnd = RO.ecalclusters.end();
@@ -1856,7 +1904,7 @@ linkRefinableObjectConvSecondaryKFsToSecondaryKFs(ProtoEGObject& RO) {
     NotCloserToOther<reco::PFBlockElement::TRACK,
                      reco::PFBlockElement::TRACK,
                      true> 
-      TracksToTracks(_currentblock,_currentlinks, secKFs[idx].first); 
+      TracksToTracks(_currentassociations, secKFs[idx].first); 
     auto notmatched = std::partition(KFbegin,KFend,TracksToTracks);    
     notmatched = std::partition(KFbegin,notmatched,isConvKf);    
     for( auto kf = KFbegin; kf != notmatched; ++kf ) {
@@ -1880,7 +1928,7 @@ linkRefinableObjectECALToSingleLegConv(const pfEGHelpers::HeavyObjectCache* hoc,
     NotCloserToOther<reco::PFBlockElement::ECAL,
                      reco::PFBlockElement::TRACK,
                      true>
-      ECALToTracks(_currentblock,_currentlinks,ecal.first);           
+      ECALToTracks(_currentassociations,ecal.first);           
     auto notmatchedkf  = std::partition(KFbegin,KFend,ECALToTracks);
     auto notconvkf     = std::partition(KFbegin,notmatchedkf,isConvKf);    
     // add identified KF conversion tracks
@@ -1919,7 +1967,7 @@ linkRefinableObjectSecondaryKFsToECAL(ProtoEGObject& RO) {
     NotCloserToOther<reco::PFBlockElement::TRACK,
                      reco::PFBlockElement::ECAL,
                      false>
-      TracksToECALwithCut(_currentblock,_currentlinks,skf.first,1.5f);
+      TracksToECALwithCut(_currentassociations,skf.first,1.5f);
     auto notmatched = std::partition(ECALbegin,ECALend,TracksToECALwithCut);
     for( auto ecal = ECALbegin; ecal != notmatched; ++ecal ) {
       const reco::PFBlockElementCluster* elemascluster =
@@ -2261,7 +2309,7 @@ void PFEGammaAlgo::fill_extra_info( const ProtoEGObject& RO,
     NotCloserToOther<reco::PFBlockElement::ECAL,
                      reco::PFBlockElement::TRACK,
                      true>
-      ECALToTracks(_currentblock,_currentlinks,ecal.first);           
+      ECALToTracks(_currentassociations,ecal.first);           
     auto notmatchedkf  = std::partition(KFbegin,KFend,ECALToTracks);
     auto notconvkf     = std::partition(KFbegin,notmatchedkf,isConvKf);
     // go through non-conv-identified kfs and check MVA to add conversions
@@ -2538,7 +2586,7 @@ unlinkRefinableObjectKFandECALMatchedToHCAL(ProtoEGObject& RO,
        secd_kf != RO.secondaryKFs.end(); ++secd_kf ) {
     bool remove_this_kf = false;
     NotCloserToOther<reco::PFBlockElement::TRACK,reco::PFBlockElement::HCAL>
-      tracksToHCALs(_currentblock,_currentlinks,secd_kf->first);
+      tracksToHCALs(_currentassociations,secd_kf->first);
     reco::TrackRef trkRef =   secd_kf->first->trackRef();
 
     bool goodTrack = PFTrackAlgoTools::isGoodForEGM(trkRef->algo());
@@ -44,6 +44,7 @@
 */
 
 
+#include <array>
 #include <sstream>
 template <class T> inline T sqr( T t) {return t*t;}
 
@@ -86,8 +87,9 @@ KFBasedPixelFitter::KFBasedPixelFitter(const edm::EventSetup *es, const Propagat
 std::unique_ptr<reco::Track> KFBasedPixelFitter::run(const std::vector<const TrackingRecHit *>& hits, const TrackingRegion& region) const {
   std::unique_ptr<reco::Track> ret;
 
+  // the initial kinematics and the backward fit use the first three hits
   int nhits = hits.size();
-  if (nhits <2) return ret;
+  if (nhits <3) return ret;
 
 
   float ptMin = region.ptMin();
@@ -95,7 +97,7 @@ std::unique_ptr<reco::Track> KFBasedPixelFitter::run(const std::vector<const Tra
   const GlobalPoint& vertexPos = region.origin();
   GlobalError vertexErr( sqr(region.originRBound()), 0, sqr(region.originRBound()), 0, 0, sqr(region.originZBound()));
 
-  std::vector<GlobalPoint> points(nhits);
+  std::array<GlobalPoint,3> points;
   points[0] = theTracker->idToDet(hits[0]->geographicalId())->toGlobal(hits[0]->localPosition());
   points[1] = theTracker->idToDet(hits[1]->geographicalId())->toGlobal(hits[1]->localPosition());
   points[2] = theTracker->idToDet(hits[2]->geographicalId())->toGlobal(hits[2]->localPosition());
@@ -116,9 +116,12 @@ public:
   }
   
 
-  void checkAlignmentAndAct(CAColl& allCells, CAntuple & innerCells, const float ptmin, const float region_origin_x,
-			    const float region_origin_y, const float region_origin_radius, const float thetaCut,
-			    const float phiCut, const float hardPtCut, std::vector<CACell::CAntuplet> * foundTriplets) {
+  // Calls action(innerCellId) for each cell of innerCells which is aligned with this cell.
+  // The cells are only read, so this can be called for different cells concurrently.
+  template<typename F>
+  void checkAlignment(CAColl const& allCells, CAntuple const& innerCells, const float ptmin, const float region_origin_x,
+		      const float region_origin_y, const float region_origin_radius, const float thetaCut,
+		      const float phiCut, const float hardPtCut, F&& action) const {
     int ncells = innerCells.size();
     int constexpr VSIZE = 16;
     int ok[VSIZE];
@@ -126,7 +129,6 @@ public:
     float z1[VSIZE];
     auto ro = getOuterR();
     auto zo = getOuterZ();
-    unsigned int cellId = this - &allCells.front();
     auto loop = [&](int i, int vs) {
       for (int j=0;j<vs; ++j) {
 	auto koc = innerCells[i+j];
@@ -141,10 +143,7 @@ public:
 	auto & oc =  allCells[koc]; 
 	if (ok[j]&&haveSimilarCurvature(oc,ptmin, region_origin_x, region_origin_y,
 					region_origin_radius, phiCut, hardPtCut)) {
-	  if (foundTriplets) foundTriplets->emplace_back(CACell::CAntuplet{koc,cellId});
-	  else {
-	    oc.tagAsOuterNeighbor(cellId);
-	  }
+	  action(koc);
 	}
       }
     };
@@ -153,6 +152,17 @@ public:
     loop(lim, ncells-lim);
     
   }
+
+  void checkAlignmentAndAct(CAColl& allCells, CAntuple & innerCells, const float ptmin, const float region_origin_x,
+			    const float region_origin_y, const float region_origin_radius, const float thetaCut,
+			    const float phiCut, const float hardPtCut, std::vector<CACell::CAntuplet> * foundTriplets) {
+    unsigned int cellId = this - &allCells.front();
+    checkAlignment(allCells, innerCells, ptmin, region_origin_x, region_origin_y, region_origin_radius, thetaCut,
+		   phiCut, hardPtCut, [&](unsigned int koc) {
+		     if (foundTriplets) foundTriplets->emplace_back(CACell::CAntuplet{koc,cellId});
+		     else allCells[koc].tagAsOuterNeighbor(cellId);
+		   });
+  }
   
   void checkAlignmentAndTag(CAColl& allCells, CAntuple & innerCells, const float ptmin, const float region_origin_x,
 			    const float region_origin_y, const float region_origin_radius, const float thetaCut,
@@ -260,7 +270,7 @@ public:
   // trying to free the track building process from hardcoded layers, leaving the visit of the graph
   // based on the neighborhood connections between cells.
   
-  void findNtuplets(CAColl& allCells, std::vector<CAntuplet>& foundNtuplets, CAntuplet& tmpNtuplet, const unsigned int minHitsPerNtuplet) const {
+  void findNtuplets(CAColl const& allCells, std::vector<CAntuplet>& foundNtuplets, CAntuplet& tmpNtuplet, const unsigned int minHitsPerNtuplet) const {
     
     // the building process for a track ends if:
     // it has no outer neighbor
@@ -1,7 +1,16 @@
+#include <iterator>
 #include <queue>
 
+#include <tbb/blocked_range.h>
+#include <tbb/parallel_for.h>
+
 #include "CellularAutomaton.h"
 
+namespace {
+  // cells are processed in chunks of at least this size by the parallel loops
+  constexpr unsigned int cellsPerTask = 256;
+}
+
 void CellularAutomaton::createAndConnectCells(
     const std::vector<const HitDoublets *> & hitDoublets,
     const TrackingRegion & region,
@@ -14,6 +23,9 @@ void CellularAutomaton::createAndConnectCells(
     tsize += hd->size();
   }
   allCells.reserve(tsize);
+  // for each cell, the cells whose outer hit is its inner hit
+  std::vector<CACell::CAntuple const*> innerCellCandidates;
+  innerCellCandidates.reserve(tsize);
   unsigned int cellId = 0;
   float ptmin = region.ptMin();
   float region_origin_x = region.origin().x();
@@ -59,10 +71,8 @@ void CellularAutomaton::createAndConnectCells(
 
           cellId++;
 
-          auto & neigCells = currentInnerLayerRef.isOuterHitOfCell[doubletLayerPairId->innerHitId(i)];
-          allCells.back().checkAlignmentAndTag(
-              allCells, neigCells, ptmin, region_origin_x, region_origin_y,
-              region_origin_radius, thetaCut, phiCut, hardPtCut);
+          // All the inner layer pairs have already been visited, so this list is complete.
+          innerCellCandidates.push_back(&currentInnerLayerRef.isOuterHitOfCell[doubletLayerPairId->innerHitId(i)]);
         }
         assert(cellId == currentLayerPairRef.theFoundCells[1]);
         for (auto outerLayerPair : currentOuterLayerRef.theOuterLayerPairs) {
@@ -78,6 +88,24 @@ void CellularAutomaton::createAndConnectCells(
       }
     }
   }
+
+  // The alignment of each cell with its candidates is checked in parallel. Each cell only
+  // collects its aligned inner cells, and the neighbours are then attached serially in cell
+  // order, which gives the same outer neighbour lists as a serial loop.
+  std::vector<CACell::CAntuple> alignedInnerCells(allCells.size());
+  tbb::parallel_for(tbb::blocked_range<unsigned int>(0, allCells.size(), cellsPerTask),
+                    [&](tbb::blocked_range<unsigned int> const& range) {
+    for (auto i = range.begin(); i != range.end(); ++i) {
+      allCells[i].checkAlignment(allCells, *innerCellCandidates[i], ptmin, region_origin_x, region_origin_y,
+                                 region_origin_radius, thetaCut, phiCut, hardPtCut,
+                                 [&](unsigned int innerCell) { alignedInnerCells[i].push_back(innerCell); });
+    }
+  });
+  for (unsigned int i = 0; i < allCells.size(); ++i) {
+    for (auto innerCell : alignedInnerCells[i]) {
+      allCells[innerCell].tagAsOuterNeighbor(i);
+    }
+  }
 }
 
 void CellularAutomaton::evolve(const unsigned int minHitsPerNtuplet)
@@ -86,18 +114,22 @@ void CellularAutomaton::evolve(const unsigned int minHitsPerNtuplet)
 
   unsigned int numberOfIterations = minHitsPerNtuplet - 2;
   // keeping the last iteration for later
+  // Each cell of the layer pairs (which together hold all the cells) only writes its own
+  // status, and evolve only reads the state which is changed by updateState, so both
+  // steps can run over all cells in parallel.
+  tbb::blocked_range<unsigned int> const allCellsRange(0, allCells.size(), cellsPerTask);
   for (unsigned int iteration = 0; iteration < numberOfIterations - 1; ++iteration) {
-    for (auto & layerPair : theLayerGraph.theLayerPairs) {
-      for (auto i = layerPair.theFoundCells[0]; i < layerPair.theFoundCells[1]; ++i) {
+    tbb::parallel_for(allCellsRange, [&](tbb::blocked_range<unsigned int> const& range) {
+      for (auto i = range.begin(); i != range.end(); ++i) {
         allCells[i].evolve(i, allStatus);
       }
-    }
+    });
 
-    for (auto & layerPair : theLayerGraph.theLayerPairs) {
-      for (auto i = layerPair.theFoundCells[0]; i < layerPair.theFoundCells[1]; ++i) {
+    tbb::parallel_for(allCellsRange, [&](tbb::blocked_range<unsigned int> const& range) {
+      for (auto i = range.begin(); i != range.end(); ++i) {
         allStatus[i].updateState();
       }
-    }
+    });
   }
 
   // last iteration
@@ -119,14 +151,22 @@ void CellularAutomaton::evolve(const unsigned int minHitsPerNtuplet)
 
 void CellularAutomaton::findNtuplets(std::vector<CACell::CAntuplet> & foundNtuplets, const unsigned int minHitsPerNtuplet)
 {
-  CACell::CAntuple tmpNtuplet;
-  tmpNtuplet.reserve(minHitsPerNtuplet);
-
-  for (auto root_cell : theRootCells)
-  {
-    tmpNtuplet.clear();
-    tmpNtuplet.push_back(root_cell);
-    allCells[root_cell].findNtuplets(allCells, foundNtuplets, tmpNtuplet, minHitsPerNtuplet);
+  // The search from each root cell is independent of the others. The ntuplets found from
+  // each root are kept apart and appended in the order of the roots.
+  std::vector<std::vector<CACell::CAntuplet>> ntupletsOfRoot(theRootCells.size());
+  tbb::parallel_for(tbb::blocked_range<unsigned int>(0, theRootCells.size(), 16),
+                    [&](tbb::blocked_range<unsigned int> const& range) {
+    CACell::CAntuple tmpNtuplet;
+    tmpNtuplet.reserve(minHitsPerNtuplet);
+    for (auto i = range.begin(); i != range.end(); ++i) {
+      auto root_cell = theRootCells[i];
+      tmpNtuplet.clear();
+      tmpNtuplet.push_back(root_cell);
+      allCells[root_cell].findNtuplets(allCells, ntupletsOfRoot[i], tmpNtuplet, minHitsPerNtuplet);
+    }
+  });
+  for (auto& ntuplets : ntupletsOfRoot) {
+    foundNtuplets.insert(foundNtuplets.end(), std::make_move_iterator(ntuplets.begin()), std::make_move_iterator(ntuplets.end()));
   }
 }
 
@@ -33,6 +33,7 @@
 #include "CommonTools/Utils/interface/StringObjectFunction.h"
 
 #include "boost/shared_ptr.hpp"
+#include <array>
 #include <vector>
 
 namespace reco { namespace tau {
@@ -131,10 +132,11 @@ class RecoTauConstructor {
     const reco::Candidate::LorentzVector& p4() const { return p4_; }
 
   private:
-    typedef std::pair<Region, ParticleType> CollectionKey;
-    typedef std::map<CollectionKey, std::vector<PFCandidatePtr>*> CollectionMap;
-    typedef boost::shared_ptr<std::vector<PFCandidatePtr> > SortedListPtr;
-    typedef std::map<CollectionKey, SortedListPtr> SortedCollectionMap;
+    // the collections are indexed by region*kNTypes + type, looked up for every candidate added
+    static constexpr unsigned int kNTypes = kAll + 1;
+    static constexpr unsigned int kNCollections = (kIsolation + 1)*kNTypes;
+    typedef std::array<std::vector<PFCandidatePtr>*, kNCollections> CollectionMap;
+    typedef std::array<std::vector<PFCandidatePtr>, kNCollections> SortedCollectionMap;
 
     bool copyGammas_;
 
@@ -146,7 +148,7 @@ class RecoTauConstructor {
 
     // Retrieve collection associated to signal/iso and type
     std::vector<PFCandidatePtr>* getCollection(Region region, ParticleType type);
-    SortedListPtr getSortedCollection(Region region, ParticleType type);
+    std::vector<PFCandidatePtr>* getSortedCollection(Region region, ParticleType type);
 
     // Sort all our collections by PT and copy them into the tau
     void sortAndCopyIntoTau();
@@ -29,32 +29,24 @@ RecoTauConstructor::RecoTauConstructor(const PFJetRef& jet, const edm::Handle<PF
 
   copyGammas_ = copyGammasFromPiZeros;
   // Initialize our Accessors
-  collections_[std::make_pair(kSignal, kChargedHadron)] =
+  collections_[kSignal*kNTypes + kChargedHadron] =
       &tau_->selectedSignalPFChargedHadrCands_;
-  collections_[std::make_pair(kSignal, kGamma)] =
+  collections_[kSignal*kNTypes + kGamma] =
       &tau_->selectedSignalPFGammaCands_;
-  collections_[std::make_pair(kSignal, kNeutralHadron)] =
+  collections_[kSignal*kNTypes + kNeutralHadron] =
       &tau_->selectedSignalPFNeutrHadrCands_;
-  collections_[std::make_pair(kSignal, kAll)] =
+  collections_[kSignal*kNTypes + kAll] =
       &tau_->selectedSignalPFCands_;
 
-  collections_[std::make_pair(kIsolation, kChargedHadron)] =
+  collections_[kIsolation*kNTypes + kChargedHadron] =
       &tau_->selectedIsolationPFChargedHadrCands_;
-  collections_[std::make_pair(kIsolation, kGamma)] =
+  collections_[kIsolation*kNTypes + kGamma] =
       &tau_->selectedIsolationPFGammaCands_;
-  collections_[std::make_pair(kIsolation, kNeutralHadron)] =
+  collections_[kIsolation*kNTypes + kNeutralHadron] =
       &tau_->selectedIsolationPFNeutrHadrCands_;
-  collections_[std::make_pair(kIsolation, kAll)] =
+  collections_[kIsolation*kNTypes + kAll] =
       &tau_->selectedIsolationPFCands_;
 
-  // Build our temporary sorted collections, since you can't use stl sorts on
-  // RefVectors
-  BOOST_FOREACH(const CollectionMap::value_type& colkey, collections_) {
-    // Build an empty list for each collection
-    sortedCollections_[colkey.first] = SortedListPtr(
-        new SortedListPtr::element_type);
-  }
-
   tau_->setjetRef(jet);
 }
 
@@ -224,12 +216,12 @@ void RecoTauConstructor::addPiZero(Region region, const RecoTauPiZero& piZero)
 
 std::vector<PFCandidatePtr>*
 RecoTauConstructor::getCollection(Region region, ParticleType type) {
-    return collections_[std::make_pair(region, type)];
+    return collections_[region*kNTypes + type];
 }
 
-RecoTauConstructor::SortedListPtr
+std::vector<PFCandidatePtr>*
 RecoTauConstructor::getSortedCollection(Region region, ParticleType type) {
-  return sortedCollections_[std::make_pair(region, type)];
+  return &sortedCollections_[region*kNTypes + type];
 }
 
 // Trivial converter needed for polymorphism
@@ -294,16 +286,13 @@ void RecoTauConstructor::sortAndCopyIntoTau() {
 
   // Sort each of our sortable collections, and copy them into the final
   // tau RefVector.
-  BOOST_FOREACH ( const CollectionMap::value_type& colkey, collections_ ) {
-    SortedListPtr sortedCollection = sortedCollections_[colkey.first];
-    std::sort(sortedCollection->begin(),
-              sortedCollection->end(),
+  for ( unsigned int i = 0; i < kNCollections; ++i ) {
+    std::vector<PFCandidatePtr>& sortedCollection = sortedCollections_[i];
+    std::sort(sortedCollection.begin(),
+              sortedCollection.end(),
               ptDescendingPtr<PFCandidatePtr>);
     // Copy into the real tau collection
-    for ( std::vector<PFCandidatePtr>::const_iterator particle = sortedCollection->begin();
-	  particle != sortedCollection->end(); ++particle ) {
-      colkey.second->push_back(*particle);
-    }
+    collections_[i]->insert(collections_[i]->end(), sortedCollection.begin(), sortedCollection.end());
   }
 }
 
@@ -29,6 +29,7 @@
 #include <memory>
 
 class TransientInitialStateEstimator;
+namespace edm { class ParameterSetDescription; }
 
 namespace cms
 {
@@ -39,6 +40,9 @@ namespace cms
 
     virtual ~CkfTrackCandidateMakerBase() noexcept(false);
 
+    /// declare the parameters read by the base class with a default value
+    static void fillPSetDescription(edm::ParameterSetDescription& desc);
+
     virtual void beginRunBase (edm::Run const & , edm::EventSetup const & es);
 
     virtual void produceBase(edm::Event& e, const edm::EventSetup& es);
@@ -71,6 +75,9 @@ namespace cms
     RedundantSeedCleaner*  theSeedCleaner;
 
     unsigned int maxSeedsBeforeCleaning_;
+
+    /// build the trajectories of all the seeds concurrently and apply the seed cleaning afterwards
+    bool parallelSeeds_;
     
     edm::EDGetTokenT<edm::View<TrajectorySeed> >  theSeedLabel;
     edm::EDGetTokenT<MeasurementTrackerEvent>     theMTELabel;
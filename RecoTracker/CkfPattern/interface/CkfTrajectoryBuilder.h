@@ -30,6 +30,7 @@ class TrajectoryFilter;
 
 class TransientTrackingRecHitBuilder;
 class TrajectoryFilter;
+namespace edm { class ParameterSetDescription; }
 
 class CkfTrajectoryBuilder :public BaseCkfTrajectoryBuilder {
 
@@ -43,6 +44,8 @@ public:
 
   ~CkfTrajectoryBuilder() override {}
 
+  static void fillPSetDescription(edm::ParameterSetDescription& desc);
+
   /// trajectories building starting from a seed
   TrajectoryContainer trajectories(const TrajectorySeed& seed) const override;
   /// trajectories building starting from a seed
@@ -70,6 +73,8 @@ public:
   bool theIntermediateCleaning;	/**< Tells whether an intermediary cleaning stage 
                                      should take place during TB. */
   bool theAlwaysUseInvalidHits;
+  bool theBatchedUpdate;        /**< Tells whether the valid hits compatible with a
+                                     candidate are updated together with TrajectoryStateUpdator::updateBatch. */
 
 
  protected:
@@ -81,6 +86,8 @@ public:
   unsigned int limitedCandidates(const boost::shared_ptr<const TrajectorySeed> & sharedSeed, TempTrajectoryContainer &candidates, TrajectoryContainer& result) const;
   
   void updateTrajectory( TempTrajectory& traj, TM && tm) const;
+  /// as above for a valid hit whose updated state is already known
+  void updateTrajectory( TempTrajectory& traj, TM && tm, TrajectoryStateOnSurface && upState) const;
 
   /*  
       //not mature for integration.  
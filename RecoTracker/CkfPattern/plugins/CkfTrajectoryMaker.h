@@ -7,6 +7,8 @@
 #include "FWCore/Framework/interface/EventSetup.h"
 
 #include "FWCore/ParameterSet/interface/ParameterSet.h"
+#include "FWCore/ParameterSet/interface/ConfigurationDescriptions.h"
+#include "FWCore/ParameterSet/interface/ParameterSetDescription.h"
 
 #include "TrackingTools/TrajectoryCleaning/interface/TrajectoryCleaner.h"
 
@@ -41,6 +43,14 @@ namespace cms
 
     ~CkfTrajectoryMaker() override{;}
 
+    static void fillDescriptions(edm::ConfigurationDescriptions& descriptions) {
+      edm::ParameterSetDescription desc;
+      fillPSetDescription(desc);
+      // the remaining parameters are not described yet
+      desc.setAllowAnything();
+      descriptions.addDefault(desc);
+    }
+
     void beginRun (edm::Run const & run, edm::EventSetup const & es) override {beginRunBase(run,es);}
 
     void produce(edm::Event& e, const edm::EventSetup& es) override {produceBase(e,es);}
@@ -2,6 +2,7 @@
 #include "FWCore/Framework/interface/ESHandle.h"
 #include "FWCore/Framework/interface/EventSetup.h"
 #include "FWCore/MessageLogger/interface/MessageLogger.h"
+#include "FWCore/ParameterSet/interface/ParameterSetDescription.h"
 #include "FWCore/Utilities/interface/isFinite.h"
 #include <FWCore/Utilities/interface/ESInputTag.h>
 
@@ -22,6 +23,7 @@
 #include "RecoTracker/Record/interface/TrackerRecoGeometryRecord.h"
 #include "RecoTracker/Record/interface/CkfComponentsRecord.h"
 #include "RecoTracker/CkfPattern/interface/BaseCkfTrajectoryBuilderFactory.h"
+#include "RecoTracker/CkfPattern/interface/CkfTrajectoryBuilder.h"
 
 
 #include "RecoTracker/CkfPattern/interface/CachingSeedCleanerBySharedInput.h"
@@ -38,12 +40,8 @@
 
 // #define VI_SORTSEED
 // #define VI_REPRODUCIBLE
-// #define VI_TBB
 
-#include <thread>
-#ifdef VI_TBB
 #include "tbb/parallel_for.h"
-#endif
 
 #include "RecoTracker/CkfPattern/interface/PrintoutHelper.h"
 
@@ -74,6 +72,7 @@ namespace cms{
     theNavigationSchool(nullptr),
     theSeedCleaner(nullptr),
     maxSeedsBeforeCleaning_(0),
+    parallelSeeds_(conf.getParameter<bool>("parallelSeeds")),
     theMTELabel(iC.consumes<MeasurementTrackerEvent>(conf.getParameter<edm::InputTag>("MeasurementTrackerEvent"))),
     skipClusters_(false),
     phase2skipClusters_(false)
@@ -123,6 +122,17 @@ namespace cms{
     if (theSeedCleaner) delete theSeedCleaner;
   }
 
+  void CkfTrackCandidateMakerBase::fillPSetDescription(edm::ParameterSetDescription& desc) {
+    desc.add<bool>("parallelSeeds", false)
+      ->setComment("build the trajectories of all the seeds concurrently, the output is the same as in the serial mode");
+
+    // only the parameters added to the builders are described
+    edm::ParameterSetDescription builderDesc;
+    CkfTrajectoryBuilder::fillPSetDescription(builderDesc);
+    builderDesc.setAllowAnything();
+    desc.add<edm::ParameterSetDescription>("TrajectoryBuilderPSet", builderDesc);
+  }
+
   void CkfTrackCandidateMakerBase::beginRunBase (edm::Run const & r, EventSetup const & es)
   {
     /* no op*/
@@ -222,10 +232,6 @@ namespace cms{
       // method for debugging
       countSeedsDebugger();
 
-      // the mutex
-      std::mutex theMutex;
-      using Lock = std::unique_lock<std::mutex>;
-
       // Loop over seeds
       size_t collseed_size = collseed->size();
 
@@ -266,38 +272,19 @@ namespace cms{
       // std::cout << spt(indeces[0]) << ' ' << spt(indeces[collseed_size-1]) << std::endl;
 #endif
 
-      std::atomic<unsigned int> ntseed(0);
-      auto theLoop = [&](size_t ii) {
-        auto j = indeces[ii];
-
-        ntseed++;
-
-        // to be moved inside a par section (how with tbb??)
-        std::vector<Trajectory> theTmpTrajectories;
-
+      // build the trajectories of seed j, only the SeedStopInfo of the seed is modified
+      auto buildSeed = [&](size_t j, std::vector<Trajectory> & theTmpTrajectories) {
 
 	LogDebug("CkfPattern") << "======== Begin to look for trajectories from seed " << j << " ========\n";
 
-        { Lock lock(theMutex);
-	// Check if seed hits already used by another track
-	if (theSeedCleaner && !theSeedCleaner->good( &((*collseed)[j])) ) {
-          LogDebug("CkfTrackCandidateMakerBase")<<" Seed cleaning kills seed "<<j;
-          (*outputSeedStopInfos)[j].setStopReason(SeedStopReason::SEED_CLEANING);
-          return;  // from the lambda!
-        }}
-
-
 	// Build trajectory from seed outwards
         theTmpTrajectories.clear();
         unsigned int nCandPerSeed = 0;
         auto const & startTraj = theTrajectoryBuilder->buildTrajectories( (*collseed)[j], theTmpTrajectories, nCandPerSeed, nullptr );
-        {
-          Lock lock(theMutex);
-          (*outputSeedStopInfos)[j].setCandidatesPerSeed(nCandPerSeed);
-          if(theTmpTrajectories.empty()) {
-            (*outputSeedStopInfos)[j].setStopReason(SeedStopReason::NO_TRAJECTORY);
-            return; // from the lambda!
-          }
+        (*outputSeedStopInfos)[j].setCandidatesPerSeed(nCandPerSeed);
+        if(theTmpTrajectories.empty()) {
+          (*outputSeedStopInfos)[j].setStopReason(SeedStopReason::NO_TRAJECTORY);
+          return;
         }
 
 	LogDebug("CkfPattern") << "======== In-out trajectory building found " << theTmpTrajectories.size()
@@ -325,7 +312,6 @@ namespace cms{
   			              << " valid/invalid trajectories from seed " << j << " ========\n"
 				 <<PrintoutHelper::dumpCandidates(theTmpTrajectories);
           if(theTmpTrajectories.empty()) {
-            Lock lock(theMutex);
             (*outputSeedStopInfos)[j].setStopReason(SeedStopReason::SEED_REGION_REBUILD);
             return;
           }
@@ -338,8 +324,22 @@ namespace cms{
         LogDebug("CkfPattern") << "======== Trajectory cleaning gave the following " << theTmpTrajectories.size() << " valid trajectories from seed "
                                << j << " ========\n"
 			       <<PrintoutHelper::dumpCandidates(theTmpTrajectories);
+      };
 
-        { Lock lock(theMutex);
+      // check the seed against the trajectories already stored, true if the seed is to be used
+      auto seedIsGood = [&](size_t j) {
+	// Check if seed hits already used by another track
+	if (theSeedCleaner && !theSeedCleaner->good( &((*collseed)[j])) ) {
+          LogDebug("CkfTrackCandidateMakerBase")<<" Seed cleaning kills seed "<<j;
+          (*outputSeedStopInfos)[j].setCandidatesPerSeed(0);
+          (*outputSeedStopInfos)[j].setStopReason(SeedStopReason::SEED_CLEANING);
+          return false;
+        }
+        return true;
+      };
+
+      // store the valid trajectories of seed j, in the order of the seeds
+      auto storeSeed = [&](size_t j, std::vector<Trajectory> & theTmpTrajectories) {
 	for(vector<Trajectory>::iterator it=theTmpTrajectories.begin();
 	    it!=theTmpTrajectories.end(); it++){
 	  if( it->isValid() ) {
@@ -352,13 +352,12 @@ namespace cms{
             if (theSeedCleaner && rawResult.back().foundHits()>3) theSeedCleaner->add( &rawResult.back() );
             //if (theSeedCleaner ) theSeedCleaner->add( & (*it) );
 	  }
-	}}
+	}
 
         theTmpTrajectories.clear();
 
 	LogDebug("CkfPattern") << "rawResult trajectories found so far = " << rawResult.size();
 
-        { Lock lock(theMutex);
 	if ( maxSeedsBeforeCleaning_ >0 && rawResult.size() > maxSeedsBeforeCleaning_+lastCleanResult) {
           theTrajectoryCleaner->clean(rawResult);
           rawResult.erase(std::remove_if(rawResult.begin()+lastCleanResult,rawResult.end(),
@@ -366,23 +365,35 @@ namespace cms{
 			  rawResult.end());
           lastCleanResult=rawResult.size();
         }
-        }
-
       };
-      // end of loop over seeds
-
 
-#ifdef VI_TBB
-     tbb::parallel_for(0UL,collseed_size,1UL,theLoop);
-#else
-#ifdef VI_OMP
-#pragma omp parallel for schedule(dynamic,4)
-#endif
-      for (size_t j = 0; j < collseed_size; j++){
-       theLoop(j);
+      if (parallelSeeds_) {
+        // all the seeds are built concurrently, then the seed cleaning is applied
+        // afterwards in the order of the seeds: the trajectories from seeds the
+        // serial loop would have skipped are dropped, so the result is the same.
+        // The strip detsets are still set on first access, which is thread safe,
+        // so only the modules reached by the seeds are unpacked
+        std::vector<std::vector<Trajectory> > seedTrajectories(collseed_size);
+        tbb::parallel_for(size_t(0), collseed_size, [&](size_t ii) {
+          auto j = indeces[ii];
+          buildSeed(j, seedTrajectories[j]);
+        });
+        for (size_t ii = 0; ii < collseed_size; ii++) {
+          auto j = indeces[ii];
+          if (!seedIsGood(j)) { seedTrajectories[j].clear(); continue; }
+          storeSeed(j, seedTrajectories[j]);
+        }
+      } else {
+        std::vector<Trajectory> theTmpTrajectories;
+        for (size_t ii = 0; ii < collseed_size; ii++) {
+          auto j = indeces[ii];
+          if (!seedIsGood(j)) continue;
+          buildSeed(j, theTmpTrajectories);
+          storeSeed(j, theTmpTrajectories);
+        }
       }
-#endif
-      assert(ntseed==collseed_size);
+      // end of loop over seeds
+
       if (theSeedCleaner) theSeedCleaner->done();
 
       // std::cout << "VICkfPattern " << "rawResult trajectories found = " << rawResult.size() << " in " << ntseed << " seeds " << collseed_size << std::endl;
@@ -1,6 +1,7 @@
 #include "RecoTracker/CkfPattern/interface/CkfTrajectoryBuilder.h"
 
 #include "FWCore/MessageLogger/interface/MessageLogger.h"
+#include "FWCore/ParameterSet/interface/ParameterSetDescription.h"
 
 #include "MagneticField/Records/interface/IdealMagneticFieldRecord.h"
 
@@ -39,6 +40,9 @@ CkfTrajectoryBuilder::CkfTrajectoryBuilder(const edm::ParameterSet& conf, Trajec
   theLostHitPenalty       = conf.getParameter<double>("lostHitPenalty");
   theIntermediateCleaning = conf.getParameter<bool>("intermediateCleaning");
   theAlwaysUseInvalidHits = conf.getParameter<bool>("alwaysUseInvalidHits");
+  // the builders of the described track candidate makers get the default from fillPSetDescription,
+  // the ones configured elsewhere, e.g. by MuonCkfTrajectoryBuilder, may not have the parameter
+  theBatchedUpdate        = conf.existsAs<bool>("batchedUpdate") && conf.getParameter<bool>("batchedUpdate");
   /*
     theSharedSeedCheck = conf.getParameter<bool>("SharedSeedCheck");
     std::stringstream ss;
@@ -48,6 +52,11 @@ CkfTrajectoryBuilder::CkfTrajectoryBuilder(const edm::ParameterSet& conf, Trajec
   */
 }
 
+void CkfTrajectoryBuilder::fillPSetDescription(edm::ParameterSetDescription& desc) {
+  desc.add<bool>("batchedUpdate", false)
+    ->setComment("update the valid hits compatible with a candidate together with TrajectoryStateUpdator::updateBatch");
+}
+
 /*
   void CkfTrajectoryBuilder::setEvent(const edm::Event& event) const
   {
@@ -224,9 +233,30 @@ limitedCandidates(const boost::shared_ptr<const TrajectorySeed> & sharedSeed, Te
 	  else last = meas.end();
 	}
 
+	// update the candidate with all its valid hits at once
+	std::vector<TSOS> upStates;
+	if (theBatchedUpdate) {
+	  std::vector<const TSOS*> predicted;
+	  std::vector<const TrackingRecHit*> hits;
+	  for(auto itm = meas.begin(); itm != last; itm++) {
+	    if (!itm->recHit()->isValid()) continue;
+	    predicted.push_back(&itm->predictedState());
+	    hits.push_back(itm->recHit().get());
+	  }
+	  std::vector<TSOS> updated;
+	  theUpdator->updateBatch(predicted, hits, updated);
+	  upStates.resize(last-meas.begin());
+	  unsigned int k=0;
+	  for(auto itm = meas.begin(); itm != last; itm++)
+	    if (itm->recHit()->isValid()) upStates[itm-meas.begin()] = std::move(updated[k++]);
+	}
+
 	for(auto itm = meas.begin(); itm != last; itm++) {
 	  TempTrajectory newTraj = *traj;
-	  updateTrajectory( newTraj, std::move(*itm));
+	  if (theBatchedUpdate && itm->recHit()->isValid())
+	    updateTrajectory( newTraj, std::move(*itm), std::move(upStates[itm-meas.begin()]));
+	  else
+	    updateTrajectory( newTraj, std::move(*itm));
 
 	  if ( toBeContinued(newTraj)) {
 	    newCand.push_back(std::move(newTraj));  std::push_heap(newCand.begin(),newCand.end(),trajCandLess);
@@ -327,6 +357,16 @@ void CkfTrajectoryBuilder::updateTrajectory( TempTrajectory& traj,
   }
 }
 
+void CkfTrajectoryBuilder::updateTrajectory( TempTrajectory& traj,
+					     TM && tm, TSOS && upState) const
+{
+  auto && predictedState = tm.predictedState();
+  auto  && hit = tm.recHit();
+  traj.emplace( std::move(predictedState), std::move(upState),
+	       std::move(hit), tm.estimate(), tm.layer());
+}
+
+
 
 void 
 CkfTrajectoryBuilder::findCompatibleMeasurements(const TrajectorySeed&seed,
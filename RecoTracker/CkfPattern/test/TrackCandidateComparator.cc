@@ -0,0 +1,66 @@
+// compare two TrackCandidate collections, e.g. produced with and without parallelSeeds,
+// and throw if they differ
+
+#include "FWCore/Framework/interface/global/EDAnalyzer.h"
+#include "FWCore/Framework/interface/Event.h"
+#include "FWCore/ParameterSet/interface/ParameterSet.h"
+#include "FWCore/ParameterSet/interface/ConfigurationDescriptions.h"
+#include "FWCore/ParameterSet/interface/ParameterSetDescription.h"
+#include "FWCore/Utilities/interface/Exception.h"
+#include "DataFormats/Common/interface/Handle.h"
+#include "DataFormats/TrackCandidate/interface/TrackCandidateCollection.h"
+
+#include <iterator>
+
+class TrackCandidateComparator : public edm::global::EDAnalyzer<> {
+public:
+  explicit TrackCandidateComparator(const edm::ParameterSet& conf):
+    referenceToken_(consumes<TrackCandidateCollection>(conf.getParameter<edm::InputTag>("reference"))),
+    testToken_(consumes<TrackCandidateCollection>(conf.getParameter<edm::InputTag>("test"))) {}
+
+  static void fillDescriptions(edm::ConfigurationDescriptions& descriptions) {
+    edm::ParameterSetDescription desc;
+    desc.add<edm::InputTag>("reference");
+    desc.add<edm::InputTag>("test");
+    descriptions.add("trackCandidateComparator", desc);
+  }
+
+  void analyze(edm::StreamID, const edm::Event& e, const edm::EventSetup&) const override {
+    edm::Handle<TrackCandidateCollection> reference;
+    e.getByToken(referenceToken_, reference);
+    edm::Handle<TrackCandidateCollection> test;
+    e.getByToken(testToken_, test);
+
+    if (reference->size() != test->size())
+      throw cms::Exception("TrackCandidateMismatch") << "event " << e.id() << ": " << reference->size()
+                                                    << " reference candidates, " << test->size() << " test candidates";
+
+    for (size_t i = 0; i < reference->size(); ++i) {
+      auto const& ref = (*reference)[i];
+      auto const& tst = (*test)[i];
+      if (ref.seedRef().key() != tst.seedRef().key())
+        throw cms::Exception("TrackCandidateMismatch") << "event " << e.id() << ", candidate " << i
+                                                      << ": seeds " << ref.seedRef().key() << " and " << tst.seedRef().key();
+      auto refHits = ref.recHits();
+      auto tstHits = tst.recHits();
+      if (std::distance(refHits.first, refHits.second) != std::distance(tstHits.first, tstHits.second))
+        throw cms::Exception("TrackCandidateMismatch") << "event " << e.id() << ", candidate " << i
+                                                      << ": different number of hits";
+      for (auto r = refHits.first, t = tstHits.first; r != refHits.second; ++r, ++t) {
+        if (r->rawId() != t->rawId() || !r->sharesInput(&*t, TrackingRecHit::all))
+          throw cms::Exception("TrackCandidateMismatch") << "event " << e.id() << ", candidate " << i
+                                                        << ": different hits on " << r->rawId();
+      }
+      if (!(ref.trajectoryStateOnDet().parameters().vector() == tst.trajectoryStateOnDet().parameters().vector()))
+        throw cms::Exception("TrackCandidateMismatch") << "event " << e.id() << ", candidate " << i
+                                                      << ": different trajectory states";
+    }
+  }
+
+private:
+  const edm::EDGetTokenT<TrackCandidateCollection> referenceToken_;
+  const edm::EDGetTokenT<TrackCandidateCollection> testToken_;
+};
+
+#include "FWCore/Framework/interface/MakerMacros.h"
+DEFINE_FWK_MODULE(TrackCandidateComparator);
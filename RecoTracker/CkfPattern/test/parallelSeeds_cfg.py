@@ -0,0 +1,50 @@
+# run the initial step track candidates with the serial and the parallel seed loop
+# and check that the two collections are identical; run by runtests.sh on the
+# events it generates
+import FWCore.ParameterSet.Config as cms
+from Configuration.StandardSequences.Eras import eras
+
+process = cms.Process("PARALLELSEEDS", eras.Run2_2016)
+
+# source
+readFiles = cms.untracked.vstring()
+secFiles = cms.untracked.vstring()
+source = cms.Source ("PoolSource",fileNames = readFiles, secondaryFileNames = secFiles)
+readFiles.extend( ['file:parallelSeeds_step2.root' ])
+
+process.source = source
+process.maxEvents = cms.untracked.PSet( input = cms.untracked.int32(-1) )
+
+### conditions
+process.load("Configuration.StandardSequences.FrontierConditions_GlobalTag_cff")
+from Configuration.AlCa.GlobalTag import GlobalTag
+process.GlobalTag = GlobalTag(process.GlobalTag, 'auto:run2_mc', '')
+
+### standard includes
+process.load('Configuration/StandardSequences/Services_cff')
+process.load('Configuration.StandardSequences.GeometryRecoDB_cff')
+process.load("Configuration.StandardSequences.RawToDigi_cff")
+process.load("Configuration.StandardSequences.MagneticField_cff")
+process.load("Configuration.StandardSequences.Reconstruction_cff")
+
+process.initialStepTrackCandidatesParallel = process.initialStepTrackCandidates.clone(
+    parallelSeeds = True
+)
+
+process.compare = cms.EDAnalyzer("TrackCandidateComparator",
+    reference = cms.InputTag("initialStepTrackCandidates"),
+    test = cms.InputTag("initialStepTrackCandidatesParallel")
+)
+
+# paths
+process.trk = cms.Path(
+      process.RawToDigi *
+      process.reconstruction_trackingOnly *
+      process.initialStepTrackCandidatesParallel *
+      process.compare
+)
+
+process.options = cms.untracked.PSet(
+      numberOfThreads = cms.untracked.uint32(4),
+      wantSummary = cms.untracked.bool(True)
+)
@@ -44,6 +44,14 @@ void DeDxEstimatorProducer::fillDescriptions(edm::ConfigurationDescriptions& des
   desc.add<double>("fraction", 0.4);
   desc.add<double>("exponent",-2.0);
 
+  // more estimators evaluated on the same hits, each put as a ValueMap with the product instance name label;
+  // the parameters not given in an entry are taken from the module
+  edm::ParameterSetDescription estimatorDesc;
+  estimatorDesc.add<string>("label");
+  estimatorDesc.add<string>("estimator");
+  estimatorDesc.setAllowAnything();
+  desc.addVPSet("additionalEstimators", estimatorDesc, std::vector<edm::ParameterSet>());
+
   descriptions.add("DeDxEstimatorProducer",desc);
 }
 
@@ -52,17 +60,19 @@ DeDxEstimatorProducer::DeDxEstimatorProducer(const edm::ParameterSet& iConfig)
 {
 
    produces<ValueMap<DeDxData> >();
-
-   string estimatorName = iConfig.getParameter<string>("estimator");
-   if     (estimatorName == "median")              m_estimator = new MedianDeDxEstimator(iConfig);
-   else if(estimatorName == "generic")             m_estimator = new GenericAverageDeDxEstimator  (iConfig);
-   else if(estimatorName == "truncated")           m_estimator = new TruncatedAverageDeDxEstimator(iConfig);
-   else if(estimatorName == "genericTruncated")    m_estimator = new GenericTruncatedAverageDeDxEstimator(iConfig);
-   else if(estimatorName == "unbinnedFit")         m_estimator = new UnbinnedFitDeDxEstimator(iConfig);
-   else if(estimatorName == "productDiscrim")      m_estimator = new ProductDeDxDiscriminator(iConfig);
-   else if(estimatorName == "btagDiscrim")         m_estimator = new BTagLikeDeDxDiscriminator(iConfig);
-   else if(estimatorName == "smirnovDiscrim")      m_estimator = new SmirnovDeDxDiscriminator(iConfig);
-   else if(estimatorName == "asmirnovDiscrim")     m_estimator = new ASmirnovDeDxDiscriminator(iConfig);
+   m_estimators.push_back(makeEstimator(iConfig));
+   m_estimatorLabels.emplace_back();
+
+   for(auto const & entry : iConfig.getParameter<std::vector<edm::ParameterSet> >("additionalEstimators")){
+      edm::ParameterSet estimatorConfig(entry);
+      for(auto const & name : iConfig.getParameterNames()){
+         if(!estimatorConfig.exists(name)) estimatorConfig.copyFrom(iConfig, name);
+      }
+      auto const & label = entry.getParameter<string>("label");
+      produces<ValueMap<DeDxData> >(label);
+      m_estimators.push_back(makeEstimator(estimatorConfig));
+      m_estimatorLabels.push_back(label);
+   }
 
   //Commented for now, might be used in the future
 //   MaxNrStrips         = iConfig.getUntrackedParameter<unsigned>("maxNrStrips"        ,  255);
@@ -84,9 +94,21 @@ DeDxEstimatorProducer::DeDxEstimatorProducer(const edm::ParameterSet& iConfig)
 }
 
 
-DeDxEstimatorProducer::~DeDxEstimatorProducer()
+DeDxEstimatorProducer::~DeDxEstimatorProducer() {}
+
+std::unique_ptr<BaseDeDxEstimator> DeDxEstimatorProducer::makeEstimator(const edm::ParameterSet& iConfig)
 {
-  delete m_estimator;
+   string estimatorName = iConfig.getParameter<string>("estimator");
+   if     (estimatorName == "median")              return std::make_unique<MedianDeDxEstimator>(iConfig);
+   else if(estimatorName == "generic")             return std::make_unique<GenericAverageDeDxEstimator>(iConfig);
+   else if(estimatorName == "truncated")           return std::make_unique<TruncatedAverageDeDxEstimator>(iConfig);
+   else if(estimatorName == "genericTruncated")    return std::make_unique<GenericTruncatedAverageDeDxEstimator>(iConfig);
+   else if(estimatorName == "unbinnedFit")         return std::make_unique<UnbinnedFitDeDxEstimator>(iConfig);
+   else if(estimatorName == "productDiscrim")      return std::make_unique<ProductDeDxDiscriminator>(iConfig);
+   else if(estimatorName == "btagDiscrim")         return std::make_unique<BTagLikeDeDxDiscriminator>(iConfig);
+   else if(estimatorName == "smirnovDiscrim")      return std::make_unique<SmirnovDeDxDiscriminator>(iConfig);
+   else if(estimatorName == "asmirnovDiscrim")     return std::make_unique<ASmirnovDeDxDiscriminator>(iConfig);
+   throw cms::Exception("Configuration") << "DeDxEstimatorProducer: unknown estimator " << estimatorName;
 }
 
 // ------------ method called once each job just before starting event loop  ------------
@@ -99,27 +121,26 @@ void  DeDxEstimatorProducer::beginRun(edm::Run const& run, const edm::EventSetup
       DeDxTools::makeCalibrationMap(m_calibrationPath, *tkGeom, calibGains, m_off);
    }
 
-   m_estimator->beginRun(run, iSetup);
+   for(auto & estimator : m_estimators) estimator->beginRun(run, iSetup);
 }
 
 
 
 void DeDxEstimatorProducer::produce(edm::Event& iEvent, const edm::EventSetup& iSetup)
 {
-  auto trackDeDxEstimateAssociation = std::make_unique<ValueMap<DeDxData>>();  
-  ValueMap<DeDxData>::Filler filler(*trackDeDxEstimateAssociation);
-
   edm::Handle<reco::TrackCollection> trackCollectionHandle;
   iEvent.getByToken(m_tracksTag,trackCollectionHandle);
 
-
-  std::vector<DeDxData> dedxEstimate( trackCollectionHandle->size() );
+  // the hits of a track are collected and calibrated once for all the estimators
+  const unsigned int nEstimators = m_estimators.size();
+  std::vector<std::vector<DeDxData> > dedxEstimate(nEstimators, std::vector<DeDxData>(trackCollectionHandle->size()));
+  DeDxHitCollection dedxHits;
 
   for(unsigned int j=0;j<trackCollectionHandle->size();j++){            
      const reco::TrackRef track = reco::TrackRef( trackCollectionHandle.product(), j );
 
      int NClusterSaturating = 0; 
-     DeDxHitCollection dedxHits;
+     dedxHits.clear();
 
      auto const & trajParams = track->extra()->trajParams();
      assert(trajParams.size()==track->recHitsSize());
@@ -135,20 +156,25 @@ void DeDxEstimatorProducer::produce(edm::Event& iEvent, const edm::EventSetup& i
         } 
 
      sort(dedxHits.begin(),dedxHits.end(),less<DeDxHit>());   
-     std::pair<float,float> val_and_error = m_estimator->dedx(dedxHits);
-
-     //WARNING: Since the dEdX Error is not properly computed for the moment
-     //It was decided to store the number of saturating cluster in that dataformat
-     val_and_error.second = NClusterSaturating; 
-     dedxEstimate[j] = DeDxData(val_and_error.first, val_and_error.second, dedxHits.size() );
+     for(unsigned int e=0;e<nEstimators;e++){
+        std::pair<float,float> val_and_error = m_estimators[e]->dedx(dedxHits);
+
+        //WARNING: Since the dEdX Error is not properly computed for the moment
+        //It was decided to store the number of saturating cluster in that dataformat
+        val_and_error.second = NClusterSaturating; 
+        dedxEstimate[e][j] = DeDxData(val_and_error.first, val_and_error.second, dedxHits.size() );
+     }
   }
   ///////////////////////////////////////
 
-  filler.insert(trackCollectionHandle, dedxEstimate.begin(), dedxEstimate.end());
-
-  // fill the association map and put it into the event
-  filler.fill();
-  iEvent.put(std::move(trackDeDxEstimateAssociation));
+  // fill the association maps and put them into the event
+  for(unsigned int e=0;e<nEstimators;e++){
+     auto trackDeDxEstimateAssociation = std::make_unique<ValueMap<DeDxData>>();  
+     ValueMap<DeDxData>::Filler filler(*trackDeDxEstimateAssociation);
+     filler.insert(trackCollectionHandle, dedxEstimate[e].begin(), dedxEstimate[e].end());
+     filler.fill();
+     iEvent.put(std::move(trackDeDxEstimateAssociation), m_estimatorLabels[e]);
+  }
 }
 
 
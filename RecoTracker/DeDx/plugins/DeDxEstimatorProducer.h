@@ -3,6 +3,8 @@
 // user include files
 
 #include <memory>
+#include <string>
+#include <vector>
 
 #include "FWCore/Framework/interface/Frameworkfwd.h"
 #include "FWCore/Framework/interface/stream/EDProducer.h"
@@ -10,6 +12,7 @@
 #include "FWCore/Framework/interface/MakerMacros.h"
 #include "FWCore/ParameterSet/interface/ParameterSet.h"
 #include "FWCore/Framework/interface/ESHandle.h"
+#include "FWCore/Utilities/interface/Exception.h"
 
 #include "Geometry/TrackerGeometryBuilder/interface/TrackerGeometry.h"
 #include "Geometry/TrackerGeometryBuilder/interface/StripGeomDetUnit.h"
@@ -58,8 +61,12 @@ private:
   void   makeCalibrationMap(const TrackerGeometry& tkGeom);
   void   processHit(const TrackingRecHit * recHit, float trackMomentum, float& cosine, reco::DeDxHitCollection& dedxHits, int& NClusterSaturating);
 
+  static std::unique_ptr<BaseDeDxEstimator> makeEstimator(const edm::ParameterSet&);
+
   // ----------member data ---------------------------
-  BaseDeDxEstimator*                m_estimator;
+  // the estimator of the unnamed product first, then the additionalEstimators with their product instance name
+  std::vector<std::unique_ptr<BaseDeDxEstimator>> m_estimators;
+  std::vector<std::string>          m_estimatorLabels;
 
   edm::EDGetTokenT<reco::TrackCollection>  m_tracksTag;
 
@@ -5,6 +5,8 @@
 #include "RecoTracker/CkfPattern/interface/CkfTrackCandidateMakerBase.h"
 #include "CkfDebugTrajectoryBuilder.h"
 #include "FWCore/Framework/interface/EDProducer.h"
+#include "FWCore/ParameterSet/interface/ConfigurationDescriptions.h"
+#include "FWCore/ParameterSet/interface/ParameterSetDescription.h"
 #include "DataFormats/TrackReco/interface/SeedStopInfo.h"
 
 namespace cms {
@@ -15,6 +17,14 @@ namespace cms {
       produces<SeedStopInfo>();
     }
 
+    static void fillDescriptions(edm::ConfigurationDescriptions& descriptions) {
+      edm::ParameterSetDescription desc;
+      fillPSetDescription(desc);
+      // the remaining parameters are not described yet
+      desc.setAllowAnything();
+      descriptions.addDefault(desc);
+    }
+
     void beginRun (edm::Run const & run, edm::EventSetup const & es) override {
       beginRunBase(run,es); 
       initDebugger(es);
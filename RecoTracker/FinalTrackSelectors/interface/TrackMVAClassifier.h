@@ -87,9 +87,27 @@ private:
 		    reco::VertexCollection const & vertices,
 		    MVACollection & mvas) const final {
 
+      compute(mva,tracks,beamSpot,vertices,mvas,0);
+    }
+
+    // an MVA can evaluate all the tracks at once...
+    template<typename M>
+    static auto compute(M const & m, reco::TrackCollection const & tracks,
+			reco::BeamSpot const & beamSpot,
+			reco::VertexCollection const & vertices,
+			MVACollection & mvas, int) -> decltype(m(tracks,beamSpot,vertices,mvas)) {
+      return m(tracks,beamSpot,vertices,mvas);
+    }
+
+    // ...or one track at a time
+    template<typename M>
+    static void compute(M const & m, reco::TrackCollection const & tracks,
+			reco::BeamSpot const & beamSpot,
+			reco::VertexCollection const & vertices,
+			MVACollection & mvas, long) {
       size_t current = 0;
       for (auto const & trk : tracks) {
-	mvas[current++]= mva(trk,beamSpot,vertices);
+	mvas[current++]= m(trk,beamSpot,vertices);
       }
     }
 
@@ -7,6 +7,7 @@
 #include "DataFormats/TrackReco/interface/Track.h"
 #include "DataFormats/VertexReco/interface/Vertex.h"
 #include <limits>
+#include <vector>
 
 #include "getBestVertex.h"
 
@@ -38,9 +39,13 @@ struct mva {
     }
   }
 
-  float operator()(reco::Track const & trk,
-		   reco::BeamSpot const & beamSpot,
-		   reco::VertexCollection const & vertices) const {
+  static constexpr unsigned int nVars = PROMPT ? 16 : 12;
+
+  // fills the input variables of the track, the variable k at gbrVals_[k*stride]
+  void fillInputs(reco::Track const & trk,
+		  reco::BeamSpot const & beamSpot,
+		  reco::VertexCollection const & vertices,
+		  float * gbrVals_, unsigned int stride) const {
 
     auto tmva_pt_ = trk.pt();
     auto tmva_ndof_ = trk.ndof();
@@ -72,19 +77,18 @@ struct mva {
     auto tmva_minlost_ = std::min(lostIn,lostOut);
     auto tmva_lostmidfrac_ = static_cast<float>(trk.numberOfLostHits()) / static_cast<float>(trk.numberOfValidHits() + trk.numberOfLostHits());
    
-    float gbrVals_[PROMPT ? 16 : 12];
     gbrVals_[0] = tmva_pt_;
-    gbrVals_[1] = tmva_lostmidfrac_;
-    gbrVals_[2] = tmva_minlost_;
-    gbrVals_[3] = tmva_nhits_;
-    gbrVals_[4] = tmva_relpterr_;
-    gbrVals_[5] = tmva_eta_;
-    gbrVals_[6] = tmva_chi2n_no1dmod_;
-    gbrVals_[7] = tmva_chi2n_;
-    gbrVals_[8] = tmva_nlayerslost_;
-    gbrVals_[9] = tmva_nlayers3D_;
-    gbrVals_[10] = tmva_nlayers_;
-    gbrVals_[11] = tmva_ndof_;
+    gbrVals_[1*stride] = tmva_lostmidfrac_;
+    gbrVals_[2*stride] = tmva_minlost_;
+    gbrVals_[3*stride] = tmva_nhits_;
+    gbrVals_[4*stride] = tmva_relpterr_;
+    gbrVals_[5*stride] = tmva_eta_;
+    gbrVals_[6*stride] = tmva_chi2n_no1dmod_;
+    gbrVals_[7*stride] = tmva_chi2n_;
+    gbrVals_[8*stride] = tmva_nlayerslost_;
+    gbrVals_[9*stride] = tmva_nlayers3D_;
+    gbrVals_[10*stride] = tmva_nlayers_;
+    gbrVals_[11*stride] = tmva_ndof_;
 
     if (PROMPT) {
       auto tmva_absd0_ = std::abs(trk.dxy(beamSpot.position()));
@@ -93,16 +97,33 @@ struct mva {
       auto tmva_absd0PV_ = std::abs(trk.dxy(bestVertex));
       auto tmva_absdzPV_ = std::abs(trk.dz(bestVertex));
       
-      gbrVals_[12] = tmva_absd0PV_;
-      gbrVals_[13] = tmva_absdzPV_;
-      gbrVals_[14] = tmva_absdz_;
-      gbrVals_[15] = tmva_absd0_;
+      gbrVals_[12*stride] = tmva_absd0PV_;
+      gbrVals_[13*stride] = tmva_absdzPV_;
+      gbrVals_[14*stride] = tmva_absdz_;
+      gbrVals_[15*stride] = tmva_absd0_;
     }
+  }
 
- 
-
+  float operator()(reco::Track const & trk,
+		   reco::BeamSpot const & beamSpot,
+		   reco::VertexCollection const & vertices) const {
+    float gbrVals_[nVars];
+    fillInputs(trk,beamSpot,vertices,gbrVals_,1);
     return forest_->GetClassifier(gbrVals_);
-    
+  }
+
+  // all the tracks of the collection go through the forest together
+  void operator()(reco::TrackCollection const & tracks,
+		  reco::BeamSpot const & beamSpot,
+		  reco::VertexCollection const & vertices,
+		  std::vector<float> & mvas) const {
+    const unsigned int nTracks = tracks.size();
+    std::vector<float> gbrVals(nVars*nTracks);
+    for (unsigned int i=0; i<nTracks; ++i)
+      fillInputs(tracks[i],beamSpot,vertices,&gbrVals[i],nTracks);
+    std::vector<double> response(nTracks);
+    forest_->GetGradBoostClassifiers(gbrVals.data(),nTracks,nTracks,response.data());
+    for (unsigned int i=0; i<nTracks; ++i) mvas[i] = response[i];
   }
 
   static const char * name();
@@ -31,6 +31,8 @@
 #include <iostream>
 #include <atomic>
 
+#include "tbb/parallel_for.h"
+
 
 #include "CondFormats/EgammaObjects/interface/GBRForest.h"
 
@@ -284,7 +286,6 @@ void DuplicateTrackMerger::produce(edm::Event& iEvent, const edm::EventSetup& iS
   iSetup.get<TrackingComponentsRecord>().get(chi2EstimatorName_, hestimator);
   chi2Estimator_ = hestimator.product();
 
-  TSCPBuilderNoMaterial tscpBuilder;
   auto out_duplicateCandidates = std::make_unique<std::vector<TrackCandidate>>();
 
   auto out_candidateMap = std::make_unique<CandidateToDuplicate>();
@@ -332,7 +333,16 @@ void DuplicateTrackMerger::produce(edm::Event& iEvent, const edm::EventSetup& iS
   }
 
 
-  for(int i = 0; i <nTracks; i++){
+  // the pairs of a track with the ones after it are tested on their own, the duplicates
+  // found are then merged in the order of the pairs
+  struct Duplicate {
+    int j;
+    const reco::Track *t1, *t2;
+    DuplicateTrackType type;
+  };
+  std::vector<std::vector<Duplicate>> duplicates(nTracks);
+  auto findDuplicates = [&](int i) {
+    TSCPBuilderNoMaterial tscpBuilder;
     const reco::Track *rt1 = selTracks[i];
     for(int j = i+1; j < nTracks;j++){
       const reco::Track *rt2 = selTracks[j];
@@ -379,8 +389,7 @@ void DuplicateTrackMerger::produce(edm::Event& iEvent, const edm::EventSetup& iS
       
       
       IfLogTrace(debug_, "DuplicateTrackMerger") << " marking as duplicates" << oriIndex[i]<<','<<oriIndex[j];
-      out_duplicateCandidates->push_back(merger_.merge(*t1,*t2, duplType));
-      out_candidateMap->emplace_back(oriIndex[i],oriIndex[j]);
+      duplicates[i].push_back(Duplicate{j, t1, t2, duplType});
 
 #ifdef VI_STAT
       ++stat.nCand;
@@ -390,6 +399,20 @@ void DuplicateTrackMerger::produce(edm::Event& iEvent, const edm::EventSetup& iS
 #endif
       
     }
+  };
+
+#ifdef EDM_ML_DEBUG
+  // debug_ is set pair by pair
+  for(int i = 0; i <nTracks; i++) findDuplicates(i);
+#else
+  tbb::parallel_for(0, nTracks, findDuplicates);
+#endif
+
+  for(int i = 0; i <nTracks; i++){
+    for(auto const & d : duplicates[i]) {
+      out_duplicateCandidates->push_back(merger_.merge(*d.t1,*d.t2, d.type));
+      out_candidateMap->emplace_back(oriIndex[i],oriIndex[d.j]);
+    }
   }
   iEvent.put(std::move(out_duplicateCandidates),"candidates");
   iEvent.put(std::move(out_candidateMap),"candidateMap");
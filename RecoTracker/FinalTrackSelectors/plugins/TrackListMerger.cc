@@ -115,6 +115,10 @@ class dso_hidden TrackListMerger : public edm::stream::EDProducer<>
 #include <iostream>
 #include <cmath>
 #include <vector>
+#include <algorithm>
+#include <utility>
+
+#include "tbb/parallel_for.h"
 
 #include "DataFormats/TrackerRecHit2D/interface/SiStripMatchedRecHit2DCollection.h"
 #include "DataFormats/TrackerRecHit2D/interface/SiStripRecHit2DCollection.h"
@@ -464,6 +468,97 @@ TrackListMerger::~TrackListMerger() { }
       std::sort_heap(rh1[i].begin(),rh1[i].end(),compById);
     }
 
+    // the overlap test of two good tracks, it depends only on their hits
+    auto share = use_sharesInput_ ?
+      [](const TrackingRecHit*  it,const TrackingRecHit*  jt, float)->bool { return it->sharesInput(jt,TrackingRecHit::some); } :
+    [](const TrackingRecHit*  it,const TrackingRecHit*  jt, float eps)->bool {
+      float delta = std::abs ( it->localPosition().x()-jt->localPosition().x() );
+      return (it->geographicalId()==jt->geographicalId())&&(delta<eps);
+    };
+
+    auto isDuplicate = [&](unsigned int i, unsigned int j) {
+      unsigned int collNum=trackCollNum[i];
+      unsigned int collNum2=trackCollNum[j];
+      int k1 = indexG[i];
+      int k2 = indexG[j];
+      unsigned int nh1=rh1[k1].size();
+      unsigned int nh2=rh1[k2].size();
+      int nhit1 = nh1; // validHits[k1];
+      int nhit2 = nh2;
+
+      //loop over rechits
+      int noverlap=0;
+      int firstoverlap=0;
+      // check first hit  (should use REAL first hit?)
+      if UNLIKELY(allowFirstHitShare_ && rh1[k1][0].first==rh1[k2][0].first ) {
+	  const TrackingRecHit*  it = rh1[k1][0].second;
+	  const TrackingRecHit*  jt = rh1[k2][0].second;
+	  if (share(it,jt,epsilon_)) firstoverlap=1;
+	}
+
+
+      // exploit sorting
+      unsigned int jh=0;
+      unsigned int ih=0;
+      while (ih!=nh1 && jh!=nh2) {
+	// break if not enough to go...
+	// if ( nprecut-noverlap+firstoverlap > int(nh1-ih)) break;
+	// if ( nprecut-noverlap+firstoverlap > int(nh2-jh)) break;
+	auto const id1 = rh1[k1][ih].first;
+	auto const id2 = rh1[k2][jh].first;
+	if (id1<id2) ++ih;
+	else if (id2<id1) ++jh;
+	else {
+	  // in case of split-hit do full conbinatorics
+	  auto li=ih; while( (++li)!=nh1 && id1 == rh1[k1][li].first);
+	  auto lj=jh; while( (++lj)!=nh2 && id2 == rh1[k2][lj].first);
+	  for (auto ii=ih; ii!=li; ++ii)
+	    for (auto jj=jh; jj!=lj; ++jj) {
+	      const TrackingRecHit*  it = rh1[k1][ii].second;
+	      const TrackingRecHit*  jt = rh1[k2][jj].second;
+	      if (share(it,jt,epsilon_))  noverlap++;
+	    }
+	  jh=lj; ih=li;
+	} // equal ids
+
+      } //loop over ih & jh
+
+      return (collNum != collNum2) ? (noverlap-firstoverlap) > (std::min(nhit1,nhit2)-firstoverlap)*shareFrac_ :
+	(noverlap-firstoverlap) > (std::min(nhit1,nhit2)-firstoverlap)*indivShareFrac_[collNum];
+    };
+
+    // tracks without a valid hit on a common module cannot share enough hits:
+    // only the pairs found in the same bucket of the module ids are tested,
+    // concurrently as the test does not depend on the selection
+    std::vector<std::pair<unsigned int, unsigned int>> candPairs;  // (i,j) with i<j, sorted
+    std::vector<char> candDup;
+    if LIKELY(ngood>1 && collsSize>1) {
+      std::vector<std::pair<unsigned int, unsigned int>> hitTracks;  // (module id, track)
+      for ( unsigned int j=0; j<rSize; j++) {
+	if (selected[j]==0) continue;
+	auto const & hits = rh1[indexG[j]];
+	for (unsigned int h=0; h<hits.size(); ++h)
+	  if (h==0 || hits[h].first!=hits[h-1].first) hitTracks.emplace_back(hits[h].first,j);
+      }
+      std::sort(hitTracks.begin(),hitTracks.end());
+      for (auto b=hitTracks.begin(); b!=hitTracks.end(); ) {
+	auto e=b; while (e!=hitTracks.end() && e->first==b->first) ++e;
+	for (auto p=b; p!=e; ++p)
+	  for (auto q=p+1; q!=e; ++q) candPairs.emplace_back(p->second,q->second);
+	b=e;
+      }
+      std::sort(candPairs.begin(),candPairs.end());
+      candPairs.erase(std::unique(candPairs.begin(),candPairs.end()),candPairs.end());
+
+      candDup.resize(candPairs.size());
+      tbb::parallel_for(std::size_t(0), candPairs.size(), [&](std::size_t ip) {
+	  auto i = candPairs[ip].first;
+	  auto j = candPairs[ip].second;
+	  unsigned int collNum=trackCollNum[i];
+	  candDup[ip] = (collNum == trackCollNum[j] && indivShareFrac_[collNum] > 0.99) ? 0 : isDuplicate(i,j);
+	});
+    }
+
     //DL here
     if LIKELY(ngood>1 && collsSize>1)
     for ( unsigned int ltm=0; ltm<listsToMerge_.size(); ltm++) {
@@ -474,8 +569,13 @@ TrackListMerger::~TrackListMerger() { }
 
       for ( unsigned int i=0; i<rSize; i++) saveSelected[i]=selected[i];
 
+      auto cand=candPairs.begin();
       //DL protect against 0 tracks?
       for ( unsigned int i=0; i<rSize-1; i++) {
+	// the candidates of track i
+	while (cand!=candPairs.end() && cand->first<i) ++cand;
+	auto candEnd=cand; while (candEnd!=candPairs.end() && candEnd->first==i) ++candEnd;
+
 	if (selected[i]==0) continue;
 	unsigned int collNum=trackCollNum[i];
 
@@ -483,14 +583,13 @@ TrackListMerger::~TrackListMerger() { }
 	if (notActive[collNum]) continue;
 
 	int k1 = indexG[i];
-	unsigned int nh1=rh1[k1].size();
 	int qualityMaskT1 = trackQuals[i];
 
-	int nhit1 = nh1; // validHits[k1];
 	float score1 = score[k1];
 
 	// start at next collection
-	for ( unsigned int j=i+1; j<rSize; j++) {
+	for (auto ip=cand; ip!=candEnd; ++ip) {
+	  unsigned int j = ip->second;
 	  if (selected[j]==0) continue;
 	  unsigned int collNum2=trackCollNum[j];
 	  if ( (collNum == collNum2) && indivShareFrac_[collNum] > 0.99) continue;
@@ -505,58 +604,10 @@ TrackListMerger::~TrackListMerger() { }
 	    int maskT2= saveSelected[j]>1? saveSelected[j]-10 : trackQuals[j];
 	    newQualityMask =(maskT1 | maskT2); // take OR of trackQuality
 	  }
-	  unsigned int nh2=rh1[k2].size();
-	  int nhit2 = nh2;
-
-
-	  auto share = use_sharesInput_ ?
-	    [](const TrackingRecHit*  it,const TrackingRecHit*  jt, float)->bool { return it->sharesInput(jt,TrackingRecHit::some); } :
-	  [](const TrackingRecHit*  it,const TrackingRecHit*  jt, float eps)->bool {
-	    float delta = std::abs ( it->localPosition().x()-jt->localPosition().x() );
-	    return (it->geographicalId()==jt->geographicalId())&&(delta<eps);
-	  };
 
 	  statCount.start();
 
-	  //loop over rechits
-	  int noverlap=0;
-	  int firstoverlap=0;
-	  // check first hit  (should use REAL first hit?)
-	  if UNLIKELY(allowFirstHitShare_ && rh1[k1][0].first==rh1[k2][0].first ) {
-	      const TrackingRecHit*  it = rh1[k1][0].second;
-	      const TrackingRecHit*  jt = rh1[k2][0].second;
-	      if (share(it,jt,epsilon_)) firstoverlap=1;
-	    }
-
-
-	  // exploit sorting
-	  unsigned int jh=0;
-	  unsigned int ih=0;
-	  while (ih!=nh1 && jh!=nh2) {
-	    // break if not enough to go...
-	    // if ( nprecut-noverlap+firstoverlap > int(nh1-ih)) break;
-	    // if ( nprecut-noverlap+firstoverlap > int(nh2-jh)) break;
-	    auto const id1 = rh1[k1][ih].first;
-	    auto const id2 = rh1[k2][jh].first;
-	    if (id1<id2) ++ih;
-	    else if (id2<id1) ++jh;
-	    else {
-	      // in case of split-hit do full conbinatorics
-	      auto li=ih; while( (++li)!=nh1 && id1 == rh1[k1][li].first);
-	      auto lj=jh; while( (++lj)!=nh2 && id2 == rh1[k2][lj].first);
-	      for (auto ii=ih; ii!=li; ++ii)
-		for (auto jj=jh; jj!=lj; ++jj) {
-		  const TrackingRecHit*  it = rh1[k1][ii].second;
-		  const TrackingRecHit*  jt = rh1[k2][jj].second;
-		  if (share(it,jt,epsilon_))  noverlap++;
-		}
-	      jh=lj; ih=li;
-	    } // equal ids
-
-	  } //loop over ih & jh
-
-	  bool dupfound = (collNum != collNum2) ? (noverlap-firstoverlap) > (std::min(nhit1,nhit2)-firstoverlap)*shareFrac_ :
-	    (noverlap-firstoverlap) > (std::min(nhit1,nhit2)-firstoverlap)*indivShareFrac_[collNum];
+	  bool dupfound = candDup[ip-candPairs.begin()];
 
           auto seti = [&](unsigned int ii, unsigned int jj) {
              selected[jj]=0;
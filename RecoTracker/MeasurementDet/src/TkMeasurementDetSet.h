@@ -1,6 +1,8 @@
 #ifndef StMeasurementDetSet_H
 #define StMeasurementDetSet_H
 
+#include<atomic>
+#include<thread>
 #include<vector>
 class TkStripMeasurementDet;
 class TkStripMeasurementDet;
@@ -156,12 +158,13 @@ public:
     activeThisEvent_(cond.nDet(), true),
     detSet_(cond.nDet()),
     detIndex_(cond.nDet(),-1),
-    ready_(cond.nDet(),true),
+    ready_(cond.nDet()),
     theRawInactiveStripDetIds_(),
     stripDefined_(0), 
     stripUpdated_(0), 
     stripRegions_(0) 
   {
+    for (auto & r : ready_) r.store(kToBeSet, std::memory_order_relaxed);
   }
 
   ~StMeasurementDetSet() {
@@ -177,7 +180,7 @@ public:
   }
 
   void update(int i, int j ) {
-    assert(j>=0); assert(empty_[i]); assert(ready_[i]); 
+    assert(j>=0); assert(empty_[i]); assert(ready_[i]==kToBeSet); 
     detIndex_[i] = j;
     empty_[i] = false;
     incReady();
@@ -199,7 +202,7 @@ public:
   void setEmpty() {
     printStat();
     std::fill(empty_.begin(),empty_.end(),true);
-    std::fill(ready_.begin(),ready_.end(),true);
+    for (auto & r : ready_) r.store(kToBeSet, std::memory_order_relaxed);
     std::fill(detIndex_.begin(),detIndex_.end(),-1);
     std::fill(activeThisEvent_.begin(), activeThisEvent_.end(),true);
     incTot(size());
@@ -212,7 +215,8 @@ public:
   edm::Handle<edmNew::DetSetVector<SiStripCluster> > & handle() {  return handle_; }
   const edm::Handle<edmNew::DetSetVector<SiStripCluster> > & handle() const {  return handle_; }
   // StripDetset & detSet(int i) { return detSet_[i]; }
-  const StripDetset & detSet(int i) const { if (ready_[i]) const_cast<StMeasurementDetSet*>(this)->getDetSet(i);     return detSet_[i]; }
+  // the detset is set on first access, which may happen from several threads at once
+  const StripDetset & detSet(int i) const { if (ready_[i].load(std::memory_order_acquire)!=kSet) const_cast<StMeasurementDetSet*>(this)->getDetSet(i);     return detSet_[i]; }
   
 
   //// ------- pieces for on-demand unpacking -------- 
@@ -231,6 +235,13 @@ public:
 private:
 
   void getDetSet(int i) {
+    // only one thread sets the detset, the others wait for it (the on-demand
+    // unpacking in DetSetVector is itself thread safe)
+    char expected = kToBeSet;
+    if (!ready_[i].compare_exchange_strong(expected, kSetting, std::memory_order_acq_rel)) {
+      while (ready_[i].load(std::memory_order_acquire)!=kSet) std::this_thread::yield();
+      return;
+    }
     if(detIndex_[i]>=0) {
       detSet_[i].set(*handle_,handle_->item(detIndex_[i]));
       empty_[i]=false; // better be false already
@@ -239,7 +250,7 @@ private:
       detSet_[i] = StripDetset();
       empty_[i]=true;  
     }
-    ready_[i]=false;
+    ready_[i].store(kSet, std::memory_order_release);
     incSet();
   }
 
@@ -253,13 +264,17 @@ private:
   edm::Handle<edmNew::DetSetVector<SiStripCluster> > handle_;
 
  
-  std::vector<bool> empty_;
+  // char rather than bool: the lazy detSet(i) writes empty_ from several threads,
+  // so each det needs its own memory location
+  std::vector<char> empty_;
   std::vector<bool> activeThisEvent_;
   
   // full reco
   std::vector<StripDetset> detSet_;
   std::vector<int> detIndex_;
-  std::vector<bool> ready_; // to be cleaned
+  // state of the lazy setting of detSet_
+  enum : char { kSet=0, kToBeSet=1, kSetting=2 };
+  std::vector<std::atomic<char>> ready_; // to be cleaned
   
  
   // note: not aligned to the index
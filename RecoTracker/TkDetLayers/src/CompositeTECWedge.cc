@@ -44,6 +44,13 @@ CompositeTECWedge::CompositeTECWedge(vector<const GeomDet*>& innerDets,
   // 
   std::sort( theFrontDets.begin(), theFrontDets.end(), DetPhiLess() );
   std::sort( theBackDets.begin(),  theBackDets.end(),  DetPhiLess() );
+
+  for (int side=0; side<2; ++side) {
+    for (auto det : subWedge(side)) {
+      auto const & surface = det->surface();
+      theFrames[side].push_back(DetFrame{surface.position(), GlobalVector(surface.rotation().x())});
+    }
+  }
   
   theFrontSector = ForwardDiskSectorBuilderFromDet()( theFrontDets );
   theBackSector  = ForwardDiskSectorBuilderFromDet()( theBackDets );
@@ -263,12 +270,13 @@ void CompositeTECWedge::searchNeighbors( const TrajectoryStateOnSurface& tsos,
 int
 CompositeTECWedge::findClosestDet( const GlobalPoint& startPos,int sectorId) const
 {
-  vector<const GeomDet*> const & myDets = sectorId==0 ? theFrontDets : theBackDets;
+  // local x of startPos in the frame of each det, as in GeomDet::toLocal
+  auto const & frames = theFrames[sectorId==0 ? 0 : 1];
 
   int close = 0;
-  auto closeDist = std::abs( (myDets.front()->toLocal(startPos)).x());
-  for (unsigned int i = 1; i < myDets.size(); i++ ) {
-    auto dist = std::abs((myDets[i]->toLocal(startPos)).x());
+  auto closeDist = std::abs( frames.front().xAxis.dot(startPos - frames.front().position));
+  for (unsigned int i = 1; i < frames.size(); i++ ) {
+    auto dist = std::abs( frames[i].xAxis.dot(startPos - frames[i].position));
     if ( dist < closeDist ) {
       close = i;
       closeDist = dist;
@@ -63,6 +63,13 @@ class CompositeTECWedge final : public TECWedge{
   std::vector<const GeomDet*> theFrontDets;
   std::vector<const GeomDet*> theBackDets;
   std::vector<const GeomDet*> theDets;
+
+  // position and local x axis of the front and back dets, for the closest det search
+  struct DetFrame {
+    GlobalPoint position;
+    GlobalVector xAxis;
+  };
+  std::vector<DetFrame> theFrames[2];
   
   ReferenceCountingPointer<BoundDiskSector>  theFrontSector;
   ReferenceCountingPointer<BoundDiskSector>  theBackSector;
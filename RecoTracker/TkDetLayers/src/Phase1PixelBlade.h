@@ -86,6 +86,9 @@ private:
   std::vector<const GeomDet*> theDets;
   std::vector<const GeomDet*> theFrontDets;
   std::vector<const GeomDet*> theBackDets;
+  // positions and radii of the front and back dets, for the closest det search
+  std::vector<GlobalPoint> thePositions[2];
+  std::vector<float> theRadii[2];
   std::pair<float, float> front_radius_range_;
   std::pair<float, float> back_radius_range_;
 
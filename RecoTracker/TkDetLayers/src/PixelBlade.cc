@@ -25,6 +25,13 @@ PixelBlade::PixelBlade(vector<const GeomDet*>& frontDets,
   theDets.assign(theFrontDets.begin(),theFrontDets.end());
   theDets.insert(theDets.end(),theBackDets.begin(),theBackDets.end());
 
+  for (int side=0; side<2; ++side) {
+    for (auto det : subBlade(side)) {
+      thePositions[side].push_back(det->surface().position());
+      theRadii[side].push_back(det->surface().position().perp());
+    }
+  }
+
   theDiskSector      = BladeShapeBuilderFromDet::build(theDets);  
   theFrontDiskSector = BladeShapeBuilderFromDet::build(theFrontDets);
   theBackDiskSector  = BladeShapeBuilderFromDet::build(theBackDets);   
@@ -247,15 +254,15 @@ bool PixelBlade::overlap( const GlobalPoint& crossPoint, const GeomDet& det, flo
 int 
 PixelBlade::findBin( float R,int diskSectorIndex) const 
 {
-  vector<const GeomDet*> localDets = diskSectorIndex==0 ? theFrontDets : theBackDets;
-  
+  auto const & radii = theRadii[diskSectorIndex==0 ? 0 : 1];
+
   int theBin = 0;
-  float rDiff = std::abs( R - localDets.front()->surface().position().perp());;
-  for (vector<const GeomDet*>::const_iterator i=localDets.begin(); i !=localDets.end(); i++){
-    float testDiff = std::abs( R - (**i).surface().position().perp());
+  float rDiff = std::abs( R - radii.front());
+  for (unsigned int i=0; i<radii.size(); ++i) {
+    float testDiff = std::abs( R - radii[i]);
     if ( testDiff < rDiff) {
       rDiff = testDiff;
-      theBin = i - localDets.begin();
+      theBin = i;
     }
   }
   return theBin;
@@ -266,7 +273,6 @@ PixelBlade::findBin( float R,int diskSectorIndex) const
 GlobalPoint 
 PixelBlade::findPosition(int index,int diskSectorType) const 
 {
-  vector<const GeomDet*> diskSector = diskSectorType == 0 ? theFrontDets : theBackDets; 
-  return (diskSector[index])->surface().position();
+  return thePositions[diskSectorType == 0 ? 0 : 1][index];
 }
 
@@ -84,6 +84,9 @@ class PixelBlade final : public GeometricSearchDet {
   std::vector<const GeomDet*> theDets;
   std::vector<const GeomDet*> theFrontDets;
   std::vector<const GeomDet*> theBackDets;
+  // positions and radii of the front and back dets, for the closest det search
+  std::vector<GlobalPoint> thePositions[2];
+  std::vector<float> theRadii[2];
   
   ReferenceCountingPointer<BoundDiskSector> theDiskSector;
   ReferenceCountingPointer<BoundDiskSector> theFrontDiskSector;
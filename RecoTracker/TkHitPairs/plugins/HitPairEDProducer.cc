@@ -17,6 +17,11 @@
 #include "RecoTracker/TkHitPairs/interface/IntermediateHitDoublets.h"
 #include "RecoTracker/TkHitPairs/interface/RegionsSeedingHitSets.h"
 
+#include "tbb/parallel_for.h"
+
+#include <utility>
+#include <vector>
+
 namespace { class ImplBase; }
 
 class HitPairEDProducer: public edm::stream::EDProducer<> {
@@ -47,12 +52,14 @@ namespace {
   protected:
     edm::RunningAverage localRA_;
     const unsigned int maxElement_;
+    const bool parallelRegions_;
 
     HitPairGeneratorFromLayerPair generator_;
     std::vector<unsigned> layerPairBegins_;
   };
   ImplBase::ImplBase(const edm::ParameterSet& iConfig):
     maxElement_(iConfig.getParameter<unsigned int>("maxElement")),
+    parallelRegions_(iConfig.getParameter<bool>("parallelRegions")),
     generator_(0, 1, nullptr, maxElement_), // these indices are dummy, TODO: cleanup HitPairGeneratorFromLayerPair
     layerPairBegins_(iConfig.getParameter<std::vector<unsigned> >("layerPairs"))
   {
@@ -91,6 +98,11 @@ namespace {
       seedingHitSetsProducer.reserve(regionsLayers.regionsSize());
       intermediateHitDoubletsProducer.reserve(regionsLayers.regionsSize());
 
+      if(parallelRegions_ && regionsLayers.regionsSize() > 1) {
+        produceParallel(regionsLayers, seedingHitSetsProducer, intermediateHitDoubletsProducer, iEvent, iSetup);
+        return;
+      }
+
       for(const auto& regionLayers: regionsLayers) {
         const TrackingRegion& region = regionLayers.region();
         auto hitCachePtr_filler_shs = seedingHitSetsProducer.beginRegion(&region, nullptr);
@@ -111,6 +123,53 @@ namespace {
     }
 
   private:
+    // The doublets of the regions are made concurrently, each region with its own LayerHitMapCache,
+    // and then stored in the products in the order of the regions, so the output does not depend on
+    // the scheduling. The cache of a region is moved with its doublets, as they point to its hits.
+    template <typename T_EventTmp>
+    void produceParallel(const T_EventTmp& regionsLayers,
+                         T_SeedingHitSets& seedingHitSetsProducer, T_IntermediateHitDoublets& intermediateHitDoubletsProducer,
+                         edm::Event& iEvent, const edm::EventSetup& iSetup) {
+      using RegionLayers = typename T_EventTmp::const_iterator::value_type;
+      struct RegionDoublets {
+        LayerHitMapCache hitCache;
+        std::vector<std::pair<SeedingLayerSetsHits::SeedingLayerSet, HitDoublets> > doublets;
+      };
+
+      std::vector<RegionLayers> regions;
+      regions.reserve(regionsLayers.regionsSize());
+      // regions using the measurement tracker read the strip detsets, which are set
+      // on first access in a thread safe way, so only the modules they reach are unpacked
+      for(const auto& regionLayers: regionsLayers) regions.push_back(regionLayers);
+
+      std::vector<RegionDoublets> regionDoublets(regions.size());
+      tbb::parallel_for(size_t(0), regions.size(), [&](size_t ir) {
+        const TrackingRegion& region = regions[ir].region();
+        auto& out = regionDoublets[ir];
+        for(SeedingLayerSetsHits::SeedingLayerSet layerSet: regions[ir].layerPairs()) {
+          auto doublets = generator_.doublets(region, iEvent, iSetup, layerSet, out.hitCache);
+          LogTrace("HitPairEDProducer") << " created " << doublets.size() << " doublets for layers " << layerSet[0].index() << "," << layerSet[1].index();
+          if(doublets.empty()) continue; // don't bother if no pairs from these layers
+          out.doublets.emplace_back(layerSet, std::move(doublets));
+        }
+      });
+
+      for(size_t ir=0; ir<regions.size(); ++ir) {
+        const TrackingRegion& region = regions[ir].region();
+        auto hitCachePtr_filler_shs = seedingHitSetsProducer.beginRegion(&region, nullptr);
+        auto hitCachePtr_filler_ihd = intermediateHitDoubletsProducer.beginRegion(&region, std::get<0>(hitCachePtr_filler_shs));
+        *std::get<0>(hitCachePtr_filler_ihd) = std::move(regionDoublets[ir].hitCache);
+
+        for(auto& layerSet_doublets: regionDoublets[ir].doublets) {
+          seedingHitSetsProducer.fill(std::get<1>(hitCachePtr_filler_shs), layerSet_doublets.second);
+          intermediateHitDoubletsProducer.fill(std::get<1>(hitCachePtr_filler_ihd), layerSet_doublets.first, std::move(layerSet_doublets.second));
+        }
+      }
+
+      seedingHitSetsProducer.put(iEvent);
+      intermediateHitDoubletsProducer.put(iEvent);
+    }
+
     T_RegionLayers regionsLayers_;
   };
 
@@ -459,6 +518,7 @@ void HitPairEDProducer::fillDescriptions(edm::ConfigurationDescriptions& descrip
   desc.add<bool>("produceSeedingHitSets", false);
   desc.add<bool>("produceIntermediateHitDoublets", false);
   desc.add<unsigned int>("maxElement", 1000000);
+  desc.add<bool>("parallelRegions", false)->setComment("Make the doublets of the tracking regions concurrently; the output is the same as in the serial mode");
   desc.add<std::vector<unsigned> >("layerPairs", std::vector<unsigned>{0})->setComment("Indices to the pairs of consecutive layers, i.e. 0 means (0,1), 1 (1,2) etc.");
 
   descriptions.add("hitPairEDProducerDefault", desc);
@@ -18,14 +18,23 @@ RecHitsSortedInPhi::RecHitsSortedInPhi(const std::vector<Hit>& hits, GlobalPoint
   // cosmic region never used here
   // assert(origin.x()==0 && origin.y()==0);
 
-  theHits.reserve(hits.size());
-  for (auto const & hp : hits) theHits.emplace_back(hp);
-  
-  std::sort( theHits.begin(), theHits.end(), HitLessPhi());
+  // The global state of each hit is computed only once: it gives the phi to sort on
+  // and the cached coordinates, which are then filled in phi order.
+  std::vector<TrackingRecHitGlobalState> states;
+  states.reserve(hits.size());
+  std::vector<std::pair<float,unsigned int>> order;
+  order.reserve(hits.size());
+  for (auto const & hp : hits) {
+    states.push_back(hp->globalState());
+    order.emplace_back(states.back().phi, order.size());
+  }
 
-  for (unsigned int i=0; i!=theHits.size(); ++i) {
-    auto const & h = *theHits[i].hit();
-    auto const & gs = static_cast<BaseTrackerRecHit const &>(h).globalState();
+  std::sort( order.begin(), order.end(), [](std::pair<float,unsigned int> const & a, std::pair<float,unsigned int> const & b) { return a.first < b.first; });
+
+  theHits.reserve(hits.size());
+  for (unsigned int i=0; i!=order.size(); ++i) {
+    theHits.emplace_back(hits[order[i].second], order[i].first);
+    auto const & gs = states[order[i].second];
     auto loc = gs.position-origin.basicVector();
     float lr = loc.perp();
     // float lr = gs.position.perp();
@@ -0,0 +1,54 @@
+// compare two RegionsSeedingHitSets, e.g. produced with and without parallelRegions,
+// and throw if they differ
+
+#include "FWCore/Framework/interface/global/EDAnalyzer.h"
+#include "FWCore/Framework/interface/Event.h"
+#include "FWCore/ParameterSet/interface/ParameterSet.h"
+#include "FWCore/ParameterSet/interface/ConfigurationDescriptions.h"
+#include "FWCore/ParameterSet/interface/ParameterSetDescription.h"
+#include "FWCore/Utilities/interface/Exception.h"
+#include "DataFormats/Common/interface/Handle.h"
+#include "RecoTracker/TkHitPairs/interface/RegionsSeedingHitSets.h"
+
+class SeedingHitSetsComparator : public edm::global::EDAnalyzer<> {
+public:
+  explicit SeedingHitSetsComparator(const edm::ParameterSet& conf):
+    referenceToken_(consumes<RegionsSeedingHitSets>(conf.getParameter<edm::InputTag>("reference"))),
+    testToken_(consumes<RegionsSeedingHitSets>(conf.getParameter<edm::InputTag>("test"))) {}
+
+  static void fillDescriptions(edm::ConfigurationDescriptions& descriptions) {
+    edm::ParameterSetDescription desc;
+    desc.add<edm::InputTag>("reference");
+    desc.add<edm::InputTag>("test");
+    descriptions.add("seedingHitSetsComparator", desc);
+  }
+
+  void analyze(edm::StreamID, const edm::Event& e, const edm::EventSetup&) const override {
+    edm::Handle<RegionsSeedingHitSets> reference;
+    e.getByToken(referenceToken_, reference);
+    edm::Handle<RegionsSeedingHitSets> test;
+    e.getByToken(testToken_, test);
+
+    if (reference->regionSize() != test->regionSize() || reference->size() != test->size())
+      throw cms::Exception("SeedingHitSetsMismatch") << "event " << e.id() << ": "
+                                                    << reference->regionSize() << " regions with " << reference->size() << " hit sets in the reference, "
+                                                    << test->regionSize() << " regions with " << test->size() << " hit sets in the test";
+
+    size_t i = 0;
+    for (auto r = reference->layerSetsBegin(), t = test->layerSetsBegin(); r != reference->layerSetsEnd(); ++r, ++t, ++i) {
+      if (r->size() != t->size())
+        throw cms::Exception("SeedingHitSetsMismatch") << "event " << e.id() << ", hit set " << i << ": different number of hits";
+      for (unsigned int ih = 0; ih < r->size(); ++ih) {
+        if ((*r)[ih] != (*t)[ih])
+          throw cms::Exception("SeedingHitSetsMismatch") << "event " << e.id() << ", hit set " << i << ": different hit " << ih;
+      }
+    }
+  }
+
+private:
+  const edm::EDGetTokenT<RegionsSeedingHitSets> referenceToken_;
+  const edm::EDGetTokenT<RegionsSeedingHitSets> testToken_;
+};
+
+#include "FWCore/Framework/interface/MakerMacros.h"
+DEFINE_FWK_MODULE(SeedingHitSetsComparator);
@@ -0,0 +1,71 @@
+# make the doublets of tracking regions using the measurement tracker with the serial
+# and the parallel region loop, and check that the two products are identical; run by
+# runtests.sh on the events it generates
+import FWCore.ParameterSet.Config as cms
+from Configuration.StandardSequences.Eras import eras
+
+process = cms.Process("PARALLELREGIONS", eras.Run2_2016)
+
+# source
+readFiles = cms.untracked.vstring()
+secFiles = cms.untracked.vstring()
+source = cms.Source ("PoolSource",fileNames = readFiles, secondaryFileNames = secFiles)
+readFiles.extend( ['file:parallelRegions_step2.root' ])
+
+process.source = source
+process.maxEvents = cms.untracked.PSet( input = cms.untracked.int32(-1) )
+
+### conditions
+process.load("Configuration.StandardSequences.FrontierConditions_GlobalTag_cff")
+from Configuration.AlCa.GlobalTag import GlobalTag
+process.GlobalTag = GlobalTag(process.GlobalTag, 'auto:run2_mc', '')
+
+### standard includes
+process.load('Configuration/StandardSequences/Services_cff')
+process.load('Configuration.StandardSequences.GeometryRecoDB_cff')
+process.load("Configuration.StandardSequences.RawToDigi_cff")
+process.load("Configuration.StandardSequences.MagneticField_cff")
+process.load("Configuration.StandardSequences.Reconstruction_cff")
+
+# several regions, with the hits read through the measurement tracker
+from RecoTracker.TkTrackingRegions.pointSeededTrackingRegion_cfi import pointSeededTrackingRegion as _pointSeededTrackingRegion
+process.testRegions = _pointSeededTrackingRegion.clone(
+    RegionPSet = dict(
+        points = dict(
+            eta = cms.vdouble(-1.5, -0.5, 0.5, 1.5),
+            phi = cms.vdouble(-2.5, -1.0, 1.0, 2.5),
+        ),
+        beamSpot = "offlineBeamSpot",
+        whereToUseMeasurementTracker = "ForSiStrips",
+        measurementTrackerName = "MeasurementTrackerEvent",
+    )
+)
+
+process.testHitDoublets = process.pixelPairStepHitDoublets.clone(
+    trackingRegions = "testRegions",
+    produceSeedingHitSets = True,
+    produceIntermediateHitDoublets = False,
+)
+process.testHitDoubletsParallel = process.testHitDoublets.clone(
+    parallelRegions = True
+)
+
+process.compare = cms.EDAnalyzer("SeedingHitSetsComparator",
+    reference = cms.InputTag("testHitDoublets"),
+    test = cms.InputTag("testHitDoubletsParallel")
+)
+
+# paths
+process.trk = cms.Path(
+      process.RawToDigi *
+      process.reconstruction_trackingOnly *
+      process.testRegions *
+      process.testHitDoublets *
+      process.testHitDoubletsParallel *
+      process.compare
+)
+
+process.options = cms.untracked.PSet(
+      numberOfThreads = cms.untracked.uint32(4),
+      wantSummary = cms.untracked.bool(True)
+)
@@ -0,0 +1,12 @@
+#!/bin/bash
+
+function die { echo $1: status $2 ;  exit $2; }
+
+pushd ${LOCAL_TMP_DIR}
+
+# generate a few ttbar events up to the raw data, then make the doublets of
+# several regions with the serial and the parallel region loop and compare them
+cmsDriver.py TTbar_13TeV_TuneCUETP8M1_cfi --conditions auto:run2_mc --era Run2_2016 --beamspot NominalCollision2015 -n 3 -s GEN,SIM,DIGI,L1,DIGI2RAW --eventcontent FEVTDEBUG --datatier GEN-SIM-DIGI-RAW --fileout file:parallelRegions_step2.root --python_filename parallelRegions_step2_cfg.py || die 'Failure running cmsDriver' $?
+cmsRun ${LOCAL_TEST_DIR}/parallelRegions_cfg.py || die 'Failure using parallelRegions_cfg.py' $?
+
+popd
@@ -49,6 +49,8 @@ public:
   float halfThickness() const { return theHalfThickness; }
 
   float x0(float cotTheta) const dso_hidden;
+  // same with 1/sin(theta) = sqrt(1+cotTheta^2) given by the caller
+  float x0(float cotTheta, float overSinTheta) const dso_hidden;
   float sumX0D(float cotTheta) const dso_hidden; 
 
   
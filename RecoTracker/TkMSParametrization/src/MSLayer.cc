@@ -135,15 +135,19 @@ float MSLayer::distance2(const PixelRecoPointRZ & point) const
 
 //----------------------------------------------------------------------
 float MSLayer::x0(float cotTheta) const
+{
+  return x0(cotTheta, std::sqrt(1.f+cotTheta*cotTheta));
+}
+
+float MSLayer::x0(float cotTheta, float OverSinTheta) const
 {
   if LIKELY(theX0Data.hasX0) {
-    float OverSinTheta = std::sqrt(1.f+cotTheta*cotTheta);
     return (theFace==barrel) ? theX0Data.x0*OverSinTheta :
                                theX0Data.x0*OverSinTheta/std::abs(cotTheta);
   } else if (theX0Data.allLayers) {
     const MSLayer * dataLayer =
        theX0Data.allLayers->layers(cotTheta).findLayer(*this);
-    if (dataLayer) return  dataLayer->x0(cotTheta);
+    if (dataLayer) return  dataLayer->x0(cotTheta, OverSinTheta);
   } 
   return 0.;
 }
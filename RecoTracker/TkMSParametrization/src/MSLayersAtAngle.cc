@@ -165,10 +165,11 @@ float MSLayersAtAngle::sum2RmRn(
 {
   float sum2 = 0.f;
   float cotTh = line.cotLine();
+  float overSinTh = std::sqrt(1.f+cotTh*cotTh);
   for (LayerItr it = i1; it < i2; it++) {
     std::pair<PixelRecoPointRZ,bool> cross = it->crossing(line);
     if (cross.second) {
-      float x0 = it->x0(cotTh);
+      float x0 = it->x0(cotTh, overSinTh);
       float dr = rTarget-cross.first.r();
       if (x0 > 1.e-5f) dr *= 1.f+0.038f*unsafe_logf<2>(x0); 
       sum2 += x0*dr*dr;
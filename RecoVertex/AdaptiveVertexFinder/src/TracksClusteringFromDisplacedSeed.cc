@@ -28,35 +28,39 @@ std::pair<std::vector<reco::TransientTrack>,GlobalPoint> TracksClusteringFromDis
       float sumWeights=0;
       std::pair<bool,Measurement1D> ipSeed = IPTools::absoluteImpactParameter3D(seed,primaryVertex);
       float pvDistance = ipSeed.second.value();
+      // the seed state is the same for all the pairs
+      const TrajectoryStateOnSurface seedState = seed.impactPointState();
+      const GlobalError seedPositionErr = seedState.cartesianError().position();
+      const GlobalVector seedDir = seedState.globalDirection();
+      const bool useTime = primaryVertex.covariance(3,3) > 0. && edm::isFinite(seed.timeExt());
       for(std::vector<reco::TransientTrack>::const_iterator tt = tracks.begin();tt!=tracks.end(); ++tt )   {
 
        if(*tt==seed) continue;
 
-       if(dist.calculate(tt->impactPointState(),seed.impactPointState()))
+       // the time compatibility does not need the two track minimum distance: reject on it first
+       double timeSig = 0.;
+       if( useTime && edm::isFinite(tt->timeExt()) ) {
+         // apply only if time available and being used in vertexing
+         const double tError = std::sqrt( std::pow(seed.dtErrorExt(),2) + std::pow(tt->dtErrorExt(),2) );
+         timeSig = std::abs( seed.timeExt() - tt->timeExt() ) / tError;
+       }
+       if( !(timeSig < maxTimeSignificance) ) continue;
+
+       const TrajectoryStateOnSurface ttState = tt->impactPointState();
+       if(dist.calculate(ttState,seedState))
             {
 		 GlobalPoint ttPoint          = dist.points().first;
-		 GlobalError ttPointErr       = tt->impactPointState().cartesianError().position();
+		 GlobalError ttPointErr       = ttState.cartesianError().position();
 	         GlobalPoint seedPosition     = dist.points().second;
-	         GlobalError seedPositionErr  = seed.impactPointState().cartesianError().position();
                  Measurement1D m = distanceComputer.distance(VertexState(seedPosition,seedPositionErr), VertexState(ttPoint, ttPointErr));
                  GlobalPoint cp(dist.crossingPoint()); 
 
-		 double timeSig = 0.;
-		 if( primaryVertex.covariance(3,3) > 0. && 
-		     edm::isFinite(seed.timeExt()) && edm::isFinite(tt->timeExt()) ) { 
-		   // apply only if time available and being used in vertexing
-		   const double tError = std::sqrt( std::pow(seed.dtErrorExt(),2) + std::pow(tt->dtErrorExt(),2) );
-		   timeSig = std::abs( seed.timeExt() - tt->timeExt() ) / tError;
-		 }
-
                  float distanceFromPV =  (dist.points().second-pv).mag();
                  float distance = dist.distance();
-		 GlobalVector trackDir2D(tt->impactPointState().globalDirection().x(),tt->impactPointState().globalDirection().y(),0.); 
-		 GlobalVector seedDir2D(seed.impactPointState().globalDirection().x(),seed.impactPointState().globalDirection().y(),0.); 
 		 //SK:UNUSED//    float dotprodTrackSeed2D = trackDir2D.unit().dot(seedDir2D.unit());
 
-                 float dotprodTrack = (dist.points().first-pv).unit().dot(tt->impactPointState().globalDirection().unit());
-                 float dotprodSeed = (dist.points().second-pv).unit().dot(seed.impactPointState().globalDirection().unit());
+                 float dotprodTrack = (dist.points().first-pv).unit().dot(ttState.globalDirection().unit());
+                 float dotprodSeed = (dist.points().second-pv).unit().dot(seedDir.unit());
 
                  float w = distanceFromPV*distanceFromPV/(pvDistance*distance);
           	 bool selected = (m.significance() < clusterMaxSignificance && 
@@ -65,8 +69,7 @@ std::pair<std::vector<reco::TransientTrack>,GlobalPoint> TracksClusteringFromDis
 				  //dotprodTrackSeed2D > clusterMinAngleCosine && //Angle between track and seed
 				  //distance*clusterScale*tracks.size() < (distanceFromPV+pvDistance)*(distanceFromPV+pvDistance)/pvDistance && // cut scaling with track density
 				  distance*distanceRatio < distanceFromPV && // cut scaling with track density
-				  distance < clusterMaxDistance &&
-				  timeSig < maxTimeSignificance);  // absolute distance cut
+				  distance < clusterMaxDistance);  // absolute distance cut
 
 #ifdef VTXDEBUG
             	    std::cout << tt->trackBaseRef().key() << " :  " << (selected?"+":" ")<< " " << m.significance() << " < " << clusterMaxSignificance <<  " &&  " << 
@@ -47,16 +47,16 @@ public:
      * An invalid vertex is returned in case of problems during the update.
      */
   CachingVertex<N> update(const CachingVertex<N> & oldVertex,
-                         const RefCountedVertexTrack track, float weight,
+                         const RefCountedVertexTrack & track, float weight,
                          int sign ) const;
 
   VertexState positionUpdate (const VertexState & oldVertex,
-	 const RefCountedLinearizedTrackState linearizedTrack, 
+	 const RefCountedLinearizedTrackState & linearizedTrack, 
 	 const float weight, int sign) const;
 
   std::pair <bool, double> chi2Increment(const VertexState & oldVertex, 
 	 const VertexState & newVertexState,
-	 const RefCountedLinearizedTrackState linearizedTrack, 
+	 const RefCountedLinearizedTrackState & linearizedTrack, 
 	 float weight) const; 
 
 private:
@@ -71,6 +71,27 @@ private:
   typedef ROOT::Math::SMatrix<double,N+1,N+1,ROOT::Math::MatRepStd<double,N+1,N+1> > AlgebraicMatrixOO;
   typedef ROOT::Math::SMatrix<double,N-2,N-2,ROOT::Math::MatRepSym<double,N-2> > AlgebraicSymMatrixMM;
 
+  /**
+   * Weight matrix of the track parameters and inverse of S = B^T G B,
+   * common to the position update and to the chi2 increment.
+   * Returns false if one of the inversions fails.
+   */
+  bool trackWeights(const RefCountedLinearizedTrackState & linearizedTrack,
+	 AlgebraicSymMatrixNN & trackParametersWeight, AlgebraicSymMatrixMM & s) const;
+
+  VertexState positionUpdate (const VertexState & oldVertex,
+	 const RefCountedLinearizedTrackState & linearizedTrack, 
+	 const AlgebraicSymMatrixNN & trackParametersWeight,
+	 const AlgebraicSymMatrixMM & s,
+	 const float weight, int sign) const;
+
+  double chi2Increment(const VertexState & oldVertex, 
+	 const VertexState & newVertexState,
+	 const RefCountedLinearizedTrackState & linearizedTrack, 
+	 const AlgebraicSymMatrixNN & trackParametersWeight,
+	 const AlgebraicSymMatrixMM & s,
+	 float weight) const; 
+
   KVFHelper<N> helper;
 
 };
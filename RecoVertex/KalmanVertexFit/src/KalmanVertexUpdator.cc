@@ -11,21 +11,27 @@
 // Based on the R.Fruhwirth et al Computer Physics Communications 96 (1996) 189-208
 template <unsigned int N>
 CachingVertex<N> KalmanVertexUpdator<N>::update(const  CachingVertex<N> & oldVertex,
-	const RefCountedVertexTrack track, float weight, int sign) const
+	const RefCountedVertexTrack & track, float weight, int sign) const
 {
   if(abs(sign) != 1) throw VertexException
                           ("KalmanVertexUpdator::abs(sign) not equal to 1");
 
+  const RefCountedLinearizedTrackState & linearizedTrack = track->linearizedTrack();
+  if (!linearizedTrack->isValid()) return CachingVertex<N>();
+
+  // the track weight and the S matrix are shared by the position update and the chi2 increment
+  AlgebraicSymMatrixNN trackParametersWeight;
+  AlgebraicSymMatrixMM s;
+  if (!trackWeights(linearizedTrack, trackParametersWeight, s)) return CachingVertex<N>();
+
   VertexState newVertexState = positionUpdate(oldVertex.vertexState(), 
-			  	track->linearizedTrack(), weight, sign);
-  if (!newVertexState.isValid()) return CachingVertex<N>();
+			  	linearizedTrack, trackParametersWeight, s, weight, sign);
 
   float chi1 = oldVertex.totalChiSquared();
-  std::pair <bool, double> chi2P = chi2Increment(oldVertex.vertexState(), newVertexState, 
-                             track->linearizedTrack() , weight );
-  if (!chi2P.first) return CachingVertex<N>(); // return invalid vertex
+  double chi2 = chi2Increment(oldVertex.vertexState(), newVertexState,
+                             linearizedTrack, trackParametersWeight, s, weight);
 
-  chi1 +=sign * chi2P.second;
+  chi1 +=sign * chi2;
 
 //adding or removing track from the CachingVertex::VertexTracks
   std::vector<RefCountedVertexTrack> newVertexTracks = oldVertex.tracks();
@@ -70,42 +76,55 @@ CachingVertex<N> KalmanVertexUpdator<N>::remove(const CachingVertex<N> & oldVert
 }
 
 
+template <unsigned int N>
+bool KalmanVertexUpdator<N>::trackWeights(const RefCountedLinearizedTrackState & linearizedTrack,
+	 AlgebraicSymMatrixNN & trackParametersWeight, AlgebraicSymMatrixMM & s) const
+{
+  int error;
+  trackParametersWeight = linearizedTrack->predictedStateWeight(error);
+  if(error != 0) {
+    edm::LogWarning("KalmanVertexUpdator") << "predictedState error matrix inversion failed. An invalid vertex will be returned.";
+    return false;
+  }
+
+  const AlgebraicMatrixNM & b = linearizedTrack->momentumJacobian();
+  s = ROOT::Math::SimilarityT(b,trackParametersWeight);
+  if (!invertPosDefMatrix(s))   {
+    edm::LogWarning("KalmanVertexUpdator") << "S matrix inversion failed. An invalid vertex will be returned.";
+    return false;
+  }
+  return true;
+}
+
+
 template <unsigned int N>
 VertexState 
 KalmanVertexUpdator<N>::positionUpdate (const VertexState & oldVertex,
-	 const RefCountedLinearizedTrackState linearizedTrack, 
+	 const RefCountedLinearizedTrackState & linearizedTrack, 
 	 const float weight, int sign) const
 {
-  int error;
-
   if (!linearizedTrack->isValid())
     return VertexState();
 
-  const AlgebraicMatrixN3 & a = linearizedTrack->positionJacobian();
-  const AlgebraicMatrixNM & b = linearizedTrack->momentumJacobian();
-
-//   AlgebraicVectorN trackParameters = 
-//   	linearizedTrack->predictedStateParameters();
-
-  AlgebraicSymMatrixNN trackParametersWeight = 
-  	linearizedTrack->predictedStateWeight(error);
-  if(error != 0) {
-    edm::LogWarning("KalmanVertexUpdator") << "predictedState error matrix inversion failed. An invalid vertex will be returned.";
+  AlgebraicSymMatrixNN trackParametersWeight;
+  AlgebraicSymMatrixMM s;
+  if (!trackWeights(linearizedTrack, trackParametersWeight, s))
     return VertexState();
-  }
 
+  return positionUpdate(oldVertex, linearizedTrack, trackParametersWeight, s, weight, sign);
+}
 
-  // Jacobians
-  //  edm::LogInfo("RecoVertex/KalmanVertexUpdator") 
-  //    << "Now updating position" << "\n";
 
-  //vertex information
-//   AlgebraicSymMatrix33 oldVertexWeight = oldVertex.weight().matrix();
-  AlgebraicSymMatrixMM s = ROOT::Math::SimilarityT(b,trackParametersWeight);
-  if (!invertPosDefMatrix(s))   {
-    edm::LogWarning("KalmanVertexUpdator") << "S matrix inversion failed. An invalid vertex will be returned.";
-    return VertexState();
-  }
+template <unsigned int N>
+VertexState 
+KalmanVertexUpdator<N>::positionUpdate (const VertexState & oldVertex,
+	 const RefCountedLinearizedTrackState & linearizedTrack, 
+	 const AlgebraicSymMatrixNN & trackParametersWeight,
+	 const AlgebraicSymMatrixMM & s,
+	 const float weight, int sign) const
+{
+  const AlgebraicMatrixN3 & a = linearizedTrack->positionJacobian();
+  const AlgebraicMatrixNM & b = linearizedTrack->momentumJacobian();
 
   AlgebraicSymMatrixNN gB = trackParametersWeight -
        ROOT::Math::Similarity(trackParametersWeight, ROOT::Math::Similarity(b,s));
@@ -136,15 +155,32 @@ KalmanVertexUpdator<N>::positionUpdate (const VertexState & oldVertex,
 template <unsigned int N>
 std::pair <bool, double>  KalmanVertexUpdator<N>::chi2Increment(const VertexState & oldVertex, 
 	const VertexState & newVertexState,
-	const RefCountedLinearizedTrackState linearizedTrack, 
+	const RefCountedLinearizedTrackState & linearizedTrack, 
 	float weight) const 
 {
-  int error;
-  GlobalPoint newVertexPosition = newVertexState.position();
-
   if (!linearizedTrack->isValid())
     return std::pair <bool, double> ( false, -1. );
 
+  AlgebraicSymMatrixNN trackParametersWeight;
+  AlgebraicSymMatrixMM s;
+  if (!trackWeights(linearizedTrack, trackParametersWeight, s))
+    return std::pair <bool, double> (false, -1.);
+
+  return std::pair <bool, double> (true, chi2Increment(oldVertex, newVertexState, linearizedTrack,
+                                                       trackParametersWeight, s, weight));
+}
+
+
+template <unsigned int N>
+double KalmanVertexUpdator<N>::chi2Increment(const VertexState & oldVertex, 
+	const VertexState & newVertexState,
+	const RefCountedLinearizedTrackState & linearizedTrack, 
+	const AlgebraicSymMatrixNN & trackParametersWeight,
+	const AlgebraicSymMatrixMM & s,
+	float weight) const 
+{
+  GlobalPoint newVertexPosition = newVertexState.position();
+
   AlgebraicVector3 newVertexPositionV;
   newVertexPositionV(0) = newVertexPosition.x();
   newVertexPositionV(1) = newVertexPosition.y();
@@ -156,19 +192,6 @@ std::pair <bool, double>  KalmanVertexUpdator<N>::chi2Increment(const VertexStat
   AlgebraicVectorN trackParameters = 
   	linearizedTrack->predictedStateParameters();
 
-  AlgebraicSymMatrixNN trackParametersWeight = 
-  	linearizedTrack->predictedStateWeight(error);
-  if(error!=0) {
-    edm::LogWarning("KalmanVertexUpdator") << "predictedState error matrix inversion failed. An invalid vertex will be returned.";
-    return std::pair <bool, double> (false, -1.);
-  }
-
-  AlgebraicSymMatrixMM s = ROOT::Math::SimilarityT(b,trackParametersWeight);
-  if (!invertPosDefMatrix(s)) {
-    edm::LogWarning("KalmanVertexUpdator") << "S matrix inversion failed. An invalid vertex will be returned.";
-    return std::pair <bool, double> (false, -1.);
-  }
-
   const AlgebraicVectorN & theResidual = linearizedTrack->constantTerm();
   AlgebraicVectorN vv = trackParameters - theResidual - a*newVertexPositionV;
   AlgebraicVectorM newTrackMomentumP =  s * ROOT::Math::Transpose(b) * trackParametersWeight * vv;
@@ -184,7 +207,7 @@ std::pair <bool, double>  KalmanVertexUpdator<N>::chi2Increment(const VertexStat
 //   chi2 += vertexPositionChi2(oldVertex, newVertexPosition);
   chi2 += helper.vertexChi2(oldVertex, newVertexState);
 
-  return std::pair <bool, double> (true, chi2);
+  return chi2;
 }
 
 template class KalmanVertexUpdator<5>;
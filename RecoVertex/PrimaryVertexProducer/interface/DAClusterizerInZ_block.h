@@ -0,0 +1,49 @@
+#ifndef DAClusterizerInZ_block_h
+#define DAClusterizerInZ_block_h
+
+/**\class DAClusterizerInZ_block
+
+ Description: separates event tracks into clusters along the beam line
+
+	The tracks are sorted in z and partitioned into blocks of about block_size
+	tracks which overlap by overlap_frac of their size. The boundary between two
+	block cores is moved to the largest z gap within the overlap. Each block is
+	annealed independently, and concurrently, with DAClusterizerInZ_vect. A vertex
+	is kept only from the block whose core, i.e. the part not shared with a
+	neighbour, contains it, and each track is assigned to at most one vertex.
+	block_size (default 512) and overlap_frac (default 0.5) are optional.
+
+ */
+
+#include "RecoVertex/PrimaryVertexProducer/interface/TrackClusterizerInZ.h"
+#include "RecoVertex/PrimaryVertexProducer/interface/DAClusterizerInZ_vect.h"
+#include "TrackingTools/TransientTrack/interface/TransientTrack.h"
+#include "FWCore/ParameterSet/interface/ParameterSet.h"
+#include "RecoVertex/VertexPrimitives/interface/TransientVertex.h"
+#include <vector>
+
+
+class DAClusterizerInZ_block final : public TrackClusterizerInZ {
+
+public:
+
+  DAClusterizerInZ_block(const edm::ParameterSet& conf);
+
+  std::vector<std::vector<reco::TransientTrack> >
+  clusterize(const std::vector<reco::TransientTrack> & tracks) const override;
+
+  std::vector<TransientVertex>
+  vertices(const std::vector<reco::TransientTrack> & tracks) const;
+
+private:
+  DAClusterizerInZ_vect annealer_;
+
+  double vertexSize_;
+  unsigned int blockSize_;
+  double overlapFrac_;
+
+};
+
+
+//#ifndef DAClusterizerInZ_block_h
+#endif
@@ -0,0 +1,157 @@
+#include "RecoVertex/PrimaryVertexProducer/interface/DAClusterizerInZ_block.h"
+#include "FWCore/MessageLogger/interface/MessageLogger.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <unordered_set>
+#include <utility>
+
+#include "tbb/parallel_for.h"
+
+using namespace std;
+
+DAClusterizerInZ_block::DAClusterizerInZ_block(const edm::ParameterSet& conf) :
+  annealer_(conf)
+{
+  vertexSize_ = conf.getParameter<double> ("vertexSize");
+
+  // optional, so that the TkDAClusParameters of DA_vect can be used unchanged
+  int blockSize = conf.existsAs<int> ("block_size") ? conf.getParameter<int> ("block_size") : 512;
+  overlapFrac_ = conf.existsAs<double> ("overlap_frac") ? conf.getParameter<double> ("overlap_frac") : 0.5;
+
+  if (blockSize < 2) {
+    edm::LogWarning("DAClusterizerInZ_block") << "DAClusterizerInZ_block: invalid block_size " << blockSize
+					      << "  reset to 512";
+    blockSize = 512;
+  }
+  blockSize_ = blockSize;
+
+  if ((overlapFrac_ < 0) || (overlapFrac_ >= 1)) {
+    edm::LogWarning("DAClusterizerInZ_block") << "DAClusterizerInZ_block: invalid overlap_frac " << overlapFrac_
+					      << "  reset to 0.5";
+    overlapFrac_ = 0.5;
+  }
+
+  LogDebug("DAClusterizerInZ_block") << "block_size = " << blockSize_ << ", overlap_frac = " << overlapFrac_;
+}
+
+
+
+vector<TransientVertex>
+DAClusterizerInZ_block::vertices(const vector<reco::TransientTrack> & tracks) const {
+
+  // z at the beam line of the tracks which can be used at all (see DAClusterizerInZ_vect::fill)
+  vector<pair<double, unsigned int> > zOrder;
+  zOrder.reserve(tracks.size());
+  for (unsigned int i = 0; i < tracks.size(); i++) {
+    if (!tracks[i].isValid()) continue;
+    double t_z = tracks[i].stateAtBeamLine().trackStateAtPCA().position().z();
+    if (std::fabs(t_z) > 1000.) continue;
+    zOrder.emplace_back(t_z, i);
+  }
+
+  const unsigned int nt = zOrder.size();
+  if (nt <= blockSize_) return annealer_.vertices(tracks);
+
+  std::stable_sort(zOrder.begin(), zOrder.end(),
+		   [](pair<double, unsigned int> const& a, pair<double, unsigned int> const& b){ return a.first < b.first; });
+
+  // the core of the blocks partitions the tracks, the rest of a block is shared with its neighbours
+  const unsigned int coreSize = std::max(1U, static_cast<unsigned int>(blockSize_ * (1. - overlapFrac_)));
+  const unsigned int margin = (blockSize_ - coreSize) / 2;
+  const unsigned int nBlocks = (nt + coreSize - 1) / coreSize;
+
+  // the cores are of equal size, up to moving each boundary to the largest z gap
+  // within the margin, so that a vertex is less likely to be cut by a boundary
+  const unsigned int shift = std::min(margin, (nt / nBlocks - 1) / 2);
+  vector<unsigned int> coreBegin(nBlocks + 1);
+  coreBegin[0] = 0;
+  coreBegin[nBlocks] = nt;
+  for (unsigned int b = 1; b < nBlocks; b++) {
+    const unsigned int nominal = static_cast<unsigned int>((static_cast<unsigned long>(b) * nt) / nBlocks);
+    unsigned int best = nominal;
+    for (unsigned int i = nominal - shift; i <= nominal + shift; i++) {
+      if (zOrder[i].first - zOrder[i - 1].first > zOrder[best].first - zOrder[best - 1].first) best = i;
+    }
+    coreBegin[b] = best;
+  }
+  auto zBoundary = [&zOrder, nt, &coreBegin](unsigned int b) {
+    unsigned int i = coreBegin[b];
+    if (i == 0) return -std::numeric_limits<double>::infinity();
+    if (i >= nt) return std::numeric_limits<double>::infinity();
+    return 0.5 * (zOrder[i - 1].first + zOrder[i].first);
+  };
+
+  LogDebug("DAClusterizerInZ_block") << nt << " tracks in " << nBlocks << " blocks";
+
+  // anneal the blocks concurrently, DAClusterizerInZ_vect::vertices has no state
+  vector<vector<TransientVertex> > blockVertices(nBlocks);
+  tbb::parallel_for(0U, nBlocks, [&](unsigned int b) {
+    unsigned int begin = coreBegin[b] > margin ? coreBegin[b] - margin : 0;
+    unsigned int end = std::min(nt, coreBegin[b + 1] + margin);
+    vector<reco::TransientTrack> blockTracks;
+    blockTracks.reserve(end - begin);
+    for (unsigned int i = begin; i < end; i++) blockTracks.push_back(tracks[zOrder[i].second]);
+    blockVertices[b] = annealer_.vertices(blockTracks);
+  });
+
+  // keep the vertices in the core of their block, tracks shared by two blocks are only assigned once
+  vector<TransientVertex> clusters;
+  unordered_set<const reco::Track*> assigned;
+  assigned.reserve(nt);
+  for (unsigned int b = 0; b < nBlocks; b++) {
+    const double zlow = zBoundary(b);
+    const double zhigh = zBoundary(b + 1);
+    for (auto const& v : blockVertices[b]) {
+      const double z = v.position().z();
+      if ((z < zlow) || (z >= zhigh)) continue;
+      vector<reco::TransientTrack> vertexTracks;
+      for (auto const& t : v.originalTracks()) {
+	if (assigned.insert(&t.track()).second) vertexTracks.push_back(t);
+      }
+      // all its tracks already belong to a vertex of the previous block
+      if (vertexTracks.empty()) continue;
+      clusters.emplace_back(v.position(), v.positionError(), vertexTracks, 0);
+    }
+  }
+
+  return clusters;
+}
+
+
+
+vector<vector<reco::TransientTrack> > DAClusterizerInZ_block::clusterize(
+		const vector<reco::TransientTrack> & tracks) const {
+
+  LogDebug("DAClusterizerInZ_block") << "blocked clusterize, nt = " << tracks.size();
+
+  vector<vector<reco::TransientTrack> > clusters;
+  vector<TransientVertex> && pv = vertices(tracks);
+
+  if (pv.empty()) {
+    return clusters;
+  }
+
+  // fill into clusters and merge, as in DAClusterizerInZ_vect::clusterize
+  vector<reco::TransientTrack> aCluster = pv.begin()->originalTracks();
+
+  for (auto k = pv.begin() + 1; k != pv.end(); k++) {
+    if ( std::abs(k->position().z() - (k - 1)->position().z()) > (2 * vertexSize_)) {
+      // close a cluster
+      if (aCluster.size()>1){
+	clusters.push_back(aCluster);
+      }else{
+	LogDebug("DAClusterizerInZ_block") << "one track cluster at " << k->position().z() << " suppressed";
+      }
+      aCluster.clear();
+    }
+    for (unsigned int i = 0; i < k->originalTracks().size(); i++) {
+      aCluster.push_back(k->originalTracks()[i]);
+    }
+
+  }
+  clusters.emplace_back(std::move(aCluster));
+
+  return clusters;
+}
@@ -0,0 +1,97 @@
+#include "RecoVertex/PrimaryVertexProducer/interface/DAClusterizerInZ_block.h"
+#include "RecoVertex/PrimaryVertexProducer/interface/DAClusterizerInZ_vect.h"
+
+#include "DataFormats/BeamSpot/interface/BeamSpot.h"
+#include "DataFormats/TrackReco/interface/Track.h"
+#include "FWCore/ParameterSet/interface/ParameterSet.h"
+#include "MagneticField/UniformEngine/interface/UniformMagneticField.h"
+#include "TrackingTools/TransientTrack/interface/TransientTrack.h"
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <iostream>
+#include <random>
+#include <set>
+#include <vector>
+
+namespace {
+
+  std::vector<TransientVertex> sorted(std::vector<TransientVertex> v) {
+    std::sort(v.begin(), v.end(), [](TransientVertex const& a, TransientVertex const& b) {
+        return a.position().z() < b.position().z(); });
+    return v;
+  }
+
+  std::set<reco::Track const*> trackSet(TransientVertex const& v) {
+    std::set<reco::Track const*> s;
+    for (auto const& t : v.originalTracks()) s.insert(&t.track());
+    return s;
+  }
+
+}
+
+// Clusters a few well separated vertices with blocks much smaller than the
+// number of tracks, and checks that the result is the one of the unblocked
+// annealer.
+int main() {
+
+  UniformMagneticField field(3.8);
+
+  reco::BeamSpot::CovarianceMatrix bsError;
+  for (unsigned int i = 0; i < 7; ++i) bsError(i, i) = 1.e-6;
+  reco::BeamSpot beamSpot(reco::BeamSpot::Point(0., 0., 0.), 5., 0., 0., 0.0015, bsError);
+
+  reco::TrackBase::CovarianceMatrix cov;
+  cov(0, 0) = 1.e-6; // q/p
+  cov(1, 1) = 1.e-6; // lambda
+  cov(2, 2) = 1.e-6; // phi
+  cov(3, 3) = 1.e-4; // dxy
+  cov(4, 4) = 1.e-4; // dsz
+
+  const unsigned int nVertices = 12;
+  const unsigned int nTracksPerVertex = 30;
+  std::mt19937 rng(12345);
+  std::normal_distribution<double> smear(0., 0.01);
+  std::uniform_real_distribution<double> phi(-M_PI, M_PI);
+  std::uniform_real_distribution<double> cotTheta(-1., 1.);
+
+  std::vector<reco::TransientTrack> tracks;
+  for (unsigned int iv = 0; iv < nVertices; ++iv) {
+    double z0 = -11. + 2.*iv;
+    for (unsigned int it = 0; it < nTracksPerVertex; ++it) {
+      double p = phi(rng);
+      reco::Track::Vector momentum(2.*std::cos(p), 2.*std::sin(p), 2.*cotTheta(rng));
+      reco::Track track(10., 10., reco::Track::Point(0., 0., z0 + smear(rng)), momentum, it % 2 ? 1 : -1, cov);
+      tracks.emplace_back(track, &field);
+      tracks.back().setBeamSpot(beamSpot);
+    }
+  }
+
+  edm::ParameterSet pset;
+  pset.addParameter<double>("Tmin", 2.0);
+  pset.addParameter<double>("Tpurge", 2.0);
+  pset.addParameter<double>("Tstop", 0.5);
+  pset.addParameter<double>("coolingFactor", 0.6);
+  pset.addParameter<double>("vertexSize", 0.006);
+  pset.addParameter<double>("d0CutOff", 3.);
+  pset.addParameter<double>("dzCutOff", 3.);
+  pset.addParameter<double>("uniquetrkweight", 0.8);
+  pset.addParameter<double>("zmerge", 0.01);
+  pset.addParameter<int>("block_size", 128);
+  pset.addParameter<double>("overlap_frac", 0.5);
+
+  auto blocked = sorted(DAClusterizerInZ_block(pset).vertices(tracks));
+  auto unblocked = sorted(DAClusterizerInZ_vect(pset).vertices(tracks));
+
+  std::cout << "blocked: " << blocked.size() << " vertices, unblocked: " << unblocked.size() << " vertices" << std::endl;
+  assert(unblocked.size() == nVertices);
+  assert(blocked.size() == unblocked.size());
+  for (unsigned int i = 0; i < blocked.size(); ++i) {
+    assert(!blocked[i].originalTracks().empty());
+    assert(std::abs(blocked[i].position().z() - unblocked[i].position().z()) < 0.005);
+    assert(trackSet(blocked[i]) == trackSet(unblocked[i]));
+  }
+
+  return 0;
+}
@@ -113,6 +113,7 @@ void V0Fitter::fitAll(const edm::Event& iEvent, const edm::EventSetup& iSetup,
 
    std::vector<reco::TrackRef> theTrackRefs;
    std::vector<reco::TransientTrack> theTransTracks;
+   std::vector<int> theCharges;
 
    // fill vectors of TransientTracks and TrackRefs after applying preselection cuts
    for (reco::TrackCollection::const_iterator iTk = theTrackCollection->begin(); iTk != theTrackCollection->end(); ++iTk) {
@@ -126,10 +127,15 @@ void V0Fitter::fitAll(const edm::Event& iEvent, const edm::EventSetup& iSetup,
          theTrackRefs.push_back(std::move(tmpRef));
          reco::TransientTrack tmpTransient(*tmpRef, theMagneticField);
          theTransTracks.push_back(std::move(tmpTransient));
+         theCharges.push_back(tmpTrack->charge());
       }
    }
    // good tracks have now been selected for vertexing
 
+   // the Kalman fitter is stateless: build it once for all the pairs
+   std::unique_ptr<KalmanVertexFitter> theKalmanFitter;
+   if (vertexFitter_) theKalmanFitter = std::make_unique<KalmanVertexFitter>(useRefTracks_ == 0 ? false : true);
+
    // loop over tracks and vertex good charged track pairs
    for (unsigned int trdx1 = 0; trdx1 < theTrackRefs.size(); ++trdx1) {
    for (unsigned int trdx2 = trdx1 + 1; trdx2 < theTrackRefs.size(); ++trdx2) {
@@ -139,12 +145,12 @@ void V0Fitter::fitAll(const edm::Event& iEvent, const edm::EventSetup& iSetup,
       reco::TransientTrack* posTransTkPtr = nullptr;
       reco::TransientTrack* negTransTkPtr = nullptr;
 
-      if (theTrackRefs[trdx1]->charge() < 0. && theTrackRefs[trdx2]->charge() > 0.) {
+      if (theCharges[trdx1] < 0 && theCharges[trdx2] > 0) {
          negativeTrackRef = theTrackRefs[trdx1];
          positiveTrackRef = theTrackRefs[trdx2];
          negTransTkPtr = &theTransTracks[trdx1];
          posTransTkPtr = &theTransTracks[trdx2];
-      } else if (theTrackRefs[trdx1]->charge() > 0. && theTrackRefs[trdx2]->charge() < 0.) {
+      } else if (theCharges[trdx1] > 0 && theCharges[trdx2] < 0) {
          negativeTrackRef = theTrackRefs[trdx2];
          positiveTrackRef = theTrackRefs[trdx1];
          negTransTkPtr = &theTransTracks[trdx2];
@@ -194,8 +200,7 @@ void V0Fitter::fitAll(const edm::Event& iEvent, const edm::EventSetup& iSetup,
       // create the vertex fitter object and vertex the tracks
       TransientVertex theRecoVertex;
       if (vertexFitter_) {
-         KalmanVertexFitter theKalmanFitter(useRefTracks_ == 0 ? false : true);
-         theRecoVertex = theKalmanFitter.vertex(transTracks);
+         theRecoVertex = theKalmanFitter->vertex(transTracks);
       } else if (!vertexFitter_) {
          useRefTracks_ = false;
          AdaptiveVertexFitter theAdaptiveFitter;
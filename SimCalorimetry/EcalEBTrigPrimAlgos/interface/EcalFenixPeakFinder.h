@@ -27,7 +27,7 @@ class EcalFenixPeakFinder {
 
   EcalFenixPeakFinder();
   virtual ~EcalFenixPeakFinder();
-  virtual std::vector<int> process(std::vector<int>& filtout, std::vector<int> & output);
+  virtual void process(std::vector<int>& filtout, std::vector<int> & output);
   // from CaloVShape
   //  virtual double operator()(double) const {return 0.;}
   //  virtual double derivative(double) const {return 0.;}
@@ -37,7 +37,7 @@ int EcalFenixPeakFinder::process()
     
 }
 
-std::vector<int> EcalFenixPeakFinder::process(std::vector<int> &filtout, std::vector<int> & output)
+void EcalFenixPeakFinder::process(std::vector<int> &filtout, std::vector<int> & output)
 {
   
   // FIXME: 3
@@ -64,7 +64,7 @@ std::vector<int> EcalFenixPeakFinder::process(std::vector<int> &filtout, std::ve
   }
   //  output.resize(filtout.size());
 
-  return output;
+  return;
 }
 
 
@@ -102,6 +102,8 @@ class EcalHitResponse
 
       double timeOfFlight( const DetId& detId ) const ;
 
+      double cellTimeOfFlight( const DetId& detId ) const ;
+
       double phaseShift() const ;
 
       void blankOutUsedSamples() ;
@@ -140,6 +142,8 @@ class EcalHitResponse
       bool                           m_useLCcorrection;
       CalibCache                     m_laserCalibCache;
 
+      std::vector<double>            m_timeOfFlight; // by dense index, filled by setGeometry
+
       VecInd m_index ;
 };
 
@@ -73,6 +73,18 @@ void
 EcalHitResponse::setGeometry( const CaloSubdetectorGeometry* geometry )
 {
   m_geometry = geometry ;
+
+  // time of flight of all the cells, by dense index
+  m_timeOfFlight.clear() ;
+  if( nullptr != m_geometry )
+  {
+     for( const auto& detId : m_geometry->getValidDetIds() )
+     {
+	const unsigned int di ( CaloGenericDetId( detId ).denseIndex() ) ;
+	if( m_timeOfFlight.size() <= di ) m_timeOfFlight.resize( di + 1, -1. ) ;
+	m_timeOfFlight[ di ] = cellTimeOfFlight( detId ) ;
+     }
+  }
 }
 
 void 
@@ -281,6 +293,14 @@ EcalHitResponse::analogSignalAmplitude( const DetId& detId, double energy, CLHEP
 
 double 
 EcalHitResponse::timeOfFlight( const DetId& detId ) const 
+{
+  const unsigned int di ( CaloGenericDetId( detId ).denseIndex() ) ;
+  if( di < m_timeOfFlight.size() && 0. <= m_timeOfFlight[ di ] ) return m_timeOfFlight[ di ] ;
+  return cellTimeOfFlight( detId ) ;
+}
+
+double 
+EcalHitResponse::cellTimeOfFlight( const DetId& detId ) const 
 {
   auto cellGeometry ( geometry()->getGeometry( detId ) ) ;
   assert( nullptr != cellGeometry ) ;
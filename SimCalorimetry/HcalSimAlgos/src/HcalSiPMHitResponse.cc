@@ -14,7 +14,7 @@
 #include "CLHEP/Random/RandPoissonQ.h"
 
 #include <cmath>
-#include <list>
+#include <vector>
 
 HcalSiPMHitResponse::HcalSiPMHitResponse(const CaloVSimParameterMap * parameterMap,
 					 const CaloShapes * shapes, bool PreMix1, bool HighFidelity) :
@@ -86,15 +86,10 @@ void HcalSiPMHitResponse::add(const CaloSamples& signal) {
   DetId id(signal.id());
   int photonTimeHistSize = nbins * getReadoutFrameSize(id);
   assert(photonTimeHistSize == signal.size());
-  if (precisionTimedPhotons.find(id)==precisionTimedPhotons.end()) {
-    precisionTimedPhotons.insert(
-      std::pair<DetId, photonTimeHist >(id, photonTimeHist(photonTimeHistSize, 0)
-      )
-    );
-  }
+  photonTimeHist& photonTimeBins = precisionTimedPhotons.emplace(id, photonTimeHist(photonTimeHistSize, 0)).first->second;
   for(int i = 0; i < signal.size(); ++i){
     unsigned int photons(signal[i] + 0.5);
-    precisionTimedPhotons[id][i] += photons;
+    photonTimeBins[i] += photons;
   }
 }
 
@@ -110,14 +105,9 @@ void HcalSiPMHitResponse::add(const PCaloHit& hit, CLHEP::HepRandomEngine* engin
       double time( hit.time() );
       if(ignoreTime) time = tof;
 
+      photonTimeHist* photonTimeBins = nullptr;
       if (photons > 0)
-        if (precisionTimedPhotons.find(id)==precisionTimedPhotons.end()) {
-          precisionTimedPhotons.insert(
-            std::pair<DetId, photonTimeHist >(id, 
-              photonTimeHist(nbins * getReadoutFrameSize(id), 0)
-            )
-          );
-        }
+        photonTimeBins = &precisionTimedPhotons.emplace(id, photonTimeHist(nbins * getReadoutFrameSize(id), 0)).first->second;
 
       LogDebug("HcalSiPMHitResponse") << id;
       LogDebug("HcalSiPMHitResponse") << " fCtoGeV: " << pars.fCtoGeV(id)
@@ -146,8 +136,8 @@ void HcalSiPMHitResponse::add(const PCaloHit& hit, CLHEP::HepRandomEngine* engin
         LogDebug("HcalSiPMHitResponse") << "t_pe: " << t_pe << " t_pe + tzero: " << (t_pe+tzero_bin*dt)
                   << " t_bin: " << t_bin << '\n';
         if ((t_bin >= 0) && 
-            (static_cast<unsigned int>(t_bin) < precisionTimedPhotons[id].size()))
-            precisionTimedPhotons[id][t_bin] += 1;
+            (static_cast<unsigned int>(t_bin) < photonTimeBins->size()))
+            (*photonTimeBins)[t_bin] += 1;
       }
     }
 }
@@ -172,18 +162,14 @@ void HcalSiPMHitResponse::addPEnoise(CLHEP::HepRandomEngine* engine)
 
     unsigned int sumnoisePE(0);
     double  elapsedTime(0.);
+    photonTimeHist* photons = nullptr; // looked up at the first noise PE
     for (int tprecise(0); tprecise < nPreciseBins; ++tprecise) {
       int noisepe = CLHEP::RandPoissonQ::shoot(engine, dc_pe_avg); // add dark current noise
 
       if (noisepe > 0) {
-	if (precisionTimedPhotons.find(id)==precisionTimedPhotons.end()) {
-	  photonTimeHist photons(nPreciseBins, 0);
-	  photons[tprecise] = noisepe;
-	  precisionTimedPhotons.insert
-	    (std::pair<DetId, photonTimeHist >(id, photons ) );
-	} else {
-	  precisionTimedPhotons[id][tprecise] += noisepe;
-	}
+	if (!photons)
+	  photons = &precisionTimedPhotons.emplace(id, photonTimeHist(nPreciseBins, 0)).first->second;
+	(*photons)[tprecise] += noisepe;
 
 	sumnoisePE += noisepe;
       }
@@ -227,9 +213,9 @@ CaloSamples HcalSiPMHitResponse::makeSiPMSignal(DetId const& id,
 
   auto& sipmPulseShape(shapeMap[pars.signalShape(id)]);
 
-  std::list< std::pair<double, double> > pulses;
-  std::list< std::pair<double, double> >::iterator pulse;
-  double timeDiff, pulseBit;
+  // pulses still contributing, in the order they started
+  std::vector< std::pair<double, double> > pulses;
+  double timeDiff, pulseShape, pulseBit;
   LogDebug("HcalSiPMHitResponse") << "makeSiPMSignal for " << HcalDetId(id);
 
   for (unsigned int tbin(0); tbin < photonTimeBins.size(); ++tbin) {
@@ -267,22 +253,23 @@ CaloSamples HcalSiPMHitResponse::makeSiPMSignal(DetId const& id,
     }
     
     if (pars.doSiPMSmearing()) {
-      pulse = pulses.begin();
-      while (pulse != pulses.end()) {
-	timeDiff = elapsedTime - pulse->first;
-	pulseBit = sipmPulseShape(timeDiff)*pulse->second;
-	LogDebug("HcalSiPMHitResponse") << " pulse t: " << pulse->first 
-					<< " pulse A: " << pulse->second
+      size_t nPulses(0);
+      for (const auto& pulse : pulses) {
+	timeDiff = elapsedTime - pulse.first;
+	pulseShape = sipmPulseShape(timeDiff);
+	pulseBit = pulseShape*pulse.second;
+	LogDebug("HcalSiPMHitResponse") << " pulse t: " << pulse.first 
+					<< " pulse A: " << pulse.second
 					<< " timeDiff: " << timeDiff
 					<< " pulseBit: " << pulseBit;
 	signal[sampleBin] += pulseBit;
 	signal.preciseAtMod(preciseBin) += pulseBit*invdt;
 
-	if (timeDiff > 1 && sipmPulseShape(timeDiff) < 1e-7)
-	  pulse = pulses.erase(pulse);
-	else
-	  ++pulse;
+	// drop the pulses which are over, keeping the others in order
+	if (!(timeDiff > 1 && pulseShape < 1e-7))
+	  pulses[nPulses++] = pulse;
       }
+      pulses.resize(nPulses);
     }
     elapsedTime += dt;
   }
@@ -34,9 +34,8 @@ bool CaloSlaveSD::format() {
 bool CaloSlaveSD::processHits(uint32_t unitID, double eDepEM, double eDepHad, 
 			      double tSlice, int tkID, uint16_t depth) {
   
-  PCaloHit aCal = PCaloHit (unitID, eDepEM, eDepHad, tSlice, tkID, depth);
-  LogDebug("HitBuildInfo") <<" Sent Hit " << aCal << " to ROU " << name_;
-  hits_.push_back(aCal);
+  hits_.emplace_back(unitID, eDepEM, eDepHad, tSlice, tkID, depth);
+  LogDebug("HitBuildInfo") <<" Sent Hit " << hits_.back() << " to ROU " << name_;
   return true;
 } 
 
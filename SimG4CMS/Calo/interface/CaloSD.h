@@ -27,6 +27,7 @@
 
 #include <vector>
 #include <map>
+#include <unordered_map>
 
 class G4Step;
 class G4HCofThisEvent;
@@ -165,7 +166,21 @@ private:
   double                          eminHitD;
   double                          correctT;
 
-  std::map<CaloHitID,CaloG4Hit*>  hitMap;
+  // hits by ID, with the equivalence of CaloHitID::operator<
+  struct CaloHitIDHash {
+    size_t operator()(const CaloHitID& id) const {
+      size_t h = id.unitID();
+      h = h*1000003 + static_cast<uint32_t>(id.trackID());
+      h = h*1000003 + static_cast<uint32_t>(id.timeSliceID());
+      return h*1000003 + id.depth();
+    }
+  };
+  struct CaloHitIDEquivalent {
+    bool operator()(const CaloHitID& a, const CaloHitID& b) const {
+      return !(a < b) && !(b < a);
+    }
+  };
+  std::unordered_map<CaloHitID,CaloG4Hit*,CaloHitIDHash,CaloHitIDEquivalent> hitMap;
   std::map<int,TrackWithHistory*> tkMap;
 
   std::vector<CaloG4Hit*>         reusehit;
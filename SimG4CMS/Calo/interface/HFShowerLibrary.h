@@ -54,6 +54,7 @@ protected:
 
   bool                rInside(double r);
   void                getRecord(int, int);
+  void                readRecord(TBranch *, int);
   void                loadEventInfo(TBranch *);
   void                interpolate(int, double);
   void                extrapolate(int, double);
@@ -63,6 +64,15 @@ protected:
 
 private:
 
+  // photons of all the records of a branch, loaded once per process and
+  // shared by the libraries of all the threads
+  struct Records {
+    std::vector<size_t>      begin; // first photon of each record and end
+    HFShowerPhotonCollection photons;
+  };
+  std::shared_ptr<const Records> loadRecords(const std::string & key,
+                                             TBranch *, int offset);
+
   HFFibre *           fibre;
   TFile *             hf;
   TBranch             *emBranch, *hadBranch;
@@ -80,6 +90,7 @@ private:
   HFShowerPhotonCollection pe;
   HFShowerPhotonCollection* photo;
   HFShowerPhotonCollection photon;
+  std::shared_ptr<const Records> emRecords, hadRecords;
 
 };
 #endif
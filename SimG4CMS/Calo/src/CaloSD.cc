@@ -331,7 +331,7 @@ bool CaloSD::checkHit() {
   //look in the HitContainer whether a hit with the same ID already exists:
   bool found = false;
   if (useMap) {
-    std::map<CaloHitID,CaloG4Hit*>::const_iterator it = hitMap.find(currentID);
+    auto const it = hitMap.find(currentID);
     if (it != hitMap.end()) {
       currentHit = it->second;
       found      = true;
@@ -378,10 +378,10 @@ CaloG4Hit* CaloSD::createNewHit(const G4Step* aStep) {
   
   CaloG4Hit* aHit;
   if (!reusehit.empty()) {
-    aHit = reusehit[0];
+    aHit = reusehit.back();
     aHit->setEM(0.f);
     aHit->setHadr(0.f);
-    reusehit.erase(reusehit.begin());
+    reusehit.pop_back();
   } else {
     aHit = new CaloG4Hit;
   }
@@ -577,7 +577,7 @@ void CaloSD::update(const ::EndOfEvent * ) {
 }
 
 void CaloSD::clearHits() {  
-  if (useMap) hitMap.erase (hitMap.begin(), hitMap.end());
+  if (useMap) hitMap.clear();
   for (unsigned int i = 0; i<reusehit.size(); ++i) delete reusehit[i];
   std::vector<CaloG4Hit*>().swap(reusehit);
   cleanIndex  = 0;
@@ -666,7 +666,7 @@ void CaloSD::storeHit(CaloG4Hit* hit) {
   }
   
   theHC->insert(hit);
-  if (useMap) hitMap.insert(std::pair<CaloHitID,CaloG4Hit*>(previousID,hit));
+  if (useMap) hitMap.emplace(previousID,hit);
 }
 
 bool CaloSD::saveHit(CaloG4Hit* aHit) {  
@@ -11,6 +11,7 @@
 #include "SimG4Core/Notification/interface/G4TrackToParticleID.h"
 
 #include "FWCore/Utilities/interface/Exception.h"
+#include "FWCore/Utilities/interface/thread_safety_macros.h"
 
 #include "G4VPhysicalVolume.hh"
 #include "G4NavigationHistory.hh"
@@ -21,8 +22,16 @@
 #include "CLHEP/Units/SystemOfUnits.h"
 #include "CLHEP/Units/PhysicalConstants.h"
 
+#include <algorithm>
+#include <map>
+#include <mutex>
+
 //#define DebugLog
 
+namespace {
+  std::mutex recordsMutex;
+}
+
 HFShowerLibrary::HFShowerLibrary(const std::string & name, const DDCompactView & cpv,
                                  edm::ParameterSet const & p) : fibre(nullptr),hf(nullptr),
                                                                 emBranch(nullptr),
@@ -44,6 +53,7 @@ HFShowerLibrary::HFShowerLibrary(const std::string & name, const DDCompactView &
   std::string branchPost   = m_HS.getUntrackedParameter<std::string>("BranchPost","_R.obj");
   verbose                  = m_HS.getUntrackedParameter<bool>("Verbosity",false);
   applyFidCut              = m_HS.getParameter<bool>("ApplyFiducialCut");
+  bool loadInMemory        = m_HS.getUntrackedParameter<bool>("LoadInMemory",false);
 
   if (pTreeName.find(".") == 0) pTreeName.erase(0,2);
   const char* nTree = pTreeName.c_str();
@@ -119,6 +129,17 @@ HFShowerLibrary::HFShowerLibrary(const std::string & name, const DDCompactView &
   
   fibre = new HFFibre(name, cpv, p);
   photo = new HFShowerPhotonCollection;
+
+  if (loadInMemory) {
+    std::string key = pTreeName + ":" + branchPre + emName + branchPost;
+    emRecords  = loadRecords(key, emBranch, 0);
+    key        = pTreeName + ":" + branchPre + hadName + branchPost;
+    hadRecords = loadRecords(key, hadBranch, (newForm) ? totEvents : 0);
+    edm::LogVerbatim("HFShower") << "HFShowerLibrary: " 
+                             << emRecords->photons.size() << " EM and "
+                             << hadRecords->photons.size() << " hadronic "
+                             << "photons of the library in memory";
+  }
 }
 
 HFShowerLibrary::~HFShowerLibrary() {
@@ -370,48 +391,16 @@ void HFShowerLibrary::getRecord(int type, int record) {
   int nrc     = record-1;
   photon.clear();
   photo->clear();
-  if (type > 0) {
-    if (newForm) {
-      if ( !v3version ) {
-        hadBranch->SetAddress(&photo);
-        hadBranch->GetEntry(nrc+totEvents);
-      }
-      else{
-        std::vector<float> t;
-        std::vector<float> *tp=&t;
-        hadBranch->SetAddress(&tp);
-        hadBranch->GetEntry(nrc+totEvents);
-        unsigned int tSize=t.size()/5;
-        photo->reserve(tSize);
-        for ( unsigned int i=0; i<tSize; i++ ) {
-          photo->push_back( HFShowerPhoton( t[i], t[1*tSize+i], t[2*tSize+i], t[3*tSize+i], t[4*tSize+i] ) );
-        }
-      }
-    } else {
-      hadBranch->SetAddress(&photon);
-      hadBranch->GetEntry(nrc);
-    }
+  const Records* records = (type > 0) ? hadRecords.get() : emRecords.get();
+  if (records && nrc >= 0 && nrc+1 < (int)(records->begin.size())) {
+    auto first = records->photons.begin() + records->begin[nrc];
+    auto last  = records->photons.begin() + records->begin[nrc+1];
+    if (newForm) photo->assign(first, last);
+    else         photon.assign(first, last);
+  } else if (type > 0) {
+    readRecord(hadBranch, (newForm) ? nrc+totEvents : nrc);
   } else {
-    if (newForm) {
-      if (!v3version) {
-        emBranch->SetAddress(&photo);
-        emBranch->GetEntry(nrc);
-      }
-      else{
-        std::vector<float> t;
-        std::vector<float> *tp=&t;
-        emBranch->SetAddress(&tp);
-        emBranch->GetEntry(nrc);
-        unsigned int tSize=t.size()/5;
-        photo->reserve(tSize);
-        for ( unsigned int i=0; i<tSize; i++ ) {
-          photo->push_back( HFShowerPhoton( t[i], t[1*tSize+i], t[2*tSize+i], t[3*tSize+i], t[4*tSize+i] ) );
-        }
-      }
-    } else {
-      emBranch->SetAddress(&photon);
-      emBranch->GetEntry(nrc);
-    }
+    readRecord(emBranch, nrc);
   }
 #ifdef DebugLog
   int nPhoton = (newForm) ? photo->size() : photon.size();
@@ -424,6 +413,59 @@ void HFShowerLibrary::getRecord(int type, int record) {
 #endif
 }
 
+void HFShowerLibrary::readRecord(TBranch* branch, int entry) {
+
+  if (newForm) {
+    if (!v3version) {
+      branch->SetAddress(&photo);
+      branch->GetEntry(entry);
+    } else {
+      std::vector<float> t;
+      std::vector<float> *tp=&t;
+      branch->SetAddress(&tp);
+      branch->GetEntry(entry);
+      unsigned int tSize=t.size()/5;
+      photo->reserve(tSize);
+      for ( unsigned int i=0; i<tSize; i++ ) {
+        photo->push_back( HFShowerPhoton( t[i], t[1*tSize+i], t[2*tSize+i], t[3*tSize+i], t[4*tSize+i] ) );
+      }
+    }
+  } else {
+    branch->SetAddress(&photon);
+    branch->GetEntry(entry);
+  }
+}
+
+std::shared_ptr<const HFShowerLibrary::Records> 
+HFShowerLibrary::loadRecords(const std::string & key, TBranch* branch, 
+                             int offset) {
+
+  CMS_THREAD_GUARD(recordsMutex) static std::map<std::string, std::weak_ptr<const Records> > loaded;
+  std::lock_guard<std::mutex> guard(recordsMutex);
+  std::shared_ptr<const Records> records = loaded[key].lock();
+  if (records) return records;
+
+  // records nrc = 0 .. totEvents-1 are the entries offset+nrc of the branch
+  int nRecords = std::max(0, std::min(totEvents, (int)(branch->GetEntries())-offset));
+  auto newRecords = std::make_shared<Records>();
+  newRecords->begin.reserve(nRecords+1);
+  newRecords->begin.push_back(0);
+  for (int nrc = 0; nrc < nRecords; ++nrc) {
+    photon.clear();
+    photo->clear();
+    readRecord(branch, nrc+offset);
+    const HFShowerPhotonCollection & rec = (newForm) ? *photo : photon;
+    newRecords->photons.insert(newRecords->photons.end(), rec.begin(), rec.end());
+    newRecords->begin.push_back(newRecords->photons.size());
+  }
+  photon.clear();
+  photo->clear();
+  edm::LogVerbatim("HFShower") << "HFShowerLibrary: loads " << nRecords
+                           << " records of " << key << " in memory";
+  loaded[key] = newRecords;
+  return newRecords;
+}
+
 void HFShowerLibrary::loadEventInfo(TBranch* branch) {
 
   if (branch) {
@@ -0,0 +1,83 @@
+//
+//---------------------------------------------------------------
+//
+//  FrozenShowerModel
+//
+//  Class description:
+//
+//  Shower library fast simulation model: e+, e- and photons in a
+//  given energy range inside a region are killed and replaced by the
+//  energy spots of a pre-simulated shower of a library, which are
+//  sent to the sensitive detectors of the region as the GFlash spots.
+//
+//  The library is a ROOT file with a TTree "FrozenShowers", one entry
+//  per shower with the branches
+//    energy   (float) energy of the incident particle in GeV
+//    depth    (vector<float>) spot position along the shower axis in mm
+//    radius   (vector<float>) spot distance to the shower axis in mm
+//    phi      (vector<float>) spot azimuth around the shower axis
+//    fraction (vector<float>) spot energy over the incident energy
+//  The shower used is drawn among the showers of the library energy
+//  closest to the particle energy and rotated by a random azimuth.
+//---------------------------------------------------------------
+
+#ifndef FrozenShowerModel_h
+#define FrozenShowerModel_h
+
+#include "FWCore/ParameterSet/interface/ParameterSet.h"
+
+#include "G4VFastSimulationModel.hh"
+#include "G4TouchableHandle.hh"
+#include "G4Navigator.hh"
+#include "G4Step.hh"
+
+#include <string>
+#include <vector>
+
+class G4Region;
+
+class FrozenShowerModel : public G4VFastSimulationModel {
+
+public:
+
+  FrozenShowerModel (const G4String& name, G4Envelope* env,
+		     const edm::ParameterSet& parSet);
+  ~FrozenShowerModel () override;
+
+  G4bool ModelTrigger(const G4FastTrack &) override;
+  G4bool IsApplicable(const G4ParticleDefinition&) override;
+  void DoIt(const G4FastTrack&, G4FastStep&) override;
+
+private:
+
+  struct Spot {
+    float depth;
+    float radius;
+    float phi;
+    float fraction;
+  };
+  struct Shower {
+    double energy;
+    size_t begin;
+    size_t end;
+  };
+
+  void loadLibrary(const std::string& fileName);
+  const Shower& selectShower(G4double energy) const;
+  void makeHits(const G4FastTrack& fastTrack, const Shower& shower,
+		G4double energy);
+
+  const G4Region* theRegion;
+  G4double theMinEnergy;
+  G4double theMaxEnergy;
+
+  // showers sorted by energy, with the range of their spots
+  std::vector<Shower> theShowers;
+  std::vector<Spot>   theSpots;
+
+  G4Step *theStep;
+  G4Navigator *theNavigator;
+  G4TouchableHandle  theTouchableHandle;
+
+};
+#endif
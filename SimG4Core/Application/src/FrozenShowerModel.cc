@@ -0,0 +1,222 @@
+//
+// Shower library fast simulation model, the hits are sent to the
+// sensitive detectors as in GFlashEMShowerModel
+//
+#include "SimG4Core/Application/interface/FrozenShowerModel.h"
+
+#include "FWCore/MessageLogger/interface/MessageLogger.h"
+#include "FWCore/ParameterSet/interface/FileInPath.h"
+#include "FWCore/Utilities/interface/Exception.h"
+
+#include "G4Electron.hh"
+#include "G4Positron.hh"
+#include "G4Gamma.hh"
+#include "G4VProcess.hh"
+#include "G4VPhysicalVolume.hh"
+#include "G4LogicalVolume.hh"
+#include "G4TransportationManager.hh"
+#include "G4TouchableHandle.hh"
+#include "G4VSensitiveDetector.hh"
+#include "G4SystemOfUnits.hh"
+#include "G4PhysicalConstants.hh"
+#include "Randomize.hh"
+
+#include "TFile.h"
+#include "TTree.h"
+
+#include <algorithm>
+#include <cmath>
+#include <memory>
+
+FrozenShowerModel::FrozenShowerModel(const G4String& modelName,
+				     G4Envelope* envelope,
+				     const edm::ParameterSet& parSet)
+  : G4VFastSimulationModel(modelName, envelope)
+{
+  theRegion    = const_cast<const G4Region*>(envelope);
+  theMinEnergy = parSet.getParameter<double>("FrozenShowerMinEnergy")*GeV;
+  theMaxEnergy = parSet.getParameter<double>("FrozenShowerMaxEnergy")*GeV;
+
+  loadLibrary(parSet.getParameter<edm::FileInPath>("FrozenShowerLibrary").fullPath());
+
+  theStep = new G4Step();
+  theTouchableHandle = new G4TouchableHistory();
+  theNavigator = new G4Navigator();
+
+  edm::LogVerbatim("SimG4CoreApplication")
+    << "FrozenShowerModel " << modelName << ": " << theShowers.size()
+    << " showers with " << theSpots.size() << " spots for e+-, gamma from "
+    << theMinEnergy/GeV << " to " << theMaxEnergy/GeV << " GeV";
+}
+
+FrozenShowerModel::~FrozenShowerModel()
+{
+  delete theStep;
+  delete theNavigator;
+}
+
+G4bool
+FrozenShowerModel::IsApplicable(const G4ParticleDefinition& particleType)
+{
+  return ( &particleType == G4Electron::Electron() ||
+	   &particleType == G4Positron::Positron() ||
+	   &particleType == G4Gamma::Gamma() );
+}
+
+G4bool FrozenShowerModel::ModelTrigger(const G4FastTrack & fastTrack )
+{
+  G4double energy = fastTrack.GetPrimaryTrack()->GetKineticEnergy();
+  if(energy < theMinEnergy || energy > theMaxEnergy) { return false; }
+
+  G4TouchableHistory* touch =
+    (G4TouchableHistory*)(fastTrack.GetPrimaryTrack()->GetTouchable());
+  G4VPhysicalVolume* pCurrentVolume = touch->GetVolume();
+  if( pCurrentVolume == nullptr) { return false; }
+
+  return pCurrentVolume->GetLogicalVolume()->GetRegion() == theRegion;
+}
+
+void FrozenShowerModel::DoIt(const G4FastTrack& fastTrack,
+			     G4FastStep& fastStep)
+{
+  // Kill the parameterised particle
+  fastStep.KillPrimaryTrack();
+  fastStep.ProposePrimaryTrackPathLength(0.0);
+
+  // the shower of a positron includes its annihilation
+  const G4Track* track = fastTrack.GetPrimaryTrack();
+  G4double energy = track->GetKineticEnergy();
+  if(track->GetDefinition() == G4Positron::Positron()) {
+    energy += 2*electron_mass_c2;
+  }
+
+  makeHits(fastTrack, selectShower(track->GetKineticEnergy()), energy);
+}
+
+void FrozenShowerModel::loadLibrary(const std::string& fileName)
+{
+  std::unique_ptr<TFile> file(TFile::Open(fileName.c_str()));
+  if (!file || !file->IsOpen()) {
+    throw cms::Exception("Unknown", "FrozenShowerModel")
+      << "Opening of " << fileName << " fails\n";
+  }
+  TTree* tree = (TTree*)file->Get("FrozenShowers");
+  if (!tree) {
+    throw cms::Exception("Unknown", "FrozenShowerModel")
+      << "FrozenShowers tree absent in " << fileName << "\n";
+  }
+
+  float energy = 0;
+  std::vector<float> *depth = nullptr, *radius = nullptr, *phi = nullptr,
+    *fraction = nullptr;
+  tree->SetBranchAddress("energy", &energy);
+  tree->SetBranchAddress("depth", &depth);
+  tree->SetBranchAddress("radius", &radius);
+  tree->SetBranchAddress("phi", &phi);
+  tree->SetBranchAddress("fraction", &fraction);
+
+  for (Long64_t i = 0; i < tree->GetEntries(); ++i) {
+    tree->GetEntry(i);
+    size_t nSpots = depth->size();
+    if (radius->size() != nSpots || phi->size() != nSpots ||
+	fraction->size() != nSpots) {
+      throw cms::Exception("Unknown", "FrozenShowerModel")
+	<< "shower " << i << " of " << fileName
+	<< " has spot branches of different sizes\n";
+    }
+    Shower shower;
+    shower.energy = energy*GeV;
+    shower.begin  = theSpots.size();
+    for (size_t j = 0; j < nSpots; ++j) {
+      Spot spot;
+      spot.depth    = (*depth)[j]*mm;
+      spot.radius   = (*radius)[j]*mm;
+      spot.phi      = (*phi)[j];
+      spot.fraction = (*fraction)[j];
+      theSpots.push_back(spot);
+    }
+    shower.end = theSpots.size();
+    theShowers.push_back(shower);
+  }
+  tree->ResetBranchAddresses();
+  delete depth;
+  delete radius;
+  delete phi;
+  delete fraction;
+
+  if (theShowers.empty()) {
+    throw cms::Exception("Unknown", "FrozenShowerModel")
+      << "no shower in " << fileName << "\n";
+  }
+  std::stable_sort(theShowers.begin(), theShowers.end(),
+		   [](const Shower& a, const Shower& b) { return a.energy < b.energy; });
+}
+
+const FrozenShowerModel::Shower&
+FrozenShowerModel::selectShower(G4double energy) const
+{
+  auto lessEnergy = [](const Shower& a, const Shower& b) { return a.energy < b.energy; };
+
+  // library energy closest to the particle energy
+  Shower key;
+  key.energy = energy;
+  auto itr = std::lower_bound(theShowers.begin(), theShowers.end(), key, lessEnergy);
+  if (itr == theShowers.end() ||
+      (itr != theShowers.begin() && energy - (itr-1)->energy < itr->energy - energy)) {
+    --itr;
+  }
+
+  // one of the showers of this energy
+  auto range = std::equal_range(theShowers.begin(), theShowers.end(), *itr, lessEnergy);
+  size_t n = range.second - range.first;
+  size_t i = std::min(n-1, (size_t)(G4UniformRand()*n));
+  return *(range.first + i);
+}
+
+void FrozenShowerModel::makeHits(const G4FastTrack& fastTrack,
+				 const Shower& shower, G4double energy)
+{
+  const G4Track* track = fastTrack.GetPrimaryTrack();
+  const G4ThreeVector& start = track->GetPosition();
+  const G4ThreeVector axis = track->GetMomentumDirection();
+  const G4ThreeVector u = axis.orthogonal().unit();
+  const G4ThreeVector v = axis.cross(u);
+  const G4double phi0 = CLHEP::twopi*G4UniformRand();
+  const G4double time = track->GetStep()->GetPostStepPoint()->GetGlobalTime();
+
+  theStep->SetTrack(const_cast<G4Track*>(track));
+  theStep->GetPostStepPoint()
+    ->SetProcessDefinedStep(const_cast<G4VProcess*>(track->GetStep()
+	 ->GetPostStepPoint()->GetProcessDefinedStep()));
+  theNavigator->SetWorldVolume(G4TransportationManager::GetTransportationManager()->GetNavigatorForTracking()->GetWorldVolume());
+
+  for (size_t j = shower.begin; j < shower.end; ++j) {
+    const Spot& spot = theSpots[j];
+    G4double phi = spot.phi + phi0;
+    G4ThreeVector position = start + spot.depth*axis
+      + spot.radius*(std::cos(phi)*u + std::sin(phi)*v);
+
+    theNavigator->LocateGlobalPointAndUpdateTouchableHandle(position,
+							    G4ThreeVector(0,0,0),
+							    theTouchableHandle, false);
+    theStep->GetPostStepPoint()->SetGlobalTime(time + spot.depth/c_light);
+    theStep->GetPreStepPoint()->SetPosition(position);
+    theStep->GetPostStepPoint()->SetPosition(position);
+    theStep->GetPreStepPoint()->SetTouchableHandle(theTouchableHandle);
+
+    // Send the spot to the sensitive detector of its volume in the region
+    G4VPhysicalVolume* aCurrentVolume =
+      theStep->GetPreStepPoint()->GetPhysicalVolume();
+    if( aCurrentVolume == nullptr ) { continue; }
+
+    G4LogicalVolume* lv = aCurrentVolume->GetLogicalVolume();
+    if(lv->GetRegion() != theRegion) { continue; }
+
+    theStep->GetPreStepPoint()->SetSensitiveDetector(lv->GetSensitiveDetector());
+    G4VSensitiveDetector* aSensitive = theStep->GetPreStepPoint()->GetSensitiveDetector();
+    if( aSensitive == nullptr ) { continue; }
+
+    theStep->SetTotalEnergyDeposit(spot.fraction*energy);
+    aSensitive->Hit(theStep);
+  }
+}
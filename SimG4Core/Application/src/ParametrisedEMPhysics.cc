@@ -8,6 +8,7 @@
 #include "SimG4Core/Application/interface/ParametrisedEMPhysics.h"
 #include "SimG4Core/Application/interface/GFlashEMShowerModel.h"
 #include "SimG4Core/Application/interface/GFlashHadronShowerModel.h"
+#include "SimG4Core/Application/interface/FrozenShowerModel.h"
 #include "SimG4Core/Application/interface/ElectronLimiter.h"
 #include "FWCore/MessageLogger/interface/MessageLogger.h"
 
@@ -22,6 +23,7 @@
 #include "G4RegionStore.hh"
 #include "G4Electron.hh"
 #include "G4Positron.hh"
+#include "G4Gamma.hh"
 #include "G4MuonMinus.hh"
 #include "G4MuonPlus.hh"
 #include "G4PionMinus.hh"
@@ -44,6 +46,7 @@ struct ParametrisedEMPhysics::TLSmod {
   std::unique_ptr<GFlashEMShowerModel> theHcalEMShowerModel;
   std::unique_ptr<GFlashHadronShowerModel> theEcalHadShowerModel;
   std::unique_ptr<GFlashHadronShowerModel> theHcalHadShowerModel;
+  std::vector<std::unique_ptr<FrozenShowerModel> > theFrozenShowerModels;
   std::unique_ptr<ElectronLimiter> theElectronLimiter;
   std::unique_ptr<ElectronLimiter> thePositronLimiter;
   std::unique_ptr<G4FastSimulationManagerProcess> theFastSimulationManagerProcess; 
@@ -214,6 +217,39 @@ void ParametrisedEMPhysics::ConstructProcess() {
     }
   }
 
+  // frozen shower library part
+  std::vector<std::string> fsRegions;
+  if(theParSet.existsAs<std::vector<std::string> >("FrozenShowerRegions")) {
+    fsRegions = theParSet.getParameter<std::vector<std::string> >("FrozenShowerRegions");
+  }
+  if(!fsRegions.empty()) {
+    if(!m_tpmod) { m_tpmod = new TLSmod; }
+    edm::LogVerbatim("SimG4CoreApplication") 
+      << "ParametrisedEMPhysics: frozen showers for e+-, gamma in "
+      << fsRegions.size() << " regions";
+
+    if(!m_tpmod->theFastSimulationManagerProcess) {
+      m_tpmod->theFastSimulationManagerProcess.reset(new G4FastSimulationManagerProcess());
+    }
+    if(!(gem || ghad)) {
+      ph->RegisterProcess(m_tpmod->theFastSimulationManagerProcess.get(), G4Electron::Electron());
+      ph->RegisterProcess(m_tpmod->theFastSimulationManagerProcess.get(), G4Positron::Positron());
+    }
+    ph->RegisterProcess(m_tpmod->theFastSimulationManagerProcess.get(), G4Gamma::Gamma());
+
+    for(auto const& rname : fsRegions) {
+      G4Region* aRegion = G4RegionStore::GetInstance()->GetRegion(rname);
+      if(!aRegion) {
+	edm::LogVerbatim("SimG4CoreApplication") 
+	  << "ParametrisedEMPhysics::ConstructProcess: " << rname
+	  << " is not defined, frozen showers will not be enabled for it!";
+      } else {
+	m_tpmod->theFrozenShowerModels.emplace_back(new FrozenShowerModel("FrozenShowerModel"+rname,
+                                                    aRegion,theParSet));
+      }
+    }
+  }
+
   // Step limiters for e+-
   bool eLimiter = theParSet.getParameter<bool>("ElectronStepLimit");
   bool rLimiter = theParSet.getParameter<bool>("ElectronRangeTest");
@@ -52,6 +52,7 @@
 #include "Geometry/Records/interface/TrackerTopologyRcd.h"
 #include "FWCore/Framework/interface/ESHandle.h"
 #include "FWCore/Utilities/interface/isFinite.h"
+#include <algorithm>
 
 //Turn on integrity checking
 //#define DO_DEBUG_TESTING
@@ -164,7 +165,7 @@ namespace
 		const double volumeRadius_;
 		const double volumeZ_;
 		const double vertexDistanceCut2_; // distance based on which HepMC::GenVertexs are added to SimVertexs
-		std::multimap<unsigned int, size_t> trackIdToHitIndex_; ///< A multimap linking SimTrack::trackId() to the hit index in pSimHits_
+		std::vector< std::pair<unsigned int, size_t> > trackIdToHitIndex_; ///< (SimTrack::trackId(), index in pSimHits_) pairs sorted by trackId and then by index
 		bool allowDifferentProcessTypeForDifferentDetectors_; ///< See the comment for the same member in TrackingTruthAccumulator
 	};
 
@@ -574,12 +575,14 @@ namespace // Unnamed namespace for things only used in this file
 		: decayChain_(decayChain), hGenParticles_(hGenParticles), hepMCproduct_(hepMCproduct), simHits_(simHits), volumeRadius_(volumeRadius),
 		  volumeZ_(volumeZ), vertexDistanceCut2_(vertexDistanceCut*vertexDistanceCut), allowDifferentProcessTypeForDifferentDetectors_(allowDifferentProcessTypes)
 	{
-		// Need to create a multimap to get from a SimTrackId to all of the hits in it. The SimTrackId
-		// is an unsigned int.
+		// Need to create a sorted index to get from a SimTrackId to all of the hits in it. The SimTrackId
+		// is an unsigned int. The hits of each track stay in the time of flight order of simHits_.
+		trackIdToHitIndex_.reserve( simHits_.size() );
 		for( size_t index=0; index<simHits_.size(); ++index )
 		{
-			trackIdToHitIndex_.insert( std::make_pair( simHits_[index]->trackId(), index ) );
+			trackIdToHitIndex_.emplace_back( simHits_[index]->trackId(), index );
 		}
+		std::sort( trackIdToHitIndex_.begin(), trackIdToHitIndex_.end() );
 
 		if( hHepMCGenParticleIndices.isValid() ) // Monte Carlo might not be available for the pileup events
 		{
@@ -656,7 +659,9 @@ namespace // Unnamed namespace for things only used in this file
 		// through the hits "in order" (ok, most important is
 		// to get the first hit right because processType and
 		// particleType are taken from it)
-		for( auto iHitIndex=trackIdToHitIndex_.lower_bound( simTrack.trackId() ), end=trackIdToHitIndex_.upper_bound( simTrack.trackId() );
+		auto const hitRange=std::equal_range( trackIdToHitIndex_.begin(), trackIdToHitIndex_.end(), std::make_pair( simTrack.trackId(), size_t(0) ),
+				[]( const std::pair<unsigned int, size_t>& a, const std::pair<unsigned int, size_t>& b ) { return a.first<b.first; } );
+		for( auto iHitIndex=hitRange.first, end=hitRange.second;
 				iHitIndex!=end;
 				++iHitIndex )
 		{
@@ -40,6 +40,7 @@
 // February, 2011: Time improvement in DriftDirection()  (J. Bashir Butt)
 // June, 2011: Bug Fix for pixels on ROC edges in module_killing_DB() (J. Bashir Butt)
 // February, 2018: Implement cluster charge reweighting (P. Schuetze, with code from A. Hazi)
+#include <algorithm>
 #include <iostream>
 #include <iomanip>
 
@@ -1160,8 +1161,12 @@ void SiPixelDigitizerAlgorithm::induce_signal(std::vector<PSimHit>::const_iterat
    typedef std::map< int, float, std::less<int> > hit_map_type;
    hit_map_type hit_signal;
 
-   // map to store pixel integrals in the x and in the y directions
-   std::map<int, float, std::less<int> > x,y;
+   // the charge of the pixels hit is first summed in a dense buffer of the
+   // module, in the same order as in the map, and moved to the map at the end
+   int numColumns = topol->ncolumns();  // det module number of cols&rows
+   int numRows = topol->nrows();
+   if (hitCharge_.size() < size_t(numRows*numColumns)) hitCharge_.resize(numRows*numColumns, 0.f);
+   hitPixels_.clear();
 
    // Assign signals to readout channels and store sorted by channel number
 
@@ -1229,92 +1234,82 @@ void SiPixelDigitizerAlgorithm::induce_signal(std::vector<PSimHit>::const_iterat
 #endif
 
      // Check detector limits to correct for pixels outside range.
-     int numColumns = topol->ncolumns();  // det module number of cols&rows
-     int numRows = topol->nrows();
-
      IPixRightUpX = numRows>IPixRightUpX ? IPixRightUpX : numRows-1 ;
      IPixRightUpY = numColumns>IPixRightUpY ? IPixRightUpY : numColumns-1 ;
      IPixLeftDownX = 0<IPixLeftDownX ? IPixLeftDownX : 0 ;
      IPixLeftDownY = 0<IPixLeftDownY ? IPixLeftDownY : 0 ;
 
-     x.clear(); // clear temporary integration array
-     y.clear();
-
-     // First integrate charge strips in x
+     // Integrate the charge in the x strips. The upper edge of a strip is
+     // the lower edge of the next one, each edge is computed once.
      int ix; // TT for compatibility
-     for (ix=IPixLeftDownX; ix<=IPixRightUpX; ix++) {  // loop over x index
-       float xUB, xLB, UpperBound, LowerBound;
-
-       // Why is set to 0 if ix=0, does it meen that we accept charge
-       // outside the sensor? CHeck How it was done in ORCA?
-       //if(ix == 0) LowerBound = 0.;
-       if(ix == 0 || SigmaX==0. )  // skip for surface segemnts
-	 LowerBound = 0.;
-       else {
-	 mp = MeasurementPoint( float(ix), 0.0);
-	 xLB = topol->localPosition(mp).x();
-	 LowerBound = 1-calcQ((xLB-CloudCenterX)/SigmaX);
-       }
-
-       if(ix == numRows-1 || SigmaX==0. )
-	 UpperBound = 1.;
-       else {
-	 mp = MeasurementPoint( float(ix+1), 0.0);
-	 xUB = topol->localPosition(mp).x();
-	 UpperBound = 1. - calcQ((xUB-CloudCenterX)/SigmaX);
+     const int nx = IPixRightUpX - IPixLeftDownX + 1;
+     if (nx > 0) {
+       xIntegrals_.resize(nx);
+       if(SigmaX==0.) { // skip for surface segemnts
+	 std::fill(xIntegrals_.begin(), xIntegrals_.end(), 1.f);
+       } else {
+	 float LowerBound = 0.;
+	 for (ix=IPixLeftDownX; ix<=IPixRightUpX+1; ix++) {  // loop over x edges
+	   float Bound;
+	   if(ix == 0)
+	     Bound = 0.;
+	   else if(ix == numRows)
+	     Bound = 1.;
+	   else {
+	     mp = MeasurementPoint( float(ix), 0.0);
+	     float xEdge = topol->localPosition(mp).x();
+	     Bound = 1. - calcQ((xEdge-CloudCenterX)/SigmaX);
+	   }
+	   if(ix > IPixLeftDownX) xIntegrals_[ix-1-IPixLeftDownX] = Bound - LowerBound; // save strip integral
+	   LowerBound = Bound;
+	 }
        }
-
-       float   TotalIntegrationRange = UpperBound - LowerBound; // get strip
-       x[ix] = TotalIntegrationRange; // save strip integral
-       //if(SigmaX==0 || SigmaY==0)
-       //cout<<TotalIntegrationRange<<" "<<ix<<std::endl;
-
      }
 
     // Now integrate strips in y
     int iy; // TT for compatibility
-    for (iy=IPixLeftDownY; iy<=IPixRightUpY; iy++) { //loope over y ind
-      float yUB, yLB, UpperBound, LowerBound;
-
-      if(iy == 0 || SigmaY==0.)
-	LowerBound = 0.;
-      else {
-        mp = MeasurementPoint( 0.0, float(iy) );
-        yLB = topol->localPosition(mp).y();
-	LowerBound = 1. - calcQ((yLB-CloudCenterY)/SigmaY);
-      }
-
-      if(iy == numColumns-1 || SigmaY==0. )
-	UpperBound = 1.;
-      else {
-        mp = MeasurementPoint( 0.0, float(iy+1) );
-        yUB = topol->localPosition(mp).y();
-	UpperBound = 1. - calcQ((yUB-CloudCenterY)/SigmaY);
+    const int ny = IPixRightUpY - IPixLeftDownY + 1;
+    if (ny > 0) {
+      yIntegrals_.resize(ny);
+      if(SigmaY==0.) {
+	std::fill(yIntegrals_.begin(), yIntegrals_.end(), 1.f);
+      } else {
+	float LowerBound = 0.;
+	for (iy=IPixLeftDownY; iy<=IPixRightUpY+1; iy++) { // loop over y edges
+	  float Bound;
+	  if(iy == 0)
+	    Bound = 0.;
+	  else if(iy == numColumns)
+	    Bound = 1.;
+	  else {
+	    mp = MeasurementPoint( 0.0, float(iy) );
+	    float yEdge = topol->localPosition(mp).y();
+	    Bound = 1. - calcQ((yEdge-CloudCenterY)/SigmaY);
+	  }
+	  if(iy > IPixLeftDownY) yIntegrals_[iy-1-IPixLeftDownY] = Bound - LowerBound; // save strip integral
+	  LowerBound = Bound;
+	}
       }
-
-      float   TotalIntegrationRange = UpperBound - LowerBound;
-      y[iy] = TotalIntegrationRange; // save strip integral
-      //if(SigmaX==0 || SigmaY==0)
-      //cout<<TotalIntegrationRange<<" "<<iy<<std::endl;
     }
 
     // Get the 2D charge integrals by folding x and y strips
-    int chan;
     for (ix=IPixLeftDownX; ix<=IPixRightUpX; ix++) {  // loop over x index
+      const float ChargeX = Charge*xIntegrals_[ix-IPixLeftDownX];
+      float* rowCharge = &hitCharge_[ix*numColumns];
       for (iy=IPixLeftDownY; iy<=IPixRightUpY; iy++) { //loope over y ind
 
-        float ChargeFraction = Charge*x[ix]*y[iy];
+        float ChargeFraction = ChargeX*yIntegrals_[iy-IPixLeftDownY];
 
         if( ChargeFraction > 0. ) {
-	  chan = PixelDigi::pixelToChannel( ix, iy);  // Get index
           // Load the amplitude
-          hit_signal[chan] += ChargeFraction;
+          if (rowCharge[iy] == 0.f) hitPixels_.push_back(ix*numColumns + iy);
+          rowCharge[iy] += ChargeFraction;
 	} // endif
 
 #ifdef TP_DEBUG
 	mp = MeasurementPoint( float(ix), float(iy) );
 	LocalPoint lp = topol->localPosition(mp);
-	chan = topol->channel(lp);
+	int chan = topol->channel(lp);
 	LogDebug ("Pixel Digitizer")
 	  << " pixel " << ix << " " << iy << " - "<<" "
 	  << chan << " " << ChargeFraction<<" "
@@ -1329,6 +1324,13 @@ void SiPixelDigitizerAlgorithm::induce_signal(std::vector<PSimHit>::const_iterat
 
   } // loop over charge distributions
 
+  // Move the pixels hit to the map, sorted by channel number, and reset the buffer
+  std::sort(hitPixels_.begin(), hitPixels_.end());
+  for (int pixel : hitPixels_) {
+    hit_signal.emplace_hint(hit_signal.end(), PixelDigi::pixelToChannel(pixel/numColumns, pixel%numColumns), hitCharge_[pixel]);
+    hitCharge_[pixel] = 0.f;
+  }
+
   // Fill the global map with all hit pixels from this event
 
    bool reweighted = false;
@@ -296,6 +296,15 @@ class SiPixelDigitizerAlgorithm  {
     // Contains the accumulated hit info.
     signalMaps _signal;
 
+    // Scratch buffers of induce_signal, reused over the hits: the x and y strip
+    // integrals of a charge cloud, and the dense charge of the pixels of the
+    // module hit by one PSimHit, indexed by row*ncolumns+column, with the list
+    // of the pixels touched.
+    std::vector<float> xIntegrals_;
+    std::vector<float> yIntegrals_;
+    std::vector<float> hitCharge_;
+    std::vector<int> hitPixels_;
+
     const bool makeDigiSimLinks_;
 
     const bool use_ineff_from_db_;
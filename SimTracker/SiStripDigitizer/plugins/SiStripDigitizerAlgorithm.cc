@@ -165,7 +165,8 @@ SiStripDigitizerAlgorithm::accumulateSimHits(std::vector<PSimHit>::const_iterato
 
   float langle = (lorentzAngleHandle.isValid()) ? lorentzAngleHandle->getLorentzAngle(detID) : 0.;
 
-  std::vector<float> locAmpl(numStrips, 0.);
+  std::vector<float>& locAmpl = locAmpl_;
+  locAmpl.assign(numStrips, 0.);
 
   // Loop over hits
 
@@ -174,7 +175,7 @@ SiStripDigitizerAlgorithm::accumulateSimHits(std::vector<PSimHit>::const_iterato
   if(CLHEP::RandFlat::shoot(engine) > inefficiency) {
     AssociationInfoForChannel* pDetIDAssociationInfo; // I only need this if makeDigiSimLinks_ is true...
     if( makeDigiSimLinks_ ) pDetIDAssociationInfo=&(associationInfoForDetId_[detId]); // ...so only search the map if that is the case
-    std::vector<float> previousLocalAmplitude; // Only used if makeDigiSimLinks_ is true. Needed to work out the change in amplitude.
+    std::vector<float>& previousLocalAmplitude = previousLocalAmplitude_; // Only used if makeDigiSimLinks_ is true. Needed to work out the change in amplitude.
 
     size_t simHitGlobalIndex=inputBeginGlobalIndex; // This needs to stored to create the digi-sim link later
     for (std::vector<PSimHit>::const_iterator simHitIter = inputBegin; simHitIter != inputEnd; ++simHitIter, ++simHitGlobalIndex ) {
@@ -279,7 +280,8 @@ SiStripDigitizerAlgorithm::digitize(
 
   const SiPileUpSignals::SignalMapType* theSignal(theSiPileUpSignals->getSignal(detID));  
 
-  std::vector<float> detAmpl(numStrips, 0.);
+  std::vector<float>& detAmpl = detAmpl_;
+  detAmpl.assign(numStrips, 0.);
   if(theSignal) {
     for(const auto& amp : *theSignal) {
       detAmpl[amp.first] = amp.second;
@@ -367,9 +369,8 @@ SiStripDigitizerAlgorithm::digitize(
                          
       if(SingleStripNoise){
 //      std::cout<<"In SSN, detId="<<detID<<std::endl;
-	std::vector<float> noiseRMSv; 
-	noiseRMSv.clear(); 
-	noiseRMSv.insert(noiseRMSv.begin(),numStrips,0.); 
+	std::vector<float>& noiseRMSv = noiseRMSv_;
+	noiseRMSv.assign(numStrips,0.);
 	for(int strip=0; strip< numStrips; ++strip){ 
 	  if(!badChannels[strip]){
 	    float gainValue = gainHandle->getStripGain(strip, detGainRange); 
@@ -443,9 +444,8 @@ SiStripDigitizerAlgorithm::digitize(
 		//Adding the strip noise
 		//------------------------------------------------------						 
 		if(noise){
-		    std::vector<float> noiseRMSv;
-			noiseRMSv.clear();
-		    noiseRMSv.insert(noiseRMSv.begin(),numStrips,0.);
+		    std::vector<float>& noiseRMSv = noiseRMSv_;
+		    noiseRMSv.assign(numStrips,0.);
 			
 		    if(SingleStripNoise){
 			    for(int strip=0; strip< numStrips; ++strip){
@@ -491,9 +491,8 @@ SiStripDigitizerAlgorithm::digitize(
 		//Adding the pedestals
 		//------------------------------------------------------
 		
-		std::vector<float> vPeds;
-		vPeds.clear();
-		vPeds.insert(vPeds.begin(),numStrips,0.);
+		std::vector<float>& vPeds = vPeds_;
+		vPeds.assign(numStrips,0.);
 		
 		if(RealPedestals){
 		    for(int strip=0; strip< numStrips; ++strip){
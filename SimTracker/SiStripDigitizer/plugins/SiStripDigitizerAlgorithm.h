@@ -146,6 +146,13 @@ class SiStripDigitizerAlgorithm {
   std::map<unsigned int, size_t> firstChannelsWithSignal;
   std::map<unsigned int, size_t> lastChannelsWithSignal;
 
+  // strip amplitude buffers, reused over the modules and the events
+  std::vector<float> locAmpl_;
+  std::vector<float> previousLocalAmplitude_;
+  std::vector<float> detAmpl_;
+  std::vector<float> noiseRMSv_;
+  std::vector<float> vPeds_;
+
   // ESHandles
   edm::ESHandle<SiStripLorentzAngle> lorentzAngleHandle;
 
@@ -1,3 +1,4 @@
+#include <algorithm>
 #include <iostream>
 #include <fstream>
 
@@ -341,7 +342,8 @@ template<typename T_TPCollection,typename iter> std::vector< std::pair<edm::Ref<
 	// number of reco clusters though.
 	std::vector<OmniClusterRef> oClusters = track_associator::hitsToClusterRefs( begin, end );
 
-	std::map < TrackingParticleRef, double > lmap;
+	// A track is matched to very few TrackingParticles, so they are accumulated in returnValue with a linear
+	// search (cheaper than a std::map), and sorted by TrackingParticleRef at the end.
 	for( std::vector<OmniClusterRef>::const_iterator it=oClusters.begin(); it != oClusters.end(); ++it )
 	{
 		auto range = clusterToTPMap.equal_range(*it);
@@ -351,7 +353,7 @@ template<typename T_TPCollection,typename iter> std::vector< std::pair<edm::Ref<
 			for( auto ip=range.first; ip != range.second; ++ip )
 			{
 
-				const TrackingParticleRef trackingParticle=(ip->second);
+				const TrackingParticleRef& trackingParticle=(ip->second);
 
                                 if(trackingParticleKeys && !trackingParticleKeys->has(trackingParticle.key()))
                                   continue;
@@ -363,30 +365,13 @@ template<typename T_TPCollection,typename iter> std::vector< std::pair<edm::Ref<
 				// But, here the association between tracks and TrackingParticles is done with *all* the hits of
 				// TrackingParticle, so we should not rely on the numberOfHits() calculated with a subset of SimHits.
 
-				/* Alternative implementation to avoid the use of lmap... memory slightly improved but slightly slower...
-				 std::pair<edm::Ref<TrackingParticleCollection>,size_t> tpIntPair(trackingParticle, 1);
-				 auto tp_range = std::equal_range(returnValue.begin(), returnValue.end(), tpIntPair, tpIntPairGreater);
-				 if ((tp_range.second-tp_range.first)>1) {
-				 edm::LogError("TrackAssociator") << ">>> Error in counting TPs!" << " file: " << __FILE__ << " line: " << __LINE__;
-				 }
-				 if(tp_range.first != tp_range.second) {
-				 tp_range.first->second++;
-				 } else {
-				 returnValue.push_back(tpIntPair);
-				 std::sort(returnValue.begin(), returnValue.end(), tpIntPairGreater);
-				 }
-				 */
-				auto jpos=lmap.find( trackingParticle );
-				if( jpos != lmap.end() ) jpos->second += weight;
-				else lmap.insert( std::make_pair( trackingParticle, weight ) );
+				auto jpos=std::find_if( returnValue.begin(), returnValue.end(), [&trackingParticle](const std::pair<edm::Ref<TrackingParticleCollection>,double>& p) { return p.first == trackingParticle; } );
+				if( jpos != returnValue.end() ) jpos->second += weight;
+				else returnValue.push_back( std::make_pair( trackingParticle, weight ) );
 			}
 		}
 	}
-	// now copy the map to returnValue
-	for( auto ip=lmap.begin(); ip != lmap.end(); ++ip )
-	{
-		returnValue.push_back( std::make_pair( ip->first, ip->second ) );
-	}
+	std::sort( returnValue.begin(), returnValue.end(), [](const std::pair<edm::Ref<TrackingParticleCollection>,double>& a, const std::pair<edm::Ref<TrackingParticleCollection>,double>& b) { return a.first < b.first; } );
 	return returnValue;
 }
 
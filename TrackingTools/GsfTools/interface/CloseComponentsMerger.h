@@ -13,6 +13,10 @@
  *  which are close to one another. The actual calculation
  *  of the distance between components is done by a specific
  *  (polymorphic) class, given at construction time.
+ *  With a positive pairing window the partner of a component is
+ *  searched only among the pairingWindow neighbours on each side
+ *  in the first parameter (q/p for tracks), which makes the reduction
+ *  linear instead of quadratic in the number of components.
  */
 
 template <unsigned int N>
@@ -26,7 +30,8 @@ class CloseComponentsMerger final : public MultiGaussianStateMerger<N> {
  public:
 
   CloseComponentsMerger(int n,
-			   const DistanceBetweenComponents<N>* distance);
+			   const DistanceBetweenComponents<N>* distance,
+			   int pairingWindow = 0);
 
   CloseComponentsMerger* clone() const override
   {  
@@ -52,6 +57,7 @@ private:
   compWithMinDistToLargestWeight(SingleStateMap&) const;
 
   int theMaxNumberOfComponents;
+  int thePairingWindow;
   DeepCopyPointerByClone< DistanceBetweenComponents<N> > theDistance;
 
 };  
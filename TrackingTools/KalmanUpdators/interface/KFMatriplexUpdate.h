@@ -0,0 +1,123 @@
+#ifndef TrackingTools_KalmanUpdators_KFMatriplexUpdate_h
+#define TrackingTools_KalmanUpdators_KFMatriplexUpdate_h
+
+/** Kalman update of N track candidates at once in "Matriplex" layout:
+ *  the same element of the N candidates is stored contiguously, so that every
+ *  operation of the update is a loop over the candidates that the compiler
+ *  vectorizes with the widest SIMD unit of the target (N=8 fills an AVX-512
+ *  register of doubles, or two AVX2 ones).
+ *
+ *  The measurement is assumed to be the local position, i.e. the projection
+ *  selects the local parameters 3 (x) and, for D=2, 4 (y), as for all the
+ *  tracker hits. The covariance of the filtered state uses the Joseph form
+ *  as in KFUpdator.
+ */
+
+namespace kfMatriplex {
+
+  /// D1 x D2 matrices of N candidates, element (i,j) of candidate n is at (i*D2+j)*N+n
+  template<typename T, unsigned int D1, unsigned int D2, unsigned int N>
+  struct Matriplex {
+    static constexpr unsigned int kSize = D1*D2;
+    alignas(64) T fArray[kSize*N];
+
+    T & operator()(unsigned int i, unsigned int j, unsigned int n) { return fArray[(i*D2+j)*N+n]; }
+    T operator()(unsigned int i, unsigned int j, unsigned int n) const { return fArray[(i*D2+j)*N+n]; }
+  };
+
+  /// symmetric D x D matrices of N candidates, only the lower triangle is stored (in the order of SMatrix)
+  template<typename T, unsigned int D, unsigned int N>
+  struct MatriplexSym {
+    static constexpr unsigned int kSize = D*(D+1)/2;
+    alignas(64) T fArray[kSize*N];
+
+    static constexpr unsigned int index(unsigned int i, unsigned int j) { return i>=j ? i*(i+1)/2+j : j*(j+1)/2+i; }
+    T & operator()(unsigned int i, unsigned int j, unsigned int n) { return fArray[index(i,j)*N+n]; }
+    T operator()(unsigned int i, unsigned int j, unsigned int n) const { return fArray[index(i,j)*N+n]; }
+  };
+
+  namespace detail {
+    template<typename T, unsigned int N>
+    inline void invertPosDef(MatriplexSym<T,1,N> & r, bool * ok) {
+      for (unsigned int n=0; n<N; ++n) {
+        ok[n] = r.fArray[n] > 0;
+        r.fArray[n] = T(1)/r.fArray[n];
+      }
+    }
+
+    template<typename T, unsigned int N>
+    inline void invertPosDef(MatriplexSym<T,2,N> & r, bool * ok) {
+      T * __restrict__ a = r.fArray;
+      for (unsigned int n=0; n<N; ++n) {
+        T r00 = a[n], r10 = a[N+n], r11 = a[2*N+n];
+        T det = r00*r11 - r10*r10;
+        ok[n] = (r00 > 0) & (det > 0);
+        T idet = T(1)/det;
+        a[n] = r11*idet;
+        a[N+n] = -r10*idet;
+        a[2*N+n] = r00*idet;
+      }
+    }
+  }
+
+  /// updates the local parameters x and their covariance C of N candidates with the D-dimensional
+  /// measurements m of covariance V, ok is false for the candidates where the residual covariance
+  /// is not positive definite (their x and C are then meaningless)
+  template<typename T, unsigned int D, unsigned int N>
+  void update(Matriplex<T,5,1,N> & x, MatriplexSym<T,5,N> & C,
+              Matriplex<T,D,1,N> const & m, MatriplexSym<T,D,N> const & V, bool * ok) {
+    constexpr unsigned int h = 3; // first measured local parameter
+
+    // covariance of the residuals R = V + H C H^T, inverted in place
+    MatriplexSym<T,D,N> R;
+    for (unsigned int i=0; i<D; ++i)
+      for (unsigned int j=0; j<=i; ++j)
+        for (unsigned int n=0; n<N; ++n)
+          R(i,j,n) = V(i,j,n) + C(h+i,h+j,n);
+    detail::invertPosDef(R, ok);
+
+    // Kalman gain K = C H^T R^-1
+    Matriplex<T,5,D,N> K;
+    for (unsigned int i=0; i<5; ++i)
+      for (unsigned int d=0; d<D; ++d) {
+        for (unsigned int n=0; n<N; ++n) K(i,d,n) = 0;
+        for (unsigned int e=0; e<D; ++e)
+          for (unsigned int n=0; n<N; ++n) K(i,d,n) += C(i,h+e,n) * R(e,d,n);
+      }
+
+    // filtered parameters x + K (m - H x)
+    Matriplex<T,D,1,N> r;
+    for (unsigned int d=0; d<D; ++d)
+      for (unsigned int n=0; n<N; ++n) r(d,0,n) = m(d,0,n) - x(h+d,0,n);
+    for (unsigned int i=0; i<5; ++i)
+      for (unsigned int d=0; d<D; ++d)
+        for (unsigned int n=0; n<N; ++n) x(i,0,n) += K(i,d,n) * r(d,0,n);
+
+    // Joseph form: M C M^T + K V K^T with M = 1 - K H
+    Matriplex<T,5,5,N> MC;
+    for (unsigned int i=0; i<5; ++i)
+      for (unsigned int j=0; j<5; ++j) {
+        for (unsigned int n=0; n<N; ++n) MC(i,j,n) = C(i,j,n);
+        for (unsigned int d=0; d<D; ++d)
+          for (unsigned int n=0; n<N; ++n) MC(i,j,n) -= K(i,d,n) * C(h+d,j,n);
+      }
+
+    Matriplex<T,5,D,N> KV;
+    for (unsigned int i=0; i<5; ++i)
+      for (unsigned int d=0; d<D; ++d) {
+        for (unsigned int n=0; n<N; ++n) KV(i,d,n) = 0;
+        for (unsigned int e=0; e<D; ++e)
+          for (unsigned int n=0; n<N; ++n) KV(i,d,n) += K(i,e,n) * V(e,d,n);
+      }
+
+    for (unsigned int i=0; i<5; ++i)
+      for (unsigned int j=0; j<=i; ++j) {
+        for (unsigned int n=0; n<N; ++n) C(i,j,n) = MC(i,j,n);
+        for (unsigned int d=0; d<D; ++d)
+          for (unsigned int n=0; n<N; ++n) C(i,j,n) += KV(i,d,n) * K(j,d,n) - MC(i,h+d,n) * K(j,d,n);
+      }
+  }
+
+}
+
+#endif
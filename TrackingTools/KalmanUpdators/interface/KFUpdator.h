@@ -40,6 +40,11 @@ public:
   TrajectoryStateOnSurface update(const TrajectoryStateOnSurface&,
                                   const TrackingRecHit&) const override;
 
+  /// the states with 1D and 2D hits are updated in batches with kfMatriplex::update
+  void updateBatch(const std::vector<const TrajectoryStateOnSurface*>&,
+		   const std::vector<const TrackingRecHit*>&,
+		   std::vector<TrajectoryStateOnSurface>&) const override;
+
 
   KFUpdator * clone() const override {
     return new KFUpdator(*this);
@@ -1,4 +1,5 @@
 #include "TrackingTools/KalmanUpdators/interface/KFUpdator.h"
+#include "TrackingTools/KalmanUpdators/interface/KFMatriplexUpdate.h"
 #include "TrackingTools/PatternTools/interface/MeasurementExtractor.h"
 #include "TrackingTools/TransientTrackingRecHit/interface/TransientTrackingRecHit.h"
 #include "DataFormats/GeometrySurface/interface/Plane.h"
@@ -180,3 +181,107 @@ TrajectoryStateOnSurface KFUpdator::update(const TrajectoryStateOnSurface& tsos,
         ", type is " << typeid(aRecHit).name() << "\n";
 }
 
+
+
+namespace {
+
+  constexpr unsigned int kBatchSize = 8;
+
+  template<typename M>
+  inline void copyLane(M & a, unsigned int from, unsigned int to) {
+    for (unsigned int e=0; e<M::kSize; ++e) a.fArray[e*kBatchSize+to] = a.fArray[e*kBatchSize+from];
+  }
+
+  // states with a D-dimensional hit waiting to be updated together
+  template <unsigned int D>
+  struct Batch {
+    kfMatriplex::Matriplex<double,5,1,kBatchSize> x;
+    kfMatriplex::MatriplexSym<double,5,kBatchSize> C;
+    kfMatriplex::Matriplex<double,D,1,kBatchSize> m;
+    kfMatriplex::MatriplexSym<double,D,kBatchSize> V;
+    unsigned int index[kBatchSize];
+    unsigned int n = 0;
+
+    // false if the hit does not measure the local position: the state is then updated alone
+    bool add(unsigned int i, const TrajectoryStateOnSurface& tsos, const TrackingRecHit& aRecHit) {
+      typedef typename AlgebraicROOTObject<D,D>::SymMatrix SMatDD;
+      typedef typename AlgebraicROOTObject<D>::Vector VecD;
+      using ROOT::Math::SMatrixNoInit;
+
+      auto && lx = tsos.localParameters().vector();
+      auto && lC = tsos.localError().matrix();
+
+      ProjectMatrix<double,5,D>  pf;
+      VecD r, rMeas;
+      SMatDD Vh(SMatrixNoInit{}), VMeas(SMatrixNoInit{});
+
+      KfComponentsHolder holder;
+      holder.template setup<D>(&r, &Vh, &pf, &rMeas, &VMeas, lx, lC);
+      aRecHit.getKfComponents(holder);
+      for (unsigned int d=0; d<D; ++d) if (pf.index[d] != 3+d) return false;
+
+      for (unsigned int k=0; k<5; ++k) x(k,0,n) = lx[k];
+      for (unsigned int k=0; k<5; ++k)
+	for (unsigned int l=0; l<=k; ++l) C(k,l,n) = lC(k,l);
+      for (unsigned int d=0; d<D; ++d) {
+	m(d,0,n) = r[d];
+	for (unsigned int e=0; e<=d; ++e) V(d,e,n) = Vh(d,e);
+      }
+      index[n++] = i;
+      return true;
+    }
+
+    bool full() const { return n==kBatchSize; }
+
+    void flush(const std::vector<const TrajectoryStateOnSurface*>& tsos, std::vector<TrajectoryStateOnSurface>& result) {
+      if (n==0) return;
+      // fill the unused lanes with a valid state
+      for (unsigned int k=n; k<kBatchSize; ++k) {
+	copyLane(x,0,k); copyLane(C,0,k); copyLane(m,0,k); copyLane(V,0,k);
+      }
+
+      bool ok[kBatchSize];
+      kfMatriplex::update(x, C, m, V, ok);
+
+      for (unsigned int k=0; k<n; ++k) {
+	auto const & state = *tsos[index[k]];
+	if (ok[k]) {
+	  AlgebraicVector5 fsv;
+	  AlgebraicSymMatrix55 fse;
+	  for (unsigned int i=0; i<5; ++i) {
+	    fsv[i] = x(i,0,k);
+	    for (unsigned int j=0; j<=i; ++j) fse(i,j) = C(i,j,k);
+	  }
+	  result[index[k]] = TrajectoryStateOnSurface( LocalTrajectoryParameters(fsv, state.localParameters().pzSign()),
+						       LocalTrajectoryError(fse), state.surface(),&(state.globalParameters().magneticField()), state.surfaceSide() );
+	} else {
+	  edm::LogError("KFUpdator")<<" could not invert martix in batched update of a "<<D<<"D hit";
+	  result[index[k]] = TrajectoryStateOnSurface();
+	}
+      }
+      n = 0;
+    }
+  };
+
+}
+
+void KFUpdator::updateBatch(const std::vector<const TrajectoryStateOnSurface*>& tsos,
+			    const std::vector<const TrackingRecHit*>& hits,
+			    std::vector<TrajectoryStateOnSurface>& result) const {
+  result.assign(tsos.size(), TrajectoryStateOnSurface());
+
+  Batch<1> batch1;
+  Batch<2> batch2;
+  for (unsigned int i=0; i<tsos.size(); ++i) {
+    auto dim = hits[i]->dimension();
+    if (dim==1 && batch1.add(i, *tsos[i], *hits[i])) {
+      if (batch1.full()) batch1.flush(tsos, result);
+    } else if (dim==2 && batch2.add(i, *tsos[i], *hits[i])) {
+      if (batch2.full()) batch2.flush(tsos, result);
+    } else {
+      result[i] = update(*tsos[i], *hits[i]);
+    }
+  }
+  batch1.flush(tsos, result);
+  batch2.flush(tsos, result);
+}
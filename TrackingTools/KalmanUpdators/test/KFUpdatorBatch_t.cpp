@@ -0,0 +1,121 @@
+#include "TrackingTools/KalmanUpdators/interface/KFUpdator.h"
+
+#include "TrackingTools/TrajectoryState/interface/TrajectoryStateOnSurface.h"
+#include "DataFormats/GeometrySurface/interface/Surface.h"
+#include "DataFormats/GeometrySurface/interface/BoundPlane.h"
+#include "Geometry/CommonDetUnit/interface/GeomDet.h"
+
+#include "MagneticField/Engine/interface/MagneticField.h"
+
+#include "DataFormats/TrackerRecHit2D/interface/SiStripRecHit2D.h"
+#include "DataFormats/TrackerRecHit2D/interface/SiStripRecHit1D.h"
+
+#include <cassert>
+#include <cmath>
+#include <iostream>
+#include <memory>
+#include <random>
+#include <vector>
+
+class ConstMagneticField : public MagneticField {
+public:
+
+  GlobalVector inTesla ( const GlobalPoint& ) const override {
+    return GlobalVector(0,0,4);
+  }
+
+};
+
+// A fake Det class
+
+class MyDet : public GeomDet {
+ public:
+  MyDet(BoundPlane * bp, DetId id) :
+    GeomDet(bp){setDetId(id);}
+
+  std::vector< const GeomDet*> components() const override {
+    return std::vector< const GeomDet*>();
+  }
+
+  /// Which subdetector
+  SubDetector subDetector() const override {return GeomDetEnumerators::TIB;}
+
+};
+
+bool close(double a, double b) {
+  return std::abs(a-b) <= 1.e-6*std::max(1.,std::max(std::abs(a),std::abs(b)));
+}
+
+// update random states with random 1D and 2D hits, with more states than a
+// batch holds, and check that updateBatch gives the result of update
+int main() {
+
+  MagneticField * field = new ConstMagneticField;
+  BoundPlane* plane = new BoundPlane( GlobalPoint(0,0,0), Surface::RotationType());
+  GeomDet * det = new MyDet(plane,41);
+
+  std::mt19937 rng(42);
+  std::uniform_real_distribution<double> uni(-1.,1.);
+  std::uniform_real_distribution<double> sigma(0.001,0.1);
+
+  const unsigned int n = 27;
+  std::vector<TrajectoryStateOnSurface> states;
+  std::vector<std::unique_ptr<TrackingRecHit>> hits;
+  OmniClusterRef cref;
+  for (unsigned int i=0; i<n; ++i) {
+    LocalTrajectoryParameters ltp(LocalPoint(uni(rng),uni(rng),0), LocalVector(uni(rng),uni(rng),1.+uni(rng)*uni(rng)), i%2 ? 1 : -1);
+    // a random positive definite covariance, A*A^T plus a diagonal
+    AlgebraicMatrix55 a;
+    for (unsigned int k=0; k<5; ++k)
+      for (unsigned int l=0; l<5; ++l) a(k,l) = 0.01*uni(rng);
+    AlgebraicSymMatrix55 cov = ROOT::Math::SimilarityT(ROOT::Math::Transpose(a), AlgebraicSymMatrix55(ROOT::Math::SMatrixIdentity()));
+    for (unsigned int k=0; k<5; ++k) cov(k,k) += sigma(rng)*sigma(rng);
+    states.emplace_back(ltp, LocalTrajectoryError(cov), *plane, field);
+
+    LocalPoint m(ltp.position().x()+0.1*uni(rng), ltp.position().y()+0.1*uni(rng), 0);
+    double sx = sigma(rng), sy = sigma(rng);
+    LocalError e(sx*sx, 0.5*uni(rng)*sx*sy, sy*sy);
+    if (i%3 == 0)
+      hits.emplace_back(new SiStripRecHit1D(m,e,*det,cref));
+    else
+      hits.emplace_back(new SiStripRecHit2D(m,e,*det,cref));
+  }
+
+  std::vector<const TrajectoryStateOnSurface*> tsos;
+  std::vector<const TrackingRecHit*> hitPointers;
+  for (unsigned int i=0; i<n; ++i) {
+    tsos.push_back(&states[i]);
+    hitPointers.push_back(hits[i].get());
+  }
+
+  KFUpdator updator;
+  std::vector<TrajectoryStateOnSurface> batched;
+  updator.updateBatch(tsos, hitPointers, batched);
+  assert(batched.size() == n);
+
+  for (unsigned int i=0; i<n; ++i) {
+    TrajectoryStateOnSurface single = updator.update(states[i], *hits[i]);
+    assert(single.isValid() == batched[i].isValid());
+    if (!single.isValid()) continue;
+    auto const & vs = single.localParameters().vector();
+    auto const & vb = batched[i].localParameters().vector();
+    auto const & cs = single.localError().matrix();
+    auto const & cb = batched[i].localError().matrix();
+    for (unsigned int k=0; k<5; ++k) {
+      if (!close(vs[k],vb[k])) {
+	std::cout << "state " << i << " parameter " << k << ": " << vs[k] << " != " << vb[k] << std::endl;
+	return 1;
+      }
+      for (unsigned int l=0; l<=k; ++l) {
+	if (!close(cs(k,l),cb(k,l))) {
+	  std::cout << "state " << i << " covariance " << k << "," << l << ": " << cs(k,l) << " != " << cb(k,l) << std::endl;
+	  return 1;
+	}
+      }
+    }
+  }
+
+  std::cout << "updateBatch matches update for " << n << " states" << std::endl;
+  return 0;
+
+}
@@ -0,0 +1,63 @@
+#ifndef _CR_BETHEBLOCHTABLE_H_
+#define _CR_BETHEBLOCHTABLE_H_
+
+/** \class BetheBlochTable
+ *  Momentum dependent factors of the energy loss of EnergyLossUpdator
+ *  (Bethe-Bloch in silicon) for a given mass hypothesis, tabulated once
+ *  in p^2 and linearly interpolated. Both the mean momentum loss and its
+ *  variance are these factors times the xi of the crossed material, so one
+ *  table serves all the surfaces. The table is immutable after construction
+ *  and can be shared by any number of threads.
+ *
+ *  The bins are 1/kBinsPerOctave of an octave in p^2, the index is read from
+ *  the exponent and the leading mantissa bits of p^2.
+ */
+
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+class BetheBlochTable {
+public:
+  /// momentum loss and variance of 1/p per unit of xi*(path length/thickness)
+  struct Factors {
+    float deltaP;
+    float sigma2;
+  };
+
+  explicit BetheBlochTable(float mass);
+
+  /// returns false, and leaves f untouched, if p2 is outside the table
+  bool factors(float p2, Factors & f) const {
+    uint32_t bits; std::memcpy(&bits,&p2,sizeof(float));
+    int i = int(bits>>kMantissaShift) - theFirstBin;
+    if ( i<0 || i>=int(theNodes.size()) ) return false;
+    bits &= ~((1U<<kMantissaShift)-1);
+    float low; std::memcpy(&low,&bits,sizeof(float));
+    auto const & n = theNodes[i];
+    float dp2 = p2-low;
+    f.deltaP = n.deltaP + n.deltaPSlope*dp2;
+    f.sigma2 = n.sigma2 + n.sigma2Slope*dp2;
+    return true;
+  }
+
+  static constexpr unsigned int kMantissaBits = 6;
+  static constexpr unsigned int kBinsPerOctave = 1U<<kMantissaBits;
+
+  /// tabulated range in p^2 (GeV^2)
+  static constexpr float kMinP2 = 1./(1<<12);
+  static constexpr float kMaxP2 = 1<<20;
+
+private:
+  static constexpr unsigned int kMantissaShift = 23-kMantissaBits;
+
+  struct Node {
+    float deltaP, deltaPSlope;
+    float sigma2, sigma2Slope;
+  };
+
+  int theFirstBin;
+  std::vector<Node> theNodes;
+};
+
+#endif
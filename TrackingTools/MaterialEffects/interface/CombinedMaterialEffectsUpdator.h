@@ -27,10 +27,11 @@ public:
   /// If ptMin > 0, then the rms muliple scattering angle will be calculated taking into account the uncertainty
   /// in the reconstructed track momentum. (By default, it is neglected). However, a lower limit on the possible
   /// value of the track Pt will be applied at ptMin, to avoid the rms multiple scattering becoming too big.
-  CombinedMaterialEffectsUpdator(float mass, float ptMin = -1. ) :
+  /// If useTable, the energy loss is interpolated in a table (see EnergyLossUpdator).
+  CombinedMaterialEffectsUpdator(float mass, float ptMin = -1., bool useTable = false ) :
     MaterialEffectsUpdator(mass),
     theMSUpdator(mass, ptMin),
-    theELUpdator(mass) {}
+    theELUpdator(mass, useTable) {}
 
   // here comes the actual computation of the values
   void compute (const TrajectoryStateOnSurface&, const PropagationDirection, Effect & effect) const override;
@@ -8,13 +8,18 @@
  *  For electrons energy loss due to radiation added according 
  *  to formulae by Bethe & Heitler.
  *  Ported from ORCA.
+ *  With useTable the Bethe-Bloch factors are interpolated in a BetheBlochTable
+ *  built in the constructor and shared by the clones.
  *
  */
 
 #include "TrackingTools/MaterialEffects/interface/MaterialEffectsUpdator.h"
 #include "DataFormats/GeometryVector/interface/LocalVector.h"
+#include "TrackingTools/MaterialEffects/interface/BetheBlochTable.h"
 #include "FWCore/Utilities/interface/Visibility.h"
 
+#include <memory>
+
 class MediumProperties;
 
 class EnergyLossUpdator final : public MaterialEffectsUpdator 
@@ -25,8 +30,9 @@ class EnergyLossUpdator final : public MaterialEffectsUpdator
   }
 
 public:
-  EnergyLossUpdator( float mass ) :
-    MaterialEffectsUpdator(mass) {}
+  EnergyLossUpdator( float mass, bool useTable=false ) :
+    MaterialEffectsUpdator(mass),
+    theTable( useTable && mass>0.001 ? std::make_shared<const BetheBlochTable>(mass) : nullptr) {}
 
   // here comes the actual computation of the values
   void compute (const TrajectoryStateOnSurface&, 
@@ -39,6 +45,7 @@ private:
   void computeElectrons (const LocalVector&, const MediumProperties&,
 			 const PropagationDirection, Effect & effect) const dso_internal;
 
+  std::shared_ptr<const BetheBlochTable> theTable;
 };
 
 #endif
@@ -34,10 +34,13 @@ public:
    *  account the uncertainty in the reconstructed track momentum, (by
    *  default neglected), but assuming that the track Pt will never fall
    *  below ptMin.
+   *  If useMaterialTable, the energy loss is interpolated in a table built
+   *  here for the mass hypothesis and shared by the clones.
    */
   PropagatorWithMaterial (PropagationDirection dir, const float mass,
 			  const MagneticField * mf=nullptr,const float maxDPhi=1.6,
-			  bool useRungeKutta=false, float ptMin=-1.,bool useOldGeoPropLogic=true);
+			  bool useRungeKutta=false, float ptMin=-1.,bool useOldGeoPropLogic=true,
+			  bool useMaterialTable=false);
 
   ~PropagatorWithMaterial() override;
 
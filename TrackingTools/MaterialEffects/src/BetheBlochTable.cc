@@ -0,0 +1,44 @@
+#include "TrackingTools/MaterialEffects/interface/BetheBlochTable.h"
+
+#include <cmath>
+
+namespace {
+  // same constants and formulas as EnergyLossUpdator::computeBetheBloch, in double precision
+  BetheBlochTable::Factors betheBloch(double p2, double m2) {
+    constexpr double emass = 0.511e-3;
+    constexpr double poti = 16.e-9 * 10.75;
+    const double eplasma = 28.816e-9 * std::sqrt(2.33*0.498);
+    const double delta0 = 2*std::log(eplasma/poti) - 1.;
+
+    double im2 = 1./m2;
+    double e2 = p2 + m2;
+    double e = std::sqrt(e2);
+    double beta2 = p2/e2;
+    double eta2 = p2*im2;
+    double ratio2 = (emass*emass)*im2;
+    double emax = 2.*emass*eta2/(1. + 2.*emass*e*im2 + ratio2);
+
+    double dEdx = (std::log(2.*emass*emax/(poti*poti)) - 2.*beta2 - delta0)/beta2;
+    double dEdx2 = emax*(1.-0.5*beta2)/beta2;
+    return BetheBlochTable::Factors{float(dEdx/std::sqrt(beta2)), float(dEdx2/(beta2*p2*p2))};
+  }
+
+  uint32_t bitsOf(float x) { uint32_t bits; std::memcpy(&bits,&x,sizeof(float)); return bits; }
+  float fromBits(uint32_t bits) { float x; std::memcpy(&x,&bits,sizeof(float)); return x; }
+}
+
+BetheBlochTable::BetheBlochTable(float mass) {
+  const double m2 = double(mass)*double(mass);
+  const uint32_t first = bitsOf(kMinP2)>>kMantissaShift;
+  const uint32_t last = bitsOf(kMaxP2)>>kMantissaShift;
+  theFirstBin = first;
+  theNodes.reserve(last-first);
+  for (uint32_t i = first; i < last; ++i) {
+    float low = fromBits(i<<kMantissaShift);
+    float high = fromBits((i+1)<<kMantissaShift);
+    auto fl = betheBloch(low,m2);
+    auto fh = betheBloch(high,m2);
+    float w = 1.f/(high-low);
+    theNodes.push_back(Node{fl.deltaP, (fh.deltaP-fl.deltaP)*w, fl.sigma2, (fh.sigma2-fl.sigma2)*w});
+  }
+}
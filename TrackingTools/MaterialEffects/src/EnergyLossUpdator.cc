@@ -61,6 +61,15 @@ EnergyLossUpdator::computeBetheBloch (const LocalVector& localP,
 
   Float p2 = localP.mag2();
   Float xf = std::abs(std::sqrt(p2)/localP.z());
+
+  BetheBlochTable::Factors factors;
+  if ( theTable && theTable->factors(p2,factors) ) {
+    Float xi = materialConstants.xi()*xf;
+    effect.deltaP += -xi*factors.deltaP;
+    using namespace materialEffect;
+    effect.deltaCov[elos] += xi*factors.sigma2;
+    return;
+  }
    
   // constants
   const Float m2 = mass()*mass();           // use mass hypothesis from constructor
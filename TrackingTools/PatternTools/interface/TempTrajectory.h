@@ -141,6 +141,9 @@ public:
    */
   void push(TempTrajectory const & segment);
 
+  /// a temporary segment is joined instead of copied
+  void push(TempTrajectory && segment) { join(segment); }
+
       
 
   /** Add a new sets of measurements to a Trajectory
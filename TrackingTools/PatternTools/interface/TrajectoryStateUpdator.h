@@ -2,6 +2,7 @@
 #define _TRACKER_UPDATOR_H_
 
 #include "TrackingTools/TrajectoryState/interface/TrajectoryStateOnSurface.h"
+#include <vector>
 
 class TrackingRecHit;
   
@@ -19,6 +20,18 @@ class TrajectoryStateUpdator {
   
   virtual TrajectoryStateOnSurface update(const TrajectoryStateOnSurface&,
 					  const TrackingRecHit&) const = 0;
+
+  /** updates the predicted states tsos[i] with the hits[i] at once, result[i] is
+   *  the same as update(*tsos[i],*hits[i]) up to rounding. This default calls update
+   *  for each pair, implementations can process the states in vectorized batches.
+   */
+  virtual void updateBatch(const std::vector<const TrajectoryStateOnSurface*>& tsos,
+			   const std::vector<const TrackingRecHit*>& hits,
+			   std::vector<TrajectoryStateOnSurface>& result) const {
+    result.clear();
+    result.reserve(tsos.size());
+    for (unsigned int i=0; i<tsos.size(); ++i) result.push_back(update(*tsos[i],*hits[i]));
+  }
   
   virtual TrajectoryStateUpdator * clone() const = 0;
   
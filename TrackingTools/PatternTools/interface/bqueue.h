@@ -1,7 +1,9 @@
 #ifndef CMSUTILS_BEUEUE_H
 #define CMSUTILS_BEUEUE_H
 #include <boost/intrusive_ptr.hpp>
+#include "TrackingTools/TrajectoryState/interface/ChurnAllocator.h"
 #include<cassert>
+#include<cstddef>
 
 /**  Backwards linked queue with "head sharing"
 
@@ -21,7 +23,9 @@
        - size(), empty(): as expected. size() does not count the items
      
      Note that boost::intrusive_ptr is used for items, so they are deleted automatically
-     while avoiding problems if one deletes a queue which shares the head with another one
+     while avoiding problems if one deletes a queue which shares the head with another one.
+     The items are allocated from a per thread free list (churn_allocator) as candidates
+     are forked and dropped at high rate during trajectory building.
 
      Disclaimer: I'm not sure the const_iterator is really const-correct..
 
@@ -49,6 +53,8 @@ namespace cmsutils {
     friend void intrusive_ptr_release<T>(_bqueue_item<T> *it);
     void addRef() { ++refCount; }
     void delRef() { if ((--refCount) == 0) delete this; }
+    static void * operator new(std::size_t) { return churn_allocator<_bqueue_item<T>>().allocate(1); }
+    static void operator delete(void * p) { churn_allocator<_bqueue_item<T>>().deallocate(static_cast<_bqueue_item<T>*>(p),1); }
   private:
     _bqueue_item() : back(0), value(), refCount(0) { }
     _bqueue_item(boost::intrusive_ptr< _bqueue_item<T> > tail, const T &val) : back(tail), value(val), refCount(0) { }
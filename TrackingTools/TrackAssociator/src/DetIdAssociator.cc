@@ -272,12 +272,29 @@ std::set<DetId> DetIdAssociator::getDetIdsInACone(const std::set<DetId>& inset,
   if ( selectAllInACone(dR)) return inset;
    check_setup();
    std::set<DetId> outset;
-   for(std::set<DetId>::const_iterator id_iter = inset.begin(); id_iter != inset.end(); id_iter++)
-     for(std::vector<GlobalPoint>::const_iterator point_iter = trajectory.begin(); point_iter != trajectory.end(); point_iter++)
-       if (nearElement(*point_iter,*id_iter,dR)) {
-	  outset.insert(*id_iter);
-	  break;
-       }
+   // same test as nearElement, with the eta and phi of the trajectory points
+   // and the position of each element computed only once
+   std::vector<float> pointEta;
+   std::vector<Geom::Phi<float> > pointPhi;
+   pointEta.reserve(trajectory.size());
+   pointPhi.reserve(trajectory.size());
+   for(std::vector<GlobalPoint>::const_iterator point_iter = trajectory.begin(); point_iter != trajectory.end(); point_iter++) {
+      pointEta.push_back(point_iter->eta());
+      pointPhi.push_back(point_iter->phi());
+   }
+   for(std::set<DetId>::const_iterator id_iter = inset.begin(); id_iter != inset.end(); id_iter++) {
+      GlobalPoint center = getPosition(*id_iter);
+      const float centerEta = center.eta();
+      const Geom::Phi<float> centerPhi = center.phi();
+      for(unsigned int i = 0; i < pointEta.size(); ++i) {
+	 double deltaPhi(fabs(pointPhi[i]-centerPhi));
+	 if(deltaPhi>M_PI) deltaPhi = fabs(deltaPhi-M_PI*2.);
+	 if ((pointEta[i]-centerEta)*(pointEta[i]-centerEta) + deltaPhi*deltaPhi < dR*dR) {
+	    outset.insert(*id_iter);
+	    break;
+	 }
+      }
+   }
    return outset;
 }
 
@@ -15,7 +15,7 @@ public:
     BasicSingleTrajectoryState(Args && ...args) : BasicTrajectoryState(std::forward<Args>(args)...){/* assert(weight()>0);*/}
 
   pointer clone() const override {
-    return build<BasicSingleTrajectoryState>(*this);
+    return churn<BasicSingleTrajectoryState>(*this);
   }
 
   using	Components = BasicTrajectoryState::Components;
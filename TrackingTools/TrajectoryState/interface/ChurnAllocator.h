@@ -2,6 +2,12 @@
 #define Tracker_ChurnAllocator_H
 #include <memory>
 
+/** allocator keeping a per thread free list of the single objects it deallocates,
+ *  so that the objects built and destroyed at high rate (as the states in trajectory
+ *  building) reuse the same memory instead of going through malloc/free.
+ *  The memory released on one thread is reused by the next allocation on that thread;
+ *  at most maxCached objects are kept, the rest is returned to std::allocator.
+ */
 template <typename T>
 class churn_allocator: public std::allocator<T>
 {
@@ -10,9 +16,18 @@ public:
   using pointer = typename Base::pointer;
   using size_type = typename Base::size_type;
 
+  static constexpr unsigned int maxCached = 1024;
+
   struct Cache {
-    pointer cache = nullptr;
-    bool gard=false;
+    pointer cache[maxCached];
+    unsigned int size = 0;
+    bool gard = true;  // false once the thread has destroyed its cache
+
+    ~Cache() {
+      Base a;
+      while (size!=0) a.deallocate(cache[--size], 1);
+      gard = false;
+    }
   };
 
   static Cache &  cache() {
@@ -30,15 +45,14 @@ public:
   pointer allocate(size_type n, const void *hint=nullptr)
   {
     Cache & c = cache();
-    if (!c.gard) 
-     c.cache = std::allocator<T>::allocate(n, hint);
-    c.gard=false; return c.cache;
+    if (n==1 && c.size!=0) return c.cache[--c.size];
+    return std::allocator<T>::allocate(n, hint);
   }
   
   void deallocate(pointer p, size_type n)
   {
     Cache & c = cache();
-    if (p==c.cache) c.gard=true;
+    if (n==1 && c.gard && c.size<maxCached) c.cache[c.size++] = p;
     else std::allocator<T>::deallocate(p, n);
   }
   
@@ -98,7 +98,8 @@ TrackTransientTrack::TrackTransientTrack( const TrackTransientTrack & tt ) :
   Track(tt), tkr_(tt.persistentTrackRef()), 
   hasTime(tt.hasTime), timeExt_(tt.timeExt()), dtErrorExt_(tt.dtErrorExt()),
   theField(tt.field()), 
-  initialFTS(tt.initialFreeState()), m_TSOS(kUnset), m_TSCP(kUnset)
+  initialFTS(tt.initialFreeState()), m_TSOS(kUnset), m_TSCP(kUnset), m_SCTBL(kUnset),
+  theTrackingGeometry(tt.theTrackingGeometry), theBeamSpot(tt.theBeamSpot)
 {
   // see ThreadSafe statement above about the order of operator= and store
   if (kSet == tt.m_TSOS.load()) {
@@ -110,6 +111,11 @@ TrackTransientTrack::TrackTransientTrack( const TrackTransientTrack & tt ) :
     initialTSCP= tt.impactPointTSCP();
     m_TSCP.store(kSet);
   }
+  // see ThreadSafe statement above about the order of operator= and store
+  if (kSet == tt.m_SCTBL.load()) {
+    trajectoryStateClosestToBeamLine= tt.stateAtBeamLine();
+    m_SCTBL.store(kSet);
+  }
 }
 
 void TrackTransientTrack::setES(const edm::EventSetup& setup) {
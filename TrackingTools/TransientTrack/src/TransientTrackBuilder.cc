@@ -169,7 +169,7 @@ TransientTrackBuilder::build (const edm::Handle<edm::View<Track> > & trkColl,
 	timeReso = defaultInvalidTrackReso;
       }
       ttVect.push_back( TransientTrack(
-	  new GsfTransientTrack(RefToBase<Track>(trkColl, i).castTo<GsfTrackRef>(), time, timeReso, theField, theTrackingGeometry)) );
+	  new GsfTransientTrack(ref, time, timeReso, theField, theTrackingGeometry)) );
     } else { // gsf
       TrackRef ref = RefToBase<Track>(trkColl, i).castTo<TrackRef>();
       double time = trackTimes[ref];
@@ -179,7 +179,7 @@ TransientTrackBuilder::build (const edm::Handle<edm::View<Track> > & trkColl,
 	time = 0.0;
 	timeReso = defaultInvalidTrackReso;
       }
-      ttVect.push_back(TransientTrack(RefToBase<Track>(trkColl, i).castTo<TrackRef>(), time, timeReso, theField, theTrackingGeometry));
+      ttVect.push_back(TransientTrack(ref, time, timeReso, theField, theTrackingGeometry));
     }
   }
   return ttVect;
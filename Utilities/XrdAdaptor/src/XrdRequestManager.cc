@@ -984,7 +984,7 @@ consumeChunkBack(size_t front, std::vector<IOPosBuffer> &input, std::vector<IOPo
     }
 }
 
-static IOSize validateList(const std::vector<IOPosBuffer> req)
+static IOSize validateList(const std::vector<IOPosBuffer> &req)
 {
     IOSize total = 0;
     off_t last_offset = -1;
@@ -107,7 +107,7 @@ class MultiTrackValidator : public DQMGlobalEDAnalyzer<MultiTrackValidatorHistog
               DynArray<float>& dR_tPCeff) const;
   void trackDR(const edm::View<reco::Track>& trackCollection,
                const edm::View<reco::Track>& trackCollectionDr,
-               DynArray<float>& dR_trk) const;
+               std::vector<float>& dR_trk) const;
 
   std::vector<edm::EDGetTokenT<reco::TrackToTrackingParticleAssociator>> associatorTokens;
   std::vector<edm::EDGetTokenT<reco::SimToRecoCollection>> associatormapStRs;
@@ -450,7 +450,7 @@ size_t MultiTrackValidator::tpDR(const TrackingParticleRefVector& tPCeff,
   return n_selTP_dr;
 }
 
-void MultiTrackValidator::trackDR(const edm::View<reco::Track>& trackCollection, const edm::View<reco::Track>& trackCollectionDr, DynArray<float>& dR_trk) const {
+void MultiTrackValidator::trackDR(const edm::View<reco::Track>& trackCollection, const edm::View<reco::Track>& trackCollectionDr, std::vector<float>& dR_trk) const {
   int i=0;
   float etaL[trackCollectionDr.size()];
   float phiL[trackCollectionDr.size()];
@@ -645,6 +645,9 @@ void MultiTrackValidator::dqmAnalyze(const edm::Event& event, const edm::EventSe
   std::vector<const QualityMaskCollection *> qualityMaskCollections;
   std::vector<float> mvaValues;
 
+  // dR of the tracks of each collection, which does not depend on the associator
+  std::vector<std::vector<float>> dR_trk_labels(label.size());
+
   int w=0; //counter counting the number of sets of histograms
   for (unsigned int ww=0;ww<associators.size();ww++){
     // run value filtering of recoToSim map already here as it depends only on the association, not track collection
@@ -906,8 +909,11 @@ void MultiTrackValidator::dqmAnalyze(const edm::Event& event, const edm::EventSe
       if(calculateDrSingleCollection_) {
         trackCollectionDr = trackCollectionForDrCalculation.product();
       }
-      declareDynArray(float, trackCollection.size(), dR_trk);
-      trackDR(trackCollection, *trackCollectionDr, dR_trk);
+      std::vector<float>& dR_trk = dR_trk_labels[www];
+      if(dR_trk.size() != trackCollection.size()) {
+        dR_trk.resize(trackCollection.size());
+        trackDR(trackCollection, *trackCollectionDr, dR_trk);
+      }
 
       for(View<Track>::size_type i=0; i<trackCollection.size(); ++i){
         auto track = trackCollection.refAt(i);